@@ -0,0 +1,335 @@
+// Bench.cpp : Benchmark of every CNN implementation over the sample images.
+//
+// Each engine runs a warm-up, then many timed iterations cycling through the images; per-stage and
+// end-to-end median / p99 and images/s are printed as a table and optionally written as JSON so
+// runs can be compared between commits.
+// With --scaling the engines are instead run for throughput on one, two, ... all NUMA nodes: each node
+// gets a replica of the model and one worker per CPU (NumaReplica.h), all of them classifying at once.
+//
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "face_binary_cls.h"
+#include "CNNModel.h"
+#include "CNNPipeline.h"
+#include "ImageDecode.h"
+#include "LatencyStats.h"
+#include "NumaReplica.h"
+#include <opencv2/opencv.hpp>
+
+using namespace std;
+using namespace cv;
+
+typedef struct bench_arg {
+	vector<int> options;	// empty: every engine
+	string images = "samples/*.jpg";
+	bool crop = false;	// centered square instead of the whole image
+	string model;	// binary model file to map, empty: compiled-in weights
+	string batchnorm;	// stored batch normalization to fold, empty: per-image statistics
+	int warmup = 20;
+	int iterations = 200;
+	string json;	// write results here ("-": stdout)
+	bool scaling = false;	// throughput over 1..all NUMA nodes instead of single-image latency
+}bench_arg;
+
+typedef struct bench_result {
+	string engine;
+	vector<string> stage_names;
+	vector<double> stage_median;
+	vector<double> stage_p99;
+	double median;
+	double p99;
+	double mean;
+	double images_per_second;
+}bench_result;
+
+typedef struct scaling_result {
+	string engine;
+	int nodes;
+	int threads;
+	double seconds;
+	double images_per_second;
+}scaling_result;
+
+static void show_usage()
+{
+	cout << "Bench Usage:\n";
+	cout << "\t-o,--options\tComma separated make_cnnbase choices (default: all)\n";
+	cout << "\t-img,--image\tImage path or wildcard pattern (default samples/*.jpg), fitted to the input size\n";
+	cout << "\t--crop\t\tFit the centered square of each image instead of the whole image\n";
+	cout << "\t--model=<file>\tMap this binary model file instead of the compiled-in weights\n";
+	cout << "\t-bn,--batchnorm\tFold stored batch normalization from this file\n";
+	cout << "\t--warmup=<n>\tUntimed iterations per engine (default 20)\n";
+	cout << "\t--iterations=<n>\tTimed iterations per engine (default 200)\n";
+	cout << "\t--json=<file>\tWrite machine-readable results (- for stdout)\n";
+	cout << "\t--scaling\tImages/s with every CPU of 1, 2, ... all NUMA nodes classifying at once\n";
+	cout << "\t\t\t(--iterations per worker, a model replica per node)\n";
+	cout << "Example:Bench -o=1,3,4 -img=samples/*.jpg --iterations=500 --json=bench.json\n";
+}
+
+static vector<int> parse_list(const string& text) {
+	vector<int> values;
+	size_t start = 0;
+	while (start <= text.size()) {
+		size_t end = text.find(',', start);
+		if (end == string::npos)
+			end = text.size();
+		if (end > start)
+			values.push_back(stoi(text.substr(start, end - start)));
+		start = end + 1;
+	}
+	return values;
+}
+
+static bench_result bench_engine(CNNBase* cnn, const CNNModel& model, const vector<Mat>& images, const bench_arg& arg) {
+	bench_result result;
+	CNNPipeline pipeline(cnn, &model);
+	int stage_count = pipeline.StageCount();
+	vector<double> stage_ms(stage_count);
+
+	for (int i = 0; i < arg.warmup; i++)
+		pipeline.Forward(images[i % images.size()]);
+
+	vector<double> total(arg.iterations);
+	vector<vector<double>> stages(stage_count, vector<double>(arg.iterations));
+	TickMeter all;
+	all.start();
+	for (int i = 0; i < arg.iterations; i++) {
+		TickMeter tm;
+		tm.start();
+		pipeline.Forward(images[i % images.size()], stage_ms.data());
+		tm.stop();
+		total[i] = tm.getTimeMilli();
+		for (int s = 0; s < stage_count; s++)
+			stages[s][i] = stage_ms[s];
+	}
+	all.stop();
+
+	for (int s = 0; s < stage_count; s++) {
+		result.stage_names.push_back(pipeline.StageName(s));
+		latency_stats stage = latency_summary(stages[s]);
+		result.stage_median.push_back(stage.p50);
+		result.stage_p99.push_back(stage.p99);
+	}
+	latency_stats end_to_end = latency_summary(total);
+	result.mean = all.getTimeMilli() / arg.iterations;
+	result.median = end_to_end.p50;
+	result.p99 = end_to_end.p99;
+	result.images_per_second = 1000.0 / result.mean;
+	return result;
+}
+
+/// <summary>
+/// Throughput of every CPU of the replicas' nodes at once: each worker owns an engine and a pipeline built on
+/// its node, warms up, waits for the others, then classifies arg.iterations images of its own copy.
+/// </summary>
+static scaling_result bench_scaling(int choice, const vector<NumaReplica*>& replicas, const vector<Mat>& images,
+	const bench_arg& arg) {
+	int workers = 0;
+	for (NumaReplica* replica : replicas)
+		workers += replica->Concurrency();
+	atomic<int> ready(0);
+	atomic<bool> start(false);
+	vector<thread> nodes;
+	for (NumaReplica* replica : replicas) {
+		nodes.push_back(replica->Launch([&, replica] {
+			replica->RunWorkers([&, replica](int) {
+				vector<Mat> local;
+				for (const Mat& image : images)
+					local.push_back(image.clone());
+				CNNBase* cnn = CNNBase::make_cnnbase(choice);
+				CNNPipeline pipeline(cnn, replica->Model());
+				for (int i = 0; i < arg.warmup; i++)
+					pipeline.Forward(local[i % local.size()]);
+				ready++;
+				while (!start)
+					this_thread::yield();
+				for (int i = 0; i < arg.iterations; i++)
+					pipeline.Forward(local[i % local.size()]);
+				delete cnn;
+			});
+		}));
+	}
+	while (ready < workers)
+		this_thread::yield();
+	TickMeter all;
+	all.start();
+	start = true;
+	for (thread& node : nodes)
+		node.join();
+	all.stop();
+
+	scaling_result result;
+	result.nodes = (int)replicas.size();
+	result.threads = workers;
+	result.seconds = all.getTimeSec();
+	result.images_per_second = (double)workers * arg.iterations / std::max(result.seconds, 1e-9);
+	return result;
+}
+
+static void print_scaling(const scaling_result& r, const scaling_result& first) {
+	printf("\t%d node%s %4d threads  %10.1f images/s  speedup %5.2fx\n", r.nodes, r.nodes == 1 ? " " : "s", r.threads,
+		r.images_per_second, r.images_per_second / first.images_per_second);
+}
+
+static void write_scaling_json(FILE* out, const vector<scaling_result>& results, const bench_arg& arg) {
+	fprintf(out, "{\n  \"iterations\": %d,\n  \"warmup\": %d,\n  \"scaling\": [\n", arg.iterations, arg.warmup);
+	for (size_t i = 0; i < results.size(); i++) {
+		const scaling_result& r = results[i];
+		fprintf(out, "    { \"engine\": \"%s\", \"nodes\": %d, \"threads\": %d, \"seconds\": %.6f, \"images_per_second\": %.3f }%s\n",
+			r.engine.c_str(), r.nodes, r.threads, r.seconds, r.images_per_second, i + 1 < results.size() ? "," : "");
+	}
+	fprintf(out, "  ]\n}\n");
+}
+
+static void print_result(const bench_result& r) {
+	printf("%s\n", r.engine.c_str());
+	for (size_t s = 0; s < r.stage_names.size(); s++)
+		printf("\t%-24s median %9.4fms  p99 %9.4fms\n", r.stage_names[s].c_str(), r.stage_median[s], r.stage_p99[s]);
+	printf("\t%-24s median %9.4fms  p99 %9.4fms  %.1f images/s\n", "end-to-end", r.median, r.p99, r.images_per_second);
+}
+
+static void write_json(FILE* out, const vector<bench_result>& results, const bench_arg& arg, size_t image_count) {
+	fprintf(out, "{\n  \"iterations\": %d,\n  \"warmup\": %d,\n  \"images\": %d,\n  \"engines\": [\n",
+		arg.iterations, arg.warmup, (int)image_count);
+	for (size_t i = 0; i < results.size(); i++) {
+		const bench_result& r = results[i];
+		fprintf(out, "    {\n      \"engine\": \"%s\",\n      \"stages\": [\n", r.engine.c_str());
+		for (size_t s = 0; s < r.stage_names.size(); s++) {
+			fprintf(out, "        { \"name\": \"%s\", \"median_ms\": %.6f, \"p99_ms\": %.6f }%s\n",
+				r.stage_names[s].c_str(), r.stage_median[s], r.stage_p99[s], s + 1 < r.stage_names.size() ? "," : "");
+		}
+		fprintf(out, "      ],\n      \"median_ms\": %.6f,\n      \"p99_ms\": %.6f,\n      \"mean_ms\": %.6f,\n"
+			"      \"images_per_second\": %.3f\n    }%s\n",
+			r.median, r.p99, r.mean, r.images_per_second, i + 1 < results.size() ? "," : "");
+	}
+	fprintf(out, "  ]\n}\n");
+}
+
+int main(int argc, char** argv)
+{
+	bench_arg arg;
+	for (int i = 1; i < argc; ++i) {
+		string a = argv[i];
+		size_t eq = a.find('=');
+		string value = eq == string::npos ? "" : a.substr(eq + 1);
+		if (a.rfind("-h", 0) == 0 || a.rfind("--help", 0) == 0) {
+			show_usage();
+			return 0;
+		}
+		else if (a.rfind("-o=", 0) == 0 || a.rfind("--options=", 0) == 0)
+			arg.options = parse_list(value);
+		else if (a.rfind("-img=", 0) == 0 || a.rfind("--image=", 0) == 0)
+			arg.images = value;
+		else if (a == "--crop")
+			arg.crop = true;
+		else if (a.rfind("--model=", 0) == 0)
+			arg.model = value;
+		else if (a.rfind("-bn=", 0) == 0 || a.rfind("--batchnorm=", 0) == 0)
+			arg.batchnorm = value;
+		else if (a.rfind("--warmup=", 0) == 0)
+			arg.warmup = std::max(0, stoi(value));
+		else if (a.rfind("--iterations=", 0) == 0)
+			arg.iterations = std::max(1, stoi(value));
+		else if (a.rfind("--json=", 0) == 0)
+			arg.json = value;
+		else if (a == "--scaling")
+			arg.scaling = true;
+		else {
+			show_usage();
+			return 1;
+		}
+	}
+
+	// Decoded and fitted up front, as the other modes do: only inference is timed.
+	vector<Mat> images = cnn_read_images(arg.images, arg.crop);
+	if (images.empty()) {
+		cout << "No images match " << arg.images << endl;
+		return 1;
+	}
+
+	CNNModel model;
+	if (!arg.model.empty() && !model.LoadBinary(arg.model)) {
+		cout << "Invalid model file " << arg.model << endl;
+		return 1;
+	}
+	if (!arg.batchnorm.empty() && !model.LoadBatchNormalization(arg.batchnorm)) {
+		cout << "Invalid batch normalization file " << arg.batchnorm << endl;
+		return 1;
+	}
+
+	if (arg.options.empty()) {
+		for (int choice = 0;; choice++) {
+			CNNBase* cnn = CNNBase::make_cnnbase(choice);
+			if (cnn == nullptr)
+				break;
+			delete cnn;
+			arg.options.push_back(choice);
+		}
+	}
+
+	vector<numa_node> nodes;
+	vector<NumaReplica*> replicas;
+	if (arg.scaling) {
+		nodes = numa_nodes();
+		replicas = NumaReplica::Create(nodes, model);
+		printf("%d images, %d NUMA nodes, %d warm-up + %d timed iterations per worker\n", (int)images.size(),
+			(int)nodes.size(), arg.warmup, arg.iterations);
+	}
+	else {
+		printf("%d images, %d warm-up + %d timed iterations per engine\n", (int)images.size(), arg.warmup, arg.iterations);
+	}
+	vector<bench_result> results;
+	vector<scaling_result> scaling;
+	for (int choice : arg.options) {
+		CNNBase* cnn = CNNBase::make_cnnbase(choice);
+		if (cnn == nullptr) {
+			cout << "Invalid option " << choice << endl;
+			return 1;
+		}
+		streambuf* console = cout.rdbuf();
+		ostringstream name;
+		cout.rdbuf(name.rdbuf());
+		cnn->GetClassName();
+		cout.rdbuf(console);
+
+		if (arg.scaling) {
+			delete cnn;
+			printf("%d:%s\n", choice, name.str().c_str());
+			size_t first = scaling.size();
+			for (size_t count = 1; count <= replicas.size(); count++) {
+				vector<NumaReplica*> used(replicas.begin(), replicas.begin() + count);
+				scaling.push_back(bench_scaling(choice, used, images, arg));
+				scaling.back().engine = to_string(choice) + ":" + name.str();
+				print_scaling(scaling.back(), scaling[first]);
+			}
+			continue;
+		}
+		bench_result result = bench_engine(cnn, model, images, arg);
+		result.engine = to_string(choice) + ":" + name.str();
+		print_result(result);
+		results.push_back(result);
+		delete cnn;
+	}
+
+	if (!arg.json.empty()) {
+		FILE* out = arg.json == "-" ? stdout : fopen(arg.json.c_str(), "w");
+		if (out == nullptr) {
+			cout << "Cannot write " << arg.json << endl;
+			return 1;
+		}
+		if (arg.scaling)
+			write_scaling_json(out, scaling, arg);
+		else
+			write_json(out, results, arg, images.size());
+		if (out != stdout)
+			fclose(out);
+	}
+	for (NumaReplica* replica : replicas)
+		delete replica;
+	return 0;
+}
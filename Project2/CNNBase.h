@@ -2,7 +2,9 @@
 
 #include <iostream>
 #include <vector>
+#include "CNNExport.h"
 #include "face_binary_cls.h"
+#include "Tensor.h"
 #include <opencv2/opencv.hpp>
 
 using namespace std;
@@ -10,34 +12,120 @@ using namespace cv;
 
 class CNNBase {
 private:
+	// Scratch buffer of the unfused ConvolutionalBlock.
+	Tensor blockScratch;
 
 public:
 	static const int CONVOLUTION_FILTER = 3; // 3x3
+	static const int REFERENCE = 0; // make_cnnbase choice of CNNBruteforce, the numerical reference
+	static const int GENERAL = 3; // make_cnnbase choice of CNNGemm, fastest engine for any convolution shape
 
-	// Factory Method
-	static CNNBase* make_cnnbase(int choice);
+	// Factory Method (CNNFactory.cpp)
+	CNN_API static CNNBase* make_cnnbase(int choice);
+
+	virtual ~CNNBase() {}
 
 	// Virtual Methods
-	virtual vector<vector<vector<float>>> MatToVector3d(Mat image) = 0;
-	virtual vector<vector<vector<float>>> ConvolutionalLayer(vector<vector<vector<float>>> input, conv_param *cp) = 0;
-	virtual vector<vector<vector<float>>> BatchNormalizationLayer(vector<vector<vector<float>>> input) = 0;
-	virtual vector<vector<vector<float>>> ActivationReluLayer(vector<vector<vector<float>>> input) = 0;
-	virtual vector<vector<vector<float>>> MaxPoolingLayer(vector<vector<vector<float>>> input, int psize) = 0;
-	virtual vector<float> FlattenLayer(vector<vector<vector<float>>> input) = 0;
-	virtual vector<float> FullyConnectedLayer(vector<float> input, fc_param* fcp) = 0;
-	virtual vector<float> SoftMaxLayer(vector<float> input) = 0;
+	// Layers write into caller-provided tensors (Tensor::create reuses their memory) and
+	// BatchNormalization / Relu / SoftMax work in place, so a pipeline that keeps its buffers
+	// performs no heap allocation once it is warm. Input and output must not be the same tensor.
+	// Tensors are NCHW batches: every layer processes all n images, BatchNormalization and SoftMax
+	// per image, and FullyConnected maps (n, 1, 1, in_features) to (n, 1, 1, out_features).
+	virtual void MatToTensor(const Mat& image, Tensor& output) = 0;
+	virtual void ConvolutionalLayer(const Tensor& input, conv_param *cp, Tensor& output) = 0;
+	virtual void BatchNormalizationLayer(Tensor& input) = 0;
+	virtual void ActivationReluLayer(Tensor& input) = 0;
+	virtual void MaxPoolingLayer(const Tensor& input, int psize, Tensor& output) = 0;
+	virtual void FullyConnectedLayer(const Tensor& input, fc_param* fcp, Tensor& output) = 0;
+	virtual void SoftMaxLayer(Tensor& input) = 0;
 	virtual void GetClassName() = 0;
 
+	/// <summary>
+	/// Batch of equally sized images -> (n, 3, rows, cols). The default converts each image with MatToTensor
+	/// straight into its slice of output.
+	/// </summary>
+	virtual void MatsToTensor(const vector<Mat>& images, Tensor& output) {
+		int batch = (int)images.size();
+		if (batch == 0)
+			return;
+		int rows = images[0].rows;
+		int cols = images[0].cols;
+		output.create(batch, 3, rows, cols);
+		size_t image = (size_t)3 * rows * cols;
+		for (int n = 0; n < batch; n++) {
+			Tensor slice = Tensor::wrap(output.ptr(n, 0, 0), image, 1, 3, rows, cols);
+			MatToTensor(images[n], slice);
+		}
+	}
+
+	/// <summary>
+	/// Whether ConvolutionalLayer / ConvolutionalBlock handle this shape. Most engines are written for the
+	/// 3x3 kernels with padding 0 or 1 of face_binary_cls; CNNPipeline runs other layers on a GENERAL engine.
+	/// </summary>
+	virtual bool SupportsConvolution(const conv_param* cp) const {
+		return cp->kernel_size == CONVOLUTION_FILTER && cp->pad <= 1;
+	}
+
+	/// <summary>
+	/// Called once per layer when a model is loaded (and again whenever the parameters cp points to change),
+	/// so engines can precompute per-layer data such as transformed weights.
+	/// </summary>
+	virtual void PrepareLayer(const conv_param* cp) {}
+
+	/// <summary>
+	/// Whether the engine computes in reduced precision (e.g. INT8) and only approximates CNNBruteforce.
+	/// Parity then compares the class probabilities instead of every layer.
+	/// </summary>
+	virtual bool Quantized() const {
+		return false;
+	}
+
+	/// <summary>
+	/// Whether every value MatToTensor and the convolution blocks produce depends only on its receptive field.
+	/// False for engines that use statistics of the whole tensor (input standardization, a per-tensor
+	/// quantization range): a region cut out of a frame then is not computed like the frame itself, so
+	/// CNNIncremental recomputes whole frames.
+	/// </summary>
+	virtual bool LocalFeatures() const {
+		return true;
+	}
+
+	/// <summary>
+	/// Convolution block: Conv -> BatchNormalization -> Relu -> MaxPooling (psize x psize, skipped when psize is 1).
+	/// normalize is false when the batch normalization is already folded into cp (see CNNModel).
+	/// The default runs the layers one after another; engines override it with a fused single pass.
+	/// </summary>
+	virtual void ConvolutionalBlock(const Tensor& input, conv_param* cp, int psize, bool normalize, Tensor& output) {
+		if (psize <= 1) {
+			ConvolutionalLayer(input, cp, output);
+			if (normalize)
+				BatchNormalizationLayer(output);
+			ActivationReluLayer(output);
+			return;
+		}
+		ConvolutionalLayer(input, cp, blockScratch);
+		if (normalize)
+			BatchNormalizationLayer(blockScratch);
+		ActivationReluLayer(blockScratch);
+		MaxPoolingLayer(blockScratch, psize, output);
+	}
+
+	/// <summary>
+	/// Flatten is a zero-copy view of the contiguous CHW activation.
+	/// </summary>
+	virtual Tensor FlattenLayer(const Tensor& input) {
+		return input.flatten();
+	}
 
-	void PrintMatrix(vector<vector<vector<float>>> input) {
-		for (int i = 0; i < input.size(); i++) {
+	void PrintMatrix(const Tensor& input) {
+		for (int i = 0; i < input.channels(); i++) {
 			cout << "channel:" << i << endl;
-			for (int j = 0; j < input[i].size(); j++) {
-				for (int x = 0; x < input[i][j].size(); x++) {
-					cout << input[i][j][x] << ",";
+			for (int j = 0; j < input.rows(); j++) {
+				for (int x = 0; x < input.cols(); x++) {
+					cout << input.at(i, j, x) << ",";
 				}
 				cout << endl;
 			}
 		}
 	}
-};
\ No newline at end of file
+};
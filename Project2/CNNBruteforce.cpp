@@ -1,79 +1,74 @@
 #pragma once
 #include "CNNBase.h"
 #include <vector>
+#include "ImageConvert.h"
 #include "face_binary_cls.h"
 using namespace std;
 
 class CNNBruteforce : public CNNBase {
 
+private:
+	// Scratch buffer reused across calls.
+	Tensor paddedInput;
+
 public:
 	void GetClassName() {
 		cout << "CNNBruteforce";
 	}
 
 	/// <summary>
-	/// Image Normalization[Range 0.0 to 1.0] - iteration through all pixel /255
+	/// Image Normalization[Range 0.0 to 1.0] - every pixel * (1/255), BGR bytes straight into the RGB planes
 	/// </summary>
 	/// <param name="image"></param>
 	/// <returns></returns>
-	vector<vector<vector<float>>> MatToVector3d(Mat image) {
-
-		vector<vector<vector<float>>> imagePixels(3, vector<vector<float>>(image.rows, vector<float>(image.cols)));
-		// Image Normalization
-		// 0.0 to 0.1 (range)
-		image.convertTo(image, CV_32F, 1.f / 255, 0);
-		for (int x = 0; x < image.rows; x++) {
-			for (int y = 0; y < image.cols; y++) {
-				Vec3f intensity = image.at<Vec3f>(x, y);
-				// red = 2; green = 1; blue = 0	
-				float blue = intensity.val[0];
-				float green = intensity.val[1];
-				float red = intensity.val[2];
-
-				imagePixels[0][x][y] = (float)red; // R
-				imagePixels[1][x][y] = (float)green; // G
-				imagePixels[2][x][y] = (float)blue; // B
-			}
-		}
-		return imagePixels;
+	void MatToTensor(const Mat& input, Tensor& imagePixels) {
+		imagePixels.create(3, input.rows, input.cols);
+		image_to_planar(input, imagePixels.data(), image_unit_range());
 	}
 
-	vector<vector<vector<float>>> ConvolutionalLayer(vector<vector<vector<float>>> input, conv_param* cp) {
+	void ConvolutionalLayer(const Tensor& input, conv_param* cp, Tensor& output) {
 		
 		// Initialize Input
-		vector<vector<vector<float>>> paddedInput = input;
+		const Tensor* source = &input;
 		
 		// Calculate output dimension
 		int padding = cp->pad;
+		int kernel = cp->kernel_size;
 		int padsize = 0;
 		int stride = cp->stride;
-		int ch_size = input.size(); // channel/kernel size 
-		int r_size = input[0].size(); // row
-		int c_size = input[0][0].size(); // column
+		int batch = input.batch(); // images
+		int ch_size = input.channels(); // channel/kernel size 
+		int r_size = input.rows(); // row
+		int c_size = input.cols(); // column
 	
 		// Padding Required?
 		if (padding) {
-			padsize = 2;
-			// Add padding to input.
-			paddedInput.clear();
-			paddedInput.resize(ch_size, vector<vector<float>>(r_size + padsize, vector<float>(c_size + padsize)));
+			padsize = 2 * padding;
+			// Add padding to input (every channel).
+			paddedInput.create(batch, ch_size, r_size + padsize, c_size + padsize);
+			paddedInput.setTo(0);
 
-			for (int r = 0; r < r_size; r++)
+			for (int n = 0; n < batch; n++)
 			{
-				for (int c = 0; c < c_size; c++)
+				for (int ch = 0; ch < ch_size; ch++)
 				{
-					paddedInput[0][r + 1][c + 1] = input[0][r][c];
-					paddedInput[1][r + 1][c + 1] = input[1][r][c];
-					paddedInput[2][r + 1][c + 1] = input[2][r][c];
+					for (int r = 0; r < r_size; r++)
+					{
+						for (int c = 0; c < c_size; c++)
+						{
+							paddedInput.at(n, ch, r + padding, c + padding) = input.at(n, ch, r, c);
+						}
+					}
 				}
 			}
+			source = &paddedInput;
 		}
 
-		// Image is always a square
-		// Initialize the output dimension.
-		int row_size = paddedInput[0].size() - 2;
-		int col_size = paddedInput[0][0].size() - 2;
-		int dimension = (r_size - CONVOLUTION_FILTER + padsize) / stride + 1;		
+		// Initialize the output dimensions (rows and cols differ for non-square inputs such as detection frames).
+		int row_size = source->rows() - (kernel - 1);
+		int col_size = source->cols() - (kernel - 1);
+		int out_rows = (r_size - kernel + padsize) / stride + 1;
+		int out_cols = (c_size - kernel + padsize) / stride + 1;
 
 		// filters
 		int out_channels = cp->out_channels;
@@ -82,8 +77,9 @@ public:
 		// output 
 		// kernel size = out_channels;
 		// row and col = new calculated dimension based on padding and stride.
-		vector<vector<vector<float>>> output(out_channels, vector<vector<float>>(dimension, vector<float>(dimension)));
+		output.create(batch, out_channels, out_rows, out_cols);
 
+		for (int n = 0; n < batch; n++)
 		for (int f = 0; f < out_channels; f++)
 		{
 			int row = 0;
@@ -93,31 +89,35 @@ public:
 				for (int c = 0; c < col_size; c += stride)
 				{
 					float sum = 0;
-					float test = 0;
 					for (int ch = 0; ch < in_channels; ch++)
 					{
 						int ch_index = 0;
-						for (int ch_row = 0; ch_row < 3; ch_row++) {
-							for (int ch_col = 0; ch_col < 3; ch_col++) {
-								sum += (paddedInput[ch][r + ch_row][c + ch_col] * cp->p_weight[f * (in_channels * 3 * 3) + ch * (3 * 3) + ch_index++]);
+						for (int ch_row = 0; ch_row < kernel; ch_row++) {
+							for (int ch_col = 0; ch_col < kernel; ch_col++) {
+								sum += (source->at(n, ch, r + ch_row, c + ch_col) * cp->p_weight[f * (in_channels * kernel * kernel) + ch * (kernel * kernel) + ch_index++]);
 							}
 						}
 					}
-					output[f][row][col] = sum + cp->p_bias[f]; // include bias
+					output.at(n, f, row, col) = sum + cp->p_bias[f]; // include bias
 					col++;
 				}
 				row++;
 			}
 		}
+	}
 
-		return output;
+	// Reference implementation: any kernel size and padding.
+	bool SupportsConvolution(const conv_param* cp) const {
+		return true;
 	}
 
-	vector<vector<vector<float>>> BatchNormalizationLayer(vector<vector<vector<float>>> input) {
-		int channels = input.size();
-		int row = input[0].size();
-		int col = input[0][0].size();
+	void BatchNormalizationLayer(Tensor& input) {
+		int batch = input.batch();
+		int channels = input.channels();
+		int row = input.rows();
+		int col = input.cols();
 
+		for (int n = 0; n < batch; n++)
 		for (int ch = 0; ch < channels; ch++) {
 			float sumMean = 0;
 			float mean = 0;
@@ -127,8 +127,8 @@ public:
 			{
 				for (int c = 0; c < col; c++)
 				{
-					sumMean += input[ch][r][c];
-					sumVariance += input[ch][r][c] * input[ch][r][c];
+					sumMean += input.at(n, ch, r, c);
+					sumVariance += input.at(n, ch, r, c) * input.at(n, ch, r, c);
 				}
 			}
 
@@ -144,114 +144,99 @@ public:
 					// x* new value of a single component
 					// E[x] - mean within the batch
 					// var(x) - variance within a batch (sqrt(var(x) - Standard Diviation))
-					input[ch][r][c] = (input[ch][r][c] - mean) / sqrt(variance);
+					input.at(n, ch, r, c) = (input.at(n, ch, r, c) - mean) / sqrt(variance);
 				}
 			}
 		}
-		return input;
 	}
 
-	vector<vector<vector<float>>> ActivationReluLayer(vector<vector<vector<float>>> input) {
-		int channels = input.size();
-		int row = input[0].size();
-		int col = input[0][0].size();
+	void ActivationReluLayer(Tensor& input) {
+		int batch = input.batch();
+		int channels = input.channels();
+		int row = input.rows();
+		int col = input.cols();
+		for (int n = 0; n < batch; n++)
 		for (int ch = 0; ch < channels; ch++)
 		{
 			for (int r = 0; r < row; r++)
 			{
 				for (int c = 0; c < col; c++)
 				{
-					input[ch][r][c] = std::max((float)0, input[ch][r][c]);
+					input.at(n, ch, r, c) = std::max((float)0, input.at(n, ch, r, c));
 				}
 			}
 		}
-		return input;
 	}
 
-	vector<vector<vector<float>>> MaxPoolingLayer(vector<vector<vector<float>>> input, int psize) {
-		int channels = input.size();
-		int row_size = input[0].size();
-		int col_size = input[0][0].size();
-		int bsize = psize * psize;
+	void MaxPoolingLayer(const Tensor& input, int psize, Tensor& output) {
+		int batch = input.batch();
+		int channels = input.channels();
+		int row_size = input.rows();
+		int col_size = input.cols();
 
-		// Get new dimension
-		int dimension = row_size / psize;
+		// Get new dimensions, a ragged last row / column is dropped
+		int out_rows = row_size / psize;
+		int out_cols = col_size / psize;
 		// channel size remains unchanged.
-		vector<vector<vector<float>>> output(channels, vector<vector<float>>(dimension, vector<float>(dimension)));
+		output.create(batch, channels, out_rows, out_cols);
 
+		for (int n = 0; n < batch; n++)
 		for (int ch = 0; ch < channels; ch++)
 		{
 			int row = 0;
-			for (int r = 0; r < row_size; r += psize)
+			for (int r = 0; r + psize <= row_size; r += psize)
 			{
 				int col = 0;
-				for (int c = 0; c < col_size; c += psize)
+				for (int c = 0; c + psize <= col_size; c += psize)
 				{
-					vector<float> blocks;
+					float block = input.at(n, ch, r, c);
 					for (int rb = 0; rb < psize; rb++) {
 						for (int cb = 0; cb < psize; cb++) {
-							blocks.push_back(input[ch][r+rb][c+cb]);
+							block = std::max(block, input.at(n, ch, r + rb, c + cb));
 						}
 					}
-					output[ch][row][col] = *max_element(blocks.begin(), blocks.end());
+					output.at(n, ch, row, col) = block;
 					col++;
 				}
 				row++;
 			}
 		}
-		return output;
-	}
-
-	vector<float> FlattenLayer(vector<vector<vector<float>>> input) {
-		int channels = input.size();
-		int row = input[0].size();
-		int col = input[0][0].size();
-		int dimension = channels * row * col;
-		vector<float> output(dimension);
-		int idx = 0;
-		for (int ch = 0; ch < channels; ch++)
-		{
-			for (int r = 0; r < row; r++)
-			{
-				for (int c = 0; c < col; c++)
-				{
-					output[idx++] = input[ch][r][c];
-				}
-			}
-		}
-		return output;
 	}
 
-	vector<float> FullyConnectedLayer(vector<float> input, fc_param* fcp) {
+	void FullyConnectedLayer(const Tensor& input, fc_param* fcp, Tensor& fc_output) {
 		int in_features = fcp->in_features; // 2048
 		int out_features = fcp->out_features; // 2
 
-		vector<float> fc_output(out_features);
+		int batch = input.batch();
+
+		fc_output.create(batch, 1, 1, out_features);
+		for (int n = 0; n < batch; n++)
 		for (int o = 0; o < out_features; o++)
 		{
 			float sum = 0;
+			const float* features = input.ptr(n, 0, 0);
 			for (int i = 0; i < in_features; i++) {
 				//sum += input[i] * fcp->p_weight[o * out_features + i];
-				sum += input[i] * fcp->p_weight[(o * in_features) + i];
+				sum += features[i] * fcp->p_weight[(o * in_features) + i];
 				//cout << "sum:" << sum << "|input:" << i << "|" << input[i] << ",p_weight:" << o * out_features + i << "|" << fcp->p_weight[o * out_features + i] << endl;
 			}
-			fc_output[o] = sum + fcp->p_bias[o];
+			fc_output.at(n, 0, 0, o) = sum + fcp->p_bias[o];
 		}
-
-		return fc_output;
 	}
 
-	vector<float> SoftMaxLayer(vector<float> input) {
-		int size = input.size();
-		float sum = 0;
-		vector<float> exponent(size);
-		for (int i = 0; i < size; i++) {
-			exponent[i] = exp(input[i]);
-			sum += exponent[i];
-		}
-		for (int i = 0; i < size; i++) {
-			input[i] = exponent[i] / sum;
+	void SoftMaxLayer(Tensor& input) {
+		// One distribution per image.
+		int size = input.total() / input.batch();
+		for (int n = 0; n < input.batch(); n++) {
+			float* scores = input.ptr(n, 0, 0);
+			float sum = 0;
+			for (int i = 0; i < size; i++) {
+				scores[i] = exp(scores[i]);
+				sum += scores[i];
+			}
+			for (int i = 0; i < size; i++) {
+				scores[i] = scores[i] / sum;
+			}
 		}
-		return input;
 	}
-};
\ No newline at end of file
+};
@@ -0,0 +1,101 @@
+// CNNClassifier.cpp : C API of the cnn library (cnn_classifier.h) on CNNBase, CNNModel and CNNPipeline.
+//
+#include "cnn_classifier.h"
+#include "CNNBase.h"
+#include "CNNModel.h"
+#include "CNNPipeline.h"
+#include "ImageDecode.h"
+
+struct cnn_classifier {
+	CNNBase* engine = nullptr;
+	CNNModel model;
+	CNNPipeline* pipeline = nullptr;	// built after the model is loaded
+	ImageDecoder decoder;
+	Mat resized;
+
+	~cnn_classifier() {
+		delete pipeline;
+		delete engine;
+	}
+};
+
+/// <summary>
+/// Classify one BGR image; exceptions (allocation, OpenCV) must not cross the C boundary.
+/// </summary>
+static int cnn_classify_mat(cnn_classifier* classifier, const Mat& image, float scores[2]) {
+	try {
+		const Tensor& result = classifier->pipeline->Forward(CNNPipeline::FitInput(image, classifier->resized));
+		scores[0] = result[0];
+		scores[1] = result[1];
+		return CNN_OK;
+	}
+	catch (...) {
+		return CNN_ERROR_INTERNAL;
+	}
+}
+
+int cnn_engine_count(void) {
+	int count = 0;
+	for (CNNBase* cnn; (cnn = CNNBase::make_cnnbase(count)) != nullptr; count++)
+		delete cnn;
+	return count;
+}
+
+cnn_classifier* cnn_classifier_create(int engine, const char* batchnorm, int* status) {
+	return cnn_classifier_create_model(engine, nullptr, batchnorm, status);
+}
+
+cnn_classifier* cnn_classifier_create_model(int engine, const char* model, const char* batchnorm, int* status) {
+	int result = CNN_OK;
+	cnn_classifier* classifier = nullptr;
+	try {
+		classifier = new cnn_classifier;
+		classifier->engine = CNNBase::make_cnnbase(engine);
+		if (classifier->engine == nullptr)
+			result = CNN_ERROR_ARGUMENT;
+		else if (model != nullptr && !classifier->model.LoadBinary(model))
+			result = CNN_ERROR_MODEL;
+		else if (batchnorm != nullptr && !classifier->model.LoadBatchNormalization(batchnorm))
+			result = CNN_ERROR_MODEL;
+		else
+			classifier->pipeline = new CNNPipeline(classifier->engine, &classifier->model);
+	}
+	catch (...) {
+		result = CNN_ERROR_INTERNAL;
+	}
+	if (result != CNN_OK) {
+		delete classifier;
+		classifier = nullptr;
+	}
+	if (status != nullptr)
+		*status = result;
+	return classifier;
+}
+
+void cnn_classifier_destroy(cnn_classifier* classifier) {
+	delete classifier;
+}
+
+int cnn_classify_bgr(cnn_classifier* classifier, const unsigned char* pixels, int rows, int cols,
+	size_t step, float scores[2]) {
+	if (classifier == nullptr || pixels == nullptr || scores == nullptr || rows <= 0 || cols <= 0 ||
+		step < (size_t)cols * 3)
+		return CNN_ERROR_ARGUMENT;
+	Mat image(rows, cols, CV_8UC3, (void*)pixels, step);
+	return cnn_classify_mat(classifier, image, scores);
+}
+
+int cnn_classify_file(cnn_classifier* classifier, const char* path, float scores[2]) {
+	if (classifier == nullptr || path == nullptr || scores == nullptr)
+		return CNN_ERROR_ARGUMENT;
+	Mat image;
+	try {
+		image = classifier->decoder.Read(path);
+	}
+	catch (...) {
+		return CNN_ERROR_DECODE;
+	}
+	if (image.empty())
+		return CNN_ERROR_DECODE;
+	return cnn_classify_mat(classifier, image, scores);
+}
@@ -0,0 +1,271 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include "CNNBase.h"
+#include "CNNIncremental.cpp"
+#include "CNNModel.h"
+#include "Tensor.h"
+#include "face_binary_cls.h"
+#include <opencv2/opencv.hpp>
+using namespace std;
+using namespace cv;
+
+/// <summary>
+/// One detected face: box in frame pixels and its face probability.
+/// </summary>
+typedef struct cnn_detection {
+	Rect box;
+	float score;
+}cnn_detection;
+
+/// <summary>
+/// Sliding-window face detection over frames of any size.
+/// Classifying every INPUT_SIZE window on its own would recompute the convolutions the overlapping windows
+/// share many times over. Instead the convolution blocks run once over each level of an image pyramid of
+/// the whole frame, and the fully connected layer runs as a convolution over the resulting feature map:
+/// its [out_features x channels*k*k] weights already are the OIHW kernel of a k x k convolution, k being
+/// the size of one window's last feature map. That yields the bg / face scores of every window, Stride()
+/// pixels apart, in one pass per level.
+/// The pyramid starts where min_face pixel faces fill a window and shrinks by scale_step until the frame is
+/// smaller than a window; boxes above threshold are merged by greedy non-maximum suppression.
+/// Scores approximate per-window classification: windows see their real neighbourhood where the classifier
+/// sees zero padding, and without stored batch normalization (-bn) the blocks normalize with the statistics
+/// of the whole level instead of the window.
+/// Every level keeps its features in a CNNIncremental, so with SetChangeThreshold consecutive frames of a video
+/// only recompute the regions that changed.
+/// The detector owns neither the engine nor the model; its buffers are reused from frame to frame.
+/// </summary>
+class CNNDetector {
+public:
+	static const int WINDOW = CNNModel::INPUT_SIZE;	// window rows/cols at the scale of its level
+
+	CNNDetector(CNNBase* engine, const CNNModel* model, float threshold = 0.5f, int min_face = WINDOW,
+		float scale_step = 1.25f, float overlap = 0.3f) :
+		cnn(engine), model(model), threshold(threshold), minFace(std::max(16, min_face)),
+		scaleStep(std::max(1.05f, scale_step)), overlap(overlap) {
+		// Geometry of one window through the blocks: its last feature map is size x size.
+		int size = WINDOW;
+		for (int i = 0; i < model->ConvLayers(); i++) {
+			const conv_param* cp = &model->conv[i];
+			size = ((size + 2 * cp->pad - cp->kernel_size) / cp->stride + 1) / model->pool[i];
+			stride *= cp->stride * model->pool[i];
+		}
+		int channels = model->conv.back().out_channels;
+		valid = size > 0 && model->fc.in_features == channels * size * size && model->fc.out_features >= 2;
+		classifier = { 0, 1, size, channels, model->fc.out_features, model->fc.p_weight, model->fc.p_bias };
+		classifierEngine = cnn;
+		if (!cnn->SupportsConvolution(&classifier)) {
+			general = CNNBase::make_cnnbase(CNNBase::GENERAL);
+			classifierEngine = general;
+		}
+		classifierEngine->PrepareLayer(&classifier);
+	}
+
+	~CNNDetector() {
+		for (CNNIncremental* level : features)
+			delete level;
+		delete general;
+	}
+
+	// classifier is registered with the engines by address.
+	CNNDetector(const CNNDetector&) = delete;
+	CNNDetector& operator=(const CNNDetector&) = delete;
+
+	/// <summary>
+	/// False when the model's fully connected layer does not cover exactly one window's feature map.
+	/// </summary>
+	bool Valid() const {
+		return valid;
+	}
+
+	/// <summary>
+	/// Pixels between neighbouring windows of a level (product of every stride and pooling size).
+	/// </summary>
+	int Stride() const {
+		return stride;
+	}
+
+	int Levels() const {
+		return levels;
+	}
+
+	/// <summary>
+	/// Windows scored by the last Detect, over every level.
+	/// </summary>
+	int Windows() const {
+		return windows;
+	}
+
+	/// <summary>
+	/// Fraction of the pyramid area whose features the last Detect recomputed (1 without a change threshold).
+	/// </summary>
+	double Recomputed() const {
+		return recomputed;
+	}
+
+	/// <summary>
+	/// Reuse the features of unchanged regions between consecutive frames of the same size: threshold is the
+	/// largest pixel change ignored (see CNNIncremental), &lt; 0 (the default) computes every frame in full.
+	/// </summary>
+	void SetChangeThreshold(int threshold) {
+		changeThreshold = threshold;
+	}
+
+	/// <summary>
+	/// The pyramid levels of a frame, largest first; a level of the frame's own size is left empty and Detect
+	/// uses the frame itself. Runs on a const detector, so it can be built on another thread.
+	/// </summary>
+	void Pyramid(const Mat& frame, vector<Mat>& pyramid) const {
+		int count = 0;
+		for (double scale = (double)WINDOW / minFace; std::min(frame.rows, frame.cols) * scale >= WINDOW; scale /= scaleStep) {
+			int rows = std::max(WINDOW, (int)lround(frame.rows * scale));
+			int cols = std::max(WINDOW, (int)lround(frame.cols * scale));
+			if (count == (int)pyramid.size())
+				pyramid.push_back(Mat());
+			Mat& level = pyramid[count++];
+			if (rows == frame.rows && cols == frame.cols)
+				level.release();
+			else
+				resize(frame, level, Size(cols, rows), 0, 0, scale < 1 ? INTER_AREA : INTER_LINEAR);
+		}
+		pyramid.resize(count);
+	}
+
+	/// <summary>
+	/// Faces in a BGR 8-bit frame, strongest first. Valid until the next call.
+	/// </summary>
+	const vector<cnn_detection>& Detect(const Mat& frame) {
+		Pyramid(frame, pyramid);
+		return Detect(frame, pyramid);
+	}
+
+	/// <summary>
+	/// Faces in a frame whose pyramid was already built with Pyramid.
+	/// </summary>
+	const vector<cnn_detection>& Detect(const Mat& frame, const vector<Mat>& images) {
+		detections.clear();
+		levels = 0;
+		windows = 0;
+		recomputed = 0;
+		if (!valid || frame.empty())
+			return detections;
+
+		double area = 0;
+		for (size_t l = 0; l < images.size(); l++) {
+			const Mat& level = images[l].empty() ? frame : images[l];
+			if (l == features.size()) {
+				features.push_back(new CNNIncremental(cnn, model));
+				scores.push_back(Tensor());
+			}
+
+			// Features of the whole level once, then every window's scores in one convolution.
+			const Tensor& map = features[l]->Update(level, changeThreshold);
+			Classify(map, features[l]->Changed(), scores[l]);
+			Collect(scores[l], frame, (double)level.cols / frame.cols, (double)level.rows / frame.rows);
+			double levelArea = (double)level.rows * level.cols;
+			recomputed += features[l]->Recomputed() * levelArea;
+			area += levelArea;
+			levels++;
+		}
+		recomputed = area > 0 ? recomputed / area : 0;
+		Suppress();
+		return detections;
+	}
+
+private:
+	CNNBase* cnn;
+	CNNBase* general = nullptr;	// runs the classifier convolution when cnn does not support it
+	const CNNModel* model;
+	float threshold;
+	int minFace;
+	float scaleStep;
+	float overlap;
+	bool valid = false;
+	int stride = 1;
+	conv_param classifier;	// the fully connected layer as a convolution
+	CNNBase* classifierEngine;
+	int changeThreshold = -1;
+	vector<CNNIncremental*> features;	// per pyramid level
+	vector<Mat> pyramid;
+	vector<Tensor> scores;	// per level, (1, out_features, window rows, window cols)
+	Tensor region;
+	Tensor block;
+	vector<cnn_detection> detections;
+	int levels = 0;
+	int windows = 0;
+	double recomputed = 0;
+
+	/// <summary>
+	/// Scores of the windows that overlap the changed part of the feature map; the others keep theirs.
+	/// </summary>
+	void Classify(const Tensor& map, const Rect& changed, Tensor& levelScores) {
+		if (changed.width == map.cols() && changed.height == map.rows()) {
+			classifierEngine->ConvolutionalLayer(map, &classifier, levelScores);
+			return;
+		}
+		int k = classifier.kernel_size;
+		int top = std::max(0, changed.y - k + 1);
+		int left = std::max(0, changed.x - k + 1);
+		int bottom = std::min(levelScores.rows(), changed.y + changed.height);
+		int right = std::min(levelScores.cols(), changed.x + changed.width);
+		if (top >= bottom || left >= right)
+			return;
+		CNNIncremental::Region(map, top, left, bottom - top + k - 1, right - left + k - 1, region);
+		classifierEngine->ConvolutionalLayer(region, &classifier, block);
+		CNNIncremental::Paste(block, top, left, levelScores);
+	}
+
+	/// <summary>
+	/// Softmax of every window's scores, boxes of the faces above threshold mapped back to frame pixels.
+	/// </summary>
+	void Collect(const Tensor& scores, const Mat& frame, double scale_x, double scale_y) {
+		int classes = scores.channels();
+		int width = (int)lround(WINDOW / scale_x);
+		int height = (int)lround(WINDOW / scale_y);
+		for (int y = 0; y < scores.rows(); y++)
+		for (int x = 0; x < scores.cols(); x++) {
+			float top = scores.at(0, y, x);
+			for (int c = 1; c < classes; c++)
+				top = std::max(top, scores.at(c, y, x));
+			float sum = 0;
+			for (int c = 0; c < classes; c++)
+				sum += exp(scores.at(c, y, x) - top);
+			float face = exp(scores.at(1, y, x) - top) / sum;
+			windows++;
+			if (face < threshold)
+				continue;
+			int left = std::min((int)lround(x * stride / scale_x), frame.cols - 1);
+			int top_row = std::min((int)lround(y * stride / scale_y), frame.rows - 1);
+			Rect box(left, top_row, std::min(width, frame.cols - left), std::min(height, frame.rows - top_row));
+			detections.push_back({ box, face });
+		}
+	}
+
+	/// <summary>
+	/// Greedy non-maximum suppression: keep the strongest box, drop the boxes whose intersection over union
+	/// with a kept box exceeds overlap, repeat.
+	/// </summary>
+	void Suppress() {
+		sort(detections.begin(), detections.end(),
+			[](const cnn_detection& a, const cnn_detection& b) { return a.score > b.score; });
+		size_t kept = 0;
+		for (size_t i = 0; i < detections.size(); i++) {
+			bool suppressed = false;
+			for (size_t k = 0; k < kept && !suppressed; k++)
+				suppressed = IntersectionOverUnion(detections[k].box, detections[i].box) > overlap;
+			if (!suppressed)
+				detections[kept++] = detections[i];
+		}
+		detections.resize(kept);
+	}
+
+	static float IntersectionOverUnion(const Rect& a, const Rect& b) {
+		int width = std::min(a.x + a.width, b.x + b.width) - std::max(a.x, b.x);
+		int height = std::min(a.y + a.height, b.y + b.height) - std::max(a.y, b.y);
+		if (width <= 0 || height <= 0)
+			return 0;
+		float intersection = (float)width * height;
+		return intersection / ((float)a.width * a.height + (float)b.width * b.height - intersection);
+	}
+};
@@ -0,0 +1,16 @@
+#pragma once
+
+// CNN_API marks the symbols of the cnn library (face_binary_cls.cpp, CNNFactory.cpp, CNNClassifier.cpp).
+// Define CNN_SHARED when building or using it as a shared library, and CNN_BUILDING while building it.
+// Static builds and the single executable projects need neither.
+#if defined(CNN_SHARED) && defined(_WIN32)
+#ifdef CNN_BUILDING
+#define CNN_API __declspec(dllexport)
+#else
+#define CNN_API __declspec(dllimport)
+#endif
+#elif defined(CNN_SHARED)
+#define CNN_API __attribute__((visibility("default")))
+#else
+#define CNN_API
+#endif
@@ -0,0 +1,65 @@
+// CNNFactory.cpp : The engines of the cnn library. They are compiled here, once, behind make_cnnbase;
+// users only need CNNBase.h. The global ThreadPool their layers share lives here as well.
+//
+#include <atomic>
+#include <cstdlib>
+#include <mutex>
+#include "CNNBase.h"
+#include "CNNBruteforce.cpp"
+#include "CNNOptimized.cpp"
+#include "CNNPlayground.cpp"
+#include "CNNGemm.cpp"
+#include "CNNSimd.cpp"
+#include "CNNInt8.cpp"
+#include "ThreadPool.h"
+
+/// <summary>
+/// Engine factory shared by Project2, Bench and the C API. Choices are numbered from 0 without gaps;
+/// anything past the last one returns nullptr.
+/// </summary>
+CNNBase* CNNBase::make_cnnbase(int choice) {
+	if (choice == 0)
+		return new CNNBruteforce;
+	else if (choice == 1)
+		return new CNNOptimized;
+	else if (choice == 2)
+		return new CNNPlayground;
+	else if (choice == 3)
+		return new CNNGemm;
+	else if (choice == 4)
+		return new CNNSimd;
+	else if (choice == 5)
+		return new CNNInt8;
+	else if (choice == 6)
+		return new CNNSimd(cpu_best_isa(), STORAGE_FP16);
+	else if (choice == 7)
+		return new CNNSimd(cpu_best_isa(), STORAGE_BF16);
+	else
+		return nullptr;
+}
+
+static atomic<ThreadPool*> global_pool{ nullptr };
+static mutex global_pool_lock;
+
+/// <summary>
+/// The pool every engine's layers share; CNN_THREADS and CNN_PIN configure it until Configure is called.
+/// </summary>
+ThreadPool& ThreadPool::Global() {
+	ThreadPool* pool = global_pool.load(memory_order_acquire);
+	if (pool != nullptr)
+		return *pool;
+	lock_guard<mutex> lock(global_pool_lock);
+	pool = global_pool.load(memory_order_relaxed);
+	if (pool == nullptr) {
+		const char* threads = getenv("CNN_THREADS");
+		const char* pin = getenv("CNN_PIN");
+		pool = new ThreadPool(threads != nullptr ? atoi(threads) : 0, pin != nullptr && atoi(pin) != 0);
+		global_pool.store(pool, memory_order_release);
+	}
+	return *pool;
+}
+
+void ThreadPool::Configure(int threads, bool pin) {
+	lock_guard<mutex> lock(global_pool_lock);
+	delete global_pool.exchange(new ThreadPool(threads, pin));
+}
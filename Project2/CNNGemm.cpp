@@ -0,0 +1,190 @@
+#pragma once
+#include "CNNBase.h"
+#include "CNNOptimized.cpp"
+#include "Sgemm.h"
+#include "Winograd.h"
+#include "face_binary_cls.h"
+using namespace std;
+
+/// <summary>
+/// Convolution lowered to im2col + blocked SGEMM; the remaining layers come from CNNOptimized.
+/// For an OIHW weight array the weights already are the [out_channels x in_channels*3*3] A matrix,
+/// im2col builds B = [in_channels*3*3 x out_rows*out_cols], and C = A * B is the CHW output.
+/// 3x3 stride-1 layers use Winograd F(2x2, 3x3) instead.
+/// The fully connected layer is one GEMM over the whole batch: scores^T = W * features^T.
+/// Every A is packed into GEMM panels once per layer (for Winograd after the weight transform) instead of
+/// on every call: the constructor prepares conv_params[] and fc_params[], other layers are prepared by
+/// PrepareLayer or on first use, and again whenever they point to other weights.
+/// </summary>
+class CNNGemm : public CNNOptimized {
+
+private:
+	// Scratch buffers reused across calls.
+	Tensor columns;
+	Tensor scoresT;
+	GemmWorkspace workspace;
+	WinogradWorkspace winogradWorkspace;
+
+	// Packed weights, one per layer: key is the conv_param / fc_param, source the weights they were packed
+	// from. im2col and fully connected layers hold one A, Winograd layers one per transform point.
+	vector<const void*> gemmKeys;
+	vector<const float*> gemmSources;
+	vector<vector<GemmPackedA>> gemmWeights;
+
+	size_t GemmLayer(const void* key) {
+		for (size_t i = 0; i < gemmKeys.size(); i++) {
+			if (gemmKeys[i] == key)
+				return i;
+		}
+		gemmKeys.push_back(key);
+		gemmSources.push_back(nullptr);
+		gemmWeights.push_back(vector<GemmPackedA>());
+		return gemmKeys.size() - 1;
+	}
+
+	/// <summary>
+	/// The [out_channels x in_channels*kernel^2] A of the im2col GEMM, or the 16 Winograd U of a 3x3 stride-1 layer.
+	/// </summary>
+	const vector<GemmPackedA>& GemmWeights(const conv_param* cp) {
+		size_t layer = GemmLayer(cp);
+		if (gemmSources[layer] != cp->p_weight) {
+			gemmSources[layer] = cp->p_weight;
+			vector<GemmPackedA>& packed = gemmWeights[layer];
+			if (winograd_supported(cp)) {
+				winograd_transform_weights(cp, packed);
+			}
+			else {
+				int k_size = cp->in_channels * cp->kernel_size * cp->kernel_size;
+				packed.resize(1);
+				sgemm_prepack_a(cp->out_channels, k_size, cp->p_weight, k_size, packed[0]);
+			}
+		}
+		return gemmWeights[layer];
+	}
+
+	/// <summary>
+	/// The [out_features x in_features] A of the fully connected GEMM.
+	/// </summary>
+	const GemmPackedA& GemmWeights(const fc_param* fcp) {
+		size_t layer = GemmLayer(fcp);
+		if (gemmSources[layer] != fcp->p_weight) {
+			gemmSources[layer] = fcp->p_weight;
+			gemmWeights[layer].resize(1);
+			sgemm_prepack_a(fcp->out_features, fcp->in_features, fcp->p_weight, fcp->in_features, gemmWeights[layer][0]);
+		}
+		return gemmWeights[layer][0];
+	}
+
+public:
+
+	CNNGemm() : CNNOptimized(false) {
+		for (size_t i = 0; i < sizeof(conv_params) / sizeof(conv_params[0]); i++)
+			PrepareLayer(&conv_params[i]);
+		for (size_t i = 0; i < sizeof(fc_params) / sizeof(fc_params[0]); i++)
+			GemmWeights(&fc_params[i]);
+	}
+
+	/// <summary>
+	/// (Re)pack the weights of a convolution layer, after the Winograd transform for 3x3 stride-1 layers.
+	/// </summary>
+	void PrepareLayer(const conv_param* cp) {
+		gemmSources[GemmLayer(cp)] = nullptr;
+		GemmWeights(cp);
+	}
+
+	void GetClassName() {
+		cout << "CNNGemm";
+	}
+
+	// im2col handles any kernel size and padding.
+	bool SupportsConvolution(const conv_param* cp) const {
+		return true;
+	}
+
+	/// <summary>
+	/// Expand every kernel x kernel receptive field into a column; padding is produced here so the input is never copied.
+	/// </summary>
+	/// <param name="input"></param>
+	/// <param name="kernel"></param>
+	/// <param name="pad"></param>
+	/// <param name="stride"></param>
+	/// <param name="out_rows">output rows</param>
+	/// <param name="out_cols">output cols</param>
+	/// <param name="columns">[in_channels*kernel^2 x batch*out_rows*out_cols], image n in columns n*out_rows*out_cols...</param>
+	static void Im2Col(const Tensor& input, int kernel, int pad, int stride, int out_rows, int out_cols, Tensor& columns) {
+		int batch = input.batch();
+		int in_channels = input.channels();
+		int r_size = input.rows();
+		int c_size = input.cols();
+		int k_size = in_channels * kernel * kernel;
+		int n_size = out_rows * out_cols;
+		columns.create(1, 1, k_size, batch * n_size);
+
+		parallel_for(k_size, [&](int k) {
+			int ch = k / (kernel * kernel);
+			int kr = (k / kernel) % kernel;
+			int kc = k % kernel;
+			float* dst = columns.data() + (size_t)k * batch * n_size;
+			for (int n = 0; n < batch; n++)
+			for (int row = 0; row < out_rows; row++) {
+				int r = row * stride + kr - pad;
+				if (r < 0 || r >= r_size) {
+					for (int col = 0; col < out_cols; col++)
+						*dst++ = 0.f;
+					continue;
+				}
+				const float* src = input.ptr(n, ch, r);
+				for (int col = 0; col < out_cols; col++) {
+					int c = col * stride + kc - pad;
+					*dst++ = (c >= 0 && c < c_size) ? src[c] : 0.f;
+				}
+			}
+		});
+	}
+
+	void ConvolutionalLayer(const Tensor& input, conv_param* cp, Tensor& output) {
+		const vector<GemmPackedA>& weights = GemmWeights(cp);
+		if (winograd_supported(cp)) {
+			winograd_convolution(input, cp, weights, output, winogradWorkspace);
+			return;
+		}
+
+		int kernel = cp->kernel_size;
+		int out_rows = (input.rows() - kernel + 2 * cp->pad) / cp->stride + 1;
+		int out_cols = (input.cols() - kernel + 2 * cp->pad) / cp->stride + 1;
+		int out_channels = cp->out_channels;
+		int n_size = out_rows * out_cols;
+
+		int batch = input.batch();
+
+		Im2Col(input, kernel, cp->pad, cp->stride, out_rows, out_cols, columns);
+		output.create(batch, out_channels, out_rows, out_cols);
+
+		// One GEMM per image writes straight into its CHW plane; B walks that image's columns.
+		for (int n = 0; n < batch; n++) {
+			sgemm_packed(weights[0], n_size,
+				columns.data() + (size_t)n * n_size, batch * n_size,
+				output.ptr(n, 0, 0), n_size,
+				cp->p_bias, workspace);
+		}
+	}
+
+	void FullyConnectedLayer(const Tensor& input, fc_param* fcp, Tensor& fc_output) {
+		int in_features = fcp->in_features;
+		int out_features = fcp->out_features;
+		int batch = input.batch();
+
+		// [out_features x batch] = W [out_features x in_features] * features^T, then transpose.
+		scoresT.create(1, 1, out_features, batch);
+		sgemm_nt_packed(GemmWeights(fcp), batch,
+			input.data(), in_features,
+			scoresT.data(), batch,
+			fcp->p_bias, workspace);
+
+		fc_output.create(batch, 1, 1, out_features);
+		for (int n = 0; n < batch; n++) {
+			for (int o = 0; o < out_features; o++)
+				fc_output.at(n, 0, 0, o) = scoresT.at(0, o, n);
+		}
+	}
+};
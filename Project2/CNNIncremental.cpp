@@ -0,0 +1,235 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include "CNNBase.h"
+#include "CNNModel.h"
+#include "Tensor.h"
+#include "face_binary_cls.h"
+#include <opencv2/opencv.hpp>
+using namespace std;
+using namespace cv;
+
+/// <summary>
+/// The convolution blocks of a CNNModel over a stream of equally sized images (video frames), keeping every
+/// block's output from one image to the next.
+/// The image is compared with the pixels the kept features were computed from in TILE x TILE tiles; only
+/// the outputs whose receptive field contains a tile that changed by more than threshold (largest absolute
+/// byte difference) are recomputed. Layer by layer, the changed region grows by the kernel and shrinks by
+/// the strides; it is cut out of the previous block's output with its halo (zeros outside, as the padding)
+/// and run through an unpadded copy of the layer, then pasted into the kept output.
+/// Outputs only depend on their receptive field when the batch normalization is folded into the weights and
+/// the engine has CNNBase::LocalFeatures, so otherwise (and for threshold &lt; 0) every image is computed in full. Threshold 0 recomputes
+/// every changed pixel; larger thresholds trade accuracy for speed, since kept outputs may have been
+/// computed from pixels that differ from the current ones by about threshold.
+/// The changed tiles are merged into one bounding rectangle; past FULL_FRACTION of the image the whole
+/// image is recomputed instead.
+/// </summary>
+class CNNIncremental {
+public:
+	static const int TILE = 16;	// change detection tiles, input pixels per side
+	static constexpr double FULL_FRACTION = 0.5;
+
+	CNNIncremental(CNNBase* engine, const CNNModel* model) : cnn(engine), model(model), local(engine->LocalFeatures()) {
+		unpadded.assign(model->conv.begin(), model->conv.end());
+		for (int i = 0; i < model->ConvLayers(); i++) {
+			const conv_param* cp = &model->conv[i];
+			CNNBase* layerEngine = cnn;
+			if (!cnn->SupportsConvolution(cp)) {
+				if (general == nullptr)
+					general = CNNBase::make_cnnbase(CNNBase::GENERAL);
+				layerEngine = general;
+			}
+			unpadded[i].pad = 0;
+			layerEngine->PrepareLayer(cp);
+			layerEngine->PrepareLayer(&unpadded[i]);
+			engines.push_back(layerEngine);
+			local = local && layerEngine->LocalFeatures();
+		}
+		values.resize(engines.size() + 1);
+	}
+
+	~CNNIncremental() {
+		delete general;
+	}
+
+	// unpadded is registered with the engines by address.
+	CNNIncremental(const CNNIncremental&) = delete;
+	CNNIncremental& operator=(const CNNIncremental&) = delete;
+
+	/// <summary>
+	/// Forget the kept features: the next Update computes the whole image.
+	/// </summary>
+	void Reset() {
+		reference.release();
+	}
+
+	/// <summary>
+	/// Fraction of the image area the last Update recomputed: 0 when nothing changed, 1 for a full pass.
+	/// </summary>
+	double Recomputed() const {
+		return recomputed;
+	}
+
+	/// <summary>
+	/// The outputs of the last block the last Update recomputed (rows and cols of the feature map), empty when
+	/// nothing changed.
+	/// </summary>
+	Rect Changed() const {
+		return changed;
+	}
+
+	/// <summary>
+	/// Output of the last convolution block for a BGR 8-bit image, (1, channels, rows, cols).
+	/// Valid until the next call.
+	/// </summary>
+	/// <param name="threshold">largest pixel change ignored, &lt; 0: always compute the whole image</param>
+	const Tensor& Update(const Mat& image, int threshold = -1) {
+		bool incremental = threshold >= 0 && local && model->BatchNormFolded() && !reference.empty() &&
+			reference.rows == image.rows && reference.cols == image.cols;
+		if (!incremental) {
+			Full(image);
+			return values.back();
+		}
+
+		Rect dirty = ChangedTiles(image, threshold);
+		recomputed = (double)dirty.width * dirty.height / ((double)image.rows * image.cols);
+		changed = Rect(0, 0, 0, 0);
+		if (recomputed == 0)
+			return values.back();
+		if (recomputed > FULL_FRACTION) {
+			Full(image);
+			return values.back();
+		}
+
+		// The halos of the changed region read the current pixels everywhere.
+		cnn->MatToTensor(image, values[0]);
+		int top = dirty.y, bottom = dirty.y + dirty.height;
+		int left = dirty.x, right = dirty.x + dirty.width;
+		for (int i = 0; i < (int)engines.size(); i++) {
+			const conv_param& cp = model->conv[i];
+			int psize = model->pool[i];
+			Span(top, bottom, cp, psize, values[i + 1].rows());
+			Span(left, right, cp, psize, values[i + 1].cols());
+			if (top >= bottom || left >= right)
+				return values.back();
+			// Input rows of conv outputs [top * psize, bottom * psize), padding included.
+			int rowStart = top * psize * cp.stride - cp.pad;
+			int colStart = left * psize * cp.stride - cp.pad;
+			int rows = ((bottom * psize - 1) - top * psize) * cp.stride + cp.kernel_size;
+			int cols = ((right * psize - 1) - left * psize) * cp.stride + cp.kernel_size;
+			Region(values[i], rowStart, colStart, rows, cols, region);
+			engines[i]->ConvolutionalBlock(region, &unpadded[i], psize, false, block);
+			Paste(block, top, left, values[i + 1]);
+		}
+		changed = Rect(left, top, right - left, bottom - top);
+		return values.back();
+	}
+
+	/// <summary>
+	/// rows x cols of every channel of src starting at (row, col), zeros outside src.
+	/// </summary>
+	static void Region(const Tensor& src, int row, int col, int rows, int cols, Tensor& dst) {
+		int channels = src.channels();
+		dst.create(1, channels, rows, cols);
+		int first = std::max(0, -col);
+		int last = std::min(cols, src.cols() - col);
+		for (int ch = 0; ch < channels; ch++)
+		for (int r = 0; r < rows; r++) {
+			float* out = dst.ptr(0, ch, r);
+			int y = row + r;
+			if (y < 0 || y >= src.rows() || first >= last) {
+				memset(out, 0, cols * sizeof(float));
+				continue;
+			}
+			memset(out, 0, first * sizeof(float));
+			memcpy(out + first, src.ptr(0, ch, y) + col + first, (last - first) * sizeof(float));
+			memset(out + last, 0, (cols - last) * sizeof(float));
+		}
+	}
+
+	/// <summary>
+	/// Copy src into dst with its top left corner at (row, col).
+	/// </summary>
+	static void Paste(const Tensor& src, int row, int col, Tensor& dst) {
+		for (int ch = 0; ch < src.channels(); ch++)
+		for (int r = 0; r < src.rows(); r++)
+			memcpy(dst.ptr(0, ch, row + r) + col, src.ptr(0, ch, r), src.cols() * sizeof(float));
+	}
+
+private:
+	CNNBase* cnn;
+	CNNBase* general = nullptr;	// runs the layers cnn does not support
+	const CNNModel* model;
+	vector<CNNBase*> engines;	// per conv layer
+	vector<conv_param> unpadded;	// the layers with pad 0, for regions that carry their own halo
+	bool local;	// every engine has LocalFeatures
+	vector<Tensor> values;	// input, then the kept output of every block
+	Tensor region;
+	Tensor block;
+	Mat reference;	// the pixels the kept features were computed from
+	double recomputed = 0;
+	Rect changed;
+
+	void Full(const Mat& image) {
+		bool normalize = !model->BatchNormFolded();
+		cnn->MatToTensor(image, values[0]);
+		for (int i = 0; i < (int)engines.size(); i++) {
+			engines[i]->ConvolutionalBlock(values[i], const_cast<conv_param*>(&model->conv[i]), model->pool[i],
+				normalize, values[i + 1]);
+		}
+		image.copyTo(reference);
+		recomputed = 1;
+		changed = Rect(0, 0, values.back().cols(), values.back().rows());
+	}
+
+	/// <summary>
+	/// Bounding rectangle of the tiles that changed by more than threshold; those tiles of the reference
+	/// take the new pixels.
+	/// </summary>
+	Rect ChangedTiles(const Mat& image, int threshold) {
+		int top = image.rows, left = image.cols, bottom = 0, right = 0;
+		for (int ty = 0; ty < image.rows; ty += TILE)
+		for (int tx = 0; tx < image.cols; tx += TILE) {
+			int height = std::min(TILE, image.rows - ty);
+			int bytes = 3 * std::min(TILE, image.cols - tx);
+			bool changed = false;
+			for (int r = ty; r < ty + height && !changed; r++) {
+				const uint8_t* a = image.ptr<uint8_t>(r) + 3 * tx;
+				const uint8_t* b = reference.ptr<uint8_t>(r) + 3 * tx;
+				int difference = 0;
+				for (int i = 0; i < bytes; i++)
+					difference = std::max(difference, abs(a[i] - b[i]));
+				changed = difference > threshold;
+			}
+			if (!changed)
+				continue;
+			for (int r = ty; r < ty + height; r++)
+				memcpy(reference.ptr<uint8_t>(r) + 3 * tx, image.ptr<uint8_t>(r) + 3 * tx, bytes);
+			top = std::min(top, ty);
+			left = std::min(left, tx);
+			bottom = std::max(bottom, ty + height);
+			right = std::max(right, tx + bytes / 3);
+		}
+		if (bottom == 0)
+			return Rect(0, 0, 0, 0);
+		return Rect(left, top, right - left, bottom - top);
+	}
+
+	/// <summary>
+	/// Input [lo, hi) -> the pooled outputs of a block whose receptive field meets it, clamped to [0, count).
+	/// Conv output i reads inputs [i * stride - pad, i * stride - pad + kernel).
+	/// </summary>
+	static void Span(int& lo, int& hi, const conv_param& cp, int psize, int count) {
+		int first = FloorDiv(lo + cp.pad - cp.kernel_size, cp.stride) + 1;
+		int last = FloorDiv(hi - 1 + cp.pad, cp.stride);
+		lo = std::max(0, first) / psize;
+		hi = std::min(count, last / psize + 1);
+	}
+
+	static int FloorDiv(int a, int b) {
+		return a >= 0 ? a / b : -((-a + b - 1) / b);
+	}
+};
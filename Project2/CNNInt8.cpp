@@ -0,0 +1,327 @@
+#pragma once
+#include "CNNBase.h"
+#include "CNNOptimized.cpp"
+#include "Int8Gemm.h"
+#include "face_binary_cls.h"
+using namespace std;
+
+/// <summary>
+/// INT8 quantized convolution and fully connected layers; the remaining layers come from CNNOptimized.
+/// Weights are quantized per output channel when a layer is prepared (the constructor prepares conv_params[]
+/// and fc_params[]). Each layer quantizes its float input per image (asymmetric u8, see Int8Gemm.h) into
+/// zero-point padded HWC bytes, gathers every output pixel's receptive field as whole 4-byte k groups,
+/// accumulates u8 x s8 products in int32 with the VNNI or AVX2 kernel and requantizes the result to float:
+/// (acc - zero_point * sum[oc]) * scale * scale[oc] + bias[oc].
+/// Batch normalization, Relu and pooling therefore see float activations, and the next layer picks its own
+/// activation scale from them.
+/// The results only approximate CNNBruteforce (Quantized()): parity compares the class probabilities.
+/// </summary>
+class CNNInt8 : public CNNOptimized {
+
+private:
+	int8_kernel kernel;
+	const char* kernelName;
+	int levels;	// activation range of the kernel
+
+	// Quantized weights, one per prepared layer: key is the conv_param / fc_param, source its weights.
+	vector<const void*> keys;
+	vector<const float*> sources;
+	vector<int8_weights> layers;
+
+	// Scratch buffers reused across calls.
+	vector<uint8_t> quantized;	// layer input, [image][padded row][padded col][channel_groups * 4]
+	vector<uint8_t> columns;	// kernel layout, see Im2Col
+	vector<int8_activation> activations;	// per image
+	vector<float> scales;	// [image][padded channel], see Requantization
+	vector<int32_t> offsets;
+	Tensor convolved;	// ConvolutionalBlock
+
+	size_t Layer(const void* key) {
+		for (size_t i = 0; i < keys.size(); i++) {
+			if (keys[i] == key)
+				return i;
+		}
+		keys.push_back(key);
+		sources.push_back(nullptr);
+		layers.push_back(int8_weights());
+		return keys.size() - 1;
+	}
+
+	void Quantize(size_t layer, const float* weight, const float* bias, int out_channels, int in_channels, int kernel_size) {
+		sources[layer] = weight;
+		int8_quantize_weights(weight, bias, out_channels, in_channels, kernel_size, layers[layer]);
+	}
+
+	/// <summary>
+	/// Quantized weights of a layer, quantized on first use (or when the layer points to other weights).
+	/// A fully connected layer is a 1x1 convolution with in_features channels.
+	/// </summary>
+	const int8_weights& Weights(const void* key, const float* weight, const float* bias, int out_channels, int in_channels, int kernel_size) {
+		size_t layer = Layer(key);
+		if (sources[layer] != weight)
+			Quantize(layer, weight, bias, out_channels, in_channels, kernel_size);
+		return layers[layer];
+	}
+
+	const int8_weights& Weights(const conv_param* cp) {
+		return Weights(cp, cp->p_weight, cp->p_bias, cp->out_channels, cp->in_channels, cp->kernel_size);
+	}
+
+	const int8_weights& Weights(const fc_param* fcp) {
+		return Weights(fcp, fcp->p_weight, fcp->p_bias, fcp->out_features, fcp->in_features, 1);
+	}
+
+	/// <summary>
+	/// Quantize every image of the batch with its own activation range into HWC bytes surrounded by pad rows /
+	/// columns of the zero point, so the receptive fields need no bounds checks.
+	/// </summary>
+	void QuantizeImages(const Tensor& input, int pad, int channel_groups) {
+		int batch = input.batch();
+		int channels = input.channels();
+		int r_size = input.rows();
+		int c_size = input.cols();
+		int padded_cols = c_size + 2 * pad;
+		size_t pixel = (size_t)channel_groups * 4;
+		size_t count = (size_t)channels * r_size * c_size;
+		size_t image = (r_size + 2 * pad) * padded_cols * pixel;
+		quantized.resize(batch * image);
+		activations.resize(batch);
+
+		parallel_for(batch, [&](int n) {
+			activations[n] = int8_choose_activation(input.data() + n * count, count, levels);
+			memset(quantized.data() + n * image, activations[n].zero_point, image);
+		});
+		parallel_for(batch * r_size, [=, &input](int t) {	// by value, see Im2Col
+			int n = t / r_size;
+			int r = t % r_size;
+			uint8_t* dst = quantized.data() + n * image + ((size_t)(r + pad) * padded_cols + pad) * pixel;
+			for (int ch = 0; ch < channels; ch++)
+				int8_quantize_activation(input.ptr(n, ch, r), c_size, activations[n], dst + ch, pixel);
+		});
+	}
+
+	/// <summary>
+	/// Gather the receptive fields into the kernel layout [image][pixel block][k group][INT8_PIXELS][4]:
+	/// k group (ky, kx, channel group) of pixel p is 4 bytes of input pixel (oy * stride + ky, ox * stride + kx).
+	/// The lanes past the last pixel are never stored, so they are not cleared.
+	/// </summary>
+	void Im2Col(int batch, int padded_rows, int padded_cols, const conv_param* cp, const int8_weights& q,
+		int out_rows, int out_cols) {
+		int kernel_size = cp->kernel_size;
+		int stride = cp->stride;
+		int channel_groups = q.channel_groups;
+		int pixel_blocks = (out_rows * out_cols + INT8_PIXELS - 1) / INT8_PIXELS;
+		size_t block_bytes = (size_t)q.k_groups * INT8_PIXELS * 4;
+		size_t pixel = (size_t)channel_groups * 4;
+		size_t image = (size_t)padded_rows * padded_cols * pixel;
+		columns.resize(batch * pixel_blocks * block_bytes);
+
+		// Captures by value: the byte stores would force every captured reference to be reloaded.
+		parallel_for(batch * out_rows, [=](int t) {
+			int n = t / out_rows;
+			int oy = t % out_rows;
+			const uint8_t* src = quantized.data() + n * image + (size_t)oy * stride * padded_cols * pixel;
+			for (int ox = 0; ox < out_cols; ox++) {
+				int p = oy * out_cols + ox;
+				uint8_t* dst = columns.data() + (n * pixel_blocks + p / INT8_PIXELS) * block_bytes + (p % INT8_PIXELS) * 4;
+				for (int ky = 0; ky < kernel_size; ky++) {
+					const uint8_t* row = src + (ky * padded_cols + ox * stride) * pixel;
+					for (int g = 0; g < kernel_size * channel_groups; g++) {
+						memcpy(dst, row + 4 * g, 4);
+						dst += INT8_PIXELS * 4;
+					}
+				}
+			}
+		});
+	}
+
+	/// <summary>
+	/// Per image and channel: activation scale x weight scale, and the zero point correction.
+	/// </summary>
+	void Requantization(const int8_weights& q, int batch) {
+		int padded = int8_padded_channels(q.out_channels);
+		scales.resize(batch * padded);
+		offsets.resize(batch * padded);
+		for (int n = 0; n < batch; n++) {
+			for (int oc = 0; oc < padded; oc++) {
+				scales[n * padded + oc] = activations[n].scale * q.scale[oc];
+				offsets[n * padded + oc] = activations[n].zero_point * q.sum[oc];
+			}
+		}
+	}
+
+	/// <summary>
+	/// Kernel call for one block of pixels and channels; channel j, pixel p goes to out[j * out_stride + p].
+	/// </summary>
+	int8_job Job(const int8_weights& q, const uint8_t* x, int n, int oc0, int pixels, float* out, size_t out_stride) const {
+		int padded = int8_padded_channels(q.out_channels);
+		int8_job job;
+		job.x = x;
+		job.w = q.packed.data() + (size_t)oc0 * q.k_groups * 4;
+		job.k_groups = q.k_groups;
+		job.scale = scales.data() + n * padded + oc0;
+		job.offset = offsets.data() + n * padded + oc0;
+		job.bias = q.bias.data() + oc0;
+		job.out = out;
+		job.out_stride = out_stride;
+		job.channels = std::min(INT8_OC_BLOCK, q.out_channels - oc0);
+		job.pixels = std::min(INT8_PIXELS, pixels);
+		return job;
+	}
+
+public:
+
+	CNNInt8() : CNNOptimized(false) {
+		kernel = int8_select_kernel(kernelName, levels);
+		for (size_t i = 0; i < sizeof(conv_params) / sizeof(conv_params[0]); i++)
+			PrepareLayer(&conv_params[i]);
+		for (size_t i = 0; i < sizeof(fc_params) / sizeof(fc_params[0]); i++)
+			Weights(&fc_params[i]);
+	}
+
+	/// <summary>
+	/// (Re)quantize the weights of a convolution layer.
+	/// </summary>
+	void PrepareLayer(const conv_param* cp) {
+		Quantize(Layer(cp), cp->p_weight, cp->p_bias, cp->out_channels, cp->in_channels, cp->kernel_size);
+	}
+
+	void GetClassName() {
+		cout << "CNNInt8(" << kernelName << ")";
+	}
+
+	// The receptive field gather handles any kernel size and padding.
+	bool SupportsConvolution(const conv_param* cp) const {
+		return true;
+	}
+
+	bool Quantized() const {
+		return true;
+	}
+
+	// Activations are quantized with the range of the whole tensor they belong to.
+	bool LocalFeatures() const {
+		return false;
+	}
+
+	void ConvolutionalLayer(const Tensor& input, conv_param* cp, Tensor& output) {
+		const int8_weights& q = Weights(cp);
+		int pad = cp->pad;
+		int batch = input.batch();
+		int out_rows = (input.rows() - cp->kernel_size + 2 * pad) / cp->stride + 1;
+		int out_cols = (input.cols() - cp->kernel_size + 2 * pad) / cp->stride + 1;
+		int pixels = out_rows * out_cols;
+		output.create(batch, cp->out_channels, out_rows, out_cols);
+
+		QuantizeImages(input, pad, q.channel_groups);
+		Im2Col(batch, input.rows() + 2 * pad, input.cols() + 2 * pad, cp, q, out_rows, out_cols);
+		Requantization(q, batch);
+
+		int channel_blocks = int8_padded_channels(q.out_channels) / INT8_OC_BLOCK;
+		int pixel_blocks = (pixels + INT8_PIXELS - 1) / INT8_PIXELS;
+		size_t block_bytes = (size_t)q.k_groups * INT8_PIXELS * 4;
+		parallel_for(batch * channel_blocks * pixel_blocks, [&](int t) {
+			int n = t / (channel_blocks * pixel_blocks);
+			int oc0 = t / pixel_blocks % channel_blocks * INT8_OC_BLOCK;
+			int block = t % pixel_blocks;
+			int p0 = block * INT8_PIXELS;
+			const uint8_t* x = columns.data() + (n * pixel_blocks + block) * block_bytes;
+			kernel(Job(q, x, n, oc0, pixels - p0, output.ptr(n, oc0, 0) + p0, output.step(1)));
+		});
+	}
+
+	/// <summary>
+	/// Convolution, then normalization, Relu and max pooling in one pass over each channel plane. Normalization
+	/// divides by a positive root mean square and Relu is increasing, so both commute with the maximum: the raw
+	/// plane is pooled first and only the pooled values are normalized.
+	/// </summary>
+	void ConvolutionalBlock(const Tensor& input, conv_param* cp, int psize, bool normalize, Tensor& output) {
+		ConvolutionalLayer(input, cp, convolved);
+		int batch = convolved.batch();
+		int channels = convolved.channels();
+		int r_size = convolved.rows();
+		int c_size = convolved.cols();
+		int dimension = r_size * c_size;
+		int pooled_rows = r_size / psize;
+		int pooled_cols = c_size / psize;
+		output.create(batch, channels, pooled_rows, pooled_cols);
+
+		parallel_for(batch * channels, [&](int p) {
+			int n = p / channels;
+			int ch = p % channels;
+			const float* plane = convolved.ptr(n, ch, 0);
+			float mean = 0;
+			float sqrtChannel = 1;
+			if (normalize) {
+				// Eight partial sums: one dependent add chain per plane would dominate the block.
+				float sumMean[8] = {}, sumVariance[8] = {};
+				int i = 0;
+				for (; i + 8 <= dimension; i += 8) {
+					for (int j = 0; j < 8; j++) {
+						sumMean[j] += plane[i + j];
+						sumVariance[j] += plane[i + j] * plane[i + j];
+					}
+				}
+				for (; i < dimension; i++) {
+					sumMean[0] += plane[i];
+					sumVariance[0] += plane[i] * plane[i];
+				}
+				for (int j = 1; j < 8; j++) {
+					sumMean[0] += sumMean[j];
+					sumVariance[0] += sumVariance[j];
+				}
+				mean = sumMean[0] / dimension;
+				sqrtChannel = sqrt(sumVariance[0] / dimension);
+			}
+
+			float* out = output.ptr(n, ch, 0);
+			for (int r = 0; r < pooled_rows; r++) {
+				const float* in0 = plane + r * psize * c_size;
+				if (psize == 2) {
+					const float* in1 = in0 + c_size;
+					for (int c = 0; c < pooled_cols; c++)
+						out[c] = std::max(std::max(in0[2 * c], in0[2 * c + 1]), std::max(in1[2 * c], in1[2 * c + 1]));
+				}
+				else {
+					for (int c = 0; c < pooled_cols; c++) {
+						float value = in0[c * psize];
+						for (int y = 0; y < psize; y++) {
+							for (int x = 0; x < psize; x++)
+								value = std::max(value, in0[y * c_size + c * psize + x]);
+						}
+						out[c] = value;
+					}
+				}
+				out += pooled_cols;
+			}
+			float* pooled = output.ptr(n, ch, 0);
+			for (int i = 0; i < pooled_rows * pooled_cols; i++)
+				pooled[i] = std::max(0.f, (pooled[i] - mean) / sqrtChannel);
+		});
+	}
+
+	/// <summary>
+	/// One INT8 GEMV per image (a pixel block with a single pixel): each image has its own activation range.
+	/// </summary>
+	void FullyConnectedLayer(const Tensor& input, fc_param* fcp, Tensor& fc_output) {
+		const int8_weights& q = Weights(fcp);
+		int batch = input.batch();
+		size_t pixel = (size_t)q.channel_groups * 4;
+		size_t block_bytes = (size_t)q.k_groups * INT8_PIXELS * 4;
+
+		// (n, 1, 1, in_features) is a 1x1 image with in_features channels.
+		QuantizeImages(input.reshape(batch, fcp->in_features, 1, 1), 0, q.channel_groups);
+		Requantization(q, batch);
+		columns.resize(batch * block_bytes);
+		fc_output.create(batch, 1, 1, fcp->out_features);
+
+		parallel_for(batch, [&](int n) {
+			const uint8_t* src = quantized.data() + n * pixel;
+			uint8_t* x = columns.data() + n * block_bytes;
+			for (int g = 0; g < q.k_groups; g++)
+				memcpy(x + g * INT8_PIXELS * 4, src + 4 * g, 4);
+			for (int oc0 = 0; oc0 < fcp->out_features; oc0 += INT8_OC_BLOCK)
+				kernel(Job(q, x, n, oc0, 1, fc_output.ptr(n, 0, 0) + oc0, 1));
+		});
+	}
+};
@@ -0,0 +1,421 @@
+#pragma once
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "CNNBase.h"
+#include "ModelFile.h"
+#include "Tensor.h"
+#include "face_binary_cls.h"
+using namespace std;
+
+/// <summary>
+/// The layer parameters a CNNPipeline runs.
+/// By default these are the arrays of face_binary_cls.h, and every convolution block normalizes with the
+/// statistics of the current image (mean and sqrt(E[x^2]) per channel), as the model was exported.
+/// In inference mode each block uses a stored per-channel y = x * scale + shift instead, which is folded
+/// into copies of the convolution weights and bias when the model is loaded:
+///		w' = w * scale, b' = b * scale + shift
+/// so the blocks run Conv -> Relu -> MaxPooling with no normalization pass at all.
+/// LoadBinary replaces the compiled-in parameters with a memory-mapped model file (ModelFile.h), used
+/// in place without copying; SaveBinary exports the current parameters, folded or not, into one.
+/// Replicate copies another model's parameters into buffers of this one, e.g. one replica per NUMA node.
+/// Engines that precompute per-layer data must see PrepareLayer again after the parameters change,
+/// so load the model before building a CNNPipeline on it.
+/// </summary>
+class CNNModel {
+public:
+	static const int INPUT_CHANNELS = 3;
+	static const int INPUT_SIZE = 128;	// network input rows/cols
+
+	// The network: convolution blocks in order, then the fully connected classifier and softmax.
+	vector<conv_param> conv;
+	vector<int> pool;	// max pooling size after each block, 1 = none
+	fc_param fc;
+
+	CNNModel() {
+		base.assign(conv_params, conv_params + sizeof(conv_params) / sizeof(conv_params[0]));
+		conv = base;
+		pool = { 2, 2, 1 };
+		fc = fc_params[0];
+		Resize();
+	}
+
+	int ConvLayers() const {
+		return (int)conv.size();
+	}
+
+	// conv[] points into the folded buffers or the mapped file of this object.
+	CNNModel(const CNNModel&) = delete;
+	CNNModel& operator=(const CNNModel&) = delete;
+
+	/// <summary>
+	/// True when batch normalization is folded into conv[] and the blocks must not normalize.
+	/// </summary>
+	bool BatchNormFolded() const {
+		return folded;
+	}
+
+	/// <summary>
+	/// Fold one bn_param per convolution layer into copies of the original weights and bias.
+	/// </summary>
+	void FoldBatchNormalization(const bn_param* bn) {
+		for (int i = 0; i < ConvLayers(); i++)
+			FoldLayer(i, bn[i].p_scale, bn[i].p_shift);
+		folded = true;
+	}
+
+	/// <summary>
+	/// Read per-channel scale/shift written by SaveBatchNormalization and fold them.
+	/// Format, one block per convolution layer:
+	///		bn layer channels
+	///		scale[0] ... scale[channels - 1]
+	///		shift[0] ... shift[channels - 1]
+	/// Lines starting with # are comments.
+	/// </summary>
+	/// <returns>false (model unchanged) when the file is missing, does not match the layers or the model
+	/// was loaded already folded</returns>
+	bool LoadBatchNormalization(const string& path) {
+		if (baseFolded)
+			return false;
+		FILE* file = fopen(path.c_str(), "r");
+		if (file == nullptr)
+			return false;
+
+		vector<vector<float>> scale(ConvLayers());
+		vector<vector<float>> shift(ConvLayers());
+		bool valid = true;
+		int c;
+		while (valid && (c = fgetc(file)) != EOF) {
+			if (c == '#') {
+				while ((c = fgetc(file)) != EOF && c != '\n');
+				continue;
+			}
+			if (isspace(c))
+				continue;
+			ungetc(c, file);
+
+			int layer, channels;
+			if (fscanf(file, " bn %d %d", &layer, &channels) != 2 || layer < 0 || layer >= ConvLayers() ||
+				channels != base[layer].out_channels) {
+				valid = false;
+				break;
+			}
+			scale[layer].resize(channels);
+			shift[layer].resize(channels);
+			for (int i = 0; valid && i < channels; i++)
+				valid = fscanf(file, "%f", &scale[layer][i]) == 1;
+			for (int i = 0; valid && i < channels; i++)
+				valid = fscanf(file, "%f", &shift[layer][i]) == 1;
+		}
+		fclose(file);
+
+		for (int i = 0; valid && i < ConvLayers(); i++)
+			valid = !scale[i].empty();
+		if (!valid)
+			return false;
+
+		for (int i = 0; i < ConvLayers(); i++)
+			FoldLayer(i, scale[i].data(), shift[i].data());
+		folded = true;
+		return true;
+	}
+
+	/// <summary>
+	/// Write the folded scale/shift in the format LoadBatchNormalization reads.
+	/// </summary>
+	bool SaveBatchNormalization(const string& path) const {
+		if (!folded || bnScale[0].empty())
+			return false;
+		FILE* file = fopen(path.c_str(), "w");
+		if (file == nullptr)
+			return false;
+		fprintf(file, "# face_binary_cls batch normalization: y = x * scale + shift per channel\n");
+		for (int i = 0; i < ConvLayers(); i++) {
+			int channels = (int)bnScale[i].size();
+			fprintf(file, "bn %d %d\n", i, channels);
+			for (int ch = 0; ch < channels; ch++)
+				fprintf(file, "%.9g%c", bnScale[i][ch], ch + 1 < channels ? ' ' : '\n');
+			for (int ch = 0; ch < channels; ch++)
+				fprintf(file, "%.9g%c", bnShift[i][ch], ch + 1 < channels ? ' ' : '\n');
+		}
+		return fclose(file) == 0;
+	}
+
+	/// <summary>
+	/// Compute stored statistics over sample images and fold them, one layer at a time: layer i is
+	/// measured on the output of the already folded layers 0..i-1, exactly as inference will see it.
+	/// scale = 1 / avg(sqrt(E[x^2])), shift = -avg(mean) * scale, averaged over the images.
+	/// </summary>
+	/// <param name="engine">any engine, used to run the layers</param>
+	/// <param name="images">BGR 8-bit images</param>
+	/// <returns>false when there are no images or the model was loaded already folded</returns>
+	bool CalibrateBatchNormalization(CNNBase* engine, const vector<Mat>& images) {
+		if (images.empty() || baseFolded)
+			return false;
+		Tensor activation, next, convolved;
+		for (int i = 0; i < ConvLayers(); i++) {
+			Unfold(i);
+			engine->PrepareLayer(&conv[i]);
+		}
+
+		for (int layer = 0; layer < ConvLayers(); layer++) {
+			int channels = conv[layer].out_channels;
+			vector<double> sumMean(channels, 0.0);
+			vector<double> sumSqrt(channels, 0.0);
+
+			for (const Mat& image : images) {
+				engine->MatToTensor(image, activation);
+				for (int i = 0; i < layer; i++) {
+					engine->ConvolutionalBlock(activation, &conv[i], pool[i], false, next);
+					std::swap(activation, next);
+				}
+				engine->ConvolutionalLayer(activation, &conv[layer], convolved);
+
+				int dimension = convolved.rows() * convolved.cols();
+				for (int ch = 0; ch < channels; ch++) {
+					double sum = 0, squares = 0;
+					for (int r = 0; r < convolved.rows(); r++) {
+						const float* row = convolved.ptr(ch, r);
+						for (int c = 0; c < convolved.cols(); c++) {
+							sum += row[c];
+							squares += (double)row[c] * row[c];
+						}
+					}
+					sumMean[ch] += sum / dimension;
+					sumSqrt[ch] += sqrt(squares / dimension);
+				}
+			}
+
+			vector<float> scale(channels), shift(channels);
+			for (int ch = 0; ch < channels; ch++) {
+				scale[ch] = (float)(images.size() / sumSqrt[ch]);
+				shift[ch] = (float)(-sumMean[ch] / sumSqrt[ch]);
+			}
+			FoldLayer(layer, scale.data(), shift.data());
+			engine->PrepareLayer(&conv[layer]);
+		}
+		folded = true;
+		return true;
+	}
+
+	/// <summary>
+	/// Map a model file written by SaveBinary and run its parameters in place. The file describes the
+	/// network: any number of convolution blocks (kernel size, padding, stride, pooling, channels) chained on
+	/// the 3 x 128 x 128 input, then the fully connected (bg, face) classifier over the flattened activation.
+	/// </summary>
+	/// <returns>false (model unchanged) when the file is missing or its layers do not chain</returns>
+	bool LoadBinary(const string& path) {
+		MappedFile file;
+		if (!file.Open(path) || file.size() < sizeof(cnn_model_header))
+			return false;
+		cnn_model_header header;
+		memcpy(&header, file.data(), sizeof(header));
+		if (memcmp(header.magic, CNN_MODEL_MAGIC, sizeof(header.magic)) != 0 || header.version != CNN_MODEL_VERSION ||
+			header.file_size != file.size() || header.layer_count < 2 ||
+			header.input_channels != INPUT_CHANNELS || header.input_rows != INPUT_SIZE || header.input_cols != INPUT_SIZE ||
+			sizeof(header) + (size_t)header.layer_count * sizeof(cnn_layer_desc) > file.size())
+			return false;
+		const cnn_layer_desc* layers = (const cnn_layer_desc*)(file.data() + sizeof(header));
+
+		int layerCount = (int)header.layer_count - 1;
+		vector<conv_param> loaded(layerCount);
+		vector<int> loadedPool(layerCount);
+		int channels = header.input_channels;
+		int rows = header.input_rows;
+		for (int i = 0; i < layerCount; i++) {
+			const cnn_layer_desc& d = layers[i];
+			if (d.type != CNN_LAYER_CONV || (int)d.in_channels != channels || d.kernel_size == 0 ||
+				d.pad >= d.kernel_size || d.stride == 0 || d.pool == 0 || d.out_channels == 0 ||
+				d.weight_count != (uint64_t)d.out_channels * d.in_channels * d.kernel_size * d.kernel_size ||
+				d.bias_count != d.out_channels ||
+				!BlobInFile(file, d.weight_offset, d.weight_count) || !BlobInFile(file, d.bias_offset, d.bias_count))
+				return false;
+			int convolved = (rows + 2 * (int)d.pad - (int)d.kernel_size) / (int)d.stride + 1;
+			if (convolved <= 0 || convolved / (int)d.pool <= 0)
+				return false;
+			rows = convolved / (int)d.pool;
+			channels = d.out_channels;
+			loaded[i] = { (int)d.pad, (int)d.stride, (int)d.kernel_size, (int)d.in_channels, (int)d.out_channels,
+				Blob(file, d.weight_offset), Blob(file, d.bias_offset) };
+			loadedPool[i] = d.pool;
+		}
+		const cnn_layer_desc& d = layers[layerCount];
+		if (d.type != CNN_LAYER_FC || d.in_channels != (uint32_t)(channels * rows * rows) || d.out_channels != 2 ||
+			d.weight_count != (uint64_t)d.out_channels * d.in_channels || d.bias_count != d.out_channels ||
+			!BlobInFile(file, d.weight_offset, d.weight_count) || !BlobInFile(file, d.bias_offset, d.bias_count))
+			return false;
+
+		base = loaded;
+		conv = loaded;
+		pool = loadedPool;
+		fc = { (int)d.in_channels, (int)d.out_channels, Blob(file, d.weight_offset), Blob(file, d.bias_offset) };
+		Resize();
+		for (int i = 0; i < layerCount; i++) {
+			bnScale[i].clear();
+			bnShift[i].clear();
+		}
+		folded = baseFolded = (header.flags & CNN_MODEL_FOLDED) != 0;
+		mapping = std::move(file);
+		return true;
+	}
+
+	/// <summary>
+	/// Make this model a copy of source's current parameters (batch normalization folded in when it is), held
+	/// in buffers of this object. The calling thread writes every page of them first, so with the default
+	/// first-touch memory policy they are allocated on the NUMA node it runs on.
+	/// A copy of a folded model cannot be folded or calibrated again, like a folded model file.
+	/// </summary>
+	void Replicate(const CNNModel& source) {
+		int layerCount = source.ConvLayers();
+		replica.assign(2 * layerCount + 2, vector<float>());
+		base = source.conv;
+		for (int i = 0; i < layerCount; i++) {
+			const conv_param& cp = source.conv[i];
+			size_t count = (size_t)cp.out_channels * cp.in_channels * cp.kernel_size * cp.kernel_size;
+			replica[2 * i].assign(cp.p_weight, cp.p_weight + count);
+			replica[2 * i + 1].assign(cp.p_bias, cp.p_bias + cp.out_channels);
+			base[i].p_weight = replica[2 * i].data();
+			base[i].p_bias = replica[2 * i + 1].data();
+		}
+		fc = source.fc;
+		replica[2 * layerCount].assign(fc.p_weight, fc.p_weight + (size_t)fc.out_features * fc.in_features);
+		replica[2 * layerCount + 1].assign(fc.p_bias, fc.p_bias + fc.out_features);
+		fc.p_weight = replica[2 * layerCount].data();
+		fc.p_bias = replica[2 * layerCount + 1].data();
+		conv = base;
+		pool = source.pool;
+		Resize();
+		for (int i = 0; i < layerCount; i++) {
+			weights[i].clear();
+			bias[i].clear();
+		}
+		bnScale = source.bnScale;
+		bnShift = source.bnShift;
+		folded = baseFolded = source.folded;
+		mapping = MappedFile();
+	}
+
+	/// <summary>
+	/// Write the current parameters (with batch normalization folded in when it is) as a model file.
+	/// </summary>
+	bool SaveBinary(const string& path) const {
+		FILE* file = fopen(path.c_str(), "wb");
+		if (file == nullptr)
+			return false;
+
+		int layerCount = ConvLayers();
+		vector<cnn_layer_desc> layers(layerCount + 1, cnn_layer_desc());
+		uint64_t offset = Align(sizeof(cnn_model_header) + layers.size() * sizeof(cnn_layer_desc));
+		for (int i = 0; i <= layerCount; i++) {
+			cnn_layer_desc& d = layers[i];
+			if (i < layerCount) {
+				d = { CNN_LAYER_CONV, (uint32_t)conv[i].pad, (uint32_t)conv[i].stride, (uint32_t)conv[i].kernel_size,
+					(uint32_t)conv[i].in_channels, (uint32_t)conv[i].out_channels, (uint32_t)pool[i] };
+				d.weight_count = (uint64_t)conv[i].out_channels * conv[i].in_channels * conv[i].kernel_size * conv[i].kernel_size;
+			}
+			else {
+				d = { CNN_LAYER_FC, 0, 1, 1, (uint32_t)fc.in_features, (uint32_t)fc.out_features, 1 };
+				d.weight_count = (uint64_t)fc.out_features * fc.in_features;
+			}
+			d.bias_count = d.out_channels;
+			d.weight_offset = offset;
+			offset = Align(offset + d.weight_count * sizeof(float));
+			d.bias_offset = offset;
+			offset = Align(offset + d.bias_count * sizeof(float));
+		}
+
+		cnn_model_header header = {};
+		memcpy(header.magic, CNN_MODEL_MAGIC, sizeof(header.magic));
+		header.version = CNN_MODEL_VERSION;
+		header.flags = folded ? CNN_MODEL_FOLDED : 0;
+		header.layer_count = layerCount + 1;
+		header.input_channels = INPUT_CHANNELS;
+		header.input_rows = INPUT_SIZE;
+		header.input_cols = INPUT_SIZE;
+		header.file_size = offset;
+
+		bool written = fwrite(&header, sizeof(header), 1, file) == 1 &&
+			fwrite(layers.data(), sizeof(cnn_layer_desc), layers.size(), file) == layers.size();
+		for (int i = 0; written && i <= layerCount; i++) {
+			const float* weight = i < layerCount ? conv[i].p_weight : fc.p_weight;
+			const float* bias = i < layerCount ? conv[i].p_bias : fc.p_bias;
+			written = WriteBlob(file, layers[i].weight_offset, weight, layers[i].weight_count) &&
+				WriteBlob(file, layers[i].bias_offset, bias, layers[i].bias_count);
+		}
+		written = written && WriteBlob(file, offset, nullptr, 0);
+		return fclose(file) == 0 && written;
+	}
+
+private:
+	bool folded = false;
+	bool baseFolded = false;	// base came folded from a model file
+	vector<conv_param> base;	// unfolded parameters: conv_params or the mapped file
+	MappedFile mapping;
+	vector<vector<float>> replica;	// Replicate: weight and bias of every layer, fc last; base and fc point here
+	vector<vector<float>> weights;
+	vector<vector<float>> bias;
+	vector<vector<float>> bnScale;
+	vector<vector<float>> bnShift;
+
+	void Resize() {
+		weights.resize(conv.size());
+		bias.resize(conv.size());
+		bnScale.resize(conv.size());
+		bnShift.resize(conv.size());
+	}
+
+	void FoldLayer(int layer, const float* scale, const float* shift) {
+		const conv_param& original = base[layer];
+		int channels = original.out_channels;
+		size_t filter = (size_t)original.in_channels * original.kernel_size * original.kernel_size;
+
+		bnScale[layer].assign(scale, scale + channels);
+		bnShift[layer].assign(shift, shift + channels);
+		weights[layer].resize(filter * channels);
+		bias[layer].resize(channels);
+		for (int oc = 0; oc < channels; oc++) {
+			const float* w = original.p_weight + oc * filter;
+			float* folded_w = weights[layer].data() + oc * filter;
+			for (size_t k = 0; k < filter; k++)
+				folded_w[k] = w[k] * scale[oc];
+			bias[layer][oc] = original.p_bias[oc] * scale[oc] + shift[oc];
+		}
+		conv[layer] = original;
+		conv[layer].p_weight = weights[layer].data();
+		conv[layer].p_bias = bias[layer].data();
+	}
+
+	static uint64_t Align(uint64_t offset) {
+		return (offset + CNN_MODEL_ALIGNMENT - 1) / CNN_MODEL_ALIGNMENT * CNN_MODEL_ALIGNMENT;
+	}
+
+	static bool BlobInFile(const MappedFile& file, uint64_t offset, uint64_t count) {
+		return offset % sizeof(float) == 0 && offset <= file.size() && count <= (file.size() - offset) / sizeof(float);
+	}
+
+	// Parameters are never written through, the const_cast only fits the float* of conv_param / fc_param.
+	static float* Blob(const MappedFile& file, uint64_t offset) {
+		return (float*)const_cast<unsigned char*>(file.data() + offset);
+	}
+
+	/// <summary>
+	/// Zero-pad up to offset, then write count floats (count 0: padding only).
+	/// </summary>
+	static bool WriteBlob(FILE* file, uint64_t offset, const float* values, uint64_t count) {
+		long position = ftell(file);
+		if (position < 0 || (uint64_t)position > offset)
+			return false;
+		for (uint64_t i = (uint64_t)position; i < offset; i++) {
+			if (fputc(0, file) == EOF)
+				return false;
+		}
+		return count == 0 || fwrite(values, sizeof(float), (size_t)count, file) == count;
+	}
+
+	void Unfold(int layer) {
+		conv[layer] = base[layer];
+		folded = false;
+	}
+};
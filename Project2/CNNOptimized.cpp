@@ -1,86 +1,161 @@
 #pragma once
 #include "CNNBase.h"
 #include <vector>
+#include "ImageConvert.h"
+#include "ThreadPool.h"
 #include "face_binary_cls.h"
 using namespace std;
 
+/// <summary>
+/// Multi-threaded fp32 layers, also the base of the faster engines for the layers they do not replace.
+/// The weights are repacked once per layer so the hot loops read them linearly: 3x3 convolutions as OIhw8o,
+/// [output-channel block][input channel][tap][8 output channels], so one input pixel feeds 8 output channels
+/// of a vector; the fully connected layer as [8 features][output][8], so the features are read once for all
+/// outputs. The constructor packs conv_params[] and fc_params[]; other layers are packed by PrepareLayer or
+/// on first use, and again whenever they point to other weights. Tensor keeps them 64-byte aligned.
+/// </summary>
 class CNNOptimized : public CNNBase {
 
-public:
+private:
+	// Scratch buffer reused across calls.
+	Tensor paddedInput;
+	static const int RELU_GRAIN = 16384;	// floats per Relu task
+	static const int PACK_BLOCK = 8;	// output channels (convolution) / features (fully connected) per packed block
+
+	// Packed weights, one per layer: key is the conv_param / fc_param, source the weights they were packed from.
+	vector<const void*> packedKeys;
+	vector<const float*> packedSources;
+	vector<Tensor> packedWeights;
+	vector<float> fcSums;	// FullyConnectedLayer: [output][PACK_BLOCK] partial sums
+
+	size_t PackedLayer(const void* key) {
+		for (size_t i = 0; i < packedKeys.size(); i++) {
+			if (packedKeys[i] == key)
+				return i;
+		}
+		packedKeys.push_back(key);
+		packedSources.push_back(nullptr);
+		packedWeights.push_back(Tensor());
+		return packedKeys.size() - 1;
+	}
 
-	void GetClassName() {
-		cout << "CNNOptimized";
+protected:
+	/// <summary>
+	/// OIhw8o weights of a 3x3 layer; filters past out_channels are zero.
+	/// </summary>
+	const float* PackedWeights(const conv_param* cp) {
+		size_t layer = PackedLayer(cp);
+		if (packedSources[layer] != cp->p_weight) {
+			packedSources[layer] = cp->p_weight;
+			int in_channels = cp->in_channels;
+			int blocks = (cp->out_channels + PACK_BLOCK - 1) / PACK_BLOCK;
+			Tensor& packed = packedWeights[layer];
+			packed.create(blocks, in_channels, 9, PACK_BLOCK);
+			packed.setTo(0);
+			for (int f = 0; f < cp->out_channels; f++)
+			for (int ch = 0; ch < in_channels; ch++) {
+				const float* filter = cp->p_weight + ((size_t)f * in_channels + ch) * 9;
+				for (int k = 0; k < 9; k++)
+					packed.at(f / PACK_BLOCK, ch, k, f % PACK_BLOCK) = filter[k];
+			}
+		}
+		return packedWeights[layer].data();
 	}
+
 	/// <summary>
-	/// Image Normalization[Range 0.0 to 1.0] - using cv.converTo with 1/255.
+	/// Fully connected weights as [feature block][output][PACK_BLOCK]; features past in_features are zero.
 	/// </summary>
-	/// <param name="image"></param>
-	/// <returns></returns>
+	const float* PackedWeights(const fc_param* fcp) {
+		size_t layer = PackedLayer(fcp);
+		if (packedSources[layer] != fcp->p_weight) {
+			packedSources[layer] = fcp->p_weight;
+			int in_features = fcp->in_features;
+			int out_features = fcp->out_features;
+			int blocks = (in_features + PACK_BLOCK - 1) / PACK_BLOCK;
+			Tensor& packed = packedWeights[layer];
+			packed.create(1, blocks, out_features, PACK_BLOCK);
+			packed.setTo(0);
+			for (int o = 0; o < out_features; o++)
+			for (int i = 0; i < in_features; i++)
+				packed.at(0, i / PACK_BLOCK, o, i % PACK_BLOCK) = fcp->p_weight[(size_t)o * in_features + i];
+		}
+		return packedWeights[layer].data();
+	}
 
-	vector<vector<vector<float>>> MatToVector3d(Mat image) {
-		vector<vector<vector<float>>> imagePixels(3, vector<vector<float>>(image.rows, vector<float>(image.cols)));
+	/// <param name="pack">false: nothing is packed up front, for engines that replace the convolution and the
+	/// fully connected layer or pack only the layers they hand back (PackedWeights)</param>
+	explicit CNNOptimized(bool pack) {
+		for (size_t i = 0; pack && i < sizeof(conv_params) / sizeof(conv_params[0]); i++)
+			PackedWeights(&conv_params[i]);
+		for (size_t i = 0; pack && i < sizeof(fc_params) / sizeof(fc_params[0]); i++)
+			PackedWeights(&fc_params[i]);
+	}
 
-		for (int x = 0; x < image.rows; x++) {
-			for (int y = 0; y < image.cols; y++) {
-				Vec3b intensity = image.at<Vec3b>(x, y);
+public:
 
-				// red = 2; green = 1; blue = 0				
-				int blue = intensity.val[0];
-				int green = intensity.val[1];
-				int red = intensity.val[2];
+	CNNOptimized() : CNNOptimized(true) {}
 
-				//int sum = red + green + blue;
-				//cout << "C[" << x << "," << y << "]" << "|R[" << red << "]|G[" << green << "]|B[" << blue << "]" << endl;
-				//imagePixels[0][x][y] = sum == 0 ? 0 : (float)red / (float)sum; // R
-				//imagePixels[1][x][y] = sum == 0 ? 0 : (float)green / (float)sum; // G
-				//imagePixels[2][x][y] = sum == 0 ? 0 : (float)blue / (float)sum; // B
+	/// <summary>
+	/// (Re)pack the weights of a 3x3 layer.
+	/// </summary>
+	void PrepareLayer(const conv_param* cp) {
+		if (cp->kernel_size != CONVOLUTION_FILTER)
+			return;
+		packedSources[PackedLayer(cp)] = nullptr;
+		PackedWeights(cp);
+	}
 
-				imagePixels[0][x][y] = (float)red / 255; // R
-				imagePixels[1][x][y] = (float)green / 255; // G
-				imagePixels[2][x][y] = (float)blue / 255; // B
+	void GetClassName() {
+		cout << "CNNOptimized";
+	}
+	/// <summary>
+	/// Image Normalization[Range 0.0 to 1.0] - 16 pixels per step (AVX2): BGR bytes deinterleaved, widened and
+	/// scaled straight into the RGB planes.
+	/// </summary>
+	/// <param name="image"></param>
+	/// <returns></returns>
 
-				//cout << "imagePixels[0][y][x]:" << imagePixels[0][y][x] << "|imagePixels[1][y][x]:" << imagePixels[1][y][x]  << "|imagePixels[2][y][x]:" << imagePixels[2][y][x] << endl;
-			}
-		}
-		return imagePixels;
+	void MatToTensor(const Mat& image, Tensor& imagePixels) {
+		imagePixels.create(3, image.rows, image.cols);
+		image_to_planar(image, imagePixels.data(), image_unit_range());
 	}
 
-	vector<vector<vector<float>>> ConvolutionalLayer(vector<vector<vector<float>>> input, conv_param* cp) {
+	void ConvolutionalLayer(const Tensor& input, conv_param* cp, Tensor& output) {
 
 		// Initialize Input
-		vector<vector<vector<float>>> paddedInput = input;
+		const Tensor* source = &input;
 
 		// Calculate output dimension
 		int padding = cp->pad;
 		int padsize = 0;
 		int stride = cp->stride;
-		int ch_size = input.size(); // channel/kernel size 
-		int r_size = input[0].size(); // row
-		int c_size = input[0][0].size(); // column
+		int batch = input.batch(); // images
+		int ch_size = input.channels(); // channel/kernel size 
+		int r_size = input.rows(); // row
+		int c_size = input.cols(); // column
 
 		// Padding Required?
 		if (padding) {
 			padsize = 2;
-			// Add padding to input.
-			paddedInput.clear();
-			paddedInput.resize(ch_size, vector<vector<float>>(r_size + padsize, vector<float>(c_size + padsize)));
+			// Add padding to input (every channel).
+			paddedInput.create(batch, ch_size, r_size + padsize, c_size + padsize);
+			paddedInput.setTo(0);
 
-			for (int r = 0; r < r_size; r++)
+			for (int n = 0; n < batch; n++)
+			for (int ch = 0; ch < ch_size; ch++)
 			{
-				for (int c = 0; c < c_size; c++)
+				for (int r = 0; r < r_size; r++)
 				{
-					paddedInput[0][r + 1][c + 1] = input[0][r][c];
-					paddedInput[1][r + 1][c + 1] = input[1][r][c];
-					paddedInput[2][r + 1][c + 1] = input[2][r][c];
+					memcpy(paddedInput.ptr(n, ch, r + 1) + 1, input.ptr(n, ch, r), c_size * sizeof(float));
 				}
 			}
+			source = &paddedInput;
 		}
 
-		// Image is always a square
-		// Initialize the output dimension.
-		int row_size = paddedInput[0].size() - 2;
-		int col_size = paddedInput[0][0].size() - 2;
-		int dimension = (r_size - CONVOLUTION_FILTER + padsize) / stride + 1;
+		// Initialize the output dimensions (rows and cols differ for non-square inputs such as detection frames).
+		int col_size = source->cols() - 2;
+		int out_rows = (r_size - CONVOLUTION_FILTER + padsize) / stride + 1;
+		int out_cols = (c_size - CONVOLUTION_FILTER + padsize) / stride + 1;
 
 		// filters
 		int out_channels = cp->out_channels;
@@ -89,64 +164,73 @@ public:
 		// output 
 		// kernel size = out_channels;
 		// row and col = new calculated dimension based on padding and stride.
-		vector<vector<vector<float>>> output(out_channels, vector<vector<float>>(dimension, vector<float>(dimension)));
-
-#pragma omp parallel
-#pragma omp for
-		for (int f = 0; f < out_channels; f++)
+		output.create(batch, out_channels, out_rows, out_cols);
+
+		// One task per output row of a block of PACK_BLOCK filters, block outermost and image inside: the block's
+		// weights (in_channels x 9 x 8 floats, read in order) stay in L1 for the whole batch. Each filter of the
+		// block is a vector lane and sums its taps in the same order as a filter computed on its own.
+		const float* weights = PackedWeights(cp);
+		int blocks = (out_channels + PACK_BLOCK - 1) / PACK_BLOCK;
+		parallel_for(blocks * batch * out_rows, [&](int t)
 		{
-			int row = 0;
-			for (int r = 0; r < row_size; r += stride)
+			int block = t / (batch * out_rows);
+			int n = t / out_rows % batch;
+			int row = t % out_rows;
+			int r = row * stride;
+			int f0 = block * PACK_BLOCK;
+			int count = std::min(PACK_BLOCK, out_channels - f0);
+			const float* blockWeights = weights + (size_t)block * in_channels * 9 * PACK_BLOCK;
+			float* out[PACK_BLOCK];
+			for (int o = 0; o < count; o++)
+				out[o] = output.ptr(n, f0 + o, row);
+			int col = 0;
+			for (int c = 0; c < col_size; c += stride)
 			{
-				int col = 0;
-				for (int c = 0; c < col_size; c += stride)
+				float sum[PACK_BLOCK] = {};
+				for (int ch = 0; ch < in_channels; ch++)
 				{
-					float sum = 0;
-					for (int ch = 0; ch < in_channels; ch++)
-					{
-						int wIndex = f * (in_channels * 3 * 3) + ch * (3 * 3);
-
-						sum += (paddedInput[ch][r][c]			* cp->p_weight[wIndex + 0]) +
-							   (paddedInput[ch][r][c + 1]		* cp->p_weight[wIndex + 1]) +
-							   (paddedInput[ch][r][c + 2]		* cp->p_weight[wIndex + 2]) +
-							   (paddedInput[ch][r + 1][c]		* cp->p_weight[wIndex + 3]) +
-							   (paddedInput[ch][r + 1][c + 1]	* cp->p_weight[wIndex + 4]) +
-							   (paddedInput[ch][r + 1][c + 2]	* cp->p_weight[wIndex + 5]) +
-							   (paddedInput[ch][r + 2][c]		* cp->p_weight[wIndex + 6]) +
-							   (paddedInput[ch][r + 2][c + 1]	* cp->p_weight[wIndex + 7]) +
-							   (paddedInput[ch][r + 2][c + 2]	* cp->p_weight[wIndex + 8]);
+					const float* w = blockWeights + ch * 9 * PACK_BLOCK;
+					const float* r0 = source->ptr(n, ch, r) + c;
+					const float* r1 = source->ptr(n, ch, r + 1) + c;
+					const float* r2 = source->ptr(n, ch, r + 2) + c;
 
+					for (int o = 0; o < PACK_BLOCK; o++)
+					{
+						sum[o] += (r0[0] * w[0 * PACK_BLOCK + o]) +
+								  (r0[1] * w[1 * PACK_BLOCK + o]) +
+								  (r0[2] * w[2 * PACK_BLOCK + o]) +
+								  (r1[0] * w[3 * PACK_BLOCK + o]) +
+								  (r1[1] * w[4 * PACK_BLOCK + o]) +
+								  (r1[2] * w[5 * PACK_BLOCK + o]) +
+								  (r2[0] * w[6 * PACK_BLOCK + o]) +
+								  (r2[1] * w[7 * PACK_BLOCK + o]) +
+								  (r2[2] * w[8 * PACK_BLOCK + o]);
 					}
-					output[f][row][col] = sum + cp->p_bias[f]; // include bias
-					col++;
 				}
-				row++;
+				for (int o = 0; o < count; o++)
+					out[o][col] = sum[o] + cp->p_bias[f0 + o]; // include bias
+				col++;
 			}
-		}
-
-		return output;
+		});
 	}
 
-	vector<vector<vector<float>>> BatchNormalizationLayer(vector<vector<vector<float>>> input) {
-		int channels = input.size();
-		int row = input[0].size();
-		int col = input[0][0].size();
+	void BatchNormalizationLayer(Tensor& input) {
+		int planes = input.batch() * input.channels();	// statistics per image and channel
+		int row = input.rows();
+		int col = input.cols();
 		int dimension = row * col;
 
-#pragma omp parallel
-#pragma omp for
-		for (int ch = 0; ch < channels; ch++) {
+		// One plane per task; the plane itself is too small to split again.
+		parallel_for(planes, [&](int p) {
 			float sumMean = 0;
 			float mean = 0;
 			float sumVariance = 0;
 			float sqrtChannel = 0;
-			for (int r = 0; r < row; r++)
+			float* plane = input.data() + (size_t)p * dimension;
+			for (int i = 0; i < dimension; i++)
 			{
-				for (int c = 0; c < col; c++)
-				{
-					sumMean += input[ch][r][c];
-					sumVariance += input[ch][r][c] * input[ch][r][c];
-				}
+				sumMean += plane[i];
+				sumVariance += plane[i] * plane[i];
 			}
 
 			mean = sumMean / dimension;
@@ -155,123 +239,125 @@ public:
 			//cout <<"ch:" << ch << "mean:" << mean << ", variance:" << variance << endl;
 			// Back populate
 
-#pragma omp parallel
-#pragma omp for
-			for (int r = 0; r < row; r++)
+			for (int i = 0; i < dimension; i++)
 			{
-				for (int c = 0; c < col; c++)
-				{
-					// Formula: x* = (x - E[x]) / sqrt(var(x))
-					// x* new value of a single component
-					// E[x] - mean within the batch
-					// var(x) - variance within a batch (sqrt(var(x) - Standard Diviation))
-					input[ch][r][c] = (input[ch][r][c] - mean) / sqrtChannel;
-				}
+				// Formula: x* = (x - E[x]) / sqrt(var(x))
+				// x* new value of a single component
+				// E[x] - mean within the batch
+				// var(x) - variance within a batch (sqrt(var(x) - Standard Diviation))
+				plane[i] = (plane[i] - mean) / sqrtChannel;
 			}
-		}
-		return input;
+		});
 	}
 
-	vector<vector<vector<float>>> ActivationReluLayer(vector<vector<vector<float>>> input) {
-		int channels = input.size();
-		int row = input[0].size();
-		int col = input[0][0].size();
-#pragma omp parallel
-#pragma omp for
-		for (int ch = 0; ch < channels; ch++)
+	void ActivationReluLayer(Tensor& input) {
+		int size = input.total();
+		ThreadPool::Current().ParallelFor(size, RELU_GRAIN, [&](int begin, int end)
 		{
-			for (int r = 0; r < row; r++)
-			{
-				for (int c = 0; c < col; c++)
-				{
-					input[ch][r][c] = std::max((float)0, input[ch][r][c]);
-				}
-			}
-		}
-		return input;
+			for (int i = begin; i < end; i++)
+				input[i] = std::max((float)0, input[i]);
+		});
 	}
 
-	vector<vector<vector<float>>> MaxPoolingLayer(vector<vector<vector<float>>> input, int psize) {
-		int channels = input.size();
-		int row_size = input[0].size();
-		int col_size = input[0][0].size();
+	void MaxPoolingLayer(const Tensor& input, int psize, Tensor& output) {
+		int batch = input.batch();
+		int channels = input.channels();
+		int row_size = input.rows();
+		int col_size = input.cols();
 
-		// Get new dimension
-		int dimension = row_size / psize;
+		// Get new dimensions, a ragged last row / column is dropped
+		int out_rows = row_size / psize;
+		int out_cols = col_size / psize;
 		// channel size remains unchanged.
-		vector<vector<vector<float>>> output(channels, vector<vector<float>>(dimension, vector<float>(dimension)));
-#pragma omp parallel
-#pragma omp for
-		for (int ch = 0; ch < channels; ch++)
+		output.create(batch, channels, out_rows, out_cols);
+		parallel_for(batch * channels, [&](int p)
 		{
+			int n = p / channels;
+			int ch = p % channels;
 			int row = 0;
-			for (int r = 0; r < row_size; r += psize)
+			for (int r = 0; r + psize <= row_size; r += psize)
 			{
+				const float* in0 = input.ptr(n, ch, r);
+				float* out = output.ptr(n, ch, row);
 				int col = 0;
-				for (int c = 0; c < col_size; c += psize)
-				{
-					output[ch][row][col] = max(output[ch][row][col], input[ch][r][c]);
-					output[ch][row][col] = max(output[ch][row][col], input[ch][r][c + 1]);
-					output[ch][row][col] = max(output[ch][row][col], input[ch][r + 1][c]);
-					output[ch][row][col] = max(output[ch][row][col], input[ch][r + 1][c + 1]);
-					col++;
+				if (psize == 2) {
+					const float* in1 = input.ptr(n, ch, r + 1);
+					for (int c = 0; c + 2 <= col_size; c += 2)
+					{
+						out[col] = max(max(in0[c], in0[c + 1]), max(in1[c], in1[c + 1]));
+						col++;
+					}
 				}
-				row++;
-			}
-		}
-		return output;
-	}
-
-	vector<float> FlattenLayer(vector<vector<vector<float>>> input) {
-		int channels = input.size();
-		int row = input[0].size();
-		int col = input[0][0].size();
-		int dimension = channels * row * col;
-		vector<float> output(dimension);
-		int idx = 0;
-		for (int ch = 0; ch < channels; ch++)
-		{
-			for (int r = 0; r < row; r++)
-			{
-				for (int c = 0; c < col; c++)
-				{
-					output[idx++] = input[ch][r][c];
+				else {
+					// Any other window, seeded with its first element.
+					for (int c = 0; c + psize <= col_size; c += psize)
+					{
+						float block = in0[c];
+						for (int rb = 0; rb < psize; rb++)
+						{
+							const float* in = input.ptr(n, ch, r + rb) + c;
+							for (int cb = 0; cb < psize; cb++)
+								block = max(block, in[cb]);
+						}
+						out[col] = block;
+						col++;
+					}
 				}
+				row++;
 			}
-		}
-		return output;
+		});
 	}
 
-	vector<float> FullyConnectedLayer(vector<float> input, fc_param* fcp) {
+	void FullyConnectedLayer(const Tensor& input, fc_param* fcp, Tensor& fc_output) {
 		int in_features = fcp->in_features; // 2048
 		int out_features = fcp->out_features; // 2
 
-		vector<float> fc_output(out_features);
-		for (int o = 0; o < out_features; o++)
-		{
-			float sum = 0;
-			for (int i = 0; i < in_features; i++) {
-				//sum += input[i] * fcp->p_weight[o * out_features + i];
-				sum += input[i] * fcp->p_weight[(o * in_features) + i];
-				//cout << "sum:" << sum << "|input:" << i << "|" << input[i] << ",p_weight:" << o * out_features + i << "|" << fcp->p_weight[o * out_features + i] << endl;
+		int batch = input.batch();
+		int blocks = in_features / PACK_BLOCK;
+		int tail = in_features % PACK_BLOCK;
+
+		// One pass over the packed weights per image: every block of features is multiplied into PACK_BLOCK
+		// partial sums of each output, which are added up at the end.
+		const float* weights = PackedWeights(fcp);
+		fcSums.resize((size_t)out_features * PACK_BLOCK);
+		fc_output.create(batch, 1, 1, out_features);
+		for (int n = 0; n < batch; n++) {
+			const float* features = input.ptr(n, 0, 0);
+			float* sums = fcSums.data();
+			std::fill(fcSums.begin(), fcSums.end(), 0.f);
+			for (int b = 0; b < blocks; b++) {
+				const float* x = features + b * PACK_BLOCK;
+				const float* w = weights + (size_t)b * out_features * PACK_BLOCK;
+				for (int o = 0; o < out_features; o++)
+				for (int k = 0; k < PACK_BLOCK; k++)
+					sums[o * PACK_BLOCK + k] += x[k] * w[o * PACK_BLOCK + k];
+			}
+			const float* x = features + blocks * PACK_BLOCK;
+			const float* w = weights + (size_t)blocks * out_features * PACK_BLOCK;
+			for (int o = 0; o < out_features; o++) {
+				for (int k = 0; k < tail; k++)
+					sums[o * PACK_BLOCK + k] += x[k] * w[o * PACK_BLOCK + k];
+				float sum = 0;
+				for (int k = 0; k < PACK_BLOCK; k++)
+					sum += sums[o * PACK_BLOCK + k];
+				fc_output.at(n, 0, 0, o) = sum + fcp->p_bias[o];
 			}
-			fc_output[o] = sum + fcp->p_bias[o];
 		}
-
-		return fc_output;
 	}
 
-	vector<float> SoftMaxLayer(vector<float> input) {
-		int size = input.size();
-		float sum = 0;
-		vector<float> exponent(size);
-		for (int i = 0; i < size; i++) {
-			exponent[i] = exp(input[i]);
-			sum += exponent[i];
-		}
-		for (int i = 0; i < size; i++) {
-			input[i] = exponent[i] / sum;
+	void SoftMaxLayer(Tensor& input) {
+		// One distribution per image.
+		int size = input.total() / input.batch();
+		for (int n = 0; n < input.batch(); n++) {
+			float* scores = input.ptr(n, 0, 0);
+			float sum = 0;
+			for (int i = 0; i < size; i++) {
+				scores[i] = exp(scores[i]);
+				sum += scores[i];
+			}
+			for (int i = 0; i < size; i++) {
+				scores[i] = scores[i] / sum;
+			}
 		}
-		return input;
 	}
-};
\ No newline at end of file
+};
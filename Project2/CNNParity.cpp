@@ -0,0 +1,343 @@
+#pragma once
+#include "CNNBase.h"
+#include "CNNModel.h"
+#include "CNNPipeline.h"
+#include "face_binary_cls.h"
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <random>
+using namespace std;
+
+/// <summary>
+/// How far an engine's tensor is from the reference tensor.
+/// relative: largest absolute difference over the largest reference magnitude (the tensor's scale).
+/// ulps: largest distance in units in the last place, over elements of at least 1/1024 of the scale;
+///		values that cancel to almost zero have meaningless ulp counts.
+/// mismatches: elements that are neither within tolerance * scale nor within max_ulps of the reference.
+/// </summary>
+typedef struct parity_error {
+	float relative;
+	int64_t ulps;
+	size_t mismatches;
+}parity_error;
+
+/// <summary>
+/// Distance between two floats in representable values (0 when equal, +/-0 count as equal).
+/// </summary>
+inline int64_t float_ulps(float a, float b) {
+	if (a == b)
+		return 0;
+	if (std::isnan(a) || std::isnan(b))
+		return INT64_MAX;
+	int32_t ia, ib;
+	memcpy(&ia, &a, sizeof(ia));
+	memcpy(&ib, &b, sizeof(ib));
+	// Map the sign-magnitude encoding onto a monotonic integer line.
+	int64_t la = ia < 0 ? (int64_t)INT32_MIN - ia : ia;
+	int64_t lb = ib < 0 ? (int64_t)INT32_MIN - ib : ib;
+	return la > lb ? la - lb : lb - la;
+}
+
+/// <summary>
+/// Compare output against reference element by element; every element mismatches when the shapes differ.
+/// </summary>
+inline parity_error tensor_parity_error(const Tensor& reference, const Tensor& output, float tolerance, int64_t max_ulps) {
+	parity_error e = { 0, 0, 0 };
+	if (reference.batch() != output.batch() || reference.channels() != output.channels() ||
+		reference.rows() != output.rows() || reference.cols() != output.cols()) {
+		e.relative = INFINITY;
+		e.ulps = INT64_MAX;
+		e.mismatches = std::max(reference.total(), output.total());
+		return e;
+	}
+	size_t size = reference.total();
+	float scale = 0;
+	for (size_t i = 0; i < size; i++)
+		scale = std::max(scale, fabsf(reference[i]));
+	float absolute = scale > 0 ? tolerance * scale : tolerance;
+	float significant = scale / 1024;
+
+	float error = 0;
+	for (size_t i = 0; i < size; i++) {
+		float difference = fabsf(reference[i] - output[i]);
+		int64_t ulps = float_ulps(reference[i], output[i]);
+		if (!(difference <= absolute) && ulps > max_ulps)
+			e.mismatches++;
+		error = std::max(error, std::isnan(difference) ? INFINITY : difference);
+		if (fabsf(reference[i]) >= significant)
+			e.ulps = std::max(e.ulps, ulps);
+	}
+	e.relative = scale > 0 ? error / scale : error;
+	return e;
+}
+
+/// <summary>
+/// Uniform random values in [low, high), reproducible from the seed.
+/// </summary>
+inline void cnn_random_tensor(Tensor& tensor, int n, int c, int h, int w, unsigned seed, float low = -1.f, float high = 1.f) {
+	tensor.create(n, c, h, w);
+	mt19937 generator(seed);
+	uniform_real_distribution<float> distribution(low, high);
+	for (size_t i = 0; i < tensor.total(); i++)
+		tensor[i] = distribution(generator);
+}
+
+/// <summary>
+/// A copy of model with other max pooling sizes after its blocks, and a random fully connected layer sized for
+/// the resulting feature map (the trained one only fits the original geometry), so parity also covers pooling
+/// windows other than 2x2 and ragged rows / columns.
+/// </summary>
+/// <param name="fc_weights">receives the fully connected weights and bias the variant points to</param>
+/// <returns>false when the blocks do not chain with these pooling sizes</returns>
+inline bool cnn_pooling_variant(const CNNModel& model, const vector<int>& pool, CNNModel& variant, Tensor& fc_weights) {
+	if ((int)pool.size() != model.ConvLayers())
+		return false;
+	int rows = CNNModel::INPUT_SIZE;
+	for (int i = 0; i < model.ConvLayers(); i++) {
+		const conv_param& cp = model.conv[i];
+		rows = ((rows + 2 * cp.pad - cp.kernel_size) / cp.stride + 1) / std::max(1, pool[i]);
+		if (rows <= 0)
+			return false;
+	}
+	int in_features = model.conv.back().out_channels * rows * rows;
+	int out_features = model.fc.out_features;
+	variant.Replicate(model);
+	variant.pool = pool;
+	cnn_random_tensor(fc_weights, 1, 1, out_features + 1, in_features, 2050u, -0.05f, 0.05f);
+	variant.fc = { in_features, out_features, fc_weights.data(), fc_weights.ptr(0, 0, out_features) };
+	return true;
+}
+
+/// <summary>
+/// Tolerances and bookkeeping for one parity run. An element passes when it is within tolerance * scale
+/// of the reference or within max_ulps of it, so both reordered float sums on large values and tiny
+/// absolute differences pass; a check passes when no element mismatches.
+/// </summary>
+typedef struct parity_report {
+	float tolerance = 1e-4f;
+	float probability_tolerance = 0.1f;	// quantized engines: tolerance of the probabilities (see CNNBase::Quantized)
+	int64_t max_ulps = 64;
+	bool verbose = true;	// false: print failed checks only
+	int checks = 0;
+	int failures = 0;
+	float worst_relative = 0;
+	int64_t worst_ulps = 0;
+
+	parity_error Compare(const Tensor& reference, const Tensor& output) const {
+		return tensor_parity_error(reference, output, tolerance, max_ulps);
+	}
+
+	bool Record(const char* what, int layer, const parity_error& e) {
+		bool pass = e.mismatches == 0;
+		checks++;
+		failures += pass ? 0 : 1;
+		worst_relative = std::max(worst_relative, e.relative);
+		worst_ulps = std::max(worst_ulps, e.ulps);
+		if (verbose || !pass) {
+			string name = layer >= 0 ? what + to_string(layer) : what;
+			printf("%s relative error = %g ulps = %lld mismatches = %d %s\n", name.c_str(), e.relative,
+				(long long)e.ulps, (int)e.mismatches, pass ? "PASS" : "FAIL");
+		}
+		return pass;
+	}
+}parity_report;
+
+/// <summary>
+/// Compare every layer of an engine against the reference engine on one input tensor: each convolution,
+/// normalization, relu, pooling and block is fed the reference's input so errors do not compound.
+/// Then the whole chain (blocks, flatten, fully connected, softmax) is run by both engines from the same
+/// input and the scores compared.
+/// </summary>
+/// <param name="engine"></param>
+/// <param name="reference">normally CNNBruteforce</param>
+/// <param name="input">(n, 3, 128, 128) network input</param>
+/// <param name="report">tolerances, receives the results</param>
+/// <param name="model">folded model to check, null for per-image batch normalization</param>
+/// <returns>number of failed checks</returns>
+inline int cnn_parity_tensor(CNNBase* engine, CNNBase* reference, const Tensor& input, parity_report& report,
+	const CNNModel* model = nullptr) {
+	int failures = report.failures;
+	CNNModel defaults;
+	if (model == nullptr)
+		model = &defaults;
+	if (engine->Quantized()) {
+		// Layer outputs carry quantization error by design; only the probabilities are comparable.
+		CNNPipeline referencePipeline(reference, model);
+		CNNPipeline enginePipeline(engine, model);
+		Tensor expected = referencePipeline.ForwardTensor(input).clone();
+		report.Record("probabilities", -1,
+			tensor_parity_error(expected, enginePipeline.ForwardTensor(input), report.probability_tolerance, 0));
+		return report.failures - failures;
+	}
+	bool normalize = !model->BatchNormFolded();
+	Tensor activation = input.clone();
+	Tensor convolved, check, pooled;
+
+	for (int layer = 0; layer < model->ConvLayers(); layer++) {
+		int psize = model->pool[layer];
+		conv_param* cp = const_cast<conv_param*>(&model->conv[layer]);
+		// Layers the engine does not support run on the GENERAL engine in CNNPipeline.
+		bool supported = engine->SupportsConvolution(cp);
+		reference->PrepareLayer(cp);
+		reference->ConvolutionalLayer(activation, cp, convolved);
+		if (supported) {
+			engine->PrepareLayer(cp);
+			engine->ConvolutionalLayer(activation, cp, check);
+			report.Record("conv", layer, report.Compare(convolved, check));
+		}
+		else if (report.verbose) {
+			printf("conv%d not supported by the engine, skipped\n", layer);
+		}
+
+		// Separate layers, each on the reference's previous output.
+		if (normalize) {
+			check = convolved.clone();
+			reference->BatchNormalizationLayer(convolved);
+			engine->BatchNormalizationLayer(check);
+			report.Record("batchnorm", layer, report.Compare(convolved, check));
+		}
+		check = convolved.clone();
+		reference->ActivationReluLayer(convolved);
+		engine->ActivationReluLayer(check);
+		report.Record("relu", layer, report.Compare(convolved, check));
+		if (psize > 1) {
+			reference->MaxPoolingLayer(convolved, psize, pooled);
+			engine->MaxPoolingLayer(convolved, psize, check);
+			report.Record("maxpool", layer, report.Compare(pooled, check));
+		}
+		else {
+			pooled = convolved;
+		}
+
+		// Whole block (fused when the engine provides it).
+		if (supported) {
+			engine->ConvolutionalBlock(activation, cp, psize, normalize, check);
+			report.Record("block", layer, report.Compare(pooled, check));
+		}
+
+		activation = pooled.clone();
+	}
+
+	Tensor expected, scores;
+	fc_param* fc = const_cast<fc_param*>(&model->fc);
+	reference->FullyConnectedLayer(reference->FlattenLayer(activation), fc, expected);
+	engine->FullyConnectedLayer(engine->FlattenLayer(activation), fc, scores);
+	report.Record("fc", -1, report.Compare(expected, scores));
+	check = expected.clone();
+	reference->SoftMaxLayer(expected);
+	engine->SoftMaxLayer(check);
+	report.Record("softmax", -1, report.Compare(expected, check));
+
+	CNNPipeline referencePipeline(reference, model);
+	CNNPipeline enginePipeline(engine, model);
+	Tensor chained = referencePipeline.ForwardTensor(input).clone();
+	report.Record("scores", -1, report.Compare(chained, enginePipeline.ForwardTensor(input)));
+	return report.failures - failures;
+}
+
+/// <summary>
+/// Parity of one image: every layer on the reference's input tensor (cnn_parity_tensor). Input preprocessing (MatToTensor) is an engine's own choice -
+/// CNNPlayground zero-centers instead of scaling to [0, 1] - so its difference is printed, not checked.
+/// </summary>
+/// <param name="tolerance">relative tolerance</param>
+/// <param name="model">folded model to check, null for per-image batch normalization</param>
+/// <returns>number of failed checks</returns>
+inline int cnn_parity(CNNBase* engine, CNNBase* reference, const Mat& image, float tolerance,
+	const CNNModel* model = nullptr) {
+	parity_report report;
+	report.tolerance = tolerance;
+	Tensor input, engineInput;
+	reference->MatToTensor(image, input);
+	engine->MatToTensor(image, engineInput);
+	parity_error e = report.Compare(input, engineInput);
+	printf("input relative error = %g ulps = %lld (not checked)\n", e.relative, (long long)e.ulps);
+	return cnn_parity_tensor(engine, reference, input, report, model);
+}
+
+/// <summary>
+/// Parity suite: every engine in options against CNNBruteforce on every image and on random_inputs
+/// synthetic tensors (uniform in [-1, 1], negative inputs included), once with the model and once with 3x3 /
+/// 2x2 / no pooling (cnn_pooling_variant), plus one batch of all images through ClassifyBatch against the
+/// same engine one image at a time.
+/// Prints one summary line per engine and the failed checks.
+/// </summary>
+/// <param name="options">make_cnnbase choices; empty: every engine but the reference</param>
+/// <returns>total number of failed checks</returns>
+inline int cnn_parity_suite(vector<int> options, const vector<Mat>& images, int random_inputs,
+	float tolerance, int64_t max_ulps, const CNNModel* model = nullptr) {
+	if (options.empty()) {
+		for (int choice = 0;; choice++) {
+			CNNBase* cnn = CNNBase::make_cnnbase(choice);
+			if (cnn == nullptr)
+				break;
+			delete cnn;
+			if (choice != CNNBase::REFERENCE)
+				options.push_back(choice);
+		}
+	}
+	CNNModel defaults;
+	if (model == nullptr)
+		model = &defaults;
+	CNNModel pooling;
+	Tensor poolingFc;
+	vector<int> poolSizes(model->ConvLayers(), 1);
+	poolSizes[0] = 3;
+	if (poolSizes.size() > 1)
+		poolSizes[1] = 2;
+	bool variant = cnn_pooling_variant(*model, poolSizes, pooling, poolingFc);
+
+	CNNBase* reference = CNNBase::make_cnnbase(CNNBase::REFERENCE);
+	Tensor input;
+	vector<Tensor> inputs;
+	for (const Mat& image : images) {
+		reference->MatToTensor(image, input);
+		inputs.push_back(input.clone());
+	}
+	for (int i = 0; i < random_inputs; i++) {
+		cnn_random_tensor(input, 1, 3, CNNPipeline::INPUT_SIZE, CNNPipeline::INPUT_SIZE, 205u + i);
+		inputs.push_back(input.clone());
+	}
+
+	int failures = 0;
+	for (int choice : options) {
+		CNNBase* cnn = CNNBase::make_cnnbase(choice);
+		if (cnn == nullptr) {
+			printf("Invalid option %d\n", choice);
+			failures++;
+			continue;
+		}
+		parity_report report;
+		report.tolerance = tolerance;
+		report.max_ulps = max_ulps;
+		report.verbose = false;
+		for (size_t i = 0; i < inputs.size(); i++) {
+			if (cnn_parity_tensor(cnn, reference, inputs[i], report, model) > 0)
+				printf("  ^ input %d (%s)\n", (int)i, i < images.size() ? "image" : "random");
+			if (variant && cnn_parity_tensor(cnn, reference, inputs[i], report, &pooling) > 0)
+				printf("  ^ input %d (%s, pooling variant)\n", (int)i, i < images.size() ? "image" : "random");
+		}
+
+		// Batched scores must not depend on the batch they were computed in.
+		if (!images.empty()) {
+			CNNPipeline pipeline(cnn, model);
+			Tensor single((int)images.size(), 1, 1, 2);
+			for (size_t i = 0; i < images.size(); i++) {
+				const Tensor& scores = pipeline.Forward(images[i]);
+				single[2 * i] = scores[0];
+				single[2 * i + 1] = scores[1];
+			}
+			report.Record("batch", -1, report.Compare(single, pipeline.ClassifyBatch(images)));
+		}
+
+		cout << choice << ":";
+		cnn->GetClassName();
+		printf(" %d inputs, %d checks, %d failed, worst relative error %g, worst ulps %lld %s\n",
+			(int)inputs.size(), report.checks, report.failures, report.worst_relative,
+			(long long)report.worst_ulps, report.failures == 0 ? "PASS" : "FAIL");
+		failures += report.failures;
+		delete cnn;
+	}
+	delete reference;
+	return failures;
+}
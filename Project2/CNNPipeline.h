@@ -0,0 +1,349 @@
+#pragma once
+#include <string>
+#include <vector>
+#include "CNNBase.h"
+#include "CNNModel.h"
+#include "Tensor.h"
+#include "face_binary_cls.h"
+using namespace std;
+
+/// <summary>
+/// Runs the face classifier described by a CNNModel on a CNNBase implementation.
+/// The model is turned into a graph of nodes (MatToTensor, one convolution block per conv layer, Flatten,
+/// FullyConnected, SoftMax), so deeper or wider models loaded from a file run without code changes.
+/// Each node is dispatched to the engine when it supports the layer, otherwise to a GENERAL engine.
+/// Before the first run of a batch size the buffer lifetimes are planned and every intermediate tensor is
+/// placed in one preallocated arena (tensors whose lifetimes overlap never share memory), so a warm
+/// pipeline performs no heap allocation.
+/// Images of any other size than INPUT_SIZE x INPUT_SIZE are fitted (FitInput) before they enter the graph.
+/// The pipeline owns neither the engine nor the model; one pipeline/engine pair per thread.
+/// Without a model it runs the parameters of face_binary_cls.h with per-image batch normalization.
+/// </summary>
+class CNNPipeline {
+public:
+	static const int INPUT_SIZE = CNNModel::INPUT_SIZE;	// network input rows/cols
+
+	CNNPipeline(CNNBase* engine, const CNNModel* model = nullptr) : cnn(engine), model(model) {
+		if (this->model == nullptr)
+			this->model = &DefaultModel();
+		BuildGraph();
+	}
+
+	~CNNPipeline() {
+		delete general;
+	}
+
+	// values[] are views into this pipeline's arena.
+	CNNPipeline(const CNNPipeline&) = delete;
+	CNNPipeline& operator=(const CNNPipeline&) = delete;
+
+	/// <summary>
+	/// The image itself when it already is INPUT_SIZE x INPUT_SIZE, otherwise resized into scratch.
+	/// With crop only the centered square is used (aspect ratio kept) instead of stretching the whole image.
+	/// </summary>
+	static const Mat& FitInput(const Mat& image, Mat& scratch, bool crop = false) {
+		if (image.rows == INPUT_SIZE && image.cols == INPUT_SIZE)
+			return image;
+		Mat source = image;
+		if (crop) {
+			int side = std::min(image.rows, image.cols);
+			source = image(Rect((image.cols - side) / 2, (image.rows - side) / 2, side, side));
+		}
+		if (source.rows == INPUT_SIZE && source.cols == INPUT_SIZE)
+			source.copyTo(scratch);
+		else
+			resize(source, scratch, Size(INPUT_SIZE, INPUT_SIZE), 0, 0, INTER_AREA);
+		return scratch;
+	}
+
+	/// <summary>
+	/// Number of timed stages: MatToTensor, then one per graph node.
+	/// </summary>
+	int StageCount() const {
+		return (int)nodes.size() + 1;
+	}
+
+	const char* StageName(int stage) const {
+		return stage == 0 ? "MatToTensor" : nodes[stage - 1].name.c_str();
+	}
+
+	/// <summary>
+	/// Bytes of the intermediate tensor arena planned for the last batch size.
+	/// </summary>
+	size_t ArenaBytes() const {
+		return arena.total() * sizeof(float);
+	}
+
+	/// <summary>
+	/// Classify one image, returns the softmax scores (bg, face).
+	/// </summary>
+	/// <param name="image">BGR 8-bit image, resized by FitInput unless it is INPUT_SIZE x INPUT_SIZE</param>
+	/// <param name="stage_ms">optional, receives StageCount() timings in milliseconds</param>
+	/// <returns></returns>
+	const Tensor& Forward(const Mat& image, double* stage_ms = nullptr) {
+		TickMeter tm;
+		int stage = 0;
+		Plan(1);
+
+		// 1. Image pixel 3 channels, Mat3d Image is BGR
+		tm.start();
+		cnn->MatToTensor(FitInput(image, fitted), values[0]);
+		lap(tm, stage_ms, stage);
+
+		return Run(tm, stage_ms, stage);
+	}
+
+	/// <summary>
+	/// Classify a batch of images in one pass; every layer streams its weights once per batch.
+	/// </summary>
+	/// <param name="images">BGR 8-bit images, each resized by FitInput unless it is INPUT_SIZE x INPUT_SIZE</param>
+	/// <param name="stage_ms">optional, receives StageCount() timings in milliseconds for the whole batch</param>
+	/// <returns>(n, 1, 1, 2) softmax scores, row n = (bg, face) of images[n]</returns>
+	const Tensor& ClassifyBatch(const vector<Mat>& images, double* stage_ms = nullptr) {
+		TickMeter tm;
+		int stage = 0;
+		Plan((int)images.size());
+
+		tm.start();
+		cnn->MatsToTensor(FitInputs(images), values[0]);
+		lap(tm, stage_ms, stage);
+
+		return Run(tm, stage_ms, stage);
+	}
+
+	/// <summary>
+	/// Run the graph on an already converted (n, 3, INPUT_SIZE, INPUT_SIZE) tensor, e.g. a synthetic input.
+	/// The tensor is copied, the caller keeps it unchanged.
+	/// </summary>
+	/// <returns>the softmax scores, or an empty tensor when input has any other shape</returns>
+	const Tensor& ForwardTensor(const Tensor& input, double* stage_ms = nullptr) {
+		if (input.channels() != CNNModel::INPUT_CHANNELS || input.rows() != INPUT_SIZE || input.cols() != INPUT_SIZE) {
+			rejected = Tensor();
+			return rejected;
+		}
+		TickMeter tm;
+		int stage = 0;
+		Plan(input.batch());
+
+		tm.start();
+		values[0].create(input.batch(), input.channels(), input.rows(), input.cols());
+		memcpy(values[0].data(), input.data(), input.total() * sizeof(float));
+		lap(tm, stage_ms, stage);
+
+		return Run(tm, stage_ms, stage);
+	}
+
+private:
+	enum NodeType { NODE_CONV_BLOCK, NODE_FLATTEN, NODE_FULLY_CONNECTED, NODE_SOFTMAX };
+
+	// Node i reads values[input] and writes values[i + 1]; value 0 is the network input.
+	// Flatten (a view) and SoftMax (in place) write no memory of their own: their value shares its
+	// input's storage.
+	struct Node {
+		NodeType type;
+		int layer;		// conv layer of NODE_CONV_BLOCK
+		CNNBase* engine;
+		string name;
+	};
+
+	// Memory of one or more values, live from the step that writes it to the last step that reads it.
+	struct Storage {
+		size_t floats;
+		int first;
+		int last;
+		size_t offset;
+	};
+
+	CNNBase* cnn;
+	CNNBase* general = nullptr;	// runs the layers cnn does not support
+	const CNNModel* model;
+	vector<Node> nodes;
+	vector<int> storageOf;	// value -> storage
+	vector<Tensor> values;
+	Tensor arena;
+	int plannedBatch = 0;
+	Mat fitted;	// Forward input resized by FitInput
+	vector<Mat> fittedBatch;	// ClassifyBatch inputs, fitted where needed
+	vector<Mat> batchScratch;
+	Tensor rejected;	// ForwardTensor result for an input of the wrong shape
+
+	void BuildGraph() {
+		static const char* ordinals[] = { "1st", "2nd", "3rd" };
+		for (int i = 0; i < model->ConvLayers(); i++) {
+			const conv_param* cp = &model->conv[i];
+			CNNBase* engine = cnn;
+			if (!cnn->SupportsConvolution(cp)) {
+				if (general == nullptr)
+					general = CNNBase::make_cnnbase(CNNBase::GENERAL);
+				engine = general;
+			}
+			engine->PrepareLayer(cp);
+			string ordinal = i < 3 ? ordinals[i] : to_string(i + 1) + "th";
+			nodes.push_back({ NODE_CONV_BLOCK, i, engine, ordinal + " ConvolutionalLayer" });
+		}
+		nodes.push_back({ NODE_FLATTEN, -1, cnn, "FlattenLayer" });
+		nodes.push_back({ NODE_FULLY_CONNECTED, -1, cnn, "FullyConnectedLayer" });
+		nodes.push_back({ NODE_SOFTMAX, -1, cnn, "SoftMaxLayer" });
+	}
+
+	/// <summary>
+	/// Shapes, lifetimes and arena offsets of every value for a batch size. Offsets are assigned largest
+	/// storage first, each at the lowest 64-byte aligned offset that does not overlap a placed storage
+	/// with an overlapping lifetime; the arena only grows.
+	/// </summary>
+	void Plan(int batch) {
+		if (batch == plannedBatch)
+			return;
+		int count = (int)nodes.size() + 1;
+		vector<int> shape(4 * count);
+		vector<Storage> storages;
+		storageOf.assign(count, 0);
+
+		int channels = CNNModel::INPUT_CHANNELS, rows = INPUT_SIZE, cols = INPUT_SIZE;
+		storages.push_back({ (size_t)batch * channels * rows * cols, 0, 0, 0 });
+		SetShape(shape, 0, batch, channels, rows, cols);
+		for (int i = 0; i < (int)nodes.size(); i++) {
+			const Node& node = nodes[i];
+			int in = storageOf[i];
+			storages[in].last = i + 1;
+			if (node.type == NODE_CONV_BLOCK) {
+				const conv_param& cp = model->conv[node.layer];
+				int psize = model->pool[node.layer];
+				rows = ((rows + 2 * cp.pad - cp.kernel_size) / cp.stride + 1) / psize;
+				cols = ((cols + 2 * cp.pad - cp.kernel_size) / cp.stride + 1) / psize;
+				channels = cp.out_channels;
+			}
+			else if (node.type == NODE_FULLY_CONNECTED) {
+				channels = 1;
+				rows = 1;
+				cols = model->fc.out_features;
+			}
+			else if (node.type == NODE_FLATTEN) {
+				cols = channels * rows * cols;
+				channels = rows = 1;
+			}
+
+			if (node.type == NODE_FLATTEN || node.type == NODE_SOFTMAX) {
+				storageOf[i + 1] = in;
+			}
+			else {
+				storageOf[i + 1] = (int)storages.size();
+				storages.push_back({ (size_t)batch * channels * rows * cols, i + 1, i + 1, 0 });
+			}
+			SetShape(shape, i + 1, batch, channels, rows, cols);
+		}
+		// The scores are read by the caller after the last step.
+		storages[storageOf[count - 1]].last = count;
+
+		vector<int> order(storages.size());
+		for (size_t i = 0; i < order.size(); i++)
+			order[i] = (int)i;
+		sort(order.begin(), order.end(), [&](int a, int b) { return storages[a].floats > storages[b].floats; });
+		size_t arenaFloats = 0;
+		vector<int> placed;
+		for (int s : order) {
+			Storage& storage = storages[s];
+			size_t offset = 0;
+			for (bool moved = true; moved;) {
+				moved = false;
+				for (int p : placed) {
+					const Storage& other = storages[p];
+					bool alive = other.first <= storage.last && storage.first <= other.last;
+					bool overlap = other.offset < offset + storage.floats && offset < other.offset + other.floats;
+					if (alive && overlap) {
+						offset = AlignFloats(other.offset + other.floats);
+						moved = true;
+					}
+				}
+			}
+			storage.offset = offset;
+			placed.push_back(s);
+			arenaFloats = std::max(arenaFloats, offset + storage.floats);
+		}
+
+		if (arena.total() < arenaFloats)
+			arena.create(1, 1, 1, (int)arenaFloats);
+		values.resize(count);
+		for (int v = 0; v < count; v++) {
+			const Storage& storage = storages[storageOf[v]];
+			values[v] = Tensor::wrap(arena.data() + storage.offset, storage.floats,
+				shape[4 * v], shape[4 * v + 1], shape[4 * v + 2], shape[4 * v + 3]);
+		}
+		plannedBatch = batch;
+	}
+
+	/// <summary>
+	/// Every node on the batch in values[0].
+	/// </summary>
+	const Tensor& Run(TickMeter& tm, double* stage_ms, int& stage) {
+		bool normalize = !model->BatchNormFolded();
+		for (int i = 0; i < (int)nodes.size(); i++) {
+			const Node& node = nodes[i];
+			Tensor& input = values[i];
+			Tensor& output = values[i + 1];
+			switch (node.type) {
+			case NODE_CONV_BLOCK:
+				// Convolutional Layer (+ BatchNormalization unless folded, Relu, MaxPooling)
+				node.engine->ConvolutionalBlock(input, const_cast<conv_param*>(&model->conv[node.layer]),
+					model->pool[node.layer], normalize, output);
+				break;
+			case NODE_FLATTEN:
+				// Flatten Layer (zero-copy view)
+				output = node.engine->FlattenLayer(input);
+				break;
+			case NODE_FULLY_CONNECTED:
+				node.engine->FullyConnectedLayer(input, const_cast<fc_param*>(&model->fc), output);
+				break;
+			case NODE_SOFTMAX:
+				output = input;
+				node.engine->SoftMaxLayer(output);
+				break;
+			}
+			lap(tm, stage_ms, stage);
+		}
+		return values.back();
+	}
+
+	/// <summary>
+	/// images itself when every image already is INPUT_SIZE x INPUT_SIZE, otherwise FitInput of each one.
+	/// </summary>
+	const vector<Mat>& FitInputs(const vector<Mat>& images) {
+		bool sized = true;
+		for (const Mat& image : images)
+			sized = sized && image.rows == INPUT_SIZE && image.cols == INPUT_SIZE;
+		if (sized)
+			return images;
+		fittedBatch.resize(images.size());
+		batchScratch.resize(images.size());
+		for (size_t i = 0; i < images.size(); i++)
+			fittedBatch[i] = FitInput(images[i], batchScratch[i]);
+		return fittedBatch;
+	}
+
+	static void SetShape(vector<int>& shape, int value, int n, int c, int h, int w) {
+		shape[4 * value] = n;
+		shape[4 * value + 1] = c;
+		shape[4 * value + 2] = h;
+		shape[4 * value + 3] = w;
+	}
+
+	static size_t AlignFloats(size_t floats) {
+		size_t step = TENSOR_ALIGNMENT / sizeof(float);
+		return (floats + step - 1) / step * step;
+	}
+
+	static const CNNModel& DefaultModel() {
+		static const CNNModel defaults;
+		return defaults;
+	}
+
+	static void lap(TickMeter& tm, double* stage_ms, int& stage) {
+		if (stage_ms != nullptr) {
+			tm.stop();
+			stage_ms[stage] = tm.getTimeMilli();
+			tm.reset();
+			tm.start();
+		}
+		stage++;
+	}
+};
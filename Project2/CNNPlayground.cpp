@@ -1,19 +1,29 @@
 #pragma once
 #include "CNNBase.h"
 #include <vector>
+#include "ImageConvert.h"
 #include "face_binary_cls.h"
 using namespace std;
 
 class CNNPlayground : public CNNBase {
 
+private:
+	// Scratch buffer reused across calls.
+	Tensor paddedInput;
+
 public:
 
 	void GetClassName() {
 		cout << "CNNPlayground";
 	}
-	vector<vector<vector<float>>> MatToVector3d(Mat image) {
 
-		vector<vector<vector<float>>> imagePixels(3, vector<vector<float>>(image.rows, vector<float>(image.cols)));
+	// MatToTensor standardizes with the statistics of the whole image.
+	bool LocalFeatures() const {
+		return false;
+	}
+	void MatToTensor(const Mat& input, Tensor& imagePixels) {
+
+		imagePixels.create(3, input.rows, input.cols);
 		// Image Normalization
 		// 0.0 to 1.0 (range)
 		//image.convertTo(image, CV_32F, 1.f / 255, 0);
@@ -33,65 +43,52 @@ public:
 		//	}
 		//}
 
-		// zero-centered = -1.0 to 1.0 (range)
-		image.convertTo(image, CV_32F);
-		Scalar m, d;
-		meanStdDev(image, m, d);
-		image -= m;
-		image /= d;
-		for (int x = 0; x < image.rows; x++) {
-			for (int y = 0; y < image.cols; y++) {
-				Vec3f intensity = image.at<Vec3f>(x, y);
-				// red = 2; green = 1; blue = 0
-				float blue = intensity.val[0];
-				float green = intensity.val[1];
-				float red = intensity.val[2];
-
-				imagePixels[0][x][y] = (float)red; // R
-				imagePixels[1][x][y] = (float)green; // G
-				imagePixels[2][x][y] = (float)blue; // B
-			}
-		}
-		return imagePixels;
+		// zero-centered: (pixel - mean) / stddev per channel, statistics from one pass over the bytes,
+		// then a single fused conversion into the planes
+		image_to_planar(input, imagePixels.data(), image_standardized(input));
 	}
 
-	vector<vector<vector<float>>> ConvolutionalLayer(vector<vector<vector<float>>> input, conv_param* cp) {
+	void ConvolutionalLayer(const Tensor& input, conv_param* cp, Tensor& output) {
 
 		// Initialize Input
-		vector<vector<vector<float>>> paddedInput = input;
+		const Tensor* source = &input;
 
 		// Calculate output dimension
 		int padding = cp->pad;
 		int padsize = 0;
 		int stride = cp->stride;
 		//int stride = 1;
-		int ch_size = input.size(); // channel/kernel size 
-		int r_size = input[0].size(); // row
-		int c_size = input[0][0].size(); // column
+		int batch = input.batch(); // images
+		int ch_size = input.channels(); // channel/kernel size 
+		int r_size = input.rows(); // row
+		int c_size = input.cols(); // column
 
 		// Padding Required?
 		if (padding) {
 			padsize = 2;
-			// Add padding to input.
-			paddedInput.clear();
-			paddedInput.resize(ch_size, vector<vector<float>>(r_size + padsize, vector<float>(c_size + padsize)));
+			// Add padding to input (every channel).
+			paddedInput.create(batch, ch_size, r_size + padsize, c_size + padsize);
+			paddedInput.setTo(0);
 
-			for (int r = 0; r < r_size; r++)
+			for (int n = 0; n < batch; n++)
+			for (int ch = 0; ch < ch_size; ch++)
 			{
-				for (int c = 0; c < c_size; c++)
+				for (int r = 0; r < r_size; r++)
 				{
-					paddedInput[0][r + 1][c + 1] = input[0][r][c];
-					paddedInput[1][r + 1][c + 1] = input[1][r][c];
-					paddedInput[2][r + 1][c + 1] = input[2][r][c];
+					for (int c = 0; c < c_size; c++)
+					{
+						paddedInput.at(n, ch, r + 1, c + 1) = input.at(n, ch, r, c);
+					}
 				}
 			}
+			source = &paddedInput;
 		}
 
-		// Image is always a square
-		// Initialize the output dimension.
-		int row_size = paddedInput[0].size() - 2;
-		int col_size = paddedInput[0][0].size() - 2;
-		int dimension = (r_size - CONVOLUTION_FILTER + padsize) / stride + 1;
+		// Initialize the output dimensions (rows and cols differ for non-square inputs such as detection frames).
+		int row_size = source->rows() - 2;
+		int col_size = source->cols() - 2;
+		int out_rows = (r_size - CONVOLUTION_FILTER + padsize) / stride + 1;
+		int out_cols = (c_size - CONVOLUTION_FILTER + padsize) / stride + 1;
 
 		// filters
 		int out_channels = cp->out_channels;
@@ -100,61 +97,51 @@ public:
 		// output 
 		// kernel size = out_channels;
 		// row and col = new calculated dimension based on padding and stride.
-		vector<vector<vector<float>>> output(out_channels, vector<vector<float>>(dimension, vector<float>(dimension)));
+		output.create(batch, out_channels, out_rows, out_cols);
 
+		// Channel by channel over the whole output plane: a filter's nine taps are loaded once per input channel
+		// instead of once per output pixel. Every output still adds the channels up in order, then the bias.
+		for (int n = 0; n < batch; n++)
 		for (int f = 0; f < out_channels; f++)
 		{
-			int row = 0;
-			for (int r = 0; r < row_size; r += stride)
+			float* out = output.ptr(n, f, 0);
+			std::fill(out, out + out_rows * out_cols, 0.f);
+			for (int ch = 0; ch < in_channels; ch++)
 			{
-				int col = 0;
-				for (int c = 0; c < col_size; c += stride)
+				const float* kernel = cp->p_weight + ((size_t)f * in_channels + ch) * (3 * 3);
+				float kernel_oi_00 = kernel[0], kernel_oi_01 = kernel[1], kernel_oi_02 = kernel[2];
+				float kernel_oi_03 = kernel[3], kernel_oi_04 = kernel[4], kernel_oi_05 = kernel[5];
+				float kernel_oi_06 = kernel[6], kernel_oi_07 = kernel[7], kernel_oi_08 = kernel[8];
+				int row = 0;
+				for (int r = 0; r < row_size; r += stride)
 				{
-					float sum = 0;
-					for (int ch = 0; ch < in_channels; ch++)
+					const float* r0 = source->ptr(n, ch, r);
+					const float* r1 = source->ptr(n, ch, r + 1);
+					const float* r2 = source->ptr(n, ch, r + 2);
+					float* sums = out + row * out_cols;
+					int col = 0;
+					for (int c = 0; c < col_size; c += stride)
 					{
-						//cout << "f:" << f << "[" << r << "," << c << "] ch:" << ch << endl;
-						float kernel_oi_00 = cp->p_weight[f * (in_channels * 3 * 3) + ch * (3 * 3) + 0];
-						float kernel_oi_01 = cp->p_weight[f * (in_channels * 3 * 3) + ch * (3 * 3) + 1];
-						float kernel_oi_02 = cp->p_weight[f * (in_channels * 3 * 3) + ch * (3 * 3) + 2];
-						float kernel_oi_03 = cp->p_weight[f * (in_channels * 3 * 3) + ch * (3 * 3) + 3];
-						float kernel_oi_04 = cp->p_weight[f * (in_channels * 3 * 3) + ch * (3 * 3) + 4];
-						float kernel_oi_05 = cp->p_weight[f * (in_channels * 3 * 3) + ch * (3 * 3) + 5];
-						float kernel_oi_06 = cp->p_weight[f * (in_channels * 3 * 3) + ch * (3 * 3) + 6];
-						float kernel_oi_07 = cp->p_weight[f * (in_channels * 3 * 3) + ch * (3 * 3) + 7];
-						float kernel_oi_08 = cp->p_weight[f * (in_channels * 3 * 3) + ch * (3 * 3) + 8];
-						
-						/*cout << "paddedInput f:" << f << ", ch:" << ch << ", c:" << c << endl;
-						cout << paddedInput[ch][r][c] << "," << paddedInput[ch][r][c + 1] << "," << paddedInput[ch][r][c + 2] << endl;
-						cout << paddedInput[ch][r+1][c] << "," << paddedInput[ch][r+1][c + 1] << "," << paddedInput[ch][r+1][c + 2] << endl;
-						cout << paddedInput[ch][r+2][c] << "," << paddedInput[ch][r+2][c + 1] << "," << paddedInput[ch][r+2][c + 2] << endl;
-						*/
-						sum += (paddedInput[ch][r][c] * cp->p_weight[f * (in_channels * 3 * 3) + ch * (3 * 3) + 0]) +
-							   (paddedInput[ch][r][c + 1] * cp->p_weight[f * (in_channels * 3 * 3) + ch * (3 * 3) + 1]) +
-							   (paddedInput[ch][r][c + 2] * cp->p_weight[f * (in_channels * 3 * 3) + ch * (3 * 3) + 2]) +
-							   (paddedInput[ch][r + 1][c] * cp->p_weight[f * (in_channels * 3 * 3) + ch * (3 * 3) + 3]) +
-							   (paddedInput[ch][r + 1][c + 1] * cp->p_weight[f * (in_channels * 3 * 3) + ch * (3 * 3) + 4]) +
-							   (paddedInput[ch][r + 1][c + 2] * cp->p_weight[f * (in_channels * 3 * 3) + ch * (3 * 3) + 5]) +
-							   (paddedInput[ch][r + 2][c] * cp->p_weight[f * (in_channels * 3 * 3) + ch * (3 * 3) + 6]) +
-							   (paddedInput[ch][r + 2][c + 1] * cp->p_weight[f * (in_channels * 3 * 3) + ch * (3 * 3) + 7]) +
-							   (paddedInput[ch][r + 2][c + 2] * cp->p_weight[f * (in_channels * 3 * 3) + ch * (3 * 3) + 8]);
-
+						sums[col] += (r0[c] * kernel_oi_00) + (r0[c + 1] * kernel_oi_01) + (r0[c + 2] * kernel_oi_02) +
+							(r1[c] * kernel_oi_03) + (r1[c + 1] * kernel_oi_04) + (r1[c + 2] * kernel_oi_05) +
+							(r2[c] * kernel_oi_06) + (r2[c + 1] * kernel_oi_07) + (r2[c + 2] * kernel_oi_08);
+						col++;
 					}
-					output[f][row][col] = sum + cp->p_bias[f]; // include bias
-					col++;
+					row++;
 				}
-				row++;
 			}
+			for (int i = 0; i < out_rows * out_cols; i++)
+				out[i] += cp->p_bias[f]; // include bias
 		}
-
-		return output;
 	}
 
-	vector<vector<vector<float>>> BatchNormalizationLayer(vector<vector<vector<float>>> input) {
-		int channels = input.size();
-		int row = input[0].size();
-		int col = input[0][0].size();
+	void BatchNormalizationLayer(Tensor& input) {
+		int batch = input.batch();
+		int channels = input.channels();
+		int row = input.rows();
+		int col = input.cols();
 
+		for (int n = 0; n < batch; n++)
 		for (int ch = 0; ch < channels; ch++) {
 			float sumMean = 0;
 			float mean = 0;
@@ -164,8 +151,8 @@ public:
 			{
 				for (int c = 0; c < col; c++)
 				{
-					sumMean += input[ch][r][c];
-					sumVariance += input[ch][r][c] * input[ch][r][c];
+					sumMean += input.at(n, ch, r, c);
+					sumVariance += input.at(n, ch, r, c) * input.at(n, ch, r, c);
 				}
 			}
 
@@ -181,96 +168,84 @@ public:
 					// x* new value of a single component
 					// E[x] - mean within the batch
 					// var(x) - variance within a batch (sqrt(var(x) - Standard Diviation))
-					input[ch][r][c] = (input[ch][r][c] - mean) / sqrt(variance);
+					input.at(n, ch, r, c) = (input.at(n, ch, r, c) - mean) / sqrt(variance);
 				}
 			}
 		}
-		return input;
 	}
 
-	vector<vector<vector<float>>> ActivationReluLayer(vector<vector<vector<float>>> input) {
-		int channels = input.size();
-		int row = input[0].size();
-		int col = input[0][0].size();
+	void ActivationReluLayer(Tensor& input) {
+		int batch = input.batch();
+		int channels = input.channels();
+		int row = input.rows();
+		int col = input.cols();
 		//PrintMatrix(input);
+		for (int n = 0; n < batch; n++)
 		for (int ch = 0; ch < channels; ch++)
 		{
 			for (int r = 0; r < row; r++)
 			{
 				for (int c = 0; c < col; c++)
 				{
-					input[ch][r][c] = std::max((float)0, input[ch][r][c]);
+					input.at(n, ch, r, c) = std::max((float)0, input.at(n, ch, r, c));
 				}
 			}
 		}
-		return input;
 	}
 
-	vector<vector<vector<float>>> MaxPoolingLayer(vector<vector<vector<float>>> input, int psize) {
-		int channels = input.size();
-		int row_size = input[0].size();
-		int col_size = input[0][0].size();
+	void MaxPoolingLayer(const Tensor& input, int psize, Tensor& output) {
+		int batch = input.batch();
+		int channels = input.channels();
+		int row_size = input.rows();
+		int col_size = input.cols();
 
-		// Get new dimension
-		int dimension = row_size / psize;
+		// Get new dimensions, a ragged last row / column is dropped
+		int out_rows = row_size / psize;
+		int out_cols = col_size / psize;
 		// channel size remains unchanged.
-		vector<vector<vector<float>>> output(channels, vector<vector<float>>(dimension, vector<float>(dimension)));
+		output.create(batch, channels, out_rows, out_cols);
 
+		for (int n = 0; n < batch; n++)
 		for (int ch = 0; ch < channels; ch++)
 		{
 			int row = 0;
-			for (int r = 0; r < row_size; r += psize)
+			for (int r = 0; r + psize <= row_size; r += psize)
 			{
 				int col = 0;
-				for (int c = 0; c < col_size; c += psize)
+				for (int c = 0; c + psize <= col_size; c += psize)
 				{
-					output[ch][row][col] = max(output[ch][row][col], input[ch][r][c]);
-					output[ch][row][col] = max(output[ch][row][col], input[ch][r][c + 1]);
-					output[ch][row][col] = max(output[ch][row][col], input[ch][r + 1][c]);
-					output[ch][row][col] = max(output[ch][row][col], input[ch][r + 1][c + 1]);
+					// The whole psize x psize window, seeded with its first element.
+					float block = input.at(n, ch, r, c);
+					for (int rb = 0; rb < psize; rb++)
+					for (int cb = 0; cb < psize; cb++)
+						block = max(block, input.at(n, ch, r + rb, c + cb));
+					output.at(n, ch, row, col) = block;
 					col++;
 				}
 				row++;
 			}
 		}
-		return output;
-	}
-
-	vector<float> FlattenLayer(vector<vector<vector<float>>> input) {
-		int channels = input.size();
-		int row = input[0].size();
-		int col = input[0][0].size();
-		int dimension = channels * row * col;
-		vector<float> output(dimension);
-		int idx = 0;
-		for (int ch = 0; ch < channels; ch++)
-		{
-			for (int r = 0; r < row; r++)
-			{
-				for (int c = 0; c < col; c++)
-				{
-					output[idx++] = input[ch][r][c];
-				}
-			}
-		}
-		return output;
 	}
 
-	virtual vector<float> FullyConnectedLayer(vector<float> input, fc_param* fcp) {
+	virtual void FullyConnectedLayer(const Tensor& input, fc_param* fcp, Tensor& fc_output) {
 		int in_features = fcp->in_features; // 2048
 		int out_features = fcp->out_features; // 2
 
-		vector<float> fc_output(out_features);
+		int batch = input.batch();
+
+		fc_output.create(batch, 1, 1, out_features);
+		for (int n = 0; n < batch; n++)
 		for (int o = 0; o < out_features; o++)
 		{
 			float sum = 0;
+			const float* features = input.ptr(n, 0, 0);
 			for (int i = 0; i < in_features; i++) {
 				//sum += input[i] * fcp->p_weight[o * out_features + i];
-				float total = input[i] * fcp->p_weight[(o * in_features) + i];
+				float total = features[i] * fcp->p_weight[(o * in_features) + i];
 				sum += total;
 				//cout << "sum:" << sum << "|input:" << i << "|" << input[i] << ",p_weight:" << o * in_features + i << "|" << fcp->p_weight[o * in_features + i] << "total:" << total << endl;
 			}
-			fc_output[o] = sum + fcp->p_bias[o];
+			fc_output.at(n, 0, 0, o) = sum + fcp->p_bias[o];
 		}
 
 	/*	float fc2[2048] = { 0.02942623f,0.05557949f,0.05933608f,-0.0219665f,-0.03065135f,0.01354398f,0.005834009f,-0.07433262f,0.02827715f,0.134849f,-0.01307839f,0.09973481f,0.08799674f,0.01588307f,0.04516471f,-0.002777814f,-0.02684223f,0.1052907f,-0.04073292f,-0.2110659f,-0.1450933f,0.04845863f,0.1877238f,0.0729458f,0.03612129f,0.1704762f,0.05730895f,-0.09147632f,-0.09763868f,0.01926613f,0.106487f,0.03900253f,0.00166359f,-0.1351782f,-0.1523872f,-0.2501594f,-0.2246224f,-0.02801832f,-0.0629493f,0.002552459f,-0.01457565f,0.05548302f,0.026242f,-0.1704824f,-0.03694898f,0.09699369f,0.05550306f,0.05196703f,0.004186971f,0.05888769f,0.05087785f,-0.1087638f,0.01031905f,0.1847424f,0.07510267f,0.05771033f,-0.08621103f,-0.01637208f,0.0006687463f,0.03831339f,0.01954364f,-0.003650359f,0.01169771f,0.03614728f,0.1259041f,0.04097817f,0.1043486f,0.02623764f,0.07930665f,0.1825396f,0.09582291f,0.0974126f,-0.1592676f,0.06708534f,0.009854388f,0.176161f,-0.06405514f,0.05076354f,0.1871278f,0.1614562f,0.08898292f,0.02011174f,-0.120218f,-0.3346512f,-0.1693664f,0.186934f,0.2069891f,0.2058994f,-0.1911289f,0.1232036f,0.2087189f,-0.0716591f,-0.08126271f,0.04846434f,0.3650357f,0.05985394f,0.255525f,0.1532335f,0.01032615f,-0.0742486f,-0.06123836f,0.1530198f,0.07766233f,0.2555332f,0.09636816f,0.1068886f,0.0122971f,0.06210193f,0.07999385f,0.3664994f,0.1775445f,0.005041016f,0.1467924f,0.1829625f,0.3088399f,-0.1971559f,-0.1813323f,0.02489328f,0.1365616f,0.2739523f,-0.1532877f,-0.4414055f,-0.08285127f,-0.004858983f,-0.1780459f,0.2087877f,-0.1464075f,-0.01205389f,0.0006016393f,0.0333586f,0.09692249f,0.00553736f,0.01242277f,0.07125729f,-0.01340379f,0.05662486f,-0.0375473f,0.07094736f,0.1032486f,0.1525766f,-0.01868349f,-0.04740986f,-0.07453612f,-0.01050974f,-0.01728704f,0.002358278f,0.1603831f,-0.06404106f,-0.2226228f,-0.103496f,0.03771832f,-0.03604582f,0.01587537f,-0.03056936f,0.1236028f,0.05091495f,0.0362307f,0.008516017f,0.02345368f,0.05373818f,-0.002047541f,0.00513306f,-0.1642843f,-0.1820269f,-0.17787f,-0.2363822f,-0.09972435f,-0.04199655f,0.03766883f,0.006738927f,-0.1038089f,0.02699636f,0.02793047f,-0.08580218f,-0.04685863f,-0.09469685f,0.0114329f,0.002417357f,-0.02592863f,0.0446655f,-0.09491655f,-0.0631009f,-0.081563f,-0.04343805f,0.01547829f,-0.05205283f,-0.008737233f,0.03980106f,0.04884046f,0.06068451f,-0.09352826f,-0.05633622f,-0.02777297f,0.04388429f,0.1026086f,0.1400418f,0.1223779f,0.1515451f,0.05594622f,-0.1876689f,-0.0214013f,0.05198466f,0.02534521f,-0.199686f,-0.1755318f,0.2064028f,0.1431381f,0.08422916f,-0.1193073f,-0.01088751f,-0.1285656f,-0.05266319f,-0.1012939f,0.1797348f,-0.06082682f,-0.05568233f,-0.004781948f,0.01825959f,-0.08418577f,-0.1528501f,-0.1556837f,0.02828728f,0.04255137f,0.04104744f,0.04131568f,0.000821025f,0.008946791f,-0.1528408f,-0.1167226f,-0.03772934f,0.1615851f,-0.006800342f,0.01482365f,0.08900481f,0.1499049f,-0.05838234f,-0.1745777f,-0.08280084f,-0.03530383f,-0.1012126f,0.006604993f,0.1001974f,0.2000479f,0.09949484f,0.1809482f,0.1787603f,0.09931219f,-0.01879322f,0.004487576f,0.1896951f,0.07698164f,0.08619633f,0.1993307f,0.1772483f,0.08689922f,0.1369888f,0.0456914f,0.0303189f,0.1219851f,0.02178014f,-0.02228048f,-0.03219118f,0.08375798f,0.005378069f,0.108079f,0.05646971f,0.1220797f,0.02645851f,-0.01554487f,-0.03195791f,0.01239496f,-0.01068711f,-0.04090854f,-0.03465202f,-0.04705771f,-0.03199473f,-0.1019539f,-0.01274255f,0.009850132f,-0.0807197f,0.01137286f,0.02401243f,0.09432354f,-0.1961894f,-0.2570907f,-0.2054507f,-0.05895165f,-0.0167246f,0.0154276f,-0.1007763f,-0.05564072f,-0.1984328f,-0.1357165f,-0.1597408f,-0.113268f,-0.06048908f,-0.02846959f,-0.03170793f,-0.01701764f,-0.1212718f,-0.1424443f,0.08351456f,0.05509637f,-0.02298697f,0.1335657f,-0.02262537f,-0.1998592f,0.07124429f,0.166406f,0.1017186f,0.06456386f,-0.05449404f,0.07827689f,0.0212049f,-0.04296878f,0.01383337f,0.004887269f,0.1391197f,0.1574858f,0.04601351f,-0.005716179f,-0.02634214f,-0.04448621f,0.06203696f,0.03051848f,0.03099166f,-0.06851654f,-0.1156639f,0.06336577f,0.2024565f,0.09308717f,-0.05169407f,-0.02692949f,0.01775526f,0.1553767f,-0.1930853f,-0.09371078f,0.2128324f,0.1203166f,-0.2641774f,-0.1143204f,0.1785514f,0.1931612f,-0.2425109f,-0.145426f,0.06139401f,0.1030537f,0.1057912f,0.0732975f,0.112892f,0.09381807f,-0.05785463f,0.1413234f,0.05035157f,-0.05736298f,-0.168026f,-0.1438759f,-0.01863922f,0.01290833f,0.005371875f,0.002560969f,-0.08248992f,0.1073145f,-0.0006327501f,0.03900937f,0.08218358f,0.0367181f,-0.09947542f,-0.06509303f,0.0642053f,0.1510723f,0.1270891f,-0.08540286f,-0.05755117f,-0.06780867f,-0.1354315f,-0.002220179f,0.03807167f,0.04999632f,0.1198538f,0.2142699f,-0.01901934f,-0.1310664f,0.07781974f,-0.00709998f,0.09470701f,0.06545106f,0.03244597f,0.06919232f,0.05527291f,-0.0930274f,-0.1196328f,0.09145617f,0.1136109f,0.003667861f,-0.03952845f,0.1958661f,0.1315856f,-0.1096087f,-0.2872578f,0.002529386f,0.05586173f,0.07908355f,0.09588522f,0.09161092f,0.05271941f,0.0160134f,0.1484702f,-0.09798567f,0.1422944f,0.04149839f,-0.06003321f,-0.01807774f,0.1864069f,-0.02047196f,0.005286019f,-0.04423543f,0.03023546f,0.05249774f,0.01386489f,0.02212992f,-0.02719017f,0.04153939f,-0.0641655f,0.02715353f,0.03860641f,0.07550613f,0.139709f,0.09553083f,0.2032447f,0.01161762f,-0.1055433f,0.04611547f,-0.02139657f,0.03260237f,0.1017126f,0.06478912f,0.1019632f,-0.08545024f,-0.03323035f,-0.1958677f,-0.1023991f,0.09361254f,0.04512378f,0.01608483f,-0.08449602f,-0.1316892f,0.01711353f,-0.0257044f,0.06841552f,0.1004202f,0.06038233f,0.1132125f,0.1790125f,0.1117645f,0.003524585f,0.04551825f,0.2560068f,0.1490657f,-0.04958679f,-0.0206196f,0.1551429f,0.1869344f,-0.06330276f,-0.05767187f,0.07009096f,0.0603478f,-0.05741611f,-0.02908419f,0.1622725f,0.1957131f,-0.05197657f,-0.006447779f,-0.07856089f,0.03727359f,-0.04710921f,-0.07421819f,0.09388871f,0.07443302f,-0.092464f,0.1042286f,0.01333766f,0.05350486f,-0.1540138f,-0.2181861f,0.01023571f,-0.002967962f,-0.05151939f,0.03723377f,0.08621174f,-0.004624668f,-0.1554725f,-0.2122101f,-0.04179681f,-0.07913876f,-0.09694602f,-0.1209865f,0.04021036f,0.1382626f,0.1443506f,0.1245018f,-0.04460861f,-0.06599773f,-0.05522094f,-0.08140261f,0.03658722f,0.02596251f,0.0353666f,0.08359321f,0.01750854f,-0.06645472f,-0.07629652f,0.007167842f,0.03431381f,0.04155653f,0.1071737f,0.04286509f,0.07768187f,0.09290048f,0.001691905f,0.009906135f,-0.02535228f,0.06028782f,0.08610009f,-0.05359377f,0.1237553f,0.1079415f,0.01197237f,-0.04719105f,-0.01878149f,-0.06911141f,-0.04450037f,-0.0115482f,0.1290436f,0.01285179f,-0.05991351f,-0.02478231f,-0.02752385f,0.1164601f,0.06472083f,0.05473361f,0.1873132f,-0.03645821f,-0.1034984f,0.009116867f,0.07795586f,0.004597838f,-0.1390134f,-0.1024694f,-0.0191266f,-0.07552034f,-0.01911764f,0.003062753f,0.04438965f,0.07154522f,0.03246142f,-0.1834412f,-0.04487744f,0.1569089f,-0.1070866f,0.0803318f,0.02354683f,0.2366971f,0.1076816f,0.03838843f,0.1265063f,0.2121987f,0.08619276f,-0.008073198f,0.02658222f,0.04253664f,0.0794011f,0.09338918f,0.04634562f,0.1176022f,0.04980284f,0.01733045f,-0.02902438f,0.01771526f,-0.04132857f,-0.006889611f,0.03995296f,-0.05289632f,-0.0600534f,0.01543992f,0.1167542f,0.03912712f,0.01739295f,0.03742013f,0.06062278f,-0.05920638f,-0.1250178f,-0.03295147f,0.01615213f,0.06298877f,0.02365862f,-0.02045388f,-0.01038609f,0.008231785f,0.1154609f,-0.04356699f,-0.02502619f,0.09823921f,-0.002697111f,0.0386156f,0.09966363f,-0.07045455f,0.05462463f,0.02055362f,0.04275582f,0.05132999f,-0.09165961f,0.01865141f,-0.05099373f,-0.02868845f,0.05251444f,0.02040766f,-0.02192661f,0.03956886f,0.06220374f,0.03095055f,-0.04991655f,-0.00215561f,-0.0337873f,-0.007533003f,0.01440666f,0.01822705f,-0.05023973f,0.0517553f,0.03896805f,-0.08724061f,-0.03389622f,-0.06895696f,-0.03672711f,-0.0220398f,-0.04347265f,0.03064796f,-0.1727858f,-0.1425138f,0.05229873f,0.05678266f,0.1663622f,0.1372045f,0.04874712f,0.02863668f,0.1736608f,0.1470656f,0.1692163f,0.02169888f,0.1483699f,0.1347706f,0.01795354f,-0.04176976f,0.008869594f,0.09552702f,0.00897379f,-0.02714911f,0.007933003f,0.03152603f,0.03395558f,-0.03007995f,0.03225628f,0.07210658f,0.06055495f,0.03772951f,0.008036999f,0.04003078f,-0.02501101f,-0.03908512f,0.02121406f,-0.01671136f,-0.08732911f,0.08534133f,0.05703615f,-0.03830118f,-0.09010659f,-0.1040585f,-0.04449631f,-0.03812525f,-0.01470488f,-0.01394253f,0.006323154f,-0.024004f,-0.09666208f,-0.1170387f,-0.07996572f,-0.006532953f,-0.03675341f,-0.01485935f,-0.01916319f,0.07958855f,0.04964698f,-0.04099183f,-0.02650432f,-0.03971012f,-0.0222664f,0.02091732f,-0.03050706f,0.05109879f,0.08797532f,-0.004573696f,0.0002838472f,-0.08342866f,-0.03982191f,0.0292965f,0.03065765f,0.0501552f,0.06653403f,0.0766751f,0.1598803f,0.1282084f,0.096905f,0.08326834f,-0.001232834f,0.02559605f,0.07546197f,0.1965872f,0.117523f,-0.01858318f,0.1035669f,0.09152235f,0.1021009f,-0.05892949f,0.1882292f,0.05803973f,0.1138317f,0.07663026f,0.1347795f,0.0231756f,0.09916256f,0.04562437f,0.09421675f,0.02498944f,-0.02219714f,0.06191972f,-0.06460029f,0.03713991f,0.003548702f,0.0623215f,-0.07708234f,-0.08357442f,-0.1460662f,0.03947405f,0.009182329f,0.0603315f,-0.02413156f,0.01180855f,-0.04953207f,-0.03397451f,-0.2075391f,-0.008669173f,0.1815259f,0.05449472f,0.08573385f,0.05989238f,0.1692604f,0.0714221f,-0.02468168f,0.1069609f,0.2174202f,0.0739109f,0.1514742f,0.1593356f,0.1953443f,0.006723697f,-0.04071243f,0.01233017f,0.1317571f,0.004679172f,-0.03296952f,0.06802773f,-0.007517516f,0.01740117f,0.07744272f,0.01729683f,-0.1065494f,0.0004613253f,0.1067825f,0.01988725f,0.06426269f,0.08152622f,0.04858349f,-0.09375992f,-0.05639468f,-0.04665882f,0.01244736f,0.0337503f,0.1396804f,0.03909681f,0.006430228f,0.03616337f,0.1768693f,-0.06956337f,0.05790343f,0.0719991f,0.04241393f,0.02160839f,0.1323477f,-0.05814072f,0.04847145f,-0.02169977f,-0.01560906f,0.04060521f,-0.03414318f,0.1212826f,-0.008784404f,0.05602994f,0.02752323f,-0.007324918f,-0.004842782f,0.06211986f,0.01933833f,0.04048173f,-0.0234341f,0.01819381f,0.03534152f,0.01880735f,0.02837889f,0.002556646f,-0.08874097f,0.1234668f,0.05563352f,0.08750205f,-0.06244587f,-0.1248285f,-0.1271272f,0.01421018f,-0.1685481f,-0.05704809f,-0.07485089f,-0.09939097f,0.01926362f,0.0338512f,0.2139251f,0.1734737f,0.08466916f,-0.02376413f,-0.0118975f,0.09125773f,0.03420096f,0.02990149f,0.1249523f,0.09781007f,0.07987723f,0.04762577f,-0.02302229f,-0.03041596f,-0.08624107f,0.01342167f,0.04633342f,0.02834787f,0.005377537f,0.01744556f,0.03688252f,-0.04618755f,-0.04200454f,0.02182182f,0.1335695f,0.07397518f,0.130082f,0.005420541f,-0.004228451f,-0.1235689f,0.03833208f,0.04486697f,0.0777625f,-0.0597668f,-0.06118806f,-0.01845173f,-0.07262743f,-0.01942244f,-0.1496897f,0.001493769f,-0.05321927f,-0.01455351f,-0.08386144f,-0.01670688f,-0.05731121f,0.05942154f,-0.1306352f,0.005990571f,0.1216342f,0.1086092f,-0.0356211f,-0.06413221f,-0.05882f,-0.05425182f,-0.07824662f,0.02230368f,0.02452277f,0.09856933f,0.07343792f,-0.0005689407f,0.0199946f,-0.01587241f,-0.03672247f,0.1418564f,0.0400354f,0.01895696f,-0.04401818f,0.1173961f,0.1227089f,0.01354177f,0.04640096f,0.1908027f,0.1115665f,0.005063434f,0.09944002f,0.1770894f,0.159035f,-0.04088884f,0.005873013f,0.1120586f,-0.02274018f,0.128913f,0.1458675f,0.05207681f,0.1276023f,0.1474134f,0.1773853f,0.04159848f,0.08746801f,0.03421318f,0.09086285f,0.1663084f,0.2094681f,0.08505538f,0.03696059f,-0.007745239f,-0.04387793f,0.1381834f,0.1532803f,0.06424151f,0.01633049f,0.009299248f,0.006288534f,0.2116755f,0.0291003f,0.09256789f,-0.0272003f,0.05854061f,-0.00202892f,-0.0590901f,-0.05240143f,0.0698137f,0.001933118f,-0.04619024f,0.01543895f,-0.008031044f,-0.05449779f,0.06498519f,0.06814861f,-0.4883159f,0.1119084f,0.352755f,-0.01246237f,-0.0991822f,0.1451261f,-0.1157447f,0.1955274f,0.0505194f,0.03163168f,0.04348882f,-0.03283883f,-0.03365798f,-0.03483932f,-0.06647367f,-0.0005753608f,-0.000175911f,-0.02110037f,0.01365168f,0.1080762f,0.1487357f,-0.05845537f,-0.05948007f,-0.01950807f,-0.009849972f,-0.02364972f,0.01419181f,-0.0305853f,-0.07270838f,-0.1009969f,0.02291867f,-0.04184428f,-0.06677126f,-0.01726661f,0.1029654f,-0.01923798f,0.03102221f,-0.0435643f,-0.04029286f,-0.03061779f,-0.03433627f,-0.04410676f,-0.04533561f,-0.08312042f,-0.09023964f,-0.06899649f,-0.1388655f,-0.08521725f,-0.0004551184f,-0.003007917f,-0.1598804f,-0.0251144f,0.0386245f,0.07242635f,-0.05017941f,-0.07713187f,0.02370415f,0.06178777f,-0.06261268f,-0.02231877f,-0.06222006f,0.06928091f,-0.02675532f,-0.01970782f,0.006954669f,-0.05879396f,-0.005370385f,0.03504889f,0.009425111f,-0.004791188f,-0.0001982267f,-0.02279283f,-0.00444781f,-0.08912033f,-0.08679318f,0.009717443f,0.03196296f,0.01524198f,0.03666821f,0.08589669f,-0.03920323f,-0.1386803f,0.01668993f,-0.1155488f,-0.1054708f,-0.02640279f,-0.041492f,0.0008909095f,0.01241803f,-0.1167077f,0.03256254f,0.2259165f,0.155078f,-0.04813069f,-0.1891952f,-0.06457476f,-0.05252083f,-0.1507866f,-0.05657656f,0.07456123f,0.1055519f,-0.01890289f,-0.1298565f,-0.03261697f,0.0005985742f,0.1212748f,0.1441768f,0.2510648f,0.2271126f,0.03486266f,0.0772549f,-0.004666477f,0.03679777f,-0.05062817f,-0.01705438f,0.2042261f,0.04263073f,-0.1047278f,-0.07988779f,-0.08169998f,-0.004250336f,-0.02101569f,-0.04522867f,0.1112407f,-0.0294143f,-0.181719f,-0.1056709f,-0.05919804f,0.08872141f,0.01791702f,0.01791563f,-0.06913299f,-0.01995752f,-0.01107994f,0.01027017f,-0.001789654f,-0.141702f,-0.03609637f,-0.1163393f,-0.001767225f,-0.09056216f,-0.1929088f,-0.08838083f,-0.08461962f,0.195404f,-0.0927323f,-0.02375847f,-0.1844507f,0.06324904f,-0.05967877f,-0.1821008f,-0.1588171f,-0.08854822f,-0.02680453f,0.1088259f,0.3285368f,0.1315045f,-0.1978916f,-0.2073169f,-0.2071383f,0.166457f,-0.1202726f,-0.2241509f,0.07097153f,0.08380412f,-0.06370736f,-0.3429903f,-0.06690985f,-0.2848419f,-0.1715601f,0.0131321f,0.09996974f,0.06622849f,-0.1282877f,-0.09707085f,-0.2480403f,-0.07736736f,-0.1139888f,-0.0007128482f,-0.05039709f,-0.05797052f,-0.3658004f,-0.152866f,-0.03557606f,-0.1529871f,-0.1825735f,-0.318133f,0.2140105f,0.1585437f,-0.02929008f,-0.160532f,-0.3023239f,0.125022f,0.4644281f,0.06889542f,-0.02460517f,0.2029763f,-0.1734727f,0.1707051f,-0.002651616f,-0.02979658f,-0.01381588f,-0.07073918f,-0.003284153f,-0.01501773f,-0.06584083f,0.02785161f,-0.0460875f,0.01118181f,-0.04972343f,-0.09899852f,-0.1266655f,0.04442747f,0.08277405f,0.06493367f,0.01358374f,0.01142938f,0.01950536f,-0.1611894f,0.04853626f,0.2229555f,0.1081121f,-0.02171575f,0.03059751f,0.01020407f,0.03817718f,-0.1277819f,-0.06376877f,-0.0342786f,-0.002818112f,-0.06430101f,-0.04078913f,-0.007742366f,-0.006747522f,0.1262241f,0.1438366f,0.1862882f,0.2487477f,0.0861307f,0.03677309f,-0.002851147f,-0.01419368f,0.09870459f,-0.0492157f,-0.03317298f,0.07814427f,0.08327809f,0.1267041f,-0.02118335f,0.0111309f,0.03269075f,-0.04985824f,0.1156025f,0.05802032f,0.08208989f,0.05104767f,-0.01517332f,0.07460615f,0.022946f,-0.02272904f,-0.05918715f,-0.0615079f,0.0632022f,0.03166329f,0.05313408f,-0.05259778f,-0.1395625f,-0.151016f,-0.1128895f,-0.1173256f,-0.08566432f,0.1736297f,0.02762454f,-0.05631725f,-0.01940201f,0.2318901f,0.179068f,-0.2193622f,-0.110911f,-0.04658776f,0.1270116f,0.0109435f,0.09116276f,0.07394103f,0.1337744f,-0.1789116f,0.05495267f,0.05778294f,-0.001062991f,-0.01974042f,0.07334714f,0.1671612f,0.1453299f,-0.0573349f,-0.05261416f,-0.0582381f,-0.04543397f,0.0184466f,-0.01239351f,0.1492461f,0.1204021f,0.06931297f,-0.1905509f,-0.01320705f,-0.0335854f,-0.09220128f,-0.1510036f,0.0784795f,0.2024218f,0.08064791f,0.03692788f,0.0856322f,0.0128678f,-0.1102687f,-0.207321f,-0.1064638f,-0.1709789f,-0.1687725f,-0.1064867f,0.006269115f,0.005265176f,-0.19735f,-0.05277316f,-0.08548077f,-0.1758722f,-0.1776253f,-0.0917671f,-0.1172276f,-0.03969852f,-0.05656003f,-0.09962151f,0.00102819f,0.04376208f,0.06843901f,-0.07982825f,0.008171915f,-0.1088955f,-0.03457558f,-0.1231073f,-0.002639877f,-0.01063789f,0.04873882f,-0.0448974f,0.02408739f,0.05051604f,0.04529842f,0.05826583f,0.01900059f,0.09345682f,0.04843331f,-0.01064096f,0.05560349f,-0.02453178f,-0.0005425253f,-0.09877691f,0.1747727f,0.2767399f,0.1882821f,0.03670372f,0.0285811f,-0.01729236f,0.08300037f,0.06361656f,0.1938248f,0.1532857f,0.1550831f,0.1066937f,0.03408806f,0.02048141f,0.03639956f,0.004467861f,0.1032279f,0.1379421f,-0.05496735f,-0.04120344f,-0.003719924f,-0.1425716f,0.01862398f,0.1915955f,-0.0971829f,-0.1471713f,-0.07697471f,-0.04427655f,0.07017896f,-0.0852186f,-0.03929264f,0.07593747f,-0.02007186f,-0.003401551f,-0.131526f,-0.1211248f,-0.01800713f,0.01557655f,-0.009685593f,0.03514606f,-0.07322375f,-0.05774997f,-0.06476847f,0.02937721f,0.08419707f,-0.08585883f,-0.1704377f,-0.1097777f,0.06104676f,-0.0007638146f,-0.01431498f,-0.1326464f,0.1877701f,0.05703981f,-0.2155858f,-0.09245688f,0.2520837f,0.08959671f,-0.1569864f,-0.207438f,0.2500483f,0.1748658f,-0.0821971f,-0.111834f,-0.1067357f,-0.08019833f,-0.102482f,-0.09155007f,0.05564615f,-0.1488681f,-0.04476095f,0.0639163f,0.1482743f,0.150646f,0.001680234f,-0.01598084f,0.02115547f,0.0007227045f,0.08360458f,-0.1076434f,-0.01276412f,-0.045183f,-0.07370967f,-0.02410421f,0.1086091f,0.1011615f,-0.07112856f,-0.1552151f,-0.1117776f,0.06564946f,0.087611f,0.06975563f,0.09672735f,0.02485329f,-0.04961308f,-0.06923381f,-0.1315521f,-0.2272567f,0.03762386f,0.1449361f,-0.06476036f,-0.02697212f,-0.07716995f,-0.08900805f,-0.05065189f,-0.0686792f,-0.05467329f,0.07260559f,0.1003379f,-0.08095953f,-0.1205742f,-0.008527154f,0.0260174f,-0.1785363f,-0.1264319f,0.07981467f,0.2952465f,0.02586124f,-0.09766576f,-0.04530894f,-0.08832373f,-0.07978085f,-0.08866318f,0.01680714f,-0.1728213f,0.06293254f,-0.1234574f,-0.01169199f,0.05387198f,0.05312138f,-0.2105626f,-0.009054241f,0.0203196f,0.02074979f,-0.03438172f,-0.07181472f,-0.02495696f,-0.006806224f,0.03795194f,-0.04778549f,0.06203289f,-0.004928818f,-0.03913921f,-0.05456176f,-0.1337412f,-0.08469703f,-0.176146f,-0.0221586f,0.1126658f,-0.01690035f,0.0188721f,-0.0237211f,-0.1168638f,-0.07694682f,-0.109285f,0.07262139f,0.06422608f,0.1739004f,0.08795668f,-0.09676382f,-0.04427083f,-0.02804389f,0.06568681f,0.1373963f,-0.01828037f,0.03229028f,-0.0615395f,-0.1200864f,-0.05981009f,-0.1231745f,-0.1641795f,-0.09458078f,-0.004986335f,-0.02349615f,-0.2730394f,-0.1850014f,0.03511366f,0.02361768f,-0.1539428f,-0.1821261f,0.0410482f,0.03373102f,-0.08178584f,-0.05849436f,0.05170208f,0.04349476f,-0.1596417f,-0.1952918f,0.02551937f,0.03840116f,0.09682171f,-0.009594897f,0.04054774f,0.06767336f,-0.10043f,-0.04456418f,0.07986076f,-0.1011634f,-0.01886614f,-0.06650905f,0.1755728f,0.2251436f,-0.01253257f,0.01287982f,0.04872473f,-0.04674961f,-0.1146447f,-0.01496288f,0.1586514f,0.2177602f,0.07304872f,0.08257967f,0.08953923f,0.09941965f,-0.0727943f,-0.1293232f,-0.1539602f,-0.145543f,0.0232089f,0.08082501f,0.04685622f,0.05367348f,-0.02340914f,-0.05657803f,-0.02220191f,-0.08515581f,-0.007664183f,0.06370942f,0.09299839f,-0.004074003f,-0.04245528f,-0.04453164f,-0.1040413f,-0.04622453f,-0.1044446f,-0.09491882f,0.0006732091f,-0.01217985f,0.02998946f,-0.04426617f,-0.0823951f,0.08548014f,-0.1214347f,-0.1004001f,-0.03249861f,0.03640103f,-0.01885497f,0.0636667f,0.03578604f,-0.001198188f,-0.1268269f,0.01169119f,0.04136649f,0.01270192f,-0.003335881f,-0.1149158f,-0.08803359f,-0.03193572f,-0.1773102f,0.05866287f,0.09149286f,-0.003502632f,-0.08358087f,0.007885753f,0.126554f,0.1000195f,0.0334488f,0.06457548f,0.0597179f,-0.009941561f,-0.05702399f,-0.06500816f,-0.02543297f,0.1601738f,0.05528336f,-0.1560386f,0.1025616f,-0.0648445f,-0.003633361f,-0.2683314f,-0.1003616f,-0.06674092f,-0.1022817f,-0.1953519f,-0.1240058f,0.002954287f,-0.02616348f,-0.04637805f,-0.07800509f,-0.06438905f,-0.05070221f,-0.1490074f,-0.04662561f,0.003992975f,0.02350023f,-0.004642996f,0.06750272f,0.04041322f,-0.04186824f,0.05080536f,0.09116594f,-0.006505587f,-0.1258675f,-0.05345991f,-0.01086433f,-0.03207365f,-0.06246879f,0.0664601f,0.142366f,0.01059108f,-0.01877745f,-0.04973993f,-0.01172421f,0.02231881f,0.04846448f,0.02117847f,-0.1252372f,0.02720253f,0.01055886f,-0.05887963f,-0.01484584f,-0.02608601f,-0.08621295f,0.0667567f,-0.05643736f,-0.01517029f,-0.008525657f,-0.05484694f,0.1228494f,-0.01912787f,0.04892588f,0.03022497f,-0.05388793f,0.0204616f,0.01630112f,-0.03928407f,-0.07408454f,-0.03880916f,0.07297052f,0.02207456f,-0.006091938f,0.01368734f,-0.02633193f,-0.03110185f,0.04370746f,-0.07027615f,-0.03509885f,0.08696099f,0.06234904f,0.08773151f,0.01187417f,0.01534709f,0.04238883f,-0.04062913f,0.172603f,0.1278899f,-0.07507154f,-0.05831204f,-0.1690286f,-0.1393106f,-0.04282692f,-0.0553959f,-0.1645832f,-0.1234f,-0.1321454f,-0.02995569f,-0.1639496f,-0.09957704f,-0.004964462f,0.03771748f,-0.005745674f,-0.105045f,-0.00869998f,0.03894078f,0.01095876f,-0.02780175f,-0.03776967f,0.03183338f,0.007409294f,-0.04164599f,-0.05939142f,0.001990661f,0.004532801f,-0.07516677f,-0.00117225f,0.01709357f,0.01467726f,-0.009497616f,0.08827552f,-0.0991956f,-0.05519206f,0.007280349f,0.05522612f,0.1112176f,0.062156f,0.06192336f,-0.003669795f,0.03147694f,-0.01555282f,0.04810518f,0.09048361f,0.1175925f,0.0828594f,0.004467683f,0.02846171f,0.03604798f,0.02818019f,-0.0716329f,-0.04349822f,0.02463195f,0.03666572f,0.04038763f,0.007657632f,0.002600728f,0.03113691f,-0.06199209f,-0.1015725f,0.008428734f,-0.001146989f,0.1099478f,0.05749806f,-0.06286611f,-0.04889847f,-0.04072269f,-0.04966748f,-0.06799831f,-0.1560874f,-0.1301307f,-0.06447376f,-0.05208873f,0.01290383f,0.00235841f,-0.06210669f,-0.2001098f,-0.08480988f,0.01137348f,-0.1341987f,-0.08166876f,-0.09130741f,0.05268645f,-0.1632567f,-0.06859858f,-0.1092039f,-0.105319f,-0.1655583f,-0.007415987f,-0.08988478f,-0.0480786f,-0.0897766f,-0.02861367f,0.03024987f,-0.07404358f,0.08097016f,-0.007903873f,-0.007892325f,-0.05015362f,0.06636924f,0.08030412f,0.142062f,-0.009386062f,-0.02719506f,-0.05917086f,-0.01139123f,-0.01971714f,0.02239418f,0.04410838f,0.242154f,-0.02805543f,-0.1698645f,-0.06239235f,-0.08603732f,-0.07357604f,-0.1975725f,-0.07275703f,0.01894001f,-0.09858384f,-0.2107236f,-0.0835897f,-0.1543117f,-0.1388144f,-0.1969307f,-0.03242598f,0.03148277f,-0.0325362f,-0.1097485f,-0.01609588f,0.04690439f,-0.06985693f,-0.002084273f,-0.0541673f,-0.07687384f,0.002269483f,0.1086841f,-0.005504676f,-0.1044749f,-0.04828223f,-0.05539086f,-0.0735757f,-0.03766867f,0.06047574f,0.04496464f,0.02825214f,-0.02765926f,-0.04823906f,-0.147968f,-0.02746509f,-0.002724803f,-0.00334577f,-0.1655837f,0.07234511f,-0.05392243f,-0.03184342f,-0.05195507f,-0.02695253f,-0.1232588f,0.06470309f,-0.04978018f,0.01779052f,0.01947148f,-0.02102011f,0.0004203192f,-0.1141495f,0.008482905f,-0.05909225f,-0.007184533f,0.03799878f,-0.02770483f,-0.04690398f,-0.04690345f,-0.06061229f,-0.004735475f,-0.002004639f,0.003092215f,-0.006379396f,-0.005895328f,0.02163061f,0.09680834f,-0.1084454f,-0.06748671f,-0.06685789f,0.02489788f,0.1194616f,0.1415019f,-0.01010773f,0.1446527f,0.07372352f,0.07423639f,0.09371917f,-0.006967372f,-0.02229871f,-0.2027487f,-0.1659458f,-0.08575933f,0.03853066f,0.01302843f,-0.07292181f,-0.02798235f,-0.02785178f,-0.1244318f,-0.08505646f,-0.07879867f,-0.0320368f,-0.004017198f,0.02395909f,0.05305667f,-0.04188786f,-0.02407379f,-0.04642428f,0.004460485f,-0.001193815f,-0.007773924f,0.0447213f,0.01838884f,-0.02225028f,-0.1307821f,-0.09049883f,-0.1555202f,0.001752115f,-0.006908287f,0.1024757f,-0.06057797f,-0.02390636f,-0.08265662f,0.07327443f,0.05440865f,0.0420711f,0.1106437f,0.02020482f,0.1345403f,-0.01229844f,0.05199865f,0.02038155f,0.05954487f,0.02581535f,0.06876034f,-0.03711051f,0.1335637f,-0.01783726f,-0.09262527f,-0.07838283f,0.02686968f,0.06852859f,0.06418113f,0.07905571f,0.09464829f,-0.02476219f,0.000299065f,-0.1024348f,-0.08186001f,0.02496921f,0.01028843f,0.0535602f,0.03340898f,-0.1367726f,-0.01380847f,-0.02728633f,0.038113f,-0.1145493f,-0.1525294f,-0.04425374f,-0.07534369f,-0.1775874f,-0.1216586f,-0.03266724f,-0.1246316f,-0.1754752f,-0.1658195f,0.07050867f,0.009420003f,-0.1164122f,-0.002131045f,-0.152573f,-0.1481982f,-0.0292261f,-0.1000655f,-0.1462906f,-0.1644434f,-0.05479571f,-0.1066912f,-0.03922966f,-0.0971351f,-0.166013f,-0.2107095f,-0.08173112f,-0.03441051f,0.03244135f,0.06763122f,-0.1678938f,-0.1604607f,-0.0863808f,-0.006266787f,-0.03984927f,-0.01138942f,-0.1755641f,-0.026197f,-0.1206243f,0.04444046f,-0.05258389f,0.0004616735f,0.08347259f,0.06723171f,-0.07027566f,-0.005536893f,0.05930805f,-0.01505984f,0.01605447f,0.0494685f,-0.07985713f,-0.07353378f,0.5052158f,-0.1287261f,-0.3450533f,0.01605221f,0.09943399f,-0.1444292f,0.1496042f,-0.205029f,-0.05399173f,-0.0347787f,-0.07529579f,0.02798771f,0.03009214f,0.05125305f,0.0434121f,-0.003480752f,-0.01177701f,0.02402982f,-0.009737376f,-0.1269054f,-0.1417342f,0.04675733f,0.04218437f,0.025782f,0.014836f,0.006625698f,-0.03282965f,0.01268508f,0.1039199f,0.1246988f,-0.02244736f,0.04869328f,0.06626987f,0.03392596f,-0.08697837f,0.004297411f,-0.04687312f,0.03952556f,0.05974365f,0.02842643f,0.03141991f,0.02541655f,0.04007832f,0.09066728f,0.0762737f,0.07716361f,0.148244f,0.06785431f,-0.01068557f,0.004336781f,0.1559074f,0.007633609f,-0.008952198f,-0.0767483f,0.02573159f,0.08758171f,-0.05018577f,-0.0398327f,0.0697628f,0.01569001f,0.06386314f,-0.06948037f,0.03015338f,0.01748361f,0.01496004f,0.07715467f,0.007627833f,-0.02858118f,-0.02056864f,-0.0241967f,0.01100828f,0.03259157f };
@@ -289,21 +264,21 @@ public:
 			cout << "sum:" << sum << "|input:" << i << "|" << input[i] << ",p_weight:" << i << "|" << fc2[i] << "total:" << total << endl;
 		}
 		fc_output[1] = sum + fcp->p_bias[1];*/
-
-		return fc_output;
 	}
 
-	vector<float> SoftMaxLayer(vector<float> input) {
-		int size = input.size();
-		float sum = 0;
-		vector<float> exponent(size);
-		for (int i = 0; i < size; i++) {
-			exponent[i] = exp(input[i]);
-			sum += exponent[i];
-		}
-		for (int i = 0; i < size; i++) {
-			input[i] = exponent[i] / sum;
+	void SoftMaxLayer(Tensor& input) {
+		// One distribution per image.
+		int size = input.total() / input.batch();
+		for (int n = 0; n < input.batch(); n++) {
+			float* scores = input.ptr(n, 0, 0);
+			float sum = 0;
+			for (int i = 0; i < size; i++) {
+				scores[i] = exp(scores[i]);
+				sum += scores[i];
+			}
+			for (int i = 0; i < size; i++) {
+				scores[i] = scores[i] / sum;
+			}
 		}
-		return input;
 	}
 };
\ No newline at end of file
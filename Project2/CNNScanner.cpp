@@ -0,0 +1,309 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "CNNBase.h"
+#include "CNNModel.h"
+#include "CNNPipeline.h"
+#include "ImageDecode.h"
+#include "MPMCQueue.h"
+#include "NumaReplica.h"
+#include "ThreadPool.h"
+using namespace std;
+
+/// <summary>
+/// Classifies a list of image files with a two-stage thread pipeline:
+///		producer -> [paths] -> decoders (ImageDecoder) -> [images] -> workers (own engine + pipeline) -> [results] -> writer
+/// All stages hand jobs over through bounded lock-free MPMC queues, so decoding of the next images overlaps
+/// inference of the current ones. The workers are tasks of the global ThreadPool, the same threads their
+/// layers run on: while every worker has an image the layers stay on their own thread, and once the queue
+/// runs dry the idle threads steal the layer tiles of the images still in flight. The calling thread writes one CSV or JSONL record per file, either in
+/// input order (a small reorder buffer) or as soon as each result is ready; the id field is the input index.
+/// Given NUMA replicas, every node gets its own decoders, image queue and workers (one per CPU of the node, on
+/// its pool and model replica): the decoders of a node take the next path from the shared queue and hand the
+/// image to that node's workers, so an image is decoded, inferred and its activations kept on one node, and
+/// faster nodes simply take more paths.
+/// </summary>
+class CNNScanner {
+public:
+	enum Format { FORMAT_CSV, FORMAT_JSONL };
+
+	/// <param name="option">make_cnnbase choice, one engine per worker</param>
+	/// <param name="model">shared read-only by all workers</param>
+	/// <param name="crop">fit images by their centered square (see CNNPipeline::FitInput)</param>
+	/// <param name="replicas">route the images to these NUMA nodes (model and workers are theirs), decoders
+	/// split among them; empty: workers on the global pool</param>
+	CNNScanner(int option, const CNNModel* model, int workers, int decoders, Format format, bool ordered, FILE* out,
+		bool crop = false, const vector<NumaReplica*>& replicas = {})
+		: option(option), format(format), ordered(ordered), out(out), crop(crop),
+		paths(QUEUE_CAPACITY), results(QUEUE_CAPACITY) {
+		decoders = std::max(1, decoders);
+		if (replicas.empty()) {
+			routes.emplace_back(new ScanRoute(nullptr, model, std::max(1, workers), decoders));
+			return;
+		}
+		int count = (int)replicas.size();
+		for (int i = 0; i < count; i++) {
+			int share = std::max(1, decoders / count + (i < decoders % count ? 1 : 0));
+			routes.emplace_back(new ScanRoute(replicas[i], replicas[i]->Model(), replicas[i]->Concurrency(), share));
+		}
+	}
+
+	/// <summary>
+	/// Workers over every node.
+	/// </summary>
+	int Workers() const {
+		int count = 0;
+		for (const unique_ptr<ScanRoute>& route : routes)
+			count += route->workers;
+		return count;
+	}
+
+	/// <summary>
+	/// Decode threads over every node.
+	/// </summary>
+	int Decoders() const {
+		int count = 0;
+		for (const unique_ptr<ScanRoute>& route : routes)
+			count += route->decoders;
+		return count;
+	}
+
+	/// <summary>
+	/// Image files below a directory (recursive), sorted.
+	/// </summary>
+	static vector<string> ListDirectory(const string& directory) {
+		vector<String> files;
+		glob(directory, files, true);
+		vector<string> images;
+		for (const String& file : files) {
+			size_t dot = file.find_last_of('.');
+			if (dot == string::npos)
+				continue;
+			string extension = file.substr(dot + 1);
+			for (char& c : extension)
+				c = (char)tolower((unsigned char)c);
+			if (extension == "jpg" || extension == "jpeg" || extension == "png" || extension == "bmp")
+				images.push_back(file);
+		}
+		sort(images.begin(), images.end());
+		return images;
+	}
+
+	/// <summary>
+	/// One path per line, blank lines skipped.
+	/// </summary>
+	static vector<string> ReadList(const string& listFile) {
+		vector<string> files;
+		ifstream list(listFile);
+		string line;
+		while (getline(list, line)) {
+			if (!line.empty() && line.back() == '\r')
+				line.pop_back();
+			if (!line.empty())
+				files.push_back(line);
+		}
+		return files;
+	}
+
+	/// <summary>
+	/// Classify every file and write the records.
+	/// </summary>
+	/// <returns>number of files that could not be classified</returns>
+	int Run(const vector<string>& files) {
+		WriteHeader();
+
+		vector<thread> threads;
+		threads.emplace_back(&CNNScanner::Produce, this, std::cref(files));
+		for (const unique_ptr<ScanRoute>& owned : routes) {
+			ScanRoute* route = owned.get();
+			route->liveDecoders = route->decoders;
+			NumaReplica* replica = route->replica;
+			for (int i = 0; i < route->decoders; i++) {
+				if (replica != nullptr)
+					threads.push_back(replica->Launch([this, route] { Decode(*route); }));
+				else
+					threads.emplace_back(&CNNScanner::Decode, this, std::ref(*route));
+			}
+			if (replica != nullptr) {
+				threads.push_back(replica->Launch([this, route, replica] {
+					replica->RunWorkers([this, route](int) { Infer(*route); });
+				}));
+			}
+			else {
+				threads.emplace_back([this, route] {
+					ThreadPool::Global().ParallelFor(route->workers, 1, [this, route](int begin, int end) {
+						for (int i = begin; i < end; i++)
+							Infer(*route);
+					});
+				});
+			}
+		}
+
+		int errors = 0;
+		long next = 0;
+		map<long, ScanJob> pending;
+		for (size_t received = 0; received < files.size(); received++) {
+			ScanJob job;
+			results.Pop(job);
+			errors += job.error.empty() ? 0 : 1;
+			if (!ordered) {
+				WriteRecord(job);
+				continue;
+			}
+			pending[job.id] = std::move(job);
+			for (auto it = pending.find(next); it != pending.end(); it = pending.find(++next)) {
+				WriteRecord(it->second);
+				pending.erase(it);
+			}
+		}
+		fflush(out);
+
+		for (thread& t : threads)
+			t.join();
+		return errors;
+	}
+
+private:
+	static const int QUEUE_CAPACITY = 256;
+
+	// One file on its way through the stages; id -1 tells a stage to stop.
+	struct ScanJob {
+		long id = -1;
+		string path;
+		Mat image;
+		string error;
+		float bg = 0;
+		float face = 0;
+	};
+
+	// The decoders and workers of one node and the queue between them.
+	struct ScanRoute {
+		NumaReplica* replica;	// null: the global pool
+		const CNNModel* model;
+		int workers;
+		int decoders;
+		MPMCQueue<ScanJob> images;
+		atomic<int> liveDecoders;
+
+		ScanRoute(NumaReplica* replica, const CNNModel* model, int workers, int decoders)
+			: replica(replica), model(model), workers(workers), decoders(decoders), images(QUEUE_CAPACITY) {}
+	};
+
+	int option;
+	Format format;
+	bool ordered;
+	FILE* out;
+	bool crop;
+	MPMCQueue<ScanJob> paths;
+	MPMCQueue<ScanJob> results;
+	vector<unique_ptr<ScanRoute>> routes;	// the queues do not move
+
+	void Produce(const vector<string>& files) {
+		for (size_t i = 0; i < files.size(); i++) {
+			ScanJob job;
+			job.id = (long)i;
+			job.path = files[i];
+			paths.Push(std::move(job));
+		}
+		for (int i = 0; i < Decoders(); i++)
+			paths.Push(ScanJob());
+	}
+
+	void Decode(ScanRoute& route) {
+		// Reduced-resolution decode + fit here, so only input-sized images are queued.
+		ImageDecoder decoder(crop);
+		for (;;) {
+			ScanJob job;
+			paths.Pop(job);
+			if (job.id < 0)
+				break;
+			job.image = decoder.Read(job.path).clone();
+			if (job.image.empty())
+				job.error = "cannot decode";
+			route.images.Push(std::move(job));
+		}
+		// The last decoder of the node out stops its workers.
+		if (--route.liveDecoders == 0) {
+			for (int i = 0; i < route.workers; i++)
+				route.images.Push(ScanJob());
+		}
+	}
+
+	void Infer(ScanRoute& route) {
+		CNNBase* cnn = CNNBase::make_cnnbase(option);
+		CNNPipeline pipeline(cnn, route.model);
+		for (;;) {
+			ScanJob job;
+			route.images.Pop(job);
+			if (job.id < 0)
+				break;
+			if (job.error.empty()) {
+				const Tensor& scores = pipeline.Forward(job.image);
+				job.bg = scores[0];
+				job.face = scores[1];
+			}
+			job.image.release();
+			results.Push(std::move(job));
+		}
+		delete cnn;
+	}
+
+	void WriteHeader() {
+		if (format == FORMAT_CSV)
+			fprintf(out, "id,path,bg,face,error\n");
+	}
+
+	void WriteRecord(const ScanJob& job) {
+		if (format == FORMAT_CSV) {
+			if (job.error.empty())
+				fprintf(out, "%ld,%s,%g,%g,\n", job.id, CsvField(job.path).c_str(), job.bg, job.face);
+			else
+				fprintf(out, "%ld,%s,,,%s\n", job.id, CsvField(job.path).c_str(), job.error.c_str());
+		}
+		else {
+			if (job.error.empty())
+				fprintf(out, "{\"id\":%ld,\"path\":\"%s\",\"bg\":%g,\"face\":%g}\n", job.id, JsonString(job.path).c_str(), job.bg, job.face);
+			else
+				fprintf(out, "{\"id\":%ld,\"path\":\"%s\",\"error\":\"%s\"}\n", job.id, JsonString(job.path).c_str(), job.error.c_str());
+		}
+	}
+
+	static string CsvField(const string& value) {
+		if (value.find_first_of(",\"\r\n") == string::npos)
+			return value;
+		string quoted = "\"";
+		for (char c : value) {
+			if (c == '"')
+				quoted += '"';
+			quoted += c;
+		}
+		return quoted + "\"";
+	}
+
+	static string JsonString(const string& value) {
+		string escaped;
+		for (char c : value) {
+			if (c == '"' || c == '\\') {
+				escaped += '\\';
+				escaped += c;
+			}
+			else if ((unsigned char)c < 0x20) {
+				char code[8];
+				snprintf(code, sizeof(code), "\\u%04x", c);
+				escaped += code;
+			}
+			else {
+				escaped += c;
+			}
+		}
+		return escaped;
+	}
+};
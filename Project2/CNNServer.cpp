@@ -0,0 +1,197 @@
+#pragma once
+#include <algorithm>
+#include <cerrno>
+#include <csignal>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <new>
+#include <string>
+#include <vector>
+#include "CNNBase.h"
+#include "CNNModel.h"
+#include "CNNPipeline.h"
+#include "ImageDecode.h"
+#include "LatencyStats.h"
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#else
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+using namespace std;
+
+/// <summary>
+/// Long-running classifier: the engine, model and pipeline buffers stay warm between requests.
+/// Requests are text lines on stdin or on a Unix domain socket:
+///		&lt;image path&gt;			classify a file
+///		bytes &lt;N&gt;			followed by N bytes of an encoded image (jpg, png, ...), at most MAX_BYTES;
+///							a larger N is refused and ends the connection without reading the body
+///		quit				end this connection (stdin: shut down)
+///		shutdown			shut the server down
+/// Every request gets one line back: "&lt;name&gt; bg:&lt;p&gt; face:&lt;p&gt; &lt;ms&gt;ms" or "&lt;name&gt; error:&lt;reason&gt;".
+/// Images are decoded at reduced resolution and fitted to the input size (ImageDecoder).
+/// Latency percentiles (decode + inference) are reported on shutdown.
+/// </summary>
+class CNNServer {
+public:
+	static const long MAX_BYTES = 64L << 20;	// largest encoded image a bytes request may send
+
+	CNNServer(CNNBase* engine, const CNNModel* model, bool crop = false) : pipeline(engine, model), decoder(crop) {}
+
+	/// <summary>
+	/// Serve stdin until end of input, quit or shutdown.
+	/// </summary>
+	void ServeStdin() {
+#ifdef _WIN32
+		_setmode(_fileno(stdin), _O_BINARY);
+#endif
+		Serve(stdin, stdout);
+		Report();
+	}
+
+	/// <summary>
+	/// Accept connections on a Unix domain socket, one at a time, until a client sends shutdown.
+	/// </summary>
+	/// <returns>false when the socket cannot be created</returns>
+	bool ServeSocket(const string& path) {
+#ifdef _WIN32
+		fprintf(stderr, "Unix domain sockets are not supported on this platform\n");
+		return false;
+#else
+		int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+		sockaddr_un address = {};
+		address.sun_family = AF_UNIX;
+		if (listener < 0 || path.size() >= sizeof(address.sun_path)) {
+			fprintf(stderr, "Cannot create socket %s\n", path.c_str());
+			if (listener >= 0)
+				close(listener);
+			return false;
+		}
+		strcpy(address.sun_path, path.c_str());
+		unlink(path.c_str());
+		if (bind(listener, (sockaddr*)&address, sizeof(address)) != 0 || listen(listener, 8) != 0) {
+			fprintf(stderr, "Cannot listen on %s: %s\n", path.c_str(), strerror(errno));
+			close(listener);
+			return false;
+		}
+		fprintf(stderr, "Listening on %s\n", path.c_str());
+		// A client hanging up mid-response must not kill the server.
+		signal(SIGPIPE, SIG_IGN);
+
+		while (!stopped) {
+			int connection = accept(listener, nullptr, nullptr);
+			if (connection < 0)
+				break;
+			FILE* in = fdopen(connection, "rb");
+			FILE* out = fdopen(dup(connection), "wb");
+			if (in != nullptr && out != nullptr)
+				Serve(in, out);
+			if (in != nullptr)
+				fclose(in);
+			else
+				close(connection);
+			if (out != nullptr)
+				fclose(out);
+		}
+		close(listener);
+		unlink(path.c_str());
+		Report();
+		return true;
+#endif
+	}
+
+private:
+	CNNPipeline pipeline;
+	ImageDecoder decoder;
+	vector<double> latencies;
+	vector<unsigned char> encoded;
+	bool stopped = false;
+
+	void Serve(FILE* in, FILE* out) {
+		string line;
+		while (!stopped && ReadLine(in, line)) {
+			if (line.empty())
+				continue;
+			if (line == "quit")
+				break;
+			if (line == "shutdown") {
+				stopped = true;
+				break;
+			}
+
+			TickMeter tm;
+			tm.start();
+			string name = line;
+			bool inline_bytes = line.rfind("bytes ", 0) == 0;
+			if (inline_bytes) {
+				name = "bytes";
+				long size = atol(line.c_str() + 6);
+				if (size <= 0) {
+					fprintf(out, "%s error:invalid size\n", name.c_str());
+					fflush(out);
+					continue;
+				}
+				if (size > MAX_BYTES) {
+					// The body is left unread, so the rest of the stream cannot be parsed as requests.
+					fprintf(out, "%s error:too large\n", name.c_str());
+					break;
+				}
+				encoded.resize(size);
+				if (fread(encoded.data(), 1, size, in) != (size_t)size) {
+					fprintf(out, "%s error:truncated\n", name.c_str());
+					break;
+				}
+			}
+			// One bad request (allocation, OpenCV decode failure) must not take the server down.
+			try {
+				Respond(out, name, inline_bytes ? decoder.Decode(encoded) : decoder.Read(line), tm);
+			}
+			catch (const bad_alloc&) {
+				fprintf(out, "%s error:out of memory\n", name.c_str());
+				fflush(out);
+			}
+			catch (const exception& e) {
+				fprintf(stderr, "%s: %s\n", name.c_str(), e.what());
+				fprintf(out, "%s error:internal\n", name.c_str());
+				fflush(out);
+			}
+		}
+		fflush(out);
+	}
+
+	void Respond(FILE* out, const string& name, const Mat& image, TickMeter& tm) {
+		if (image.empty()) {
+			fprintf(out, "%s error:cannot decode\n", name.c_str());
+			fflush(out);
+			return;
+		}
+		const Tensor& scores = pipeline.Forward(image);
+		tm.stop();
+		double ms = tm.getTimeMilli();
+		latencies.push_back(ms);
+		fprintf(out, "%s bg:%g face:%g %.3fms\n", name.c_str(), scores[0], scores[1], ms);
+		fflush(out);
+	}
+
+	static bool ReadLine(FILE* in, string& line) {
+		line.clear();
+		int c;
+		while ((c = fgetc(in)) != EOF && c != '\n')
+			line += (char)c;
+		if (!line.empty() && line.back() == '\r')
+			line.pop_back();
+		return c != EOF || !line.empty();
+	}
+
+	void Report() {
+		if (latencies.empty()) {
+			fprintf(stderr, "requests: 0\n");
+			return;
+		}
+		fprintf(stderr, "requests: %d ", (int)latencies.size());
+		print_latency(stderr, latency_summary(latencies));
+	}
+};
@@ -0,0 +1,754 @@
+#pragma once
+#include "CNNBase.h"
+#include "CNNOptimized.cpp"
+#include "CpuFeatures.h"
+#include "HalfFloat.h"
+#include "ThreadPool.h"
+#include "face_binary_cls.h"
+#ifdef CNN_X86
+#include <immintrin.h>
+#endif
+using namespace std;
+
+/// <summary>
+/// Everything a 3x3 kernel needs for one convolution.
+/// The input is "prepared" once per layer: zero padded, rows widened so whole vectors can be loaded past the
+/// last output column, and for stride 2 every row split into its even and odd columns. Output column ox then
+/// always reads src_row[col_offset[kx] + ox], i.e. contiguous loads for both strides.
+/// </summary>
+typedef struct conv3x3_job {
+	const void* src;		// prepared input, [in_channels][padded rows][row_stride] of the storage type
+	size_t plane_stride;	// floats per prepared channel
+	int row_stride;			// floats per prepared row
+	int col_offset[3];		// offset of kernel column kx inside a prepared row
+	int stride;
+	int in_channels;
+	int out_channels;
+	int out_cols;
+	const void* weight;		// storage type, see conv3x3_block_weights
+	int weight_ic_stride;	// elements between the filters of consecutive input channels
+	int weight_q_stride;	// elements between the filters of consecutive output channels of a block
+	size_t weight_block_stride;	// elements per output-channel block
+	const float* bias;
+} conv3x3_job;
+
+/// <summary>
+/// A kernel computes one output row for a block of (up to) 4 output channels starting at oc0,
+/// writing channel oc0 + q to dst + q * dst_plane.
+/// </summary>
+typedef void (*conv3x3_kernel)(const conv3x3_job& job, int oc0, int oy, float* dst, size_t dst_plane);
+
+static const int CONV3X3_OC_BLOCK = 4;
+static const int CONV3X3_COL_ALIGN = 32; // widest column step of any kernel (avx512: 2 x 16)
+static const int CONV3X3_BAND_ROWS = 8; // convolution rows per ConvolutionalBlock task, even (whole pooling windows)
+static const int CONV3X3_BLOCK_TAPS = 40; // 16-bit weights: 4 x 9 taps of one input channel, padded to 8
+
+/// <summary>
+/// Element access of the prepared input and the weights in one storage format; the kernels are templates over it.
+/// Load8 / Load16 widen 8 / 16 consecutive values to floats, Taps returns the 9 weights of a 3x3 filter as
+/// floats and BlockTaps those of the 4 filters of a block for one input channel. Weights of every storage
+/// format are packed [block][input channel][CONV3X3_BLOCK_TAPS], so the 36 taps a block needs per input channel
+/// are contiguous; fp32 taps are read in place, 16-bit ones widened with a few 8-wide conversions.
+/// </summary>
+struct conv3x3_fp32 {
+	typedef float type;
+	static float Value(const float* p) { return *p; }
+	static const float* Taps(const float* k, float* taps) { return k; }
+#ifdef CNN_X86
+	CNN_TARGET_AVX2 static void BlockTaps(const float* const w[4], size_t offset, float* taps, const float* k[4]) {
+		for (int q = 0; q < CONV3X3_OC_BLOCK; q++)
+			k[q] = w[q] + offset;
+	}
+	CNN_TARGET_AVX2 static __m256 Load8(const float* p) { return _mm256_loadu_ps(p); }
+	CNN_TARGET_AVX512 static __m512 Load16(const float* p) { return _mm512_loadu_ps(p); }
+#endif
+};
+
+struct conv3x3_fp16 {
+	typedef uint16_t type;
+	static float Value(const uint16_t* p) { return fp16_to_float(*p); }
+	static const float* Taps(const uint16_t* k, float* taps) {
+		for (int t = 0; t < 9; t++)
+			taps[t] = fp16_to_float(k[t]);
+		return taps;
+	}
+#ifdef CNN_X86
+	CNN_TARGET_AVX2 static __m256 Load8(const uint16_t* p) { return _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)p)); }
+	CNN_TARGET_AVX2 static void BlockTaps(const uint16_t* const w[4], size_t offset, float* taps, const float* k[4]) {
+		for (int i = 0; i < CONV3X3_BLOCK_TAPS; i += 8)
+			_mm256_storeu_ps(taps + i, Load8(w[0] + offset + i));
+		for (int q = 0; q < CONV3X3_OC_BLOCK; q++)
+			k[q] = taps + q * 9;
+	}
+	CNN_TARGET_AVX512 static __m512 Load16(const uint16_t* p) { return _mm512_cvtph_ps(_mm256_loadu_si256((const __m256i*)p)); }
+#endif
+};
+
+struct conv3x3_bf16 {
+	typedef uint16_t type;
+	static float Value(const uint16_t* p) { return bf16_to_float(*p); }
+	static const float* Taps(const uint16_t* k, float* taps) {
+		for (int t = 0; t < 9; t++)
+			taps[t] = bf16_to_float(k[t]);
+		return taps;
+	}
+#ifdef CNN_X86
+	CNN_TARGET_AVX2 static __m256 Load8(const uint16_t* p) {
+		return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)p)), 16));
+	}
+	CNN_TARGET_AVX2 static void BlockTaps(const uint16_t* const w[4], size_t offset, float* taps, const float* k[4]) {
+		for (int i = 0; i < CONV3X3_BLOCK_TAPS; i += 8)
+			_mm256_storeu_ps(taps + i, Load8(w[0] + offset + i));
+		for (int q = 0; q < CONV3X3_OC_BLOCK; q++)
+			k[q] = taps + q * 9;
+	}
+	CNN_TARGET_AVX512 static __m512 Load16(const uint16_t* p) {
+		return _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_cvtepu16_epi32(_mm256_loadu_si256((const __m256i*)p)), 16));
+	}
+#endif
+};
+
+/// <summary>
+/// Filters of the output-channel block (input channel ic at w[q] + ic * weight_ic_stride); channels past the end
+/// repeat the last one and are never stored.
+/// </summary>
+template <typename T>
+static inline void conv3x3_block_weights(const conv3x3_job& job, int oc0, const T* w[4], float b[4], int& count) {
+	const T* block = (const T*)job.weight + oc0 / CONV3X3_OC_BLOCK * job.weight_block_stride;
+	count = std::min(CONV3X3_OC_BLOCK, job.out_channels - oc0);
+	for (int q = 0; q < CONV3X3_OC_BLOCK; q++) {
+		int last = std::min(q, count - 1);
+		w[q] = block + last * job.weight_q_stride;
+		b[q] = job.bias[oc0 + last];
+	}
+}
+
+/// <summary>
+/// Copy n (<= width) lanes of a kernel tile into the output row.
+/// </summary>
+static inline void conv3x3_store_tail(float* out, const float* tile, int n) {
+	for (int i = 0; i < n; i++)
+		out[i] = tile[i];
+}
+
+template <typename S>
+static void conv3x3_scalar(const conv3x3_job& job, int oc0, int oy, float* dst, size_t dst_plane) {
+	typedef typename S::type T;
+	const T* w[4];
+	float b[4];
+	int count;
+	conv3x3_block_weights(job, oc0, w, b, count);
+	const T* base = (const T*)job.src + (size_t)(oy * job.stride) * job.row_stride;
+
+	for (int q = 0; q < count; q++) {
+		float* out = dst + q * dst_plane;
+		for (int ox = 0; ox < job.out_cols; ox++) {
+			float sum = b[q];
+			for (int ic = 0; ic < job.in_channels; ic++) {
+				const T* plane = base + ic * job.plane_stride + ox;
+				float taps[9];
+				const float* k = S::Taps(w[q] + ic * job.weight_ic_stride, taps);
+				for (int ky = 0; ky < 3; ky++) {
+					const T* row = plane + ky * job.row_stride;
+					sum += S::Value(row + job.col_offset[0]) * k[ky * 3 + 0] +
+						   S::Value(row + job.col_offset[1]) * k[ky * 3 + 1] +
+						   S::Value(row + job.col_offset[2]) * k[ky * 3 + 2];
+				}
+			}
+			out[ox] = sum;
+		}
+	}
+}
+
+#ifdef CNN_X86
+
+/// <summary>
+/// SSE2: 4 output channels x 8 columns per step (no FMA, multiply + add). fp32 storage only: converting
+/// 16-bit storage needs F16C / AVX2.
+/// </summary>
+static void conv3x3_sse2(const conv3x3_job& job, int oc0, int oy, float* dst, size_t dst_plane) {
+	const float* w[4];
+	float b[4];
+	int count;
+	conv3x3_block_weights(job, oc0, w, b, count);
+	const float* base = (const float*)job.src + (size_t)(oy * job.stride) * job.row_stride;
+
+	for (int ox = 0; ox < job.out_cols; ox += 8) {
+		__m128 a00 = _mm_set1_ps(b[0]), a01 = a00;
+		__m128 a10 = _mm_set1_ps(b[1]), a11 = a10;
+		__m128 a20 = _mm_set1_ps(b[2]), a21 = a20;
+		__m128 a30 = _mm_set1_ps(b[3]), a31 = a30;
+		for (int ic = 0; ic < job.in_channels; ic++) {
+			const float* plane = base + ic * job.plane_stride + ox;
+			const float* k0 = w[0] + ic * job.weight_ic_stride;
+			const float* k1 = w[1] + ic * job.weight_ic_stride;
+			const float* k2 = w[2] + ic * job.weight_ic_stride;
+			const float* k3 = w[3] + ic * job.weight_ic_stride;
+			for (int ky = 0; ky < 3; ky++) {
+				const float* row = plane + ky * job.row_stride;
+				for (int kx = 0; kx < 3; kx++) {
+					const float* p = row + job.col_offset[kx];
+					int t = ky * 3 + kx;
+					__m128 x0 = _mm_loadu_ps(p);
+					__m128 x1 = _mm_loadu_ps(p + 4);
+					__m128 wv;
+					wv = _mm_set1_ps(k0[t]); a00 = _mm_add_ps(a00, _mm_mul_ps(wv, x0)); a01 = _mm_add_ps(a01, _mm_mul_ps(wv, x1));
+					wv = _mm_set1_ps(k1[t]); a10 = _mm_add_ps(a10, _mm_mul_ps(wv, x0)); a11 = _mm_add_ps(a11, _mm_mul_ps(wv, x1));
+					wv = _mm_set1_ps(k2[t]); a20 = _mm_add_ps(a20, _mm_mul_ps(wv, x0)); a21 = _mm_add_ps(a21, _mm_mul_ps(wv, x1));
+					wv = _mm_set1_ps(k3[t]); a30 = _mm_add_ps(a30, _mm_mul_ps(wv, x0)); a31 = _mm_add_ps(a31, _mm_mul_ps(wv, x1));
+				}
+			}
+		}
+		alignas(16) float tile[4][8];
+		_mm_store_ps(tile[0], a00); _mm_store_ps(tile[0] + 4, a01);
+		_mm_store_ps(tile[1], a10); _mm_store_ps(tile[1] + 4, a11);
+		_mm_store_ps(tile[2], a20); _mm_store_ps(tile[2] + 4, a21);
+		_mm_store_ps(tile[3], a30); _mm_store_ps(tile[3] + 4, a31);
+		int n = std::min(8, job.out_cols - ox);
+		for (int q = 0; q < count; q++)
+			conv3x3_store_tail(dst + q * dst_plane + ox, tile[q], n);
+	}
+}
+
+/// <summary>
+/// AVX2 + FMA: 4 output channels x 16 columns per step.
+/// </summary>
+template <typename S>
+CNN_TARGET_AVX2 static void conv3x3_avx2(const conv3x3_job& job, int oc0, int oy, float* dst, size_t dst_plane) {
+	typedef typename S::type T;
+	const T* w[4];
+	float b[4];
+	int count;
+	conv3x3_block_weights(job, oc0, w, b, count);
+	const T* base = (const T*)job.src + (size_t)(oy * job.stride) * job.row_stride;
+	float taps[CONV3X3_BLOCK_TAPS];
+
+	for (int ox = 0; ox < job.out_cols; ox += 16) {
+		__m256 a00 = _mm256_set1_ps(b[0]), a01 = a00;
+		__m256 a10 = _mm256_set1_ps(b[1]), a11 = a10;
+		__m256 a20 = _mm256_set1_ps(b[2]), a21 = a20;
+		__m256 a30 = _mm256_set1_ps(b[3]), a31 = a30;
+		for (int ic = 0; ic < job.in_channels; ic++) {
+			const T* plane = base + ic * job.plane_stride + ox;
+			const float* k[4];
+			S::BlockTaps(w, ic * job.weight_ic_stride, taps, k);
+			const float* k0 = k[0];
+			const float* k1 = k[1];
+			const float* k2 = k[2];
+			const float* k3 = k[3];
+			for (int ky = 0; ky < 3; ky++) {
+				const T* row = plane + ky * job.row_stride;
+				for (int kx = 0; kx < 3; kx++) {
+					const T* p = row + job.col_offset[kx];
+					int t = ky * 3 + kx;
+					__m256 x0 = S::Load8(p);
+					__m256 x1 = S::Load8(p + 8);
+					__m256 wv;
+					wv = _mm256_broadcast_ss(k0 + t); a00 = _mm256_fmadd_ps(wv, x0, a00); a01 = _mm256_fmadd_ps(wv, x1, a01);
+					wv = _mm256_broadcast_ss(k1 + t); a10 = _mm256_fmadd_ps(wv, x0, a10); a11 = _mm256_fmadd_ps(wv, x1, a11);
+					wv = _mm256_broadcast_ss(k2 + t); a20 = _mm256_fmadd_ps(wv, x0, a20); a21 = _mm256_fmadd_ps(wv, x1, a21);
+					wv = _mm256_broadcast_ss(k3 + t); a30 = _mm256_fmadd_ps(wv, x0, a30); a31 = _mm256_fmadd_ps(wv, x1, a31);
+				}
+			}
+		}
+		int n = std::min(16, job.out_cols - ox);
+		if (n == 16 && count == CONV3X3_OC_BLOCK) {
+			float* o0 = dst + ox;
+			float* o1 = dst + dst_plane + ox;
+			float* o2 = dst + 2 * dst_plane + ox;
+			float* o3 = dst + 3 * dst_plane + ox;
+			_mm256_storeu_ps(o0, a00); _mm256_storeu_ps(o0 + 8, a01);
+			_mm256_storeu_ps(o1, a10); _mm256_storeu_ps(o1 + 8, a11);
+			_mm256_storeu_ps(o2, a20); _mm256_storeu_ps(o2 + 8, a21);
+			_mm256_storeu_ps(o3, a30); _mm256_storeu_ps(o3 + 8, a31);
+			continue;
+		}
+		alignas(32) float tile[4][16];
+		_mm256_store_ps(tile[0], a00); _mm256_store_ps(tile[0] + 8, a01);
+		_mm256_store_ps(tile[1], a10); _mm256_store_ps(tile[1] + 8, a11);
+		_mm256_store_ps(tile[2], a20); _mm256_store_ps(tile[2] + 8, a21);
+		_mm256_store_ps(tile[3], a30); _mm256_store_ps(tile[3] + 8, a31);
+		for (int q = 0; q < count; q++)
+			conv3x3_store_tail(dst + q * dst_plane + ox, tile[q], n);
+	}
+}
+
+/// <summary>
+/// AVX-512: 4 output channels x 32 columns per step, ragged tails written with a store mask.
+/// </summary>
+template <typename S>
+CNN_TARGET_AVX512 static void conv3x3_avx512(const conv3x3_job& job, int oc0, int oy, float* dst, size_t dst_plane) {
+	typedef typename S::type T;
+	const T* w[4];
+	float b[4];
+	int count;
+	conv3x3_block_weights(job, oc0, w, b, count);
+	const T* base = (const T*)job.src + (size_t)(oy * job.stride) * job.row_stride;
+	float taps[CONV3X3_BLOCK_TAPS];
+
+	for (int ox = 0; ox < job.out_cols; ox += 32) {
+		__m512 a00 = _mm512_set1_ps(b[0]), a01 = a00;
+		__m512 a10 = _mm512_set1_ps(b[1]), a11 = a10;
+		__m512 a20 = _mm512_set1_ps(b[2]), a21 = a20;
+		__m512 a30 = _mm512_set1_ps(b[3]), a31 = a30;
+		for (int ic = 0; ic < job.in_channels; ic++) {
+			const T* plane = base + ic * job.plane_stride + ox;
+			const float* k[4];
+			S::BlockTaps(w, ic * job.weight_ic_stride, taps, k);
+			const float* k0 = k[0];
+			const float* k1 = k[1];
+			const float* k2 = k[2];
+			const float* k3 = k[3];
+			for (int ky = 0; ky < 3; ky++) {
+				const T* row = plane + ky * job.row_stride;
+				for (int kx = 0; kx < 3; kx++) {
+					const T* p = row + job.col_offset[kx];
+					int t = ky * 3 + kx;
+					__m512 x0 = S::Load16(p);
+					__m512 x1 = S::Load16(p + 16);
+					__m512 wv;
+					wv = _mm512_set1_ps(k0[t]); a00 = _mm512_fmadd_ps(wv, x0, a00); a01 = _mm512_fmadd_ps(wv, x1, a01);
+					wv = _mm512_set1_ps(k1[t]); a10 = _mm512_fmadd_ps(wv, x0, a10); a11 = _mm512_fmadd_ps(wv, x1, a11);
+					wv = _mm512_set1_ps(k2[t]); a20 = _mm512_fmadd_ps(wv, x0, a20); a21 = _mm512_fmadd_ps(wv, x1, a21);
+					wv = _mm512_set1_ps(k3[t]); a30 = _mm512_fmadd_ps(wv, x0, a30); a31 = _mm512_fmadd_ps(wv, x1, a31);
+				}
+			}
+		}
+		int n = std::min(32, job.out_cols - ox);
+		__mmask16 m0 = (__mmask16)(n >= 16 ? 0xffff : (1u << n) - 1);
+		__mmask16 m1 = (__mmask16)(n >= 32 ? 0xffff : n <= 16 ? 0 : (1u << (n - 16)) - 1);
+		__m512 acc[4][2] = { { a00, a01 }, { a10, a11 }, { a20, a21 }, { a30, a31 } };
+		for (int q = 0; q < count; q++) {
+			float* out = dst + q * dst_plane + ox;
+			_mm512_mask_storeu_ps(out, m0, acc[q][0]);
+			_mm512_mask_storeu_ps(out + 16, m1, acc[q][1]);
+		}
+	}
+}
+
+#endif
+
+/// <summary>
+/// Hand-vectorized 3x3 convolution (stride 1 and 2, bias fused into the accumulator initialization).
+/// The widest kernel the CPU supports (AVX-512, AVX2/FMA, SSE2, scalar) is selected once at construction via cpuid.
+/// With fp16 / bf16 storage the 3x3 and fully connected weights and the prepared layer inputs (the data the
+/// kernels stream) are kept in 16 bits and widened to fp32 as they are loaded, halving their cache footprint
+/// and bandwidth; accumulation stays fp32, and so do the tensors passed between layers. Results then only
+/// approximate CNNBruteforce (Quantized()).
+/// The 3x3 filters are packed per output-channel block once per layer (the constructor prepares conv_params[]
+/// and fc_params[]). CNNOptimized only packs what it still runs: the fp32 fully connected layer and
+/// convolutions with other strides.
+/// </summary>
+class CNNSimd : public CNNOptimized {
+
+private:
+	CpuIsa isa;
+	StorageFormat storage;
+	conv3x3_kernel kernel;
+	// Scratch buffers reused across calls.
+	Tensor prepared;
+	vector<uint16_t> preparedHalf;	// prepared input with 16-bit storage
+	size_t preparedImage = 0;	// elements per image of the prepared input
+	Tensor blockSums;	// ConvolutionalBlock: [task][mean, variance][channel of the block]
+	vector<float> weightRow;	// FullyConnectedLayer with 16-bit storage
+
+	// Packed weights, one per prepared layer: key is the conv_param / fc_param, source its fp32 weights.
+	vector<const void*> keys;
+	vector<const float*> sources;
+	vector<Tensor> blockWeights;	// fp32 storage: 3x3 filters
+	vector<vector<uint16_t>> halfWeights;	// 16-bit storage: 3x3 filters and fully connected weights
+
+	template <typename S>
+	conv3x3_kernel SelectKernel() {
+#ifdef CNN_X86
+		if (isa == ISA_AVX512)
+			return conv3x3_avx512<S>;
+		if (isa == ISA_AVX2)
+			return conv3x3_avx2<S>;
+		if (isa == ISA_SSE2 && storage == STORAGE_FP32)
+			return conv3x3_sse2;
+#endif
+		isa = ISA_SCALAR;
+		return conv3x3_scalar<S>;
+	}
+
+	size_t Layer(const void* key) {
+		for (size_t i = 0; i < keys.size(); i++) {
+			if (keys[i] == key)
+				return i;
+		}
+		keys.push_back(key);
+		sources.push_back(nullptr);
+		blockWeights.push_back(Tensor());
+		halfWeights.push_back(vector<uint16_t>());
+		return keys.size() - 1;
+	}
+
+	/// <summary>
+	/// 16-bit copy of a fully connected layer's weights, converted on first use (or when the layer points to
+	/// other weights).
+	/// </summary>
+	const uint16_t* HalfWeights(const fc_param* fcp) {
+		size_t layer = Layer(fcp);
+		if (sources[layer] != fcp->p_weight) {
+			sources[layer] = fcp->p_weight;
+			size_t count = (size_t)fcp->out_features * fcp->in_features;
+			halfWeights[layer].resize(count);
+			half_store(fcp->p_weight, halfWeights[layer].data(), count, storage);
+		}
+		return halfWeights[layer].data();
+	}
+
+	/// <summary>
+	/// 3x3 filters packed per output-channel block in the storage format, [block][input channel][CONV3X3_BLOCK_TAPS]
+	/// with filter q of the block at q * 9; the padding and the missing channels of the last block are zero.
+	/// </summary>
+	const void* BlockWeights(const conv_param* cp) {
+		size_t layer = Layer(cp);
+		if (sources[layer] != cp->p_weight) {
+			sources[layer] = cp->p_weight;
+			int in_channels = cp->in_channels;
+			int blocks = (cp->out_channels + CONV3X3_OC_BLOCK - 1) / CONV3X3_OC_BLOCK;
+			Tensor& packed = blockWeights[layer];
+			packed.create(blocks, in_channels, 1, CONV3X3_BLOCK_TAPS);
+			packed.setTo(0);
+			for (int oc = 0; oc < cp->out_channels; oc++) {
+				for (int ic = 0; ic < in_channels; ic++) {
+					const float* filter = cp->p_weight + ((size_t)oc * in_channels + ic) * 9;
+					memcpy(packed.ptr(oc / CONV3X3_OC_BLOCK, ic, 0) + oc % CONV3X3_OC_BLOCK * 9, filter, 9 * sizeof(float));
+				}
+			}
+			if (storage != STORAGE_FP32) {
+				halfWeights[layer].resize(packed.total());
+				half_store(packed.data(), halfWeights[layer].data(), packed.total(), storage);
+				packed = Tensor();
+			}
+		}
+		if (storage == STORAGE_FP32)
+			return blockWeights[layer].data();
+		return halfWeights[layer].data();
+	}
+
+	/// <summary>
+	/// Weights of a 3x3 layer in the storage format, with the strides conv3x3_block_weights needs.
+	/// </summary>
+	void SetWeights(const conv_param* cp, conv3x3_job& job) {
+		job.bias = cp->p_bias;
+		job.weight = BlockWeights(cp);
+		job.weight_ic_stride = CONV3X3_BLOCK_TAPS;
+		job.weight_q_stride = 9;
+		job.weight_block_stride = (size_t)cp->in_channels * CONV3X3_BLOCK_TAPS;
+	}
+
+	static void StoreRow(const float* src, float* dst, int count, StorageFormat format) {
+		memcpy(dst, src, count * sizeof(float));
+	}
+
+	static void StoreRow(const float* src, uint16_t* dst, int count, StorageFormat format) {
+		half_store(src, dst, count, format);
+	}
+
+	/// <summary>
+	/// Rows of the prepared input in the storage type T (see PrepareInput).
+	/// </summary>
+	template <typename T>
+	void PrepareRows(const Tensor& input, int pad, int stride, int phase_width, int padded_rows, int row_stride, T* base) {
+		int channels = input.channels();
+		int r_size = input.rows();
+		int c_size = input.cols();
+		StorageFormat format = storage;
+
+		parallel_for(input.batch() * channels, [&](int p) {
+			int n = p / channels;
+			int ch = p % channels;
+			T converted[CONV3X3_COL_ALIGN];
+			for (int r = 0; r < padded_rows; r++) {
+				T* dst = base + ((size_t)p * padded_rows + r) * row_stride;
+				for (int i = 0; i < row_stride; i++)
+					dst[i] = 0;
+				int src_r = r - pad;
+				if (src_r < 0 || src_r >= r_size)
+					continue;
+				const float* src = input.ptr(n, ch, src_r);
+				if (stride == 1) {
+					StoreRow(src, dst + pad, c_size, format);
+				}
+				else {
+					for (int c0 = 0; c0 < c_size; c0 += CONV3X3_COL_ALIGN) {
+						int count = std::min(CONV3X3_COL_ALIGN, c_size - c0);
+						StoreRow(src + c0, converted, count, format);
+						for (int c = c0; c < c0 + count; c++) {
+							int x = c + pad;
+							dst[(x % stride) * phase_width + x / stride] = converted[c - c0];
+						}
+					}
+				}
+			}
+		});
+	}
+
+public:
+
+	CNNSimd() : CNNSimd(cpu_best_isa()) {}
+
+	CNNSimd(CpuIsa level, StorageFormat format = STORAGE_FP32) : CNNOptimized(false), isa(level), storage(format) {
+		if (storage == STORAGE_FP16)
+			kernel = SelectKernel<conv3x3_fp16>();
+		else if (storage == STORAGE_BF16)
+			kernel = SelectKernel<conv3x3_bf16>();
+		else
+			kernel = SelectKernel<conv3x3_fp32>();
+		for (size_t i = 0; i < sizeof(conv_params) / sizeof(conv_params[0]); i++)
+			PrepareLayer(&conv_params[i]);
+		for (size_t i = 0; i < sizeof(fc_params) / sizeof(fc_params[0]); i++) {
+			if (storage == STORAGE_FP32)
+				PackedWeights(&fc_params[i]);	// runs on CNNOptimized::FullyConnectedLayer
+			else
+				HalfWeights(&fc_params[i]);
+		}
+	}
+
+	/// <summary>
+	/// (Re)pack the weights of a convolution layer.
+	/// </summary>
+	void PrepareLayer(const conv_param* cp) {
+		if (cp->stride != 1 && cp->stride != 2) {
+			CNNOptimized::PrepareLayer(cp);	// runs on CNNOptimized::ConvolutionalLayer
+			return;
+		}
+		if (cp->kernel_size != CONVOLUTION_FILTER)
+			return;
+		sources[Layer(cp)] = nullptr;
+		BlockWeights(cp);
+	}
+
+	void GetClassName() {
+		cout << "CNNSimd(" << cpu_isa_name(isa);
+		if (storage != STORAGE_FP32)
+			cout << "," << storage_format_name(storage);
+		cout << ")";
+	}
+
+	bool Quantized() const {
+		return storage != STORAGE_FP32;
+	}
+
+	/// <summary>
+	/// Zero pad, widen and (stride 2) de-interleave the input into the prepared buffer, in the storage format.
+	/// job.src points at image 0; ImageJob moves it to another image of the batch.
+	/// </summary>
+	void PrepareInput(const Tensor& input, int pad, int stride, int out_cols, conv3x3_job& job) {
+		int batch = input.batch();
+		int channels = input.channels();
+		int padded_rows = input.rows() + 2 * pad;
+		int width = (out_cols + CONV3X3_COL_ALIGN - 1) / CONV3X3_COL_ALIGN * CONV3X3_COL_ALIGN;
+
+		// Columns of one phase (stride 1: the padded row, stride 2: even or odd padded columns).
+		int phase_width = stride == 1 ? width + 2 : width + 1;
+		int row_stride = phase_width * stride;
+		size_t plane = (size_t)padded_rows * row_stride;
+		preparedImage = channels * plane;
+		if (storage == STORAGE_FP32) {
+			prepared.create(batch, channels, padded_rows, row_stride);
+			PrepareRows(input, pad, stride, phase_width, padded_rows, row_stride, prepared.data());
+			job.src = prepared.data();
+		}
+		else {
+			preparedHalf.resize(batch * preparedImage);
+			PrepareRows(input, pad, stride, phase_width, padded_rows, row_stride, preparedHalf.data());
+			job.src = preparedHalf.data();
+		}
+
+		job.plane_stride = plane;
+		job.row_stride = row_stride;
+		job.stride = stride;
+		if (stride == 1) {
+			job.col_offset[0] = 0;
+			job.col_offset[1] = 1;
+			job.col_offset[2] = 2;
+		}
+		else {
+			job.col_offset[0] = 0;
+			job.col_offset[1] = phase_width;
+			job.col_offset[2] = 1;
+		}
+	}
+
+	conv3x3_job ImageJob(const conv3x3_job& job, int n) const {
+		conv3x3_job image = job;
+		size_t element = storage == STORAGE_FP32 ? sizeof(float) : sizeof(uint16_t);
+		image.src = (const char*)job.src + n * preparedImage * element;
+		return image;
+	}
+
+	void ConvolutionalLayer(const Tensor& input, conv_param* cp, Tensor& output) {
+		if (cp->kernel_size != CONVOLUTION_FILTER || (cp->stride != 1 && cp->stride != 2)) {
+			CNNOptimized::ConvolutionalLayer(input, cp, output);
+			return;
+		}
+
+		int padsize = cp->pad ? 2 : 0;
+		int out_rows = (input.rows() - CONVOLUTION_FILTER + padsize) / cp->stride + 1;
+		int out_cols = (input.cols() - CONVOLUTION_FILTER + padsize) / cp->stride + 1;
+		int batch = input.batch();
+		output.create(batch, cp->out_channels, out_rows, out_cols);
+
+		conv3x3_job job;
+		PrepareInput(input, padsize / 2, cp->stride, out_cols, job);
+		job.in_channels = cp->in_channels;
+		job.out_channels = cp->out_channels;
+		job.out_cols = out_cols;
+		SetWeights(cp, job);
+
+		// Image outermost: a layer's weights (at most 37 KB) stay cached for the whole batch anyway, while
+		// one image's prepared input stays in L2 across all channel blocks.
+		int blocks = (cp->out_channels + CONV3X3_OC_BLOCK - 1) / CONV3X3_OC_BLOCK;
+		int image_tasks = blocks * out_rows;
+		int tasks = batch * image_tasks;
+		parallel_for(tasks, [&](int t) {
+			int n = t / image_tasks;
+			int oc0 = (t % image_tasks / out_rows) * CONV3X3_OC_BLOCK;
+			int oy = t % out_rows;
+			kernel(ImageJob(job, n), oc0, oy, output.ptr(n, oc0, oy), output.step(1));
+		});
+	}
+
+	/// <summary>
+	/// Fused Conv + BatchNormalization + Relu + MaxPooling in tiles of one output-channel block and a band of rows.
+	/// Per-image normalization (x - mean) / sqrt(E[x^2]) is increasing in x, so max-pooling the raw convolution
+	/// and normalizing afterwards gives the same result as the unfused layers. Each pair of convolution rows is
+	/// therefore produced into a small L1 tile, folded into the channel sums and pooled straight away;
+	/// only the pooled result is written, then normalized + Relu'd in place.
+	/// With normalization folded into cp (normalize false) the statistics are skipped and only Relu remains.
+	/// </summary>
+	void ConvolutionalBlock(const Tensor& input, conv_param* cp, int psize, bool normalize, Tensor& output) {
+		if (cp->kernel_size != CONVOLUTION_FILTER || (cp->stride != 1 && cp->stride != 2) || psize > 2) {
+			CNNBase::ConvolutionalBlock(input, cp, psize, normalize, output);
+			return;
+		}
+
+		int padsize = cp->pad ? 2 : 0;
+		int out_rows = (input.rows() - CONVOLUTION_FILTER + padsize) / cp->stride + 1;
+		int out_cols = (input.cols() - CONVOLUTION_FILTER + padsize) / cp->stride + 1;
+		int pooled_rows = out_rows / psize;
+		int pooled_cols = out_cols / psize;
+		int batch = input.batch();
+		output.create(batch, cp->out_channels, pooled_rows, pooled_cols);
+
+		conv3x3_job job;
+		PrepareInput(input, padsize / 2, cp->stride, out_cols, job);
+		job.in_channels = cp->in_channels;
+		job.out_channels = cp->out_channels;
+		job.out_cols = out_cols;
+		SetWeights(cp, job);
+
+		// Tasks are (image, channel block, CONV3X3_BAND_ROWS rows) tiles: a layer with few channel blocks still
+		// keeps every thread busy. Each task adds its rows into its own channel sums, which are combined
+		// afterwards in band order, so results depend neither on the thread count nor on the batch.
+		// Every task produces one [4 channels][2 rows][out_cols] tile at a time.
+		int blocks = (cp->out_channels + CONV3X3_OC_BLOCK - 1) / CONV3X3_OC_BLOCK;
+		int band_rows = CONV3X3_BAND_ROWS;
+		int bands = (out_rows + band_rows - 1) / band_rows;
+		int tasks = batch * blocks * bands;
+		size_t tile_plane = (size_t)2 * out_cols;
+		blockSums.create(1, tasks, 2, CONV3X3_OC_BLOCK);
+
+		ThreadPool::Current().ParallelFor(tasks, 1, [&](int begin, int end) {
+			static thread_local vector<float> tile;
+			tile.resize(CONV3X3_OC_BLOCK * tile_plane);
+			for (int task = begin; task < end; task++) {
+				int n = task / (blocks * bands);
+				int oc0 = task / bands % blocks * CONV3X3_OC_BLOCK;
+				int first = task % bands * band_rows;
+				int last = std::min(out_rows, first + band_rows);
+				int count = std::min(CONV3X3_OC_BLOCK, cp->out_channels - oc0);
+				conv3x3_job image = ImageJob(job, n);
+				float sumMean[CONV3X3_OC_BLOCK] = {};
+				float sumVariance[CONV3X3_OC_BLOCK] = {};
+
+				for (int oy = first; oy < last; oy += 2) {
+					int rows = std::min(2, last - oy);
+					for (int r = 0; r < rows; r++)
+						kernel(image, oc0, oy + r, tile.data() + r * out_cols, tile_plane);
+
+					for (int q = 0; q < count; q++) {
+						const float* t = tile.data() + q * tile_plane;
+						if (normalize) {
+							for (int i = 0; i < rows * out_cols; i++) {
+								sumMean[q] += t[i];
+								sumVariance[q] += t[i] * t[i];
+							}
+						}
+						if (psize == 2 && rows == 2 && oy / 2 < pooled_rows) {
+							float* out = output.ptr(n, oc0 + q, oy / 2);
+							const float* t0 = t;
+							const float* t1 = t + out_cols;
+							for (int c = 0; c < pooled_cols; c++) {
+								out[c] = std::max(std::max(t0[2 * c], t0[2 * c + 1]), std::max(t1[2 * c], t1[2 * c + 1]));
+							}
+						}
+						else if (psize == 1) {
+							for (int r = 0; r < rows; r++)
+								memcpy(output.ptr(n, oc0 + q, oy + r), t + r * out_cols, out_cols * sizeof(float));
+						}
+					}
+				}
+				memcpy(blockSums.ptr(0, task, 0), sumMean, sizeof(sumMean));
+				memcpy(blockSums.ptr(0, task, 1), sumVariance, sizeof(sumVariance));
+			}
+		});
+
+		int dimension = out_rows * out_cols;
+		parallel_for(batch * cp->out_channels, [&](int p) {
+			int n = p / cp->out_channels;
+			int oc = p % cp->out_channels;
+			float* plane = output.ptr(n, oc, 0);
+			if (!normalize) {
+				for (int i = 0; i < pooled_rows * pooled_cols; i++)
+					plane[i] = std::max(0.f, plane[i]);
+				return;
+			}
+			int first = (n * blocks + oc / CONV3X3_OC_BLOCK) * bands;
+			float sumMean = 0;
+			float sumVariance = 0;
+			for (int band = 0; band < bands; band++) {
+				sumMean += blockSums.at(0, first + band, 0, oc % CONV3X3_OC_BLOCK);
+				sumVariance += blockSums.at(0, first + band, 1, oc % CONV3X3_OC_BLOCK);
+			}
+			float mean = sumMean / dimension;
+			float sqrtChannel = sqrt(sumVariance / dimension);
+			for (int i = 0; i < pooled_rows * pooled_cols; i++)
+				plane[i] = std::max(0.f, (plane[i] - mean) / sqrtChannel);
+		});
+	}
+
+	/// <summary>
+	/// With 16-bit storage each weight row is widened into a small fp32 buffer once per batch.
+	/// </summary>
+	void FullyConnectedLayer(const Tensor& input, fc_param* fcp, Tensor& fc_output) {
+		if (storage == STORAGE_FP32) {
+			CNNOptimized::FullyConnectedLayer(input, fcp, fc_output);
+			return;
+		}
+
+		int in_features = fcp->in_features;
+		int out_features = fcp->out_features;
+		int batch = input.batch();
+		const uint16_t* weights = HalfWeights(fcp);
+		weightRow.resize(in_features);
+
+		fc_output.create(batch, 1, 1, out_features);
+		for (int o = 0; o < out_features; o++) {
+			half_load(weights + (size_t)o * in_features, weightRow.data(), in_features, storage);
+			const float* weight = weightRow.data();
+			for (int n = 0; n < batch; n++) {
+				const float* features = input.ptr(n, 0, 0);
+				float sum = 0;
+				for (int i = 0; i < in_features; i++) {
+					sum += features[i] * weight[i];
+				}
+				fc_output.at(n, 0, 0, o) = sum + fcp->p_bias[o];
+			}
+		}
+	}
+};
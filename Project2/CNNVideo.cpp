@@ -0,0 +1,157 @@
+#pragma once
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+#include "CNNBase.h"
+#include "CNNDetector.cpp"
+#include "CNNIncremental.cpp"
+#include "CNNModel.h"
+#include "CNNPipeline.h"
+#include "LatencyStats.h"
+#include "MPMCQueue.h"
+#include <opencv2/opencv.hpp>
+using namespace std;
+using namespace cv;
+
+/// <summary>
+/// Classifies (or, with a CNNDetector, detects faces in) every frame of a cv::VideoCapture source: a video
+/// file, an image sequence or a camera index. Three threads overlap the stages of consecutive frames:
+///		capture (VideoCapture::read) -> [frames] -> preprocess (fit to the input / build the pyramid) -> [frames] -> inference + output
+/// The queues are short, so a live camera is never more than a few frames behind.
+/// With a change threshold &gt;= 0 the conv features of regions that did not change since the previous frame
+/// are reused (CNNIncremental). One record per frame is written to out; sustained FPS, latency from capture
+/// to result and the recomputed fraction are reported at the end.
+/// </summary>
+class CNNVideo {
+public:
+	/// <param name="detector">null: classify each frame fitted to the input, otherwise detect faces</param>
+	/// <param name="change_threshold">largest pixel change whose features are reused, &lt; 0: compute every frame</param>
+	CNNVideo(CNNBase* engine, const CNNModel* model, FILE* out, bool crop = false, int change_threshold = -1,
+		CNNDetector* detector = nullptr)
+		: cnn(engine), model(model), out(out), crop(crop), changeThreshold(change_threshold), detector(detector),
+		incremental(engine, model), captured(QUEUE_CAPACITY), prepared(QUEUE_CAPACITY) {
+		if (detector != nullptr)
+			detector->SetChangeThreshold(change_threshold);
+	}
+
+	/// <summary>
+	/// Process the source until it ends.
+	/// </summary>
+	/// <param name="source">file name, image sequence pattern, or a camera index (digits only)</param>
+	/// <returns>false when the source cannot be opened</returns>
+	bool Run(const string& source) {
+		VideoCapture capture;
+		bool camera = !source.empty() && all_of(source.begin(), source.end(), [](char c) { return isdigit((unsigned char)c) != 0; });
+		if (camera ? !capture.open(stoi(source)) : !capture.open(source)) {
+			fprintf(stderr, "Cannot open video %s\n", source.c_str());
+			return false;
+		}
+
+		TickMeter wall;
+		wall.start();
+		thread captureThread(&CNNVideo::Capture, this, std::ref(capture));
+		thread prepareThread(&CNNVideo::Prepare, this);
+		double recomputedSum = 0;
+		for (;;) {
+			VideoFrame frame;
+			prepared.Pop(frame);
+			if (frame.index < 0)
+				break;
+			recomputedSum += Infer(frame);
+			latencies.push_back((getTickCount() - frame.captured) * 1000 / getTickFrequency());
+		}
+		wall.stop();
+		captureThread.join();
+		prepareThread.join();
+		fflush(out);
+		Report(wall.getTimeSec(), recomputedSum);
+		return true;
+	}
+
+private:
+	static const int QUEUE_CAPACITY = 4;
+
+	// One frame on its way through the stages; index -1 ends the stream.
+	struct VideoFrame {
+		long index = -1;
+		double captured = 0;	// getTickCount() when read
+		Mat frame;
+		Mat input;	// classification: the frame fitted to the input size
+		vector<Mat> pyramid;	// detection: CNNDetector::Pyramid of the frame
+	};
+
+	CNNBase* cnn;
+	const CNNModel* model;
+	FILE* out;
+	bool crop;
+	int changeThreshold;
+	CNNDetector* detector;
+	CNNIncremental incremental;
+	Tensor scores;
+	MPMCQueue<VideoFrame> captured;
+	MPMCQueue<VideoFrame> prepared;
+	vector<double> latencies;
+
+	void Capture(VideoCapture& capture) {
+		for (long index = 0;; index++) {
+			VideoFrame frame;
+			if (!capture.read(frame.frame) || frame.frame.empty())
+				break;
+			frame.index = index;
+			frame.captured = getTickCount();
+			captured.Push(std::move(frame));
+		}
+		captured.Push(VideoFrame());
+	}
+
+	void Prepare() {
+		Mat fitted;
+		for (;;) {
+			VideoFrame frame;
+			captured.Pop(frame);
+			if (frame.index >= 0) {
+				if (detector != nullptr)
+					detector->Pyramid(frame.frame, frame.pyramid);
+				else
+					frame.input = CNNPipeline::FitInput(frame.frame, fitted, crop).clone();
+			}
+			bool last = frame.index < 0;
+			prepared.Push(std::move(frame));
+			if (last)
+				break;
+		}
+	}
+
+	/// <returns>fraction of the frame's features recomputed</returns>
+	double Infer(const VideoFrame& frame) {
+		if (detector != nullptr) {
+			const vector<cnn_detection>& faces = detector->Detect(frame.frame, frame.pyramid);
+			fprintf(out, "frame %ld faces:%d", frame.index, (int)faces.size());
+			for (const cnn_detection& face : faces)
+				fprintf(out, " %d,%d,%d,%d,%.4f", face.box.x, face.box.y, face.box.width, face.box.height, face.score);
+			fprintf(out, "\n");
+			return detector->Recomputed();
+		}
+
+		// Conv blocks through the kept features, then Flatten -> FullyConnected -> SoftMax.
+		const Tensor& features = incremental.Update(frame.input, changeThreshold);
+		cnn->FullyConnectedLayer(cnn->FlattenLayer(features), const_cast<fc_param*>(&model->fc), scores);
+		cnn->SoftMaxLayer(scores);
+		fprintf(out, "frame %ld bg:%g face:%g\n", frame.index, scores[0], scores[1]);
+		return incremental.Recomputed();
+	}
+
+	void Report(double seconds, double recomputedSum) {
+		if (latencies.empty()) {
+			fprintf(stderr, "frames: 0\n");
+			return;
+		}
+		fprintf(stderr, "frames: %d in %.3fs, %.1f FPS, recomputed %.1f%%\n", (int)latencies.size(), seconds,
+			latencies.size() / std::max(seconds, 1e-9), 100 * recomputedSum / latencies.size());
+		fprintf(stderr, "latency ");
+		print_latency(stderr, latency_summary(latencies));
+	}
+};
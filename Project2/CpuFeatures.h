@@ -0,0 +1,133 @@
+#pragma once
+
+#include <cstdlib>
+#include <cstring>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define CNN_X86 1
+#elif defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#define CNN_X86 1
+#endif
+
+/// <summary>
+/// Per-function ISA selection. GCC/Clang need the target attribute to compile intrinsics that are above
+/// the baseline of the translation unit; MSVC accepts every intrinsic without it.
+/// </summary>
+#if defined(CNN_X86) && (defined(__GNUC__) || defined(__clang__))
+#define CNN_TARGET(isa) __attribute__((target(isa)))
+#else
+#define CNN_TARGET(isa)
+#endif
+#define CNN_TARGET_AVX2 CNN_TARGET("avx2,fma,f16c")
+#define CNN_TARGET_AVX512 CNN_TARGET("avx512f,avx2,fma,f16c")
+#define CNN_TARGET_AVX512VNNI CNN_TARGET("avx512f,avx512bw,avx512vnni,avx2,fma,f16c")
+
+/// <summary>
+/// Instruction set levels the kernels are written for, in increasing order.
+/// </summary>
+enum CpuIsa { ISA_SCALAR = 0, ISA_SSE2 = 1, ISA_AVX2 = 2, ISA_AVX512 = 3 };
+
+inline const char* cpu_isa_name(CpuIsa isa) {
+	static const char* names[] = { "scalar", "sse2", "avx2", "avx512" };
+	return names[isa];
+}
+
+typedef struct CpuFeatures {
+	bool sse2 = false;
+	bool avx2 = false;
+	bool fma = false;
+	bool f16c = false;
+	bool avx512f = false;
+	bool avx512bw = false;
+	bool avx512vnni = false;
+	bool avxvnni = false;
+} CpuFeatures;
+
+#ifdef CNN_X86
+inline void cnn_cpuid(int leaf, int subleaf, unsigned int regs[4]) {
+#ifdef _MSC_VER
+	int r[4];
+	__cpuidex(r, leaf, subleaf);
+	for (int i = 0; i < 4; i++)
+		regs[i] = (unsigned int)r[i];
+#else
+	__cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+inline unsigned long long cnn_xgetbv() {
+#ifdef _MSC_VER
+	return _xgetbv(0);
+#else
+	unsigned int eax, edx;
+	__asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+	return ((unsigned long long)edx << 32) | eax;
+#endif
+}
+#endif
+
+/// <summary>
+/// Query cpuid once; AVX/AVX-512 are only reported when the OS saves the wider registers (XCR0).
+/// </summary>
+inline CpuFeatures detect_cpu_features() {
+	CpuFeatures f;
+#ifdef CNN_X86
+	unsigned int r[4];
+	cnn_cpuid(0, 0, r);
+	unsigned int max_leaf = r[0];
+	cnn_cpuid(1, 0, r);
+	f.sse2 = (r[3] >> 26) & 1;
+	bool osxsave = (r[2] >> 27) & 1;
+	bool avx = (r[2] >> 28) & 1;
+	f.fma = (r[2] >> 12) & 1;
+	f.f16c = (r[2] >> 29) & 1;
+	unsigned long long xcr0 = osxsave ? cnn_xgetbv() : 0;
+	bool ymm = (xcr0 & 0x6) == 0x6;
+	bool zmm = (xcr0 & 0xe6) == 0xe6;
+	if (!(avx && ymm)) {
+		f.fma = false;
+		f.f16c = false;
+	}
+	if (max_leaf >= 7) {
+		cnn_cpuid(7, 0, r);
+		f.avx2 = avx && ymm && ((r[1] >> 5) & 1);
+		f.avx512f = zmm && ((r[1] >> 16) & 1);
+		f.avx512bw = zmm && ((r[1] >> 30) & 1);
+		f.avx512vnni = zmm && ((r[2] >> 11) & 1);
+		cnn_cpuid(7, 1, r);
+		f.avxvnni = avx && ymm && ((r[0] >> 4) & 1);
+	}
+#endif
+	return f;
+}
+
+inline const CpuFeatures& cpu_features() {
+	static const CpuFeatures features = detect_cpu_features();
+	return features;
+}
+
+/// <summary>
+/// Best kernel level for this machine (the AVX2 level includes FMA and the F16C conversions). The environment variable CNN_ISA (scalar, sse2, avx2, avx512)
+/// can lower it, e.g. to compare kernels on one box.
+/// </summary>
+inline CpuIsa cpu_best_isa() {
+	const CpuFeatures& f = cpu_features();
+	CpuIsa isa = ISA_SCALAR;
+	if (f.sse2)
+		isa = ISA_SSE2;
+	if (f.avx2 && f.fma && f.f16c)
+		isa = ISA_AVX2;
+	if (f.avx512f && f.avx2 && f.fma && f.f16c)
+		isa = ISA_AVX512;
+
+	const char* requested = getenv("CNN_ISA");
+	if (requested != nullptr) {
+		for (int i = ISA_SCALAR; i <= ISA_AVX512; i++) {
+			if (strcmp(requested, cpu_isa_name((CpuIsa)i)) == 0 && i < isa)
+				isa = (CpuIsa)i;
+		}
+	}
+	return isa;
+}
@@ -0,0 +1,154 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include "CpuFeatures.h"
+#ifdef CNN_X86
+#include <immintrin.h>
+#endif
+
+/// <summary>
+/// Storage formats for weights and activations; kernels always compute in fp32.
+/// fp16 (IEEE half) keeps 11 significant bits over +-65504, bf16 keeps the fp32 range with 8 significant bits.
+/// </summary>
+enum StorageFormat { STORAGE_FP32 = 0, STORAGE_FP16 = 1, STORAGE_BF16 = 2 };
+
+inline const char* storage_format_name(StorageFormat format) {
+	static const char* names[] = { "fp32", "fp16", "bf16" };
+	return names[format];
+}
+
+/// <summary>
+/// fp32 -> fp16, round to nearest even; overflow gives infinity, NaN stays NaN.
+/// </summary>
+inline uint16_t fp16_from_float(float value) {
+	uint32_t x;
+	memcpy(&x, &value, sizeof(x));
+	uint16_t sign = (uint16_t)((x >> 16) & 0x8000);
+	uint32_t magnitude = x & 0x7fffffff;
+	if (magnitude >= 0x7f800000)
+		return sign | 0x7c00 | (magnitude > 0x7f800000 ? 0x200 : 0);
+	if (magnitude >= 0x477ff000)	// rounds to 65520 or more
+		return sign | 0x7c00;
+	if (magnitude < 0x38800000) {
+		// Subnormal: adding 0.5 makes the fp32 ulp 2^-24, the fp16 subnormal step, so the FPU does the rounding.
+		float f;
+		memcpy(&f, &magnitude, sizeof(f));
+		f += 0.5f;
+		memcpy(&magnitude, &f, sizeof(f));
+		return sign | (uint16_t)(magnitude - 0x3f000000);
+	}
+	uint32_t odd = (magnitude >> 13) & 1;
+	magnitude += 0xc8000fff + odd;	// exponent bias 127 -> 15, plus rounding
+	return sign | (uint16_t)(magnitude >> 13);
+}
+
+inline float fp16_to_float(uint16_t h) {
+	uint32_t sign = (uint32_t)(h & 0x8000) << 16;
+	uint32_t exponent = (h >> 10) & 0x1f;
+	uint32_t mantissa = h & 0x3ff;
+	uint32_t x;
+	if (exponent == 0) {
+		float f = mantissa * 5.9604645e-8f;	// 2^-24
+		memcpy(&x, &f, sizeof(x));
+		x |= sign;
+	}
+	else if (exponent == 31) {
+		x = sign | 0x7f800000 | (mantissa << 13);
+	}
+	else {
+		x = sign | ((exponent + 112) << 23) | (mantissa << 13);
+	}
+	float value;
+	memcpy(&value, &x, sizeof(value));
+	return value;
+}
+
+/// <summary>
+/// fp32 -> bf16, round to nearest even; NaN stays NaN.
+/// </summary>
+inline uint16_t bf16_from_float(float value) {
+	uint32_t x;
+	memcpy(&x, &value, sizeof(x));
+	if ((x & 0x7fffffff) > 0x7f800000)
+		return (uint16_t)((x >> 16) | 0x40);
+	x += 0x7fff + ((x >> 16) & 1);
+	return (uint16_t)(x >> 16);
+}
+
+inline float bf16_to_float(uint16_t h) {
+	uint32_t x = (uint32_t)h << 16;
+	float value;
+	memcpy(&value, &x, sizeof(value));
+	return value;
+}
+
+#ifdef CNN_X86
+
+CNN_TARGET_AVX2 inline void half_store_avx2(const float* src, uint16_t* dst, size_t count, StorageFormat format) {
+	size_t i = 0;
+	if (format == STORAGE_FP16) {
+		for (; i + 8 <= count; i += 8)
+			_mm_storeu_si128((__m128i*)(dst + i), _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT));
+	}
+	else {
+		const __m256i bias = _mm256_set1_epi32(0x7fff);
+		const __m256i one = _mm256_set1_epi32(1);
+		for (; i + 16 <= count; i += 16) {
+			__m256i a = _mm256_castps_si256(_mm256_loadu_ps(src + i));
+			__m256i b = _mm256_castps_si256(_mm256_loadu_ps(src + i + 8));
+			a = _mm256_add_epi32(a, _mm256_add_epi32(bias, _mm256_and_si256(_mm256_srli_epi32(a, 16), one)));
+			b = _mm256_add_epi32(b, _mm256_add_epi32(bias, _mm256_and_si256(_mm256_srli_epi32(b, 16), one)));
+			// packus works per 128-bit lane: restore the element order afterwards.
+			__m256i packed = _mm256_packus_epi32(_mm256_srli_epi32(a, 16), _mm256_srli_epi32(b, 16));
+			_mm256_storeu_si256((__m256i*)(dst + i), _mm256_permute4x64_epi64(packed, 0xd8));
+		}
+	}
+	for (; i < count; i++)
+		dst[i] = format == STORAGE_FP16 ? fp16_from_float(src[i]) : bf16_from_float(src[i]);
+}
+
+CNN_TARGET_AVX2 inline void half_load_avx2(const uint16_t* src, float* dst, size_t count, StorageFormat format) {
+	size_t i = 0;
+	for (; i + 8 <= count; i += 8) {
+		__m128i h = _mm_loadu_si128((const __m128i*)(src + i));
+		__m256 f = format == STORAGE_FP16 ? _mm256_cvtph_ps(h) :
+			_mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(h), 16));
+		_mm256_storeu_ps(dst + i, f);
+	}
+	for (; i < count; i++)
+		dst[i] = format == STORAGE_FP16 ? fp16_to_float(src[i]) : bf16_to_float(src[i]);
+}
+
+#endif
+
+/// <summary>
+/// Convert count floats to fp16 / bf16 (F16C or AVX2 when available; bf16 NaNs are only preserved by the scalar path).
+/// </summary>
+inline void half_store(const float* src, uint16_t* dst, size_t count, StorageFormat format) {
+#ifdef CNN_X86
+	static const bool simd = cpu_best_isa() >= ISA_AVX2;
+	if (simd) {
+		half_store_avx2(src, dst, count, format);
+		return;
+	}
+#endif
+	for (size_t i = 0; i < count; i++)
+		dst[i] = format == STORAGE_FP16 ? fp16_from_float(src[i]) : bf16_from_float(src[i]);
+}
+
+/// <summary>
+/// Convert count fp16 / bf16 values back to floats.
+/// </summary>
+inline void half_load(const uint16_t* src, float* dst, size_t count, StorageFormat format) {
+#ifdef CNN_X86
+	static const bool simd = cpu_best_isa() >= ISA_AVX2;
+	if (simd) {
+		half_load_avx2(src, dst, count, format);
+		return;
+	}
+#endif
+	for (size_t i = 0; i < count; i++)
+		dst[i] = format == STORAGE_FP16 ? fp16_to_float(src[i]) : bf16_to_float(src[i]);
+}
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include "CpuFeatures.h"
+#include <opencv2/opencv.hpp>
+#ifdef CNN_X86
+#include <immintrin.h>
+#endif
+
+/// <summary>
+/// BGR 8-bit images -> normalized RGB float planes in one pass, without intermediate Mats:
+/// plane c (0 = red, 1 = green, 2 = blue) gets pixel * scale[c] + offset[c].
+/// </summary>
+typedef struct image_normalization {
+	float scale[3];
+	float offset[3];
+}image_normalization;
+
+/// <summary>
+/// pixel / 255, range 0.0 to 1.0.
+/// </summary>
+inline image_normalization image_unit_range() {
+	image_normalization norm;
+	for (int c = 0; c < 3; c++) {
+		norm.scale[c] = 1.f / 255;
+		norm.offset[c] = 0.f;
+	}
+	return norm;
+}
+
+/// <summary>
+/// (pixel - mean) / standard deviation per channel (population statistics of this image), zero-centered.
+/// The sums are exact integers, so one pass over the bytes is enough.
+/// </summary>
+inline image_normalization image_standardized(const cv::Mat& image) {
+	uint64_t sum[3] = {};
+	uint64_t squares[3] = {};
+	for (int r = 0; r < image.rows; r++) {
+		const uint8_t* pixel = image.ptr<uint8_t>(r);
+		uint32_t rowSum[3] = {};
+		uint32_t rowSquares[3] = {};
+		for (int x = 0; x < image.cols; x++, pixel += 3) {
+			for (int c = 0; c < 3; c++) {
+				rowSum[c] += pixel[c];
+				rowSquares[c] += pixel[c] * pixel[c];
+			}
+		}
+		for (int c = 0; c < 3; c++) {
+			sum[c] += rowSum[c];
+			squares[c] += rowSquares[c];
+		}
+	}
+	double count = (double)image.rows * image.cols;
+	image_normalization norm;
+	for (int c = 0; c < 3; c++) {
+		// BGR sums, RGB planes.
+		double mean = sum[2 - c] / count;
+		double deviation = sqrt(std::max(0.0, squares[2 - c] / count - mean * mean));
+		norm.scale[c] = (float)(1 / deviation);
+		norm.offset[c] = (float)(-mean / deviation);
+	}
+	return norm;
+}
+
+#ifdef CNN_X86
+
+/// <summary>
+/// pshufb masks gathering one channel of 16 BGR pixels (48 bytes in three 16-byte loads) into 16 bytes:
+/// [channel (B, G, R)][load], -1 clears a byte so the three shuffles can be or'ed together.
+/// </summary>
+alignas(16) static const int8_t IMAGE_DEINTERLEAVE[3][3][16] = {
+	{ { 0, 3, 6, 9, 12, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
+	  { -1, -1, -1, -1, -1, -1, 2, 5, 8, 11, 14, -1, -1, -1, -1, -1 },
+	  { -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, 4, 7, 10, 13 } },
+	{ { 1, 4, 7, 10, 13, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
+	  { -1, -1, -1, -1, -1, 0, 3, 6, 9, 12, 15, -1, -1, -1, -1, -1 },
+	  { -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 2, 5, 8, 11, 14 } },
+	{ { 2, 5, 8, 11, 14, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
+	  { -1, -1, -1, -1, -1, 1, 4, 7, 10, 13, -1, -1, -1, -1, -1, -1 },
+	  { -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 3, 6, 9, 12, 15 } },
+};
+
+/// <summary>
+/// AVX2: 16 pixels per step, deinterleaved with pshufb and widened to floats 8 at a time. Returns the
+/// number of pixels converted; the caller finishes the row.
+/// </summary>
+CNN_TARGET_AVX2 inline int image_row_to_planar_avx2(const uint8_t* src, int cols, float* const planes[3],
+	const image_normalization& norm) {
+	__m128i masks[3][3];
+	__m256 scale[3];
+	__m256 offset[3];
+	for (int c = 0; c < 3; c++) {
+		for (int l = 0; l < 3; l++)
+			masks[c][l] = _mm_load_si128((const __m128i*)IMAGE_DEINTERLEAVE[c][l]);
+		// Planes are RGB, shuffles BGR.
+		scale[c] = _mm256_set1_ps(norm.scale[2 - c]);
+		offset[c] = _mm256_set1_ps(norm.offset[2 - c]);
+	}
+
+	int x = 0;
+	for (; x + 16 <= cols; x += 16) {
+		const uint8_t* p = src + 3 * x;
+		__m128i a = _mm_loadu_si128((const __m128i*)p);
+		__m128i b = _mm_loadu_si128((const __m128i*)(p + 16));
+		__m128i d = _mm_loadu_si128((const __m128i*)(p + 32));
+		for (int c = 0; c < 3; c++) {
+			__m128i bytes = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(a, masks[c][0]), _mm_shuffle_epi8(b, masks[c][1])),
+				_mm_shuffle_epi8(d, masks[c][2]));
+			__m256 lo = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(bytes));
+			__m256 hi = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_srli_si128(bytes, 8)));
+			float* out = planes[2 - c] + x;
+			_mm256_storeu_ps(out, _mm256_fmadd_ps(lo, scale[c], offset[c]));
+			_mm256_storeu_ps(out + 8, _mm256_fmadd_ps(hi, scale[c], offset[c]));
+		}
+	}
+	return x;
+}
+
+#endif
+
+/// <summary>
+/// Convert a CV_8UC3 BGR image into three RGB float planes of rows x cols starting at dst
+/// (plane stride rows * cols), e.g. one image of an NCHW Tensor.
+/// </summary>
+inline void image_to_planar(const cv::Mat& image, float* dst, const image_normalization& norm) {
+#ifdef CNN_X86
+	static const bool simd = cpu_best_isa() >= ISA_AVX2;
+#endif
+	size_t plane = (size_t)image.rows * image.cols;
+	for (int r = 0; r < image.rows; r++) {
+		const uint8_t* src = image.ptr<uint8_t>(r);
+		float* planes[3] = { dst + (size_t)r * image.cols, dst + plane + (size_t)r * image.cols, dst + 2 * plane + (size_t)r * image.cols };
+		int x = 0;
+#ifdef CNN_X86
+		if (simd)
+			x = image_row_to_planar_avx2(src, image.cols, planes, norm);
+#endif
+		for (; x < image.cols; x++) {
+			const uint8_t* pixel = src + 3 * x;
+			for (int c = 0; c < 3; c++)
+				planes[c][x] = pixel[2 - c] * norm.scale[c] + norm.offset[c];
+		}
+	}
+}
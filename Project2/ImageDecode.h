@@ -0,0 +1,132 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "CNNPipeline.h"
+#include <opencv2/opencv.hpp>
+
+using namespace std;
+using namespace cv;
+
+/// <summary>
+/// Rows and columns from a JPEG's frame header (SOFn), without decoding anything.
+/// </summary>
+/// <returns>false when the data is not a JPEG or has no frame header</returns>
+inline bool jpeg_dimensions(const uint8_t* data, size_t size, int& rows, int& cols) {
+	if (size < 4 || data[0] != 0xFF || data[1] != 0xD8)
+		return false;
+	size_t i = 2;
+	while (i + 4 <= size) {
+		if (data[i] != 0xFF)
+			return false;
+		uint8_t marker = data[i + 1];
+		if (marker == 0xFF) {	// fill byte
+			i++;
+			continue;
+		}
+		if (marker == 0x01 || (marker >= 0xD0 && marker <= 0xD9)) {	// no length
+			i += 2;
+			continue;
+		}
+		size_t length = ((size_t)data[i + 2] << 8) | data[i + 3];
+		bool frame = marker >= 0xC0 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 && marker != 0xCC;
+		if (frame) {
+			if (i + 9 > size)
+				return false;
+			rows = (data[i + 5] << 8) | data[i + 6];
+			cols = (data[i + 7] << 8) | data[i + 8];
+			return rows > 0 && cols > 0;
+		}
+		i += 2 + length;
+	}
+	return false;
+}
+
+/// <summary>
+/// imread / imdecode flag for an image that is only needed at size x size: the largest JPEG DCT downscale
+/// (1/2, 1/4, 1/8) that keeps both sides at least size, so the decoder skips most of the work and the
+/// final resize still only shrinks.
+/// </summary>
+inline int image_reduced_flag(int rows, int cols, int size) {
+	static const int scales[] = { 8, 4, 2 };
+	static const int flags[] = { IMREAD_REDUCED_COLOR_8, IMREAD_REDUCED_COLOR_4, IMREAD_REDUCED_COLOR_2 };
+	for (int i = 0; i < 3; i++) {
+		int s = scales[i];
+		if ((rows + s - 1) / s >= size && (cols + s - 1) / s >= size)
+			return flags[i];
+	}
+	return IMREAD_COLOR;
+}
+
+/// <summary>
+/// Preprocessing stage in front of CNNPipeline: encoded image (file or bytes) -> BGR INPUT_SIZE x INPUT_SIZE.
+/// JPEGs are decoded at reduced resolution (see image_reduced_flag), then CNNPipeline::FitInput resizes, or
+/// with crop takes the centered square first. The returned image stays valid until the next call;
+/// buffers are reused, one decoder per thread.
+/// </summary>
+class ImageDecoder {
+public:
+	explicit ImageDecoder(bool crop = false) : crop(crop) {}
+
+	/// <returns>an empty Mat when the file cannot be read or decoded</returns>
+	const Mat& Read(const string& path) {
+		FILE* file = fopen(path.c_str(), "rb");
+		if (file == nullptr)
+			return Fail();
+		encoded.clear();
+		unsigned char chunk[65536];
+		size_t count;
+		while ((count = fread(chunk, 1, sizeof(chunk), file)) > 0)
+			encoded.insert(encoded.end(), chunk, chunk + count);
+		fclose(file);
+		return Decode(encoded);
+	}
+
+	/// <returns>an empty Mat when the bytes cannot be decoded</returns>
+	const Mat& Decode(const vector<unsigned char>& bytes) {
+		if (bytes.empty())
+			return Fail();
+		int flag = IMREAD_COLOR;
+		int rows, cols;
+		if (jpeg_dimensions(bytes.data(), bytes.size(), rows, cols))
+			flag = image_reduced_flag(rows, cols, CNNPipeline::INPUT_SIZE);
+		decoded = imdecode(bytes, flag);
+		if (decoded.empty())
+			return Fail();
+		return CNNPipeline::FitInput(decoded, fitted, crop);
+	}
+
+private:
+	bool crop;
+	vector<unsigned char> encoded;
+	Mat decoded;
+	Mat fitted;
+
+	const Mat& Fail() {
+		decoded.release();
+		return decoded;
+	}
+};
+
+/// <summary>
+/// Read every image matching an -img argument (a single path or a wildcard pattern) with ImageDecoder,
+/// fitted to the input size; files that cannot be decoded are skipped.
+/// </summary>
+inline vector<Mat> cnn_read_images(const string& pattern, bool crop) {
+	vector<String> files;
+	if (pattern.find_first_of("*?") != string::npos)
+		glob(pattern, files, false);
+	else
+		files.push_back(pattern);
+
+	ImageDecoder decoder(crop);
+	vector<Mat> images;
+	for (const String& file : files) {
+		const Mat& image = decoder.Read(file);
+		if (!image.empty())
+			images.push_back(image.clone());
+	}
+	return images;
+}
@@ -0,0 +1,303 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include "CpuFeatures.h"
+#ifdef CNN_X86
+#include <immintrin.h>
+#endif
+using namespace std;
+
+/// <summary>
+/// INT8 matrix kernels of CNNInt8: out[oc][pixel] = sum_k x[pixel][k] * w[oc][k] with unsigned 8-bit
+/// activations, signed 8-bit weights and 32-bit accumulation, requantized to float in the same pass.
+/// K is processed in groups of 4 bytes, the unit of vpmaddubsw / vpdpbusd. Activations are laid out as
+/// [pixel block][k group][INT8_PIXELS][4], so one 64-byte load holds a k group of 16 pixels; the 4 weight
+/// bytes of an output channel are broadcast against it and each accumulator is 16 pixels of one channel,
+/// stored straight into the CHW output.
+/// Activations use 0..255 with vpdpbusd (and the scalar kernel), which accumulate straight into int32. The AVX2
+/// kernel limits them to 0..127 (7 bits): vpmaddubsw adds two u8 x s8 products into a saturating int16, and
+/// 2 x 127 x 127 is the largest sum that cannot saturate. AVX2 results are therefore slightly less accurate.
+/// </summary>
+static const int INT8_PIXELS = 16;	// pixels per block, one zmm of int32
+static const int INT8_OC_BLOCK = 8;	// output channels per kernel call
+static const int INT8_ACTIVATION_MAX = 255;
+static const int INT8_MADDUBS_ACTIVATION_MAX = 127;
+static const int INT8_WEIGHT_MAX = 127;
+
+/// <summary>
+/// Per-output-channel symmetric quantization of OIHW float weights: w ~= packed * scale[oc].
+/// K runs (ky, kx, input channel) with the input channels padded to whole k groups, matching activations
+/// stored HWC with channel_groups * 4 bytes per pixel: every k group is then 4 channels of one input pixel.
+/// sum[oc] is the sum of the quantized weights, used to remove the activation zero point.
+/// Output channels are padded to a multiple of INT8_OC_BLOCK with zero weights.
+/// </summary>
+typedef struct int8_weights {
+	int out_channels = 0;
+	int channel_groups = 0;	// input channels / 4 rounded up
+	int kernel_size = 0;
+	int k_groups = 0;	// kernel_size^2 * channel_groups
+	vector<int8_t> packed;	// [padded out_channels][k_groups][4]
+	vector<float> scale;
+	vector<int32_t> sum;
+	vector<float> bias;
+}int8_weights;
+
+/// <summary>
+/// Per-tensor asymmetric quantization of activations: x ~= (q - zero_point) * scale, q in 0..levels.
+/// Zero is always exactly representable, so padding is the zero point.
+/// </summary>
+typedef struct int8_activation {
+	float scale = 1.f;
+	int zero_point = 0;
+	int levels = INT8_ACTIVATION_MAX;
+}int8_activation;
+
+/// <summary>
+/// One kernel call: a block of INT8_PIXELS pixels against INT8_OC_BLOCK output channels.
+/// Channel j, pixel p is written as (acc - offset[j]) * scale[j] + bias[j] to out[j * out_stride + p].
+/// </summary>
+typedef struct int8_job {
+	const uint8_t* x;		// [k_groups][INT8_PIXELS][4]
+	const int8_t* w;		// [INT8_OC_BLOCK][k_groups][4]
+	int k_groups;
+	const float* scale;		// activation scale x weight scale, per channel
+	const int32_t* offset;	// activation zero point x weight sum, per channel
+	const float* bias;
+	float* out;
+	size_t out_stride;
+	int channels;			// valid channels of the block
+	int pixels;				// valid pixels of the block
+}int8_job;
+
+typedef void (*int8_kernel)(const int8_job& job);
+
+inline int int8_padded_channels(int out_channels) {
+	return (out_channels + INT8_OC_BLOCK - 1) / INT8_OC_BLOCK * INT8_OC_BLOCK;
+}
+
+inline void int8_quantize_weights(const float* weight, const float* bias, int out_channels, int in_channels,
+	int kernel_size, int8_weights& q) {
+	int padded = int8_padded_channels(out_channels);
+	int window = kernel_size * kernel_size;
+	size_t k_size = (size_t)in_channels * window;
+	q.out_channels = out_channels;
+	q.channel_groups = (in_channels + 3) / 4;
+	q.kernel_size = kernel_size;
+	q.k_groups = window * q.channel_groups;
+	q.packed.assign((size_t)padded * q.k_groups * 4, 0);
+	q.scale.assign(padded, 0.f);
+	q.sum.assign(padded, 0);
+	q.bias.assign(padded, 0.f);
+
+	for (int oc = 0; oc < out_channels; oc++) {
+		const float* row = weight + oc * k_size;
+		float range = 0.f;
+		for (size_t k = 0; k < k_size; k++)
+			range = std::max(range, fabs(row[k]));
+		float scale = range > 0.f ? range / INT8_WEIGHT_MAX : 1.f;
+		q.scale[oc] = scale;
+		q.bias[oc] = bias[oc];
+
+		int8_t* packed = q.packed.data() + (size_t)oc * q.k_groups * 4;
+		for (int ic = 0; ic < in_channels; ic++) {
+			for (int k = 0; k < window; k++) {
+				int value = (int)lrintf(row[ic * window + k] / scale);
+				value = std::max(-INT8_WEIGHT_MAX, std::min(INT8_WEIGHT_MAX, value));
+				packed[k * q.channel_groups * 4 + ic] = (int8_t)value;
+				q.sum[oc] += value;
+			}
+		}
+	}
+}
+
+/// <summary>
+/// Range of count values; negative values only when the data has them (post-Relu activations do not).
+/// Eight independent partial ranges let the compiler vectorize the scan.
+/// </summary>
+inline int8_activation int8_choose_activation(const float* data, size_t count, int levels) {
+	float lo[8] = {}, hi[8] = {};
+	size_t i = 0;
+	for (; i + 8 <= count; i += 8) {
+		for (int j = 0; j < 8; j++) {
+			lo[j] = data[i + j] < lo[j] ? data[i + j] : lo[j];
+			hi[j] = data[i + j] > hi[j] ? data[i + j] : hi[j];
+		}
+	}
+	for (; i < count; i++) {
+		lo[0] = std::min(lo[0], data[i]);
+		hi[0] = std::max(hi[0], data[i]);
+	}
+	for (int j = 1; j < 8; j++) {
+		lo[0] = std::min(lo[0], lo[j]);
+		hi[0] = std::max(hi[0], hi[j]);
+	}
+
+	int8_activation a;
+	a.levels = levels;
+	if (hi[0] > lo[0]) {
+		a.scale = (hi[0] - lo[0]) / levels;
+		a.zero_point = (int)lrintf(-lo[0] / a.scale);
+	}
+	return a;
+}
+
+/// <summary>
+/// Round to the nearest level, storing every stride-th byte. data * inverse + zero_point is at least -0.5 for
+/// any value of the chosen range, so adding 0.5 and truncating rounds (halves up) without a libm call.
+/// Strided output is produced in vectorizable chunks and scattered afterwards.
+/// </summary>
+inline void int8_quantize_activation(const float* data, size_t count, const int8_activation& a, uint8_t* q, size_t stride = 1) {
+	// Locals: the byte stores could alias a, which would keep the loop from vectorizing.
+	float inverse = 1.f / a.scale;
+	float offset = a.zero_point + 0.5f;
+	int levels = a.levels;
+	uint8_t chunk[64];
+	for (size_t i0 = 0; i0 < count; i0 += sizeof(chunk)) {
+		size_t n = std::min(sizeof(chunk), count - i0);
+		uint8_t* dst = stride == 1 ? q + i0 : chunk;
+		for (size_t i = 0; i < n; i++) {
+			int value = (int)(data[i0 + i] * inverse + offset);
+			dst[i] = (uint8_t)std::max(0, std::min(levels, value));
+		}
+		if (stride != 1) {
+			for (size_t i = 0; i < n; i++)
+				q[(i0 + i) * stride] = chunk[i];
+		}
+	}
+}
+
+static void int8_kernel_scalar(const int8_job& job) {
+	for (int j = 0; j < job.channels; j++) {
+		const int8_t* w = job.w + (size_t)j * job.k_groups * 4;
+		float* out = job.out + j * job.out_stride;
+		for (int p = 0; p < job.pixels; p++) {
+			int32_t sum = 0;
+			for (int g = 0; g < job.k_groups; g++) {
+				const uint8_t* x = job.x + ((size_t)g * INT8_PIXELS + p) * 4;
+				sum += x[0] * w[4 * g] + x[1] * w[4 * g + 1] + x[2] * w[4 * g + 2] + x[3] * w[4 * g + 3];
+			}
+			out[p] = (sum - job.offset[j]) * job.scale[j] + job.bias[j];
+		}
+	}
+}
+
+#ifdef CNN_X86
+
+static inline int32_t int8_load_group(const int8_t* p) {
+	int32_t v;
+	memcpy(&v, p, sizeof(v));
+	return v;
+}
+
+/// <summary>
+/// AVX2: vpmaddubsw (u8 x s8 pairs -> int16) + vpmaddwd by 1 (-> int32). 16 pixels are two registers, so the
+/// channel block runs as two halves of 4 channels (8 accumulators each).
+/// </summary>
+CNN_TARGET_AVX2 static void int8_kernel_avx2(const int8_job& job) {
+	const __m256i ones = _mm256_set1_epi16(1);
+	size_t row = (size_t)job.k_groups * 4;
+	for (int j0 = 0; j0 < job.channels; j0 += 4) {
+		const int8_t* w0 = job.w + j0 * row;
+		const int8_t* w1 = w0 + row;
+		const int8_t* w2 = w1 + row;
+		const int8_t* w3 = w2 + row;
+		__m256i a00 = _mm256_setzero_si256(), a01 = a00, a10 = a00, a11 = a00;
+		__m256i a20 = a00, a21 = a00, a30 = a00, a31 = a00;
+		for (int g = 0; g < job.k_groups; g++) {
+			__m256i x0 = _mm256_loadu_si256((const __m256i*)(job.x + (size_t)g * INT8_PIXELS * 4));
+			__m256i x1 = _mm256_loadu_si256((const __m256i*)(job.x + (size_t)g * INT8_PIXELS * 4 + 32));
+			__m256i wv;
+			wv = _mm256_set1_epi32(int8_load_group(w0 + 4 * g));
+			a00 = _mm256_add_epi32(a00, _mm256_madd_epi16(_mm256_maddubs_epi16(x0, wv), ones));
+			a01 = _mm256_add_epi32(a01, _mm256_madd_epi16(_mm256_maddubs_epi16(x1, wv), ones));
+			wv = _mm256_set1_epi32(int8_load_group(w1 + 4 * g));
+			a10 = _mm256_add_epi32(a10, _mm256_madd_epi16(_mm256_maddubs_epi16(x0, wv), ones));
+			a11 = _mm256_add_epi32(a11, _mm256_madd_epi16(_mm256_maddubs_epi16(x1, wv), ones));
+			wv = _mm256_set1_epi32(int8_load_group(w2 + 4 * g));
+			a20 = _mm256_add_epi32(a20, _mm256_madd_epi16(_mm256_maddubs_epi16(x0, wv), ones));
+			a21 = _mm256_add_epi32(a21, _mm256_madd_epi16(_mm256_maddubs_epi16(x1, wv), ones));
+			wv = _mm256_set1_epi32(int8_load_group(w3 + 4 * g));
+			a30 = _mm256_add_epi32(a30, _mm256_madd_epi16(_mm256_maddubs_epi16(x0, wv), ones));
+			a31 = _mm256_add_epi32(a31, _mm256_madd_epi16(_mm256_maddubs_epi16(x1, wv), ones));
+		}
+
+		__m256i acc[4][2] = { { a00, a01 }, { a10, a11 }, { a20, a21 }, { a30, a31 } };
+		for (int q = 0; q < 4 && j0 + q < job.channels; q++) {
+			int j = j0 + q;
+			__m256i offset = _mm256_set1_epi32(job.offset[j]);
+			__m256 scale = _mm256_set1_ps(job.scale[j]);
+			__m256 bias = _mm256_set1_ps(job.bias[j]);
+			__m256 v0 = _mm256_fmadd_ps(_mm256_cvtepi32_ps(_mm256_sub_epi32(acc[q][0], offset)), scale, bias);
+			__m256 v1 = _mm256_fmadd_ps(_mm256_cvtepi32_ps(_mm256_sub_epi32(acc[q][1], offset)), scale, bias);
+			float* out = job.out + j * job.out_stride;
+			if (job.pixels == INT8_PIXELS) {
+				_mm256_storeu_ps(out, v0);
+				_mm256_storeu_ps(out + 8, v1);
+				continue;
+			}
+			alignas(32) float tile[INT8_PIXELS];
+			_mm256_store_ps(tile, v0);
+			_mm256_store_ps(tile + 8, v1);
+			for (int p = 0; p < job.pixels; p++)
+				out[p] = tile[p];
+		}
+	}
+}
+
+/// <summary>
+/// AVX-512 VNNI: one vpdpbusd per channel and k group accumulates 4 products of 16 pixels; 8 accumulators.
+/// </summary>
+CNN_TARGET_AVX512VNNI static void int8_kernel_vnni(const int8_job& job) {
+	size_t row = (size_t)job.k_groups * 4;
+	const int8_t* w = job.w;
+	__m512i a0 = _mm512_setzero_si512(), a1 = a0, a2 = a0, a3 = a0, a4 = a0, a5 = a0, a6 = a0, a7 = a0;
+	for (int g = 0; g < job.k_groups; g++) {
+		__m512i x = _mm512_loadu_si512((const void*)(job.x + (size_t)g * INT8_PIXELS * 4));
+		const int8_t* k = w + 4 * g;
+		a0 = _mm512_dpbusd_epi32(a0, x, _mm512_set1_epi32(int8_load_group(k)));
+		a1 = _mm512_dpbusd_epi32(a1, x, _mm512_set1_epi32(int8_load_group(k + row)));
+		a2 = _mm512_dpbusd_epi32(a2, x, _mm512_set1_epi32(int8_load_group(k + 2 * row)));
+		a3 = _mm512_dpbusd_epi32(a3, x, _mm512_set1_epi32(int8_load_group(k + 3 * row)));
+		a4 = _mm512_dpbusd_epi32(a4, x, _mm512_set1_epi32(int8_load_group(k + 4 * row)));
+		a5 = _mm512_dpbusd_epi32(a5, x, _mm512_set1_epi32(int8_load_group(k + 5 * row)));
+		a6 = _mm512_dpbusd_epi32(a6, x, _mm512_set1_epi32(int8_load_group(k + 6 * row)));
+		a7 = _mm512_dpbusd_epi32(a7, x, _mm512_set1_epi32(int8_load_group(k + 7 * row)));
+	}
+
+	__m512i acc[INT8_OC_BLOCK] = { a0, a1, a2, a3, a4, a5, a6, a7 };
+	__mmask16 mask = (__mmask16)(job.pixels >= INT8_PIXELS ? 0xffff : (1u << job.pixels) - 1);
+	for (int j = 0; j < job.channels; j++) {
+		__m512 v = _mm512_cvtepi32_ps(_mm512_sub_epi32(acc[j], _mm512_set1_epi32(job.offset[j])));
+		v = _mm512_fmadd_ps(v, _mm512_set1_ps(job.scale[j]), _mm512_set1_ps(job.bias[j]));
+		_mm512_mask_storeu_ps(job.out + j * job.out_stride, mask, v);
+	}
+}
+
+#endif
+
+/// <summary>
+/// Fastest kernel for this machine, its name and the activation levels it can take.
+/// CNN_ISA below avx512 disables VNNI, below avx2 every SIMD kernel.
+/// </summary>
+inline int8_kernel int8_select_kernel(const char*& name, int& levels) {
+	name = "scalar";
+	levels = INT8_ACTIVATION_MAX;
+#ifdef CNN_X86
+	const CpuFeatures& f = cpu_features();
+	CpuIsa isa = cpu_best_isa();
+	if (isa >= ISA_AVX512 && f.avx512bw && f.avx512vnni) {
+		name = "avx512vnni";
+		return int8_kernel_vnni;
+	}
+	if (isa >= ISA_AVX2) {
+		name = "avx2";
+		levels = INT8_MADDUBS_ACTIVATION_MAX;
+		return int8_kernel_avx2;
+	}
+#endif
+	return int8_kernel_scalar;
+}
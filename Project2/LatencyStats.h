@@ -0,0 +1,54 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+using namespace std;
+
+/// <summary>
+/// Summary of latency samples in milliseconds: mean, nearest-rank percentiles and the maximum.
+/// </summary>
+typedef struct latency_stats {
+	int count = 0;
+	double mean = 0;
+	double p50 = 0;
+	double p90 = 0;
+	double p99 = 0;
+	double max = 0;
+}latency_stats;
+
+/// <summary>
+/// Nearest-rank percentile of sorted, non-empty samples.
+/// </summary>
+inline double latency_percentile(const vector<double>& sorted, double p) {
+	size_t rank = (size_t)ceil(p / 100 * sorted.size());
+	return sorted[std::min(sorted.size() - 1, rank > 0 ? rank - 1 : 0)];
+}
+
+/// <summary>
+/// Summary of samples in any order; all zero when there are none.
+/// </summary>
+inline latency_stats latency_summary(vector<double> samples) {
+	latency_stats stats;
+	if (samples.empty())
+		return stats;
+	sort(samples.begin(), samples.end());
+	double total = 0;
+	for (double ms : samples)
+		total += ms;
+	stats.count = (int)samples.size();
+	stats.mean = total / samples.size();
+	stats.p50 = latency_percentile(samples, 50);
+	stats.p90 = latency_percentile(samples, 90);
+	stats.p99 = latency_percentile(samples, 99);
+	stats.max = samples.back();
+	return stats;
+}
+
+/// <summary>
+/// Prints "mean: ...ms p50: ...ms p90: ...ms p99: ...ms max: ...ms" and a newline.
+/// </summary>
+inline void print_latency(FILE* out, const latency_stats& stats) {
+	fprintf(out, "mean: %.3fms p50: %.3fms p90: %.3fms p99: %.3fms max: %.3fms\n",
+		stats.mean, stats.p50, stats.p90, stats.p99, stats.max);
+}
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+/// <summary>
+/// Bounded lock-free multi-producer multi-consumer queue (Dmitry Vyukov's array queue).
+/// Every cell carries a sequence number: a producer may fill cell i when sequence == position, a consumer
+/// may empty it when sequence == position + 1. A single CAS on the shared position claims a cell, so
+/// producers and consumers only contend on their own end of the queue.
+/// Capacity is rounded up to a power of two.
+/// </summary>
+template <typename T>
+class MPMCQueue {
+public:
+	explicit MPMCQueue(size_t capacity) {
+		size_t size = 2;
+		while (size < capacity)
+			size *= 2;
+		cells = std::vector<Cell>(size);
+		mask = size - 1;
+		for (size_t i = 0; i < size; i++)
+			cells[i].sequence.store(i, std::memory_order_relaxed);
+		enqueuePos.store(0, std::memory_order_relaxed);
+		dequeuePos.store(0, std::memory_order_relaxed);
+	}
+
+	MPMCQueue(const MPMCQueue&) = delete;
+	MPMCQueue& operator=(const MPMCQueue&) = delete;
+
+	/// <summary>
+	/// False when the queue is full.
+	/// </summary>
+	bool TryPush(T&& value) {
+		size_t pos = enqueuePos.load(std::memory_order_relaxed);
+		for (;;) {
+			Cell& cell = cells[pos & mask];
+			size_t sequence = cell.sequence.load(std::memory_order_acquire);
+			intptr_t diff = (intptr_t)sequence - (intptr_t)pos;
+			if (diff == 0) {
+				if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+					cell.value = std::move(value);
+					cell.sequence.store(pos + 1, std::memory_order_release);
+					return true;
+				}
+			}
+			else if (diff < 0) {
+				return false;
+			}
+			else {
+				pos = enqueuePos.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	/// <summary>
+	/// False when the queue is empty.
+	/// </summary>
+	bool TryPop(T& value) {
+		size_t pos = dequeuePos.load(std::memory_order_relaxed);
+		for (;;) {
+			Cell& cell = cells[pos & mask];
+			size_t sequence = cell.sequence.load(std::memory_order_acquire);
+			intptr_t diff = (intptr_t)sequence - (intptr_t)(pos + 1);
+			if (diff == 0) {
+				if (dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+					value = std::move(cell.value);
+					cell.sequence.store(pos + mask + 1, std::memory_order_release);
+					return true;
+				}
+			}
+			else if (diff < 0) {
+				return false;
+			}
+			else {
+				pos = dequeuePos.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	/// <summary>
+	/// Blocking variants: spin briefly, then yield the core while the other side catches up.
+	/// </summary>
+	void Push(T value) {
+		for (int spin = 0; !TryPush(std::move(value)); spin++)
+			Backoff(spin);
+	}
+
+	void Pop(T& value) {
+		for (int spin = 0; !TryPop(value); spin++)
+			Backoff(spin);
+	}
+
+private:
+	struct Cell {
+		std::atomic<size_t> sequence;
+		T value;
+
+		Cell() : sequence(0) {}
+		Cell(Cell&& other) noexcept : sequence(other.sequence.load()), value(std::move(other.value)) {}
+		Cell& operator=(Cell&& other) noexcept {
+			sequence.store(other.sequence.load());
+			value = std::move(other.value);
+			return *this;
+		}
+	};
+
+	// Producer and consumer positions on separate cache lines.
+	alignas(64) std::vector<Cell> cells;
+	size_t mask = 0;
+	alignas(64) std::atomic<size_t> enqueuePos;
+	alignas(64) std::atomic<size_t> dequeuePos;
+
+	static void Backoff(int spin) {
+		if (spin > 64)
+			std::this_thread::yield();
+	}
+};
@@ -0,0 +1,149 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <utility>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/// <summary>
+/// Binary model file (little endian), written by CNNModel::SaveBinary and mapped by CNNModel::LoadBinary:
+///		cnn_model_header						64 bytes
+///		cnn_layer_desc[layer_count]				64 bytes each, in execution order
+///		weight and bias blobs					float32, each starting on a 64-byte boundary
+/// Blob offsets are from the start of the file, so a mapped file is used in place: the weights are shared
+/// read-only between every engine and every process that maps the same file.
+/// </summary>
+static const char CNN_MODEL_MAGIC[8] = { 'C', 'N', 'N', 'M', 'O', 'D', 'E', 'L' };
+static const uint32_t CNN_MODEL_VERSION = 1;
+static const uint32_t CNN_MODEL_ALIGNMENT = 64;
+
+enum CnnModelFlags {
+	CNN_MODEL_FOLDED = 1	// batch normalization folded into the conv weights, blocks must not normalize
+};
+
+enum CnnLayerType {
+	CNN_LAYER_CONV = 1,	// convolution block: conv (+ batch normalization unless folded) + relu + max pooling
+	CNN_LAYER_FC = 2	// fully connected on the flattened activation
+};
+
+typedef struct cnn_model_header {
+	char magic[8];
+	uint32_t version;
+	uint32_t flags;
+	uint32_t layer_count;
+	uint32_t input_channels;
+	uint32_t input_rows;
+	uint32_t input_cols;
+	uint64_t file_size;
+	uint8_t reserved[24];
+}cnn_model_header;
+
+typedef struct cnn_layer_desc {
+	uint32_t type;
+	uint32_t pad;
+	uint32_t stride;
+	uint32_t kernel_size;
+	uint32_t in_channels;	// in_features for CNN_LAYER_FC
+	uint32_t out_channels;	// out_features for CNN_LAYER_FC
+	uint32_t pool;			// max pooling size after the block, 1 = none
+	uint32_t reserved;
+	uint64_t weight_offset;
+	uint64_t weight_count;
+	uint64_t bias_offset;
+	uint64_t bias_count;
+}cnn_layer_desc;
+
+static_assert(sizeof(cnn_model_header) == 64, "cnn_model_header must stay 64 bytes");
+static_assert(sizeof(cnn_layer_desc) == 64, "cnn_layer_desc must stay 64 bytes");
+
+/// <summary>
+/// Read-only memory mapping of a whole file; movable, not copyable.
+/// </summary>
+class MappedFile {
+public:
+	MappedFile() {}
+	~MappedFile() { Close(); }
+
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+	MappedFile(MappedFile&& other) noexcept { *this = std::move(other); }
+	MappedFile& operator=(MappedFile&& other) noexcept {
+		if (this != &other) {
+			Close();
+			address = other.address;
+			length = other.length;
+			other.address = nullptr;
+			other.length = 0;
+		}
+		return *this;
+	}
+
+	/// <returns>false when the file cannot be opened or is empty</returns>
+	bool Open(const std::string& path) {
+		Close();
+#ifdef _WIN32
+		HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (file == INVALID_HANDLE_VALUE)
+			return false;
+		LARGE_INTEGER size;
+		HANDLE mapping = nullptr;
+		if (GetFileSizeEx(file, &size) && size.QuadPart > 0)
+			mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		CloseHandle(file);
+		if (mapping == nullptr)
+			return false;
+		address = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+		CloseHandle(mapping);
+		if (address == nullptr)
+			return false;
+		length = (size_t)size.QuadPart;
+#else
+		int file = open(path.c_str(), O_RDONLY);
+		if (file < 0)
+			return false;
+		struct stat info;
+		void* p = MAP_FAILED;
+		if (fstat(file, &info) == 0 && info.st_size > 0)
+			p = mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_SHARED, file, 0);
+		close(file);
+		if (p == MAP_FAILED)
+			return false;
+		address = p;
+		length = (size_t)info.st_size;
+#endif
+		return true;
+	}
+
+	void Close() {
+		if (address == nullptr)
+			return;
+#ifdef _WIN32
+		UnmapViewOfFile(address);
+#else
+		munmap(address, length);
+#endif
+		address = nullptr;
+		length = 0;
+	}
+
+	const unsigned char* data() const { return (const unsigned char*)address; }
+	size_t size() const { return length; }
+
+private:
+	void* address = nullptr;
+	size_t length = 0;
+};
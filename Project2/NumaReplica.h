@@ -0,0 +1,176 @@
+#pragma once
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+#include "CNNModel.h"
+#include "ThreadPool.h"
+using namespace std;
+
+/// <summary>
+/// A NUMA node and the CPUs of it this process may run on.
+/// </summary>
+typedef struct numa_node {
+	int id;
+	vector<int> cpus;
+}numa_node;
+
+/// <summary>
+/// CPU numbers of a Linux cpulist such as "0-3,8-11".
+/// </summary>
+inline vector<int> parse_cpu_list(const string& text) {
+	vector<int> cpus;
+	size_t start = 0;
+	while (start < text.size()) {
+		size_t end = text.find(',', start);
+		if (end == string::npos)
+			end = text.size();
+		int first, last;
+		int fields = sscanf(text.substr(start, end - start).c_str(), "%d-%d", &first, &last);
+		if (fields == 1)
+			last = first;
+		for (int cpu = first; fields >= 1 && cpu <= last; cpu++)
+			cpus.push_back(cpu);
+		start = end + 1;
+	}
+	return cpus;
+}
+
+/// <summary>
+/// The NUMA nodes that have CPUs this process may run on, in node order. Without NUMA information (single
+/// socket, no sysfs, macOS) every available CPU belongs to node 0.
+/// </summary>
+inline vector<numa_node> numa_nodes() {
+	vector<int> available = ThreadPool::AvailableCpus();
+	vector<numa_node> nodes;
+#ifdef _WIN32
+	ULONG highest = 0;
+	if (GetNumaHighestNodeNumber(&highest)) {
+		for (ULONG id = 0; id <= highest; id++) {
+			ULONGLONG mask = 0;
+			if (!GetNumaNodeProcessorMask((UCHAR)id, &mask))
+				continue;
+			numa_node node = { (int)id, {} };
+			for (int cpu : available) {
+				if (cpu < 64 && ((mask >> cpu) & 1))
+					node.cpus.push_back(cpu);
+			}
+			if (!node.cpus.empty())
+				nodes.push_back(node);
+		}
+	}
+#elif defined(__linux__)
+	// Node numbers may have gaps (offline or memory-only nodes); stop after a long run of missing ones.
+	for (int id = 0, missing = 0; missing < 64; id++) {
+		string path = "/sys/devices/system/node/node" + to_string(id) + "/cpulist";
+		FILE* file = fopen(path.c_str(), "r");
+		if (file == nullptr) {
+			missing++;
+			continue;
+		}
+		missing = 0;
+		char line[4096] = {};
+		bool read = fgets(line, sizeof(line), file) != nullptr;
+		fclose(file);
+		numa_node node = { id, {} };
+		for (int cpu : read ? parse_cpu_list(line) : vector<int>()) {
+			if (find(available.begin(), available.end(), cpu) != available.end())
+				node.cpus.push_back(cpu);
+		}
+		if (!node.cpus.empty())
+			nodes.push_back(node);
+	}
+#endif
+	if (nodes.empty()) {
+		numa_node all = { 0, available };
+		if (all.cpus.empty()) {
+			for (int cpu = 0; cpu < (int)std::max(1u, std::thread::hardware_concurrency()); cpu++)
+				all.cpus.push_back(cpu);
+		}
+		nodes.push_back(all);
+	}
+	return nodes;
+}
+
+/// <summary>
+/// One NUMA node's share of a multi-socket deployment: a ThreadPool with a thread pinned to each CPU of the
+/// node, and a replica of the model (CNNModel::Replicate) written from the node.
+/// Launch runs code on a thread pinned to the node and bound to its pool, so whatever it allocates (engines
+/// with their pre-packed weights, pipeline arenas, decoded images) is first touched there, and its parallel
+/// layers only use the node's threads. Requests handed to one replica never read another node's memory;
+/// the nodes only share the queues that route requests to them.
+/// </summary>
+class NumaReplica {
+public:
+	/// <param name="source">copied, not referenced afterwards</param>
+	NumaReplica(const numa_node& node, const CNNModel& source) : node(node), pool(node.cpus) {
+		Launch([this, &source] { model.Replicate(source); }).join();
+	}
+
+	// The pool's workers and Launch threads refer to this object.
+	NumaReplica(const NumaReplica&) = delete;
+	NumaReplica& operator=(const NumaReplica&) = delete;
+
+	const numa_node& Node() const {
+		return node;
+	}
+
+	/// <summary>
+	/// The node-local copy of the model.
+	/// </summary>
+	const CNNModel* Model() const {
+		return &model;
+	}
+
+	/// <summary>
+	/// Threads of the node, one per CPU.
+	/// </summary>
+	int Concurrency() const {
+		return pool.Concurrency();
+	}
+
+	/// <summary>
+	/// A thread running body() pinned to the node's CPUs and bound to its pool; the caller joins it.
+	/// </summary>
+	template <typename Body>
+	thread Launch(Body body) {
+		return thread([this, body]() mutable {
+			ThreadPool::PinThread(node.cpus);
+			ThreadPool::Binding binding(pool);
+			body();
+		});
+	}
+
+	/// <summary>
+	/// body(worker) for every worker in [0, Concurrency()), one per thread of the node at the same time, e.g.
+	/// request loops that each own an engine and a pipeline. Call on a Launch thread; returns when every
+	/// worker returned. Idle threads keep stealing the layer tiles of the workers still busy.
+	/// </summary>
+	template <typename Body>
+	void RunWorkers(const Body& body) {
+		pool.ParallelFor(Concurrency(), 1, [&body](int begin, int end) {
+			for (int i = begin; i < end; i++)
+				body(i);
+		});
+	}
+
+	/// <summary>
+	/// One replica per node of nodes, at most count of them (&lt;= 0: all). The caller deletes them.
+	/// </summary>
+	static vector<NumaReplica*> Create(const vector<numa_node>& nodes, const CNNModel& source, int count = 0) {
+		vector<NumaReplica*> replicas;
+		for (const numa_node& node : nodes) {
+			if (count > 0 && (int)replicas.size() == count)
+				break;
+			replicas.push_back(new NumaReplica(node, source));
+		}
+		return replicas;
+	}
+
+private:
+	numa_node node;
+	ThreadPool pool;
+	CNNModel model;
+};
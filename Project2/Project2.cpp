@@ -2,27 +2,53 @@
 //
 #include "face_binary_cls.h"
 #include <iostream>
+#include <sstream>
+#include <thread>
 #include <vector>
-#include "CNNBruteforce.cpp"
-#include "CNNOptimized.cpp"
-#include "CNNPlayground.cpp"
+#include "Tensor.h"
+#include "CNNModel.h"
+#include "CNNPipeline.h"
+#include "ImageDecode.h"
+#include "CNNParity.cpp"
+#include "CNNServer.cpp"
+#include "CNNScanner.cpp"
+#include "CNNDetector.cpp"
+#include "CNNVideo.cpp"
+#include "NumaReplica.h"
+#include "ThreadPool.h"
 #include <opencv2/opencv.hpp>
 
 using namespace std;
 using namespace cv;
 
-CNNBase* CNNBase::make_cnnbase(int choice) {
-	if (choice == 0)
-		return new CNNBruteforce;
-	else if (choice == 1)
-		return new CNNOptimized;
-	else
-		return new CNNPlayground;
-}
-
 typedef struct cnn_arg {
-	int option;
+	int option = -1;	// make_cnnbase choice; --parity: -1 checks every engine
 	string image;
+	bool crop = false;	// fit images by their centered square instead of stretching them
+	float check_tolerance = 0; // > 0: compare against CNNBruteforce instead of classifying
+	float parity_tolerance = 0;	// > 0: run the parity suite over every engine
+	long long parity_ulps = 64;	// checks within this many ulps pass regardless of relative error
+	int parity_random = 4;	// synthetic random inputs added to the parity suite
+	string model;	// binary model file to map instead of the compiled-in weights
+	string export_model;	// write the model (with -bn folded in) to this binary file
+	string batchnorm;	// stored batch normalization to fold into the weights, empty: per-image statistics
+	string calibrate;	// write stored batch normalization computed over the image(s) to this file
+	vector<int> batch_sizes;	// non-empty: measure ClassifyBatch throughput at these batch sizes
+	bool serve = false;	// keep the engine warm and classify requests
+	string socket;	// serve on this Unix domain socket instead of stdin
+	string scan_dir;	// classify every image below this directory
+	string scan_list;	// classify every path listed in this file
+	string output;	// scan results file, empty: stdout
+	string format = "csv";	// scan results: csv or jsonl
+	bool unordered = false;	// scan results as they complete instead of in input order
+	int threads = 0;	// threads of the pool the layers and scan workers share, 0: CNN_THREADS or one per core
+	bool pin = false;	// pin the pool threads to cores
+	int decoders = 0;	// scan decode threads, 0: half the workers
+	int numa = 0;	// scan: model replica and workers on this many NUMA nodes, < 0: every node, 0: one shared model
+	float detect_threshold = 0;	// > 0: sliding-window face detection over -img with this face probability
+	int min_face = CNNDetector::WINDOW;	// smallest face (pixels) the detection pyramid looks for
+	string video;	// classify (or with --detect, detect faces in) every frame of this VideoCapture source
+	int change_threshold = -1;	// video: reuse the features of regions that changed by at most this much, < 0: never
 }cnn_arg;
 
 static void show_usage()
@@ -34,7 +60,36 @@ static void show_usage()
 	cout << "\t\t0:CNNBruteforce\n";
 	cout << "\t\t1:CNNOptimized\n";
 	cout << "\t\t2:CNNPlayground\n";
+	cout << "\t\t3:CNNGemm (im2col + blocked SGEMM, Winograd for stride-1 3x3)\n";
+	cout << "\t\t4:CNNSimd (SSE2/AVX2/AVX-512 3x3 kernels, chosen at startup; CNN_ISA=<isa> to lower)\n";
+	cout << "\t\t5:CNNInt8 (INT8 weights and activations, AVX-512 VNNI / AVX2 kernels; approximate)\n";
+	cout << "\t\t6:CNNSimd with fp16 weight and activation storage (F16C, fp32 compute; approximate)\n";
+	cout << "\t\t7:CNNSimd with bf16 weight and activation storage (fp32 compute; approximate)\n";
 	cout << "\t-img,--image\tFull path for the image\n";
+	cout << "\t--crop\t\tFit larger images to the 128x128 input by their centered square instead of stretching them\n";
+	cout << "\t--check[=tol]\tCompare the implementation against CNNBruteforce (default tolerance 1e-4)\n";
+	cout << "\t--parity[=tol]\tCompare every implementation (or -o) layer by layer against CNNBruteforce on -img\n";
+	cout << "\t\t\t(default samples/*.jpg) and --random=<n> synthetic inputs (default 4); --ulps=<n> (default 64)\n";
+	cout << "\t--model=<file>\tMap this binary model file instead of the compiled-in weights\n";
+	cout << "\t--export-model=<file>\tWrite the model (with -bn folded in) as a binary model file\n";
+	cout << "\t-bn,--batchnorm\tInference mode: fold stored per-channel batch normalization from this file\n";
+	cout << "\t--calibrate-bn\tCompute stored batch normalization over -img (wildcards allowed) and write it to this file\n";
+	cout << "\t--batch[=1,8,..]\tMeasure batched throughput over -img (wildcards allowed), default 1,8,32,128\n";
+	cout << "\t--serve[=socket]\tClassify requests from stdin (or a Unix domain socket): one image path per line,\n";
+	cout << "\t\t\tor \"bytes <N>\" followed by N encoded bytes (N <= 64 MiB); \"quit\" / \"shutdown\" to stop\n";
+	cout << "\t--dir,--list\tClassify every image below a directory / listed in a file (one path per line)\n";
+	cout << "\t\t--format=csv|jsonl\tresult records (default csv), --out=<file> instead of stdout\n";
+	cout << "\t\t--unordered\twrite records as they complete (the id field is the input index)\n";
+	cout << "\t\t--decoders=<n>\timage decode threads (default: half the workers)\n";
+	cout << "\t\t--numa[=<n>]\treplicate the model on every (or the first n) NUMA node, workers pinned to each node's\n";
+	cout << "\t\t\tCPUs, images kept on the node that decoded them\n";
+	cout << "\t--detect[=p]\tFind faces of any size in -img: boxes with face probability above p (default 0.5)\n";
+	cout << "\t\t--min-face=<n>\tsmallest face in pixels (default 128)\n";
+	cout << "\t--video=<src>\tClassify every frame of a video file, image sequence or camera index (with --detect: find faces)\n";
+	cout << "\t\t--change=<t>\trecompute only regions whose pixels changed by more than t (0-255) since the last frame\n";
+	cout << "\t\t\t(needs -bn or a folded --model); --out=<file> instead of stdout\n";
+	cout << "\t--threads=<n>\tThreads shared by the layers and the scan workers (default: CNN_THREADS or one per core)\n";
+	cout << "\t--pin\t\tPin the threads to cores (or CNN_PIN=1)\n";
 	cout << "Example:Project2 -o=<option> -img=<fullpath image>\n";
 	cout << "Example:Project2 -o=1 -img=c:\\temp\\sample\\face.jpg\n";
 }
@@ -53,9 +108,31 @@ void eraseSubStr(std::string& mainStr, const std::string& toErase)
 	}
 }
 
+/// <summary>
+/// Load the model parameters: maps the binary model file, then folds the stored batch normalization when given.
+/// </summary>
+/// <returns>false when the model or batch normalization file cannot be used</returns>
+bool cnn_load_model(const cnn_arg& cnnarg, CNNModel& model) {
+	if (!cnnarg.model.empty()) {
+		if (!model.LoadBinary(cnnarg.model)) {
+			cout << "Invalid model file " << cnnarg.model << endl;
+			return false;
+		}
+		cout << "Model mapped from " << cnnarg.model << (model.BatchNormFolded() ? " (batch normalization folded)" : "") << endl;
+	}
+	if (cnnarg.batchnorm.empty())
+		return true;
+	if (!model.LoadBatchNormalization(cnnarg.batchnorm)) {
+		cout << "Invalid batch normalization file " << cnnarg.batchnorm << endl;
+		return false;
+	}
+	cout << "Batch normalization folded from " << cnnarg.batchnorm << endl;
+	return true;
+}
+
 /// <summary>
 /// CNN Execution
-/// 1. Read Image > Convert Image to 3d values (RGB) with normalized values.
+/// 1. Read Image > Convert Image to CHW tensor (RGB) with normalized values.
 ///		a. Note> There is no 32 bit opencv, will need to cmake. so change to x64 Debug.
 /// 2. ConvolutionLayer1
 ///		a. BatchNormalizationLayer
@@ -71,6 +148,7 @@ void eraseSubStr(std::string& mainStr, const std::string& toErase)
 /// 5. FlatternLayer
 /// 6. FullyConnectedLayer
 /// 7. SoftMaxLayer.
+/// Stages run through CNNPipeline, one per layer of the model, in a preplanned tensor arena.
 /// </summary>
 /// <param name="cnnarg"></param>
 /// <returns></returns>
@@ -79,82 +157,45 @@ int cnn_execute(cnn_arg cnnarg) {
 	//Initialize CNN Factory
 	CNNBase* cnn = CNNBase::make_cnnbase(cnnarg.option);
 	//CNNBase* cnn = CNNBase::make_cnnbase(0);
+	if (cnn == nullptr) {
+		cout << "Invalid option, try again" << endl;
+		show_usage();
+		return 1;
+	}
 	
 	cout << "CNN implementation:";
 	cnn->GetClassName();
 	cout << endl;
 	cout << "*****************************\n";
 
-	// 1.Read Image
-	//Mat image = imread("samples\\face.jpg");
-	Mat image = imread(cnnarg.image, COLOR_BGR2RGB);
+	// 1.Read Image: reduced-resolution decode, fitted to the 128x128 input
+	TickMeter decode;
+	decode.start();
+	ImageDecoder decoder(cnnarg.crop);
+	const Mat& image = decoder.Read(cnnarg.image);
+	decode.stop();
 	if (image.empty()) {
 		cout << "Invalid Image, try again" << endl;
+		delete cnn;
 		return 0;
 	}
+	printf("Decode = %gms\n", decode.getTimeMilli());
+
+	CNNModel model;
+	if (!cnn_load_model(cnnarg, model)) {
+		delete cnn;
+		return 1;
+	}
+
+	CNNPipeline pipeline(cnn, &model);
+	vector<double> stage_ms(pipeline.StageCount());
 
-	
 	TickMeter cvtmall;
 	cvtmall.start();
-	TickMeter cvtm;
-	cvtm.start();
 
-	// 1. Image pixel 3 channels, Mat3d Image is BGR
-	vector<vector<vector<float>>> imagePixels = cnn->MatToVector3d(image);
-	
-	//cnn->PrintMatrix(imagePixels);
-	cvtm.stop();
-	printf("MatToVector3d = %gms\n", cvtm.getTimeMilli());
-
-	cvtm.reset();
-	cvtm.start();
-	// 2. Convolutional Layer
-	vector<vector<vector<float>>> output = cnn->ConvolutionalLayer(imagePixels, &conv_params[0]);
-	output = cnn->BatchNormalizationLayer(output);
-	output = cnn->ActivationReluLayer(output);
-	output = cnn->MaxPoolingLayer(output, 2);
-	//cnn->PrintMatrix(output);
-	cvtm.stop();
-	printf("1st ConvolutionalLayer = %gms\n", cvtm.getTimeMilli());
-
-	cvtm.reset();
-	cvtm.start();
-	// 3. Convolutional Layer
-	output = cnn->ConvolutionalLayer(output, &conv_params[1]);
-	output = cnn->BatchNormalizationLayer(output);
-	output = cnn->ActivationReluLayer(output);
-	output = cnn->MaxPoolingLayer(output, 2);
-	cvtm.stop();
-	printf("2nd ConvolutionalLayer = %gms\n", cvtm.getTimeMilli());
-
-	cvtm.reset();
-	cvtm.start();
-	// 4. Convolutional Layer
-	output = cnn->ConvolutionalLayer(output, &conv_params[2]);
-	output = cnn->BatchNormalizationLayer(output);
-	output = cnn->ActivationReluLayer(output);
-	cvtm.stop();
-	printf("3rd ConvolutionalLayer = %gms\n", cvtm.getTimeMilli());
-
-	cvtm.start();
-	// 5. Flatten Layer
-	vector<float> flatten = cnn->FlattenLayer(output);
-	cvtm.stop();
-	printf("FlattenLayer = %gms\n", cvtm.getTimeMilli());
-
-	cvtm.reset();
-	cvtm.start();
-	// 6. Fully Connected Layer
-	vector<float> fullyConnected = cnn->FullyConnectedLayer(flatten, &fc_params[0]);
-	cvtm.stop();
-	printf("FullyConnectedLayer = %gms\n", cvtm.getTimeMilli());
-
-	cvtm.reset();
-	cvtm.start();
-	// 7. SoftMax Layer
-	fullyConnected = cnn->SoftMaxLayer(fullyConnected);
-	cvtm.stop();
-	printf("SoftMaxLayer = %gms\n", cvtm.getTimeMilli());
+	const Tensor& fullyConnected = pipeline.Forward(image, stage_ms.data());
+	for (int i = 0; i < pipeline.StageCount(); i++)
+		printf("%s = %gms\n", pipeline.StageName(i), stage_ms[i]);
 
 	//cout << "*****************************\n";
 	cout << "bg:" << fullyConnected[0] << " face:" << fullyConnected[1] << endl;
@@ -162,12 +203,367 @@ int cnn_execute(cnn_arg cnnarg) {
 	cvtmall.stop();
 	printf("overall = %gms\n", cvtmall.getTimeMilli());
 
+	delete cnn;
+	return 0;
+}
+
+/// <summary>
+/// Compute per-channel batch normalization over the sample images and save it for -bn.
+/// </summary>
+/// <param name="cnnarg"></param>
+/// <returns>0 on success</returns>
+int cnn_calibrate(cnn_arg cnnarg) {
+	CNNBase* cnn = CNNBase::make_cnnbase(cnnarg.option);
+	if (cnn == nullptr) {
+		cout << "Invalid option, try again" << endl;
+		return 1;
+	}
+	vector<Mat> images = cnn_read_images(cnnarg.image, cnnarg.crop);
+	if (images.empty()) {
+		cout << "Invalid Image, try again" << endl;
+		delete cnn;
+		return 1;
+	}
+
+	CNNModel model;
+	if (!cnn_load_model(cnnarg, model)) {
+		delete cnn;
+		return 1;
+	}
+	bool calibrated = model.CalibrateBatchNormalization(cnn, images);
+	delete cnn;
+	if (!calibrated) {
+		cout << "Cannot calibrate a model with batch normalization already folded" << endl;
+		return 1;
+	}
+	if (!model.SaveBatchNormalization(cnnarg.calibrate)) {
+		cout << "Cannot write " << cnnarg.calibrate << endl;
+		return 1;
+	}
+	cout << "Batch normalization of " << images.size() << " image(s) written to " << cnnarg.calibrate << endl;
+	return 0;
+}
+
+/// <summary>
+/// Export the model (compiled-in or --model, with -bn folded in) as a binary model file for --model.
+/// </summary>
+/// <param name="cnnarg"></param>
+/// <returns>0 on success</returns>
+int cnn_export_model(cnn_arg cnnarg) {
+	CNNModel model;
+	if (!cnn_load_model(cnnarg, model))
+		return 1;
+	if (!model.SaveBinary(cnnarg.export_model)) {
+		cout << "Cannot write " << cnnarg.export_model << endl;
+		return 1;
+	}
+	cout << "Model written to " << cnnarg.export_model << endl;
 	return 0;
 }
 
+/// <summary>
+/// Throughput of CNNPipeline::ClassifyBatch at each requested batch size (images are repeated to fill a batch),
+/// after checking that batched scores match one-image-at-a-time scores.
+/// </summary>
+/// <param name="cnnarg"></param>
+/// <returns>0 on success</returns>
+int cnn_batch(cnn_arg cnnarg) {
+	CNNBase* cnn = CNNBase::make_cnnbase(cnnarg.option);
+	if (cnn == nullptr) {
+		cout << "Invalid option, try again" << endl;
+		return 1;
+	}
+	vector<Mat> images = cnn_read_images(cnnarg.image, cnnarg.crop);
+	if (images.empty()) {
+		cout << "Invalid Image, try again" << endl;
+		delete cnn;
+		return 1;
+	}
+	CNNModel model;
+	if (!cnn_load_model(cnnarg, model)) {
+		delete cnn;
+		return 1;
+	}
+
+	cout << "CNN implementation:";
+	cnn->GetClassName();
+	cout << endl;
+	CNNPipeline pipeline(cnn, &model);
+
+	// Batched scores must not depend on the batch they were computed in.
+	vector<float> single;
+	for (const Mat& image : images) {
+		const Tensor& scores = pipeline.Forward(image);
+		single.push_back(scores[0]);
+		single.push_back(scores[1]);
+	}
+	const Tensor& batched = pipeline.ClassifyBatch(images);
+	float error = 0;
+	for (size_t i = 0; i < single.size(); i++)
+		error = std::max(error, fabsf(single[i] - batched[i]));
+	printf("batch of %d vs single: max abs error = %g\n", (int)images.size(), error);
+
+	for (int batch : cnnarg.batch_sizes) {
+		vector<Mat> inputs;
+		for (int i = 0; i < batch; i++)
+			inputs.push_back(images[i % images.size()]);
+
+		pipeline.ClassifyBatch(inputs); // warm-up, sizes the buffers
+		int iterations = std::max(1, 512 / batch);
+		TickMeter tm;
+		tm.start();
+		for (int i = 0; i < iterations; i++)
+			pipeline.ClassifyBatch(inputs);
+		tm.stop();
+		double ms = tm.getTimeMilli() / iterations;
+		printf("batch %4d: %8.3f ms/batch %8.3f ms/image %9.1f images/s\n", batch, ms, ms / batch, batch * 1000.0 / ms);
+	}
+	delete cnn;
+	return 0;
+}
+
+/// <summary>
+/// Serve classification requests until shutdown, reporting latency percentiles at the end.
+/// </summary>
+/// <param name="cnnarg"></param>
+/// <returns>0 on success</returns>
+int cnn_serve(cnn_arg cnnarg) {
+	CNNBase* cnn = CNNBase::make_cnnbase(cnnarg.option);
+	if (cnn == nullptr) {
+		cerr << "Invalid option, try again" << endl;
+		return 1;
+	}
+	CNNModel model;
+	if (!cnn_load_model(cnnarg, model)) {
+		delete cnn;
+		return 1;
+	}
+
+	bool served = true;
+	{
+		CNNServer server(cnn, &model, cnnarg.crop);
+		if (cnnarg.socket.empty())
+			server.ServeStdin();
+		else
+			served = server.ServeSocket(cnnarg.socket);
+	}
+	delete cnn;
+	return served ? 0 : 1;
+}
+
+/// <summary>
+/// Classify a directory or file list with CNNScanner, records to stdout or --out.
+/// </summary>
+/// <param name="cnnarg"></param>
+/// <returns>0 when every file was classified</returns>
+int cnn_scan(cnn_arg cnnarg) {
+	CNNBase* probe = CNNBase::make_cnnbase(cnnarg.option);
+	if (probe == nullptr) {
+		cerr << "Invalid option, try again" << endl;
+		return 1;
+	}
+	delete probe;
+	if (cnnarg.format != "csv" && cnnarg.format != "jsonl") {
+		cerr << "Invalid format " << cnnarg.format << endl;
+		return 1;
+	}
+	CNNModel model;
+	if (!cnn_load_model(cnnarg, model))
+		return 1;
+
+	vector<string> files = cnnarg.scan_dir.empty() ?
+		CNNScanner::ReadList(cnnarg.scan_list) : CNNScanner::ListDirectory(cnnarg.scan_dir);
+	FILE* out = stdout;
+	if (!cnnarg.output.empty() && (out = fopen(cnnarg.output.c_str(), "w")) == nullptr) {
+		cerr << "Cannot write " << cnnarg.output << endl;
+		return 1;
+	}
+
+	vector<NumaReplica*> replicas;
+	if (cnnarg.numa != 0)
+		replicas = NumaReplica::Create(numa_nodes(), model, cnnarg.numa);
+	int workers = 0;
+	for (NumaReplica* replica : replicas)
+		workers += replica->Concurrency();
+	if (replicas.empty())
+		workers = ThreadPool::Global().Concurrency();
+	int decoders = cnnarg.decoders > 0 ? cnnarg.decoders : std::max(1, workers / 2);
+	CNNScanner scanner(cnnarg.option, &model, workers, decoders,
+		cnnarg.format == "jsonl" ? CNNScanner::FORMAT_JSONL : CNNScanner::FORMAT_CSV, !cnnarg.unordered, out, cnnarg.crop,
+		replicas);
+
+	TickMeter tm;
+	tm.start();
+	int errors = scanner.Run(files);
+	tm.stop();
+	if (out != stdout)
+		fclose(out);
+	fprintf(stderr, "%d images (%d errors) in %.3fs, %.1f images/s, %d workers, %d decoders",
+		(int)files.size(), errors, tm.getTimeSec(), files.size() / std::max(tm.getTimeSec(), 1e-9), scanner.Workers(),
+		scanner.Decoders());
+	if (!replicas.empty())
+		fprintf(stderr, ", %d NUMA nodes", (int)replicas.size());
+	fprintf(stderr, "\n");
+	for (NumaReplica* replica : replicas)
+		delete replica;
+	return errors == 0 ? 0 : 1;
+}
+
+/// <summary>
+/// Sliding-window face detection with CNNDetector: one box per line, strongest first.
+/// </summary>
+/// <param name="cnnarg"></param>
+/// <returns>0 on success</returns>
+int cnn_detect(cnn_arg cnnarg) {
+	CNNBase* cnn = CNNBase::make_cnnbase(cnnarg.option);
+	if (cnn == nullptr) {
+		cout << "Invalid option, try again" << endl;
+		return 1;
+	}
+	// The whole frame: windows are cut from it at every pyramid level.
+	Mat frame = imread(cnnarg.image, IMREAD_COLOR);
+	if (frame.empty()) {
+		cout << "Invalid Image, try again" << endl;
+		delete cnn;
+		return 1;
+	}
+	CNNModel model;
+	if (!cnn_load_model(cnnarg, model)) {
+		delete cnn;
+		return 1;
+	}
+
+	int result = 0;
+	{
+		CNNDetector detector(cnn, &model, cnnarg.detect_threshold, cnnarg.min_face);
+		if (!detector.Valid()) {
+			cout << "The fully connected layer does not match one window of the model" << endl;
+			result = 1;
+		}
+		else {
+			cout << "CNN implementation:";
+			cnn->GetClassName();
+			cout << endl;
+			if (!model.BatchNormFolded())
+				cout << "No stored batch normalization (-bn): windows are normalized with the statistics of their whole level" << endl;
+			TickMeter tm;
+			tm.start();
+			const vector<cnn_detection>& faces = detector.Detect(frame);
+			tm.stop();
+			printf("%dx%d frame: %d levels, %d windows (stride %dpx), detect = %gms\n", frame.cols, frame.rows,
+				detector.Levels(), detector.Windows(), detector.Stride(), tm.getTimeMilli());
+			for (const cnn_detection& face : faces)
+				printf("face x:%d y:%d w:%d h:%d score:%.4f\n", face.box.x, face.box.y, face.box.width, face.box.height, face.score);
+			printf("%d face(s)\n", (int)faces.size());
+		}
+	}
+	delete cnn;
+	return result;
+}
+
+/// <summary>
+/// Classify or detect faces in every frame of a video with CNNVideo, records to stdout or --out.
+/// </summary>
+/// <param name="cnnarg"></param>
+/// <returns>0 on success</returns>
+int cnn_video(cnn_arg cnnarg) {
+	CNNBase* cnn = CNNBase::make_cnnbase(cnnarg.option);
+	if (cnn == nullptr) {
+		cerr << "Invalid option, try again" << endl;
+		return 1;
+	}
+	CNNModel model;
+	if (!cnn_load_model(cnnarg, model)) {
+		delete cnn;
+		return 1;
+	}
+	if (cnnarg.change_threshold >= 0 && !model.BatchNormFolded())
+		cerr << "No stored batch normalization (-bn): every frame is computed in full" << endl;
+	else if (cnnarg.change_threshold >= 0 && !cnn->LocalFeatures())
+		cerr << "The engine normalizes over whole frames: every frame is computed in full" << endl;
+	FILE* out = stdout;
+	if (!cnnarg.output.empty() && (out = fopen(cnnarg.output.c_str(), "w")) == nullptr) {
+		cerr << "Cannot write " << cnnarg.output << endl;
+		delete cnn;
+		return 1;
+	}
+
+	bool played;
+	{
+		CNNDetector detector(cnn, &model, cnnarg.detect_threshold, cnnarg.min_face);
+		CNNVideo video(cnn, &model, out, cnnarg.crop, cnnarg.change_threshold,
+			cnnarg.detect_threshold > 0 ? &detector : nullptr);
+		played = video.Run(cnnarg.video);
+	}
+	if (out != stdout)
+		fclose(out);
+	delete cnn;
+	return played ? 0 : 1;
+}
+
+/// <summary>
+/// Numeric tolerance check of the selected implementation against CNNBruteforce.
+/// </summary>
+/// <param name="cnnarg"></param>
+/// <returns>0 when every check passes</returns>
+int cnn_check(cnn_arg cnnarg) {
+	CNNBase* cnn = CNNBase::make_cnnbase(cnnarg.option);
+	if (cnn == nullptr) {
+		cout << "Invalid option, try again" << endl;
+		return 1;
+	}
+	ImageDecoder decoder(cnnarg.crop);
+	const Mat& image = decoder.Read(cnnarg.image);
+	if (image.empty()) {
+		cout << "Invalid Image, try again" << endl;
+		delete cnn;
+		return 1;
+	}
+
+	CNNModel model;
+	if (!cnn_load_model(cnnarg, model)) {
+		delete cnn;
+		return 1;
+	}
+
+	CNNBase* reference = CNNBase::make_cnnbase(CNNBase::REFERENCE);
+	cout << "Checking ";
+	cnn->GetClassName();
+	cout << " against CNNBruteforce, tolerance " << cnnarg.check_tolerance << endl;
+	int failures = cnn_parity(cnn, reference, image, cnnarg.check_tolerance, &model);
+	delete reference;
+	delete cnn;
+	return failures == 0 ? 0 : 1;
+}
+
+/// <summary>
+/// Parity suite of every implementation (or the selected one) against CNNBruteforce.
+/// </summary>
+/// <param name="cnnarg"></param>
+/// <returns>0 when every check passes</returns>
+int cnn_parity_check(cnn_arg cnnarg) {
+	vector<Mat> images = cnn_read_images(cnnarg.image.empty() ? "samples/*.jpg" : cnnarg.image, cnnarg.crop);
+	if (images.empty() && cnnarg.parity_random <= 0) {
+		cout << "Invalid Image, try again" << endl;
+		return 1;
+	}
+	CNNModel model;
+	if (!cnn_load_model(cnnarg, model))
+		return 1;
+
+	vector<int> options;
+	if (cnnarg.option >= 0)
+		options.push_back(cnnarg.option);
+	printf("Parity against CNNBruteforce: %d images, %d random inputs, tolerance %g or %lld ulps\n",
+		(int)images.size(), cnnarg.parity_random, cnnarg.parity_tolerance, cnnarg.parity_ulps);
+	int failures = cnn_parity_suite(options, images, cnnarg.parity_random, cnnarg.parity_tolerance,
+		cnnarg.parity_ulps, &model);
+	return failures == 0 ? 0 : 1;
+}
+
 int main(int argc, char** argv)
 {
-	if (argc <= 2) {
+	if (argc < 2) {
 		show_usage();
 		return 1;
 	}
@@ -189,7 +585,133 @@ int main(int argc, char** argv)
 			eraseSubStr(arg, "--image=");
 			cnnargs.image = arg;
 		}
+		else if (arg == "--crop") {
+			cnnargs.crop = true;
+		}
+		else if (arg.rfind("--check", 0) == 0) {
+			eraseSubStr(arg, "--check");
+			eraseSubStr(arg, "=");
+			cnnargs.check_tolerance = arg.empty() ? 1e-4f : stof(arg);
+		}
+		else if (arg.rfind("--parity", 0) == 0) {
+			eraseSubStr(arg, "--parity");
+			eraseSubStr(arg, "=");
+			cnnargs.parity_tolerance = arg.empty() ? 1e-4f : stof(arg);
+		}
+		else if (arg.rfind("--ulps=", 0) == 0) {
+			eraseSubStr(arg, "--ulps=");
+			cnnargs.parity_ulps = stoll(arg);
+		}
+		else if (arg.rfind("--random=", 0) == 0) {
+			eraseSubStr(arg, "--random=");
+			cnnargs.parity_random = std::max(0, stoi(arg));
+		}
+		else if ((arg.rfind("-bn=", 0) == 0) || (arg.rfind("--batchnorm=", 0) == 0)) {
+			eraseSubStr(arg, "-bn=");
+			eraseSubStr(arg, "--batchnorm=");
+			cnnargs.batchnorm = arg;
+		}
+		else if (arg.rfind("--model=", 0) == 0) {
+			eraseSubStr(arg, "--model=");
+			cnnargs.model = arg;
+		}
+		else if (arg.rfind("--export-model=", 0) == 0) {
+			eraseSubStr(arg, "--export-model=");
+			cnnargs.export_model = arg;
+		}
+		else if (arg.rfind("--calibrate-bn=", 0) == 0) {
+			eraseSubStr(arg, "--calibrate-bn=");
+			cnnargs.calibrate = arg;
+		}
+		else if (arg.rfind("--serve", 0) == 0) {
+			eraseSubStr(arg, "--serve");
+			eraseSubStr(arg, "=");
+			cnnargs.serve = true;
+			cnnargs.socket = arg;
+		}
+		else if (arg.rfind("--dir=", 0) == 0) {
+			eraseSubStr(arg, "--dir=");
+			cnnargs.scan_dir = arg;
+		}
+		else if (arg.rfind("--list=", 0) == 0) {
+			eraseSubStr(arg, "--list=");
+			cnnargs.scan_list = arg;
+		}
+		else if (arg.rfind("--out=", 0) == 0) {
+			eraseSubStr(arg, "--out=");
+			cnnargs.output = arg;
+		}
+		else if (arg.rfind("--format=", 0) == 0) {
+			eraseSubStr(arg, "--format=");
+			cnnargs.format = arg;
+		}
+		else if (arg == "--unordered") {
+			cnnargs.unordered = true;
+		}
+		else if (arg.rfind("--threads=", 0) == 0) {
+			eraseSubStr(arg, "--threads=");
+			cnnargs.threads = stoi(arg);
+		}
+		else if (arg == "--pin") {
+			cnnargs.pin = true;
+		}
+		else if (arg.rfind("--decoders=", 0) == 0) {
+			eraseSubStr(arg, "--decoders=");
+			cnnargs.decoders = stoi(arg);
+		}
+		else if (arg.rfind("--numa", 0) == 0) {
+			eraseSubStr(arg, "--numa");
+			eraseSubStr(arg, "=");
+			cnnargs.numa = arg.empty() ? -1 : std::max(1, stoi(arg));
+		}
+		else if (arg.rfind("--detect", 0) == 0) {
+			eraseSubStr(arg, "--detect");
+			eraseSubStr(arg, "=");
+			cnnargs.detect_threshold = arg.empty() ? 0.5f : stof(arg);
+		}
+		else if (arg.rfind("--video=", 0) == 0) {
+			eraseSubStr(arg, "--video=");
+			cnnargs.video = arg;
+		}
+		else if (arg.rfind("--change=", 0) == 0) {
+			eraseSubStr(arg, "--change=");
+			cnnargs.change_threshold = stoi(arg);
+		}
+		else if (arg.rfind("--min-face=", 0) == 0) {
+			eraseSubStr(arg, "--min-face=");
+			cnnargs.min_face = stoi(arg);
+		}
+		else if (arg.rfind("--batch", 0) == 0) {
+			eraseSubStr(arg, "--batch");
+			eraseSubStr(arg, "=");
+			if (arg.empty())
+				arg = "1,8,32,128";
+			stringstream sizes(arg);
+			string size;
+			while (getline(sizes, size, ','))
+				cnnargs.batch_sizes.push_back(std::max(1, stoi(size)));
+		}
 	}
+	if (cnnargs.threads > 0 || cnnargs.pin)
+		ThreadPool::Configure(cnnargs.threads, cnnargs.pin);
+	if (cnnargs.serve)
+		return cnn_serve(cnnargs);
+	if (!cnnargs.scan_dir.empty() || !cnnargs.scan_list.empty())
+		return cnn_scan(cnnargs);
+	if (!cnnargs.video.empty())
+		return cnn_video(cnnargs);
 	cout << "Ooi Yee Jing\n";
+	if (!cnnargs.calibrate.empty())
+		return cnn_calibrate(cnnargs);
+	if (!cnnargs.export_model.empty())
+		return cnn_export_model(cnnargs);
+	if (!cnnargs.batch_sizes.empty())
+		return cnn_batch(cnnargs);
+	if (cnnargs.check_tolerance > 0)
+		return cnn_check(cnnargs);
+	if (cnnargs.parity_tolerance > 0)
+		return cnn_parity_check(cnnargs);
+	if (cnnargs.detect_threshold > 0)
+		return cnn_detect(cnnargs);
 	cnn_execute(cnnargs);
 }
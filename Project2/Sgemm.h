@@ -0,0 +1,296 @@
+#pragma once
+
+#include <algorithm>
+#include "Tensor.h"
+#include "ThreadPool.h"
+
+#if defined(__AVX2__)
+#define SGEMM_KERNEL_AVX2
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SGEMM_KERNEL_SSE
+#include <emmintrin.h>
+#endif
+
+/// <summary>
+/// Cache-blocked, register-tiled single precision GEMM (row-major): C[M x N] = A[M x K] * B[K x N] + bias[M].
+/// Blocking follows the usual Goto scheme:
+///		- a KC x NC panel of B is packed once and stays in L2/L3,
+///		- an MC x KC block of A is packed into MR-row micro panels,
+///		- the micro kernel keeps an MR x NR tile of C in registers while streaming both packed panels.
+/// The micro kernel uses AVX2/FMA or SSE2 intrinsics depending on the compile target (12 accumulators
+/// either way) and a plain loop elsewhere.
+/// </summary>
+static const int GEMM_MR = 6;
+static const int GEMM_NR = 16;
+static const int GEMM_MC = 72; // multiple of GEMM_MR
+static const int GEMM_KC = 256;
+static const int GEMM_NC = 2048; // multiple of GEMM_NR
+
+/// <summary>
+/// Packing buffers, sized once and reused by every call.
+/// </summary>
+struct GemmWorkspace {
+	Tensor packedA;
+	Tensor packedB;
+
+	GemmWorkspace() {
+		packedA.create(1, 1, 1, GEMM_MC * GEMM_KC);
+		packedB.create(1, 1, 1, GEMM_KC * GEMM_NC);
+	}
+};
+
+/// <summary>
+/// Pack an mc x kc block of A into MR-row panels (k-major inside a panel), zero filling the ragged edge.
+/// </summary>
+inline void sgemm_pack_a(int mc, int kc, const float* A, int lda, float* packed) {
+	for (int i = 0; i < mc; i += GEMM_MR) {
+		int rows = std::min(GEMM_MR, mc - i);
+		for (int k = 0; k < kc; k++) {
+			for (int r = 0; r < GEMM_MR; r++) {
+				*packed++ = r < rows ? A[(size_t)(i + r) * lda + k] : 0.f;
+			}
+		}
+	}
+}
+
+/// <summary>
+/// An A matrix packed once into the same MR-row panels sgemm_pack_a builds, for every KC x MC block: weights
+/// that do not change between calls (convolution and fully connected layers) skip the per-call packing.
+/// Block (pc, ic) starts at pc * (M rounded up to MR) + ic * kc, since GEMM_MC is a multiple of GEMM_MR.
+/// </summary>
+struct GemmPackedA {
+	int M = 0;
+	int K = 0;
+	Tensor panels;
+
+	const float* Block(int pc, int ic, int kc) const {
+		int rounded = (M + GEMM_MR - 1) / GEMM_MR * GEMM_MR;
+		return panels.data() + (size_t)pc * rounded + (size_t)ic * kc;
+	}
+};
+
+/// <summary>
+/// Pack all of A [M x K] for sgemm_packed / sgemm_nt_packed.
+/// </summary>
+inline void sgemm_prepack_a(int M, int K, const float* A, int lda, GemmPackedA& packed) {
+	int rounded = (M + GEMM_MR - 1) / GEMM_MR * GEMM_MR;
+	packed.M = M;
+	packed.K = K;
+	packed.panels.create(1, 1, rounded, K);
+	for (int pc = 0; pc < K; pc += GEMM_KC) {
+		int kc = std::min(GEMM_KC, K - pc);
+		for (int ic = 0; ic < M; ic += GEMM_MC) {
+			int mc = std::min(GEMM_MC, M - ic);
+			sgemm_pack_a(mc, kc, A + (size_t)ic * lda + pc, lda, packed.panels.data() + (size_t)pc * rounded + (size_t)ic * kc);
+		}
+	}
+}
+
+/// <summary>
+/// Pack a kc x nc panel of B into NR-column panels (k-major inside a panel), zero filling the ragged edge.
+/// </summary>
+inline void sgemm_pack_b(int kc, int nc, const float* B, int ldb, float* packed) {
+	for (int j = 0; j < nc; j += GEMM_NR) {
+		int cols = std::min(GEMM_NR, nc - j);
+		for (int k = 0; k < kc; k++) {
+			const float* row = B + (size_t)k * ldb + j;
+			if (cols == GEMM_NR) {
+				for (int c = 0; c < GEMM_NR; c++)
+					packed[c] = row[c];
+			}
+			else {
+				for (int c = 0; c < GEMM_NR; c++)
+					packed[c] = c < cols ? row[c] : 0.f;
+			}
+			packed += GEMM_NR;
+		}
+	}
+}
+
+/// <summary>
+/// Same panels as sgemm_pack_b for a B that is stored transposed (Bt is [N x K], row-major).
+/// </summary>
+inline void sgemm_pack_bt(int kc, int nc, const float* Bt, int ldbt, float* packed) {
+	for (int j = 0; j < nc; j += GEMM_NR) {
+		int cols = std::min(GEMM_NR, nc - j);
+		for (int k = 0; k < kc; k++) {
+			for (int c = 0; c < GEMM_NR; c++)
+				packed[c] = c < cols ? Bt[(size_t)(j + c) * ldbt + k] : 0.f;
+			packed += GEMM_NR;
+		}
+	}
+}
+
+/// <summary>
+/// Add an MR x NR tile to C, clipped to mr x nr.
+/// </summary>
+inline void sgemm_store_tile(const float* acc, float* C, int ldc, int mr, int nr) {
+	for (int i = 0; i < mr; i++) {
+		float* c = C + (size_t)i * ldc;
+		for (int j = 0; j < nr; j++)
+			c[j] += acc[i * GEMM_NR + j];
+	}
+}
+
+/// <summary>
+/// MR x NR register tile: C[mr x nr] += a_panel * b_panel.
+/// </summary>
+inline void sgemm_micro_kernel(int kc, const float* a, const float* b, float* C, int ldc, int mr, int nr) {
+#if defined(SGEMM_KERNEL_AVX2)
+	__m256 c00 = _mm256_setzero_ps(), c01 = _mm256_setzero_ps();
+	__m256 c10 = _mm256_setzero_ps(), c11 = _mm256_setzero_ps();
+	__m256 c20 = _mm256_setzero_ps(), c21 = _mm256_setzero_ps();
+	__m256 c30 = _mm256_setzero_ps(), c31 = _mm256_setzero_ps();
+	__m256 c40 = _mm256_setzero_ps(), c41 = _mm256_setzero_ps();
+	__m256 c50 = _mm256_setzero_ps(), c51 = _mm256_setzero_ps();
+	for (int k = 0; k < kc; k++) {
+		__m256 b0 = _mm256_load_ps(b);
+		__m256 b1 = _mm256_load_ps(b + 8);
+		__m256 av;
+		av = _mm256_broadcast_ss(a + 0); c00 = _mm256_fmadd_ps(av, b0, c00); c01 = _mm256_fmadd_ps(av, b1, c01);
+		av = _mm256_broadcast_ss(a + 1); c10 = _mm256_fmadd_ps(av, b0, c10); c11 = _mm256_fmadd_ps(av, b1, c11);
+		av = _mm256_broadcast_ss(a + 2); c20 = _mm256_fmadd_ps(av, b0, c20); c21 = _mm256_fmadd_ps(av, b1, c21);
+		av = _mm256_broadcast_ss(a + 3); c30 = _mm256_fmadd_ps(av, b0, c30); c31 = _mm256_fmadd_ps(av, b1, c31);
+		av = _mm256_broadcast_ss(a + 4); c40 = _mm256_fmadd_ps(av, b0, c40); c41 = _mm256_fmadd_ps(av, b1, c41);
+		av = _mm256_broadcast_ss(a + 5); c50 = _mm256_fmadd_ps(av, b0, c50); c51 = _mm256_fmadd_ps(av, b1, c51);
+		a += GEMM_MR;
+		b += GEMM_NR;
+	}
+	alignas(32) float acc[GEMM_MR * GEMM_NR];
+	_mm256_store_ps(acc + 0, c00);  _mm256_store_ps(acc + 8, c01);
+	_mm256_store_ps(acc + 16, c10); _mm256_store_ps(acc + 24, c11);
+	_mm256_store_ps(acc + 32, c20); _mm256_store_ps(acc + 40, c21);
+	_mm256_store_ps(acc + 48, c30); _mm256_store_ps(acc + 56, c31);
+	_mm256_store_ps(acc + 64, c40); _mm256_store_ps(acc + 72, c41);
+	_mm256_store_ps(acc + 80, c50); _mm256_store_ps(acc + 88, c51);
+	sgemm_store_tile(acc, C, ldc, mr, nr);
+#elif defined(SGEMM_KERNEL_SSE)
+	// Two passes over 8 columns each keep 12 accumulators in the 16 xmm registers.
+	alignas(16) float acc[GEMM_MR * GEMM_NR];
+	for (int half = 0; half < GEMM_NR; half += 8) {
+		__m128 c00 = _mm_setzero_ps(), c01 = _mm_setzero_ps();
+		__m128 c10 = _mm_setzero_ps(), c11 = _mm_setzero_ps();
+		__m128 c20 = _mm_setzero_ps(), c21 = _mm_setzero_ps();
+		__m128 c30 = _mm_setzero_ps(), c31 = _mm_setzero_ps();
+		__m128 c40 = _mm_setzero_ps(), c41 = _mm_setzero_ps();
+		__m128 c50 = _mm_setzero_ps(), c51 = _mm_setzero_ps();
+		const float* pa = a;
+		const float* pb = b + half;
+		for (int k = 0; k < kc; k++) {
+			__m128 b0 = _mm_load_ps(pb);
+			__m128 b1 = _mm_load_ps(pb + 4);
+			__m128 av;
+			av = _mm_set1_ps(pa[0]); c00 = _mm_add_ps(c00, _mm_mul_ps(av, b0)); c01 = _mm_add_ps(c01, _mm_mul_ps(av, b1));
+			av = _mm_set1_ps(pa[1]); c10 = _mm_add_ps(c10, _mm_mul_ps(av, b0)); c11 = _mm_add_ps(c11, _mm_mul_ps(av, b1));
+			av = _mm_set1_ps(pa[2]); c20 = _mm_add_ps(c20, _mm_mul_ps(av, b0)); c21 = _mm_add_ps(c21, _mm_mul_ps(av, b1));
+			av = _mm_set1_ps(pa[3]); c30 = _mm_add_ps(c30, _mm_mul_ps(av, b0)); c31 = _mm_add_ps(c31, _mm_mul_ps(av, b1));
+			av = _mm_set1_ps(pa[4]); c40 = _mm_add_ps(c40, _mm_mul_ps(av, b0)); c41 = _mm_add_ps(c41, _mm_mul_ps(av, b1));
+			av = _mm_set1_ps(pa[5]); c50 = _mm_add_ps(c50, _mm_mul_ps(av, b0)); c51 = _mm_add_ps(c51, _mm_mul_ps(av, b1));
+			pa += GEMM_MR;
+			pb += GEMM_NR;
+		}
+		float* t = acc + half;
+		_mm_store_ps(t + 0 * GEMM_NR, c00); _mm_store_ps(t + 0 * GEMM_NR + 4, c01);
+		_mm_store_ps(t + 1 * GEMM_NR, c10); _mm_store_ps(t + 1 * GEMM_NR + 4, c11);
+		_mm_store_ps(t + 2 * GEMM_NR, c20); _mm_store_ps(t + 2 * GEMM_NR + 4, c21);
+		_mm_store_ps(t + 3 * GEMM_NR, c30); _mm_store_ps(t + 3 * GEMM_NR + 4, c31);
+		_mm_store_ps(t + 4 * GEMM_NR, c40); _mm_store_ps(t + 4 * GEMM_NR + 4, c41);
+		_mm_store_ps(t + 5 * GEMM_NR, c50); _mm_store_ps(t + 5 * GEMM_NR + 4, c51);
+	}
+	sgemm_store_tile(acc, C, ldc, mr, nr);
+#else
+	float acc[GEMM_MR * GEMM_NR] = {};
+	for (int k = 0; k < kc; k++) {
+		for (int i = 0; i < GEMM_MR; i++) {
+			float av = a[i];
+			for (int j = 0; j < GEMM_NR; j++)
+				acc[i * GEMM_NR + j] += av * b[j];
+		}
+		a += GEMM_MR;
+		b += GEMM_NR;
+	}
+	sgemm_store_tile(acc, C, ldc, mr, nr);
+#endif
+}
+
+/// <summary>
+/// C = A * B + bias, or A * B^T + bias when transB is set (B then is [N x K]).
+/// With prepacked (sgemm_prepack_a of A) A and lda are not used.
+/// </summary>
+inline void sgemm_blocked(int M, int N, int K, const float* A, int lda, const float* B, int ldb, bool transB,
+	float* C, int ldc, const float* bias, GemmWorkspace& ws, const GemmPackedA* prepacked = nullptr) {
+
+	// Initialize C with the bias so every K block simply accumulates.
+	for (int i = 0; i < M; i++) {
+		float b = bias != nullptr ? bias[i] : 0.f;
+		float* c = C + (size_t)i * ldc;
+		for (int j = 0; j < N; j++)
+			c[j] = b;
+	}
+
+	float* packedB = ws.packedB.data();
+
+	for (int jc = 0; jc < N; jc += GEMM_NC) {
+		int nc = std::min(GEMM_NC, N - jc);
+		for (int pc = 0; pc < K; pc += GEMM_KC) {
+			int kc = std::min(GEMM_KC, K - pc);
+			if (transB)
+				sgemm_pack_bt(kc, nc, B + (size_t)jc * ldb + pc, ldb, packedB);
+			else
+				sgemm_pack_b(kc, nc, B + (size_t)pc * ldb + jc, ldb, packedB);
+
+			for (int ic = 0; ic < M; ic += GEMM_MC) {
+				int mc = std::min(GEMM_MC, M - ic);
+				const float* packedA = ws.packedA.data();
+				if (prepacked != nullptr)
+					packedA = prepacked->Block(pc, ic, kc);
+				else
+					sgemm_pack_a(mc, kc, A + (size_t)ic * lda + pc, lda, ws.packedA.data());
+
+				int panels = (nc + GEMM_NR - 1) / GEMM_NR;
+				parallel_for(panels, [&](int p) {
+					int jr = p * GEMM_NR;
+					int nr = std::min(GEMM_NR, nc - jr);
+					for (int ir = 0; ir < mc; ir += GEMM_MR) {
+						int mr = std::min(GEMM_MR, mc - ir);
+						sgemm_micro_kernel(kc, packedA + (size_t)ir * kc, packedB + (size_t)jr * kc,
+							C + (size_t)(ic + ir) * ldc + jc + jr, ldc, mr, nr);
+					}
+				});
+			}
+		}
+	}
+}
+
+/// <summary>
+/// C = A * B + bias (bias may be null). C must not alias A or B.
+/// </summary>
+inline void sgemm(int M, int N, int K, const float* A, int lda, const float* B, int ldb,
+	float* C, int ldc, const float* bias, GemmWorkspace& ws) {
+	sgemm_blocked(M, N, K, A, lda, B, ldb, false, C, ldc, bias, ws);
+}
+
+/// <summary>
+/// C = A * Bt^T + bias with Bt stored [N x K], e.g. a batch of feature rows.
+/// </summary>
+inline void sgemm_nt(int M, int N, int K, const float* A, int lda, const float* Bt, int ldbt,
+	float* C, int ldc, const float* bias, GemmWorkspace& ws) {
+	sgemm_blocked(M, N, K, A, lda, Bt, ldbt, true, C, ldc, bias, ws);
+}
+
+/// <summary>
+/// sgemm with A packed by sgemm_prepack_a.
+/// </summary>
+inline void sgemm_packed(const GemmPackedA& A, int N, const float* B, int ldb,
+	float* C, int ldc, const float* bias, GemmWorkspace& ws) {
+	sgemm_blocked(A.M, N, A.K, nullptr, 0, B, ldb, false, C, ldc, bias, ws, &A);
+}
+
+/// <summary>
+/// sgemm_nt with A packed by sgemm_prepack_a.
+/// </summary>
+inline void sgemm_nt_packed(const GemmPackedA& A, int N, const float* Bt, int ldbt,
+	float* C, int ldc, const float* bias, GemmWorkspace& ws) {
+	sgemm_blocked(A.M, N, A.K, nullptr, 0, Bt, ldbt, true, C, ldc, bias, ws, &A);
+}
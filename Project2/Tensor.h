@@ -0,0 +1,194 @@
+#pragma once
+
+#include <cstdlib>
+#include <cstring>
+#include <cstddef>
+#include <memory>
+#include <new>
+
+#ifdef _MSC_VER
+#include <malloc.h>
+#endif
+
+/// <summary>
+/// Allocate / release memory aligned to a cache line (64 bytes) so that SIMD loads never split lines.
+/// </summary>
+static const size_t TENSOR_ALIGNMENT = 64;
+
+inline void* cnn_aligned_alloc(size_t bytes) {
+	if (bytes == 0)
+		bytes = TENSOR_ALIGNMENT;
+#ifdef _MSC_VER
+	void* p = _aligned_malloc(bytes, TENSOR_ALIGNMENT);
+#else
+	void* p = nullptr;
+	if (posix_memalign(&p, TENSOR_ALIGNMENT, bytes) != 0)
+		p = nullptr;
+#endif
+	if (p == nullptr)
+		throw std::bad_alloc();
+	return p;
+}
+
+inline void cnn_aligned_free(void* p) {
+#ifdef _MSC_VER
+	_aligned_free(p);
+#else
+	free(p);
+#endif
+}
+
+/// <summary>
+/// Contiguous, 64-byte aligned 4d float tensor (batch, channel, row, column).
+/// Memory is a single block; copies are shallow and reference counted like cv::Mat,
+/// use clone() for a deep copy. Views (reshape/flatten) share the same block.
+/// Default layout is NCHW (channel planes), NHWC (interleaved channels) is available for kernels that want it.
+/// </summary>
+class Tensor {
+public:
+	enum Layout { NCHW = 0, NHWC = 1 };
+
+	Tensor() {}
+	Tensor(int c, int h, int w, Layout layout = NCHW) { create(1, c, h, w, layout); }
+	Tensor(int n, int c, int h, int w, Layout layout = NCHW) { create(n, c, h, w, layout); }
+
+	/// <summary>
+	/// (Re)shape the tensor. Existing memory is reused when it is large enough, otherwise a new block is allocated.
+	/// Content is undefined afterwards.
+	/// </summary>
+	void create(int n, int c, int h, int w, Layout layout = NCHW) {
+		size_t needed = (size_t)n * c * h * w;
+		if (!buffer || needed > capacity) {
+			float* p = (float*)cnn_aligned_alloc(needed * sizeof(float));
+			buffer = std::shared_ptr<float>(p, cnn_aligned_free);
+			capacity = needed;
+		}
+		dataPtr = buffer.get();
+		setShape(n, c, h, w, layout);
+	}
+
+	void create(int c, int h, int w, Layout layout = NCHW) { create(1, c, h, w, layout); }
+
+	/// <summary>
+	/// Non-owning tensor on external memory of capacity floats (e.g. a slice of an arena). create() keeps
+	/// using that memory while the shape fits and only allocates its own block beyond it.
+	/// The memory must outlive the tensor and every copy of it.
+	/// </summary>
+	static Tensor wrap(float* data, size_t capacity, int n, int c, int h, int w, Layout layout = NCHW) {
+		Tensor t;
+		t.buffer = std::shared_ptr<float>(data, [](float*) {});
+		t.capacity = capacity;
+		t.dataPtr = data;
+		t.setShape(n, c, h, w, layout);
+		return t;
+	}
+
+	bool empty() const { return dataPtr == nullptr || total() == 0; }
+	int batch() const { return dims[0]; }
+	int channels() const { return dims[1]; }
+	int rows() const { return dims[2]; }
+	int cols() const { return dims[3]; }
+	Layout layout() const { return tensorLayout; }
+	size_t total() const { return (size_t)dims[0] * dims[1] * dims[2] * dims[3]; }
+
+	/// <summary>
+	/// Element strides (in floats) for batch, channel, row and column.
+	/// </summary>
+	size_t step(int axis) const { return strides[axis]; }
+
+	float* data() { return dataPtr; }
+	const float* data() const { return dataPtr; }
+
+	/// <summary>
+	/// Pointer to the first element of a row (NCHW) or pixel row (NHWC).
+	/// </summary>
+	float* ptr(int n, int c, int r) { return dataPtr + n * strides[0] + c * strides[1] + r * strides[2]; }
+	const float* ptr(int n, int c, int r) const { return dataPtr + n * strides[0] + c * strides[1] + r * strides[2]; }
+	float* ptr(int c, int r) { return ptr(0, c, r); }
+	const float* ptr(int c, int r) const { return ptr(0, c, r); }
+
+	float& at(int n, int c, int r, int col) { return dataPtr[n * strides[0] + c * strides[1] + r * strides[2] + col * strides[3]]; }
+	const float& at(int n, int c, int r, int col) const { return dataPtr[n * strides[0] + c * strides[1] + r * strides[2] + col * strides[3]]; }
+	float& at(int c, int r, int col) { return at(0, c, r, col); }
+	const float& at(int c, int r, int col) const { return at(0, c, r, col); }
+
+	/// <summary>
+	/// Linear access, valid for any contiguous tensor (e.g. flattened features / probabilities).
+	/// </summary>
+	float& operator[](size_t i) { return dataPtr[i]; }
+	const float& operator[](size_t i) const { return dataPtr[i]; }
+
+	void setTo(float value) {
+		size_t size = total();
+		for (size_t i = 0; i < size; i++)
+			dataPtr[i] = value;
+	}
+
+	Tensor clone() const {
+		Tensor t;
+		if (!empty()) {
+			t.create(dims[0], dims[1], dims[2], dims[3], tensorLayout);
+			memcpy(t.dataPtr, dataPtr, total() * sizeof(float));
+		}
+		return t;
+	}
+
+	/// <summary>
+	/// Zero-copy view with a new shape of the same number of elements.
+	/// </summary>
+	Tensor reshape(int n, int c, int h, int w) const {
+		Tensor t = *this;
+		t.setShape(n, c, h, w, tensorLayout);
+		return t;
+	}
+
+	/// <summary>
+	/// Zero-copy view of each image as a (1 x 1 x C*H*W) feature vector in CHW order.
+	/// NHWC tensors are converted (copied) first so that the feature order always matches the FC weights.
+	/// </summary>
+	Tensor flatten() const {
+		if (tensorLayout == NHWC)
+			return toLayout(NCHW).flatten();
+		return reshape(dims[0], 1, 1, dims[1] * dims[2] * dims[3]);
+	}
+
+	/// <summary>
+	/// Copy into the requested memory layout (returns a shallow copy when it already matches).
+	/// </summary>
+	Tensor toLayout(Layout target) const {
+		if (target == tensorLayout)
+			return *this;
+		Tensor t(dims[0], dims[1], dims[2], dims[3], target);
+		for (int n = 0; n < dims[0]; n++)
+			for (int c = 0; c < dims[1]; c++)
+				for (int r = 0; r < dims[2]; r++)
+					for (int col = 0; col < dims[3]; col++)
+						t.at(n, c, r, col) = at(n, c, r, col);
+		return t;
+	}
+
+private:
+	std::shared_ptr<float> buffer;
+	size_t capacity = 0;
+	float* dataPtr = nullptr;
+	int dims[4] = { 0, 0, 0, 0 };
+	size_t strides[4] = { 0, 0, 0, 0 };
+	Layout tensorLayout = NCHW;
+
+	void setShape(int n, int c, int h, int w, Layout layout) {
+		dims[0] = n; dims[1] = c; dims[2] = h; dims[3] = w;
+		tensorLayout = layout;
+		if (layout == NCHW) {
+			strides[3] = 1;
+			strides[2] = w;
+			strides[1] = (size_t)h * w;
+			strides[0] = (size_t)c * h * w;
+		}
+		else {
+			strides[1] = 1;
+			strides[3] = c;
+			strides[2] = (size_t)w * c;
+			strides[0] = (size_t)h * w * c;
+		}
+	}
+};
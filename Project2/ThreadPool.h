@@ -0,0 +1,366 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "CNNExport.h"
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+/// <summary>
+/// Work-stealing thread pool behind every parallel layer (see parallel_for).
+/// ParallelFor splits [0, count) in halves: the upper half goes to the end of the calling thread's queue,
+/// the lower half is split again until it is at most grain long and runs right away. Idle workers steal the
+/// oldest (largest) ranges from the front of other queues and split them the same way, so a range spreads
+/// over the threads in log steps and uneven tiles even out. The caller runs tasks until its range is done
+/// instead of blocking, which makes nested calls (a batch of requests, each running parallel layers)
+/// share the same threads without oversubscription.
+/// A waiting thread only helps with ranges at least as deeply nested as the one it waits for, so a layer
+/// never waits behind an outer task such as a whole scan worker.
+/// Threads outside the pool share one injection queue. Bodies must not throw.
+/// Layers run on ThreadPool::Current(): the pool of the worker calling them, the pool an outside thread is
+/// bound to (Binding), else the global one. Several pools, e.g. one per NUMA node, thus serve separate
+/// requests side by side.
+/// </summary>
+class ThreadPool {
+public:
+	static const int TASKS_PER_THREAD = 4;	// default grain: ranges per thread
+
+	/// <param name="threads">threads running tasks, the calling thread included; 0: one per CPU the process may run on</param>
+	/// <param name="pin">pin worker i to the (i+1)-th CPU the process may run on, the first stays with the caller</param>
+	explicit ThreadPool(int threads = 0, bool pin = false) {
+		std::vector<int> cpus = AvailableCpus();
+		if (threads <= 0)
+			threads = cpus.empty() ? std::max(1, (int)std::thread::hardware_concurrency()) : (int)cpus.size();
+		Start(threads, pin ? cpus : std::vector<int>());
+	}
+
+	/// <summary>
+	/// One thread per listed CPU: worker i pinned to cpus[i + 1], cpus[0] is left to the calling thread.
+	/// </summary>
+	explicit ThreadPool(const std::vector<int>& cpus) {
+		Start(std::max(1, (int)cpus.size()), cpus);
+	}
+
+	~ThreadPool() {
+		stopping = true;
+		{
+			std::lock_guard<std::mutex> lock(sleepMutex);
+			wake.notify_all();
+		}
+		for (std::thread& worker : workers)
+			worker.join();
+	}
+
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+	/// <summary>
+	/// The pool of the cnn library (CNNFactory.cpp). Created on first use with the environment variables
+	/// CNN_THREADS (thread count, default one per core) and CNN_PIN=1.
+	/// </summary>
+	CNN_API static ThreadPool& Global();
+
+	/// <summary>
+	/// Replace the global pool. Only while nothing runs on it, e.g. at startup.
+	/// </summary>
+	CNN_API static void Configure(int threads, bool pin);
+
+	/// <summary>
+	/// The pool parallel layers of the calling thread run on: its own when it is a worker, else the one it is
+	/// bound to, else Global().
+	/// </summary>
+	static ThreadPool& Current() {
+		if (current != nullptr)
+			return *current;
+		return bound != nullptr ? *bound : Global();
+	}
+
+	/// <summary>
+	/// Binds the constructing thread (outside any pool) to a pool until destroyed; see Current().
+	/// </summary>
+	class Binding {
+	public:
+		explicit Binding(ThreadPool& pool) : outer(bound) {
+			bound = &pool;
+		}
+
+		~Binding() {
+			bound = outer;
+		}
+
+		Binding(const Binding&) = delete;
+		Binding& operator=(const Binding&) = delete;
+
+	private:
+		ThreadPool* outer;
+	};
+
+	/// <summary>
+	/// Threads that run tasks, the calling thread included.
+	/// </summary>
+	int Concurrency() const {
+		return (int)workers.size() + 1;
+	}
+
+	/// <summary>
+	/// body(begin, end) over ranges covering [0, count), in parallel; returns when all of them are done.
+	/// Every range runs on its own copy of body, which must be cheap to copy: the copy does not escape, so the
+	/// compiler keeps values captured by value in registers even across stores through char pointers.
+	/// </summary>
+	/// <param name="grain">longest range run without splitting, &lt;= 0: about TASKS_PER_THREAD ranges per thread</param>
+	template <typename Body>
+	void ParallelFor(int count, int grain, const Body& body) {
+		if (count <= 0)
+			return;
+		if (grain <= 0)
+			grain = std::max(1, count / (Concurrency() * TASKS_PER_THREAD));
+		if (workers.empty() || count <= grain) {
+			Body local = body;
+			local(0, count);
+			return;
+		}
+		TaskGroup group;
+		group.run = [](const void* body, int begin, int end) {
+			Body local = *static_cast<const Body*>(body);
+			local(begin, end);
+		};
+		group.body = &body;
+		group.grain = grain;
+		group.level = level;
+		group.remaining.store(count, std::memory_order_relaxed);
+		Run(Task{ &group, 0, count });
+		Wait(group);
+	}
+
+private:
+	static const int SPIN = 64;	// empty polls before yielding, twice that before sleeping
+
+	// One ParallelFor call; lives on the caller's stack until remaining reaches 0.
+	struct TaskGroup {
+		void (*run)(const void* body, int begin, int end);
+		const void* body;
+		int grain;
+		int level;	// nesting depth of the calling thread
+		std::atomic<int> remaining;	// indices not done yet
+	};
+
+	struct Task {
+		TaskGroup* group;
+		int begin;
+		int end;
+	};
+
+	struct alignas(64) WorkQueue {
+		std::mutex lock;
+		std::deque<Task> tasks;
+	};
+
+	std::vector<WorkQueue> queues;
+	std::vector<std::thread> workers;
+	std::atomic<int> pending{ 0 };	// tasks in all queues
+	std::atomic<int> sleepers{ 0 };
+	std::atomic<bool> stopping{ false };
+	std::mutex sleepMutex;
+	std::condition_variable wake;
+
+	// The pool a thread works for (null outside), its queue and how deeply nested its current task is.
+	static inline thread_local ThreadPool* current = nullptr;
+	static inline thread_local ThreadPool* bound = nullptr;	// Binding of a thread outside the pools
+	static inline thread_local int index = 0;
+	static inline thread_local int level = 0;
+
+	/// <param name="cpus">pin worker i to cpus[(i + 1) % size], empty: no pinning</param>
+	void Start(int threads, const std::vector<int>& cpus) {
+		queues = std::vector<WorkQueue>(threads);	// one per worker, the last one for outside threads
+		for (int i = 0; i < threads - 1; i++) {
+			int cpu = cpus.empty() ? -1 : cpus[(i + 1) % cpus.size()];
+			workers.emplace_back(&ThreadPool::Work, this, i, cpu);
+		}
+	}
+
+	WorkQueue& OwnQueue() {
+		return current == this ? queues[index] : queues.back();
+	}
+
+	void Push(const Task& task) {
+		WorkQueue& queue = OwnQueue();
+		{
+			std::lock_guard<std::mutex> lock(queue.lock);
+			queue.tasks.push_back(task);
+		}
+		pending.fetch_add(1);
+		if (sleepers.load() > 0) {
+			std::lock_guard<std::mutex> lock(sleepMutex);
+			wake.notify_one();
+		}
+	}
+
+	/// <summary>
+	/// Newest task of the own queue, else the oldest of another queue; only tasks nested at least min_level deep.
+	/// </summary>
+	bool Take(int min_level, Task& task) {
+		if (pending.load(std::memory_order_relaxed) == 0)
+			return false;
+		WorkQueue& own = OwnQueue();
+		{
+			std::lock_guard<std::mutex> lock(own.lock);
+			for (auto it = own.tasks.rbegin(); it != own.tasks.rend(); ++it) {
+				if (it->group->level >= min_level) {
+					task = *it;
+					own.tasks.erase(std::next(it).base());
+					pending.fetch_sub(1);
+					return true;
+				}
+			}
+		}
+		int self = (int)(&own - queues.data());
+		int count = (int)queues.size();
+		for (int i = 1; i < count; i++) {
+			WorkQueue& victim = queues[(self + i) % count];
+			std::lock_guard<std::mutex> lock(victim.lock);
+			for (auto it = victim.tasks.begin(); it != victim.tasks.end(); ++it) {
+				if (it->group->level >= min_level) {
+					task = *it;
+					victim.tasks.erase(it);
+					pending.fetch_sub(1);
+					return true;
+				}
+			}
+		}
+		return false;
+	}
+
+	void Run(Task task) {
+		TaskGroup* group = task.group;
+		while (task.end - task.begin > group->grain) {
+			int middle = task.begin + (task.end - task.begin) / 2;
+			Push(Task{ group, middle, task.end });
+			task.end = middle;
+		}
+		int outer = level;
+		level = group->level + 1;
+		group->run(group->body, task.begin, task.end);
+		level = outer;
+		// Last access: the caller may return as soon as remaining reaches 0.
+		group->remaining.fetch_sub(task.end - task.begin, std::memory_order_acq_rel);
+	}
+
+	void Wait(TaskGroup& group) {
+		Task task;
+		for (int spin = 0; group.remaining.load(std::memory_order_acquire) > 0;) {
+			if (Take(group.level, task)) {
+				Run(task);
+				spin = 0;
+			}
+			else if (++spin > SPIN) {
+				std::this_thread::yield();
+			}
+		}
+	}
+
+	void Work(int id, int cpu) {
+		current = this;
+		index = id;
+		if (cpu >= 0)
+			PinThread(cpu);
+		Task task;
+		for (int spin = 0;;) {
+			if (Take(0, task)) {
+				Run(task);
+				spin = 0;
+				continue;
+			}
+			if (stopping)
+				return;
+			if (++spin < SPIN)
+				continue;
+			if (spin < 2 * SPIN) {
+				std::this_thread::yield();
+				continue;
+			}
+			std::unique_lock<std::mutex> lock(sleepMutex);
+			sleepers.fetch_add(1);
+			wake.wait(lock, [this] { return pending.load() > 0 || stopping; });
+			sleepers.fetch_sub(1);
+			spin = 0;
+		}
+	}
+
+public:
+	/// <summary>
+	/// CPUs the process may run on, in order.
+	/// </summary>
+	static std::vector<int> AvailableCpus() {
+		std::vector<int> cpus;
+#ifdef _WIN32
+		DWORD_PTR process, system;
+		if (GetProcessAffinityMask(GetCurrentProcess(), &process, &system)) {
+			for (int cpu = 0; cpu < (int)sizeof(DWORD_PTR) * 8; cpu++) {
+				if ((process >> cpu) & 1)
+					cpus.push_back(cpu);
+			}
+		}
+#elif defined(__linux__)
+		cpu_set_t set;
+		if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+			for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+				if (CPU_ISSET(cpu, &set))
+					cpus.push_back(cpu);
+			}
+		}
+#endif
+		return cpus;
+	}
+
+	static void PinThread(int cpu) {
+		PinThread(std::vector<int>{ cpu });
+	}
+
+	/// <summary>
+	/// Let the calling thread run on any of cpus only.
+	/// </summary>
+	static void PinThread(const std::vector<int>& cpus) {
+#ifdef _WIN32
+		DWORD_PTR mask = 0;
+		for (int cpu : cpus)
+			mask |= cpu < (int)sizeof(DWORD_PTR) * 8 ? (DWORD_PTR)1 << cpu : 0;
+		if (mask != 0)
+			SetThreadAffinityMask(GetCurrentThread(), mask);
+#elif defined(__linux__)
+		cpu_set_t set;
+		CPU_ZERO(&set);
+		for (int cpu : cpus) {
+			if (cpu >= 0 && cpu < CPU_SETSIZE)
+				CPU_SET(cpu, &set);
+		}
+		if (CPU_COUNT(&set) > 0)
+			pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+		(void)cpus;	// no thread affinity API (macOS): threads stay unpinned
+#endif
+	}
+};
+
+/// <summary>
+/// body(i) for every i in [0, count) on the current pool, in ranges of about count / (TASKS_PER_THREAD * threads).
+/// </summary>
+template <typename Body>
+inline void parallel_for(int count, const Body& body) {
+	ThreadPool::Current().ParallelFor(count, 0, [&body](int begin, int end) {
+		Body local = body;
+		for (int i = begin; i < end; i++)
+			local(i);
+	});
+}
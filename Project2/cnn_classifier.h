@@ -0,0 +1,51 @@
+#pragma once
+
+#include <stddef.h>
+#include "CNNExport.h"
+
+/*
+ * C API of the cnn library: a face / background classifier for BGR 8-bit images.
+ * A classifier owns its engine, model and buffers; use one per thread. Images that are not 128x128 are
+ * resized. Functions return CNN_OK or a negative cnn_status.
+ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct cnn_classifier cnn_classifier;
+
+typedef enum cnn_status {
+	CNN_OK = 0,
+	CNN_ERROR_ARGUMENT = -1,	/* null pointer, unknown engine or empty image */
+	CNN_ERROR_DECODE = -2,		/* image file missing or not decodable */
+	CNN_ERROR_MODEL = -3,		/* model or batch normalization file missing or not matching the network */
+	CNN_ERROR_INTERNAL = -4
+} cnn_status;
+
+/* Number of engines; valid engine choices are 0 .. cnn_engine_count() - 1 (see make_cnnbase). */
+CNN_API int cnn_engine_count(void);
+
+/*
+ * Create a classifier on an engine. batchnorm: stored batch normalization to fold (see CNNModel),
+ * NULL for per-image statistics. status (may be NULL) receives the reason when NULL is returned.
+ */
+CNN_API cnn_classifier* cnn_classifier_create(int engine, const char* batchnorm, int* status);
+
+/*
+ * Same on a binary model file (CNNModel::SaveBinary), memory-mapped read-only and shared by every
+ * classifier and process that maps it. batchnorm must be NULL when the file is already folded.
+ */
+CNN_API cnn_classifier* cnn_classifier_create_model(int engine, const char* model, const char* batchnorm, int* status);
+
+CNN_API void cnn_classifier_destroy(cnn_classifier* classifier);
+
+/* Classify rows x cols BGR pixels, step bytes per row. scores receives (bg, face) probabilities. */
+CNN_API int cnn_classify_bgr(cnn_classifier* classifier, const unsigned char* pixels, int rows, int cols,
+	size_t step, float scores[2]);
+
+/* Decode an image file (jpg, png, ...) and classify it; large JPEGs are decoded at reduced resolution. */
+CNN_API int cnn_classify_file(cnn_classifier* classifier, const char* path, float scores[2]);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,22 @@
+#include "face_binary_cls.h"
+
+static float conv0_weight[16 * 3 * 3 * 3] = { 0.39464307f, 0.31125212f, -0.113536164f, 0.30107704f, 0.40669382f, 0.42162737f, 0.21860032f, -0.13719831f, -0.2722659f, -0.3841937f, -0.72105736f, -0.58308995f, -0.48366326f, -0.28575644f, -0.05651677f, -0.53083885f, -0.77037054f, -0.7629983f, 0.025733506f, 0.12633972f, -0.17480506f, 0.21570784f, 0.21041252f, -0.100641824f, 0.27207935f, -0.3632402f, -0.25211236f, -0.3779639f, -0.28126734f, -0.099892944f, -0.29411986f, -0.352513f, -0.27488035f, 0.07936121f, -0.11976181f, -0.09621229f, -0.29249555f, -0.35626453f, -0.089926735f, -0.30967128f, -0.45575193f, -0.18596205f, 0.0046898457f, 0.07736333f, 0.11418518f, 0.049611814f, -0.1174234f, -0.061348002f, -0.17694806f, -0.23101062f, -0.01014731f, 0.10893406f, -0.033674054f, 0.055747885f, -0.7857677f, -0.43438435f, -0.23328306f, -0.7045561f, -1.0594592f, -0.96986556f, -0.4306335f, -0.49769416f, -0.38025817f, 0.743165f, 0.39787427f, 0.70530725f, 0.14347716f, 0.31259444f, 0.2433205f, 0.6502008f, 0.17526624f, -0.21967348f, 0.3032335f, 0.6659125f, 0.32520002f, 0.25262007f, 0.21478127f, -0.25885805f, 0.5798695f, 0.10853558f, 0.5885381f, -0.66717565f, -2.0332286f, -2.0057657f, 2.6963172f, 0.49773622f, 1.189053f, 0.8569126f, -0.5478645f, -0.5474117f, -0.38225102f, -0.10105263f, -0.7386174f, 2.0439014f, 1.4866843f, 0.50445044f, -0.5007768f, -1.8825145f, -0.70317525f, -0.8941499f, -0.75519013f, 1.0137452f, -0.21174146f, 1.5843949f, 2.470182f, -2.3377092f, -2.20756f, -0.7657903f, 0.11595148f, -0.029040033f, 0.7682127f, 0.38493067f, 1.1514106f, 1.0909537f, -1.0764828f, -1.1670347f, 0.029069614f, -0.877457f, 0.5579421f, 1.1665275f, -0.18994229f, 0.7673296f, 0.74027365f, -1.4748354f, -1.5412221f, -0.6860829f, -0.18105343f, 0.068953045f, 1.2358037f, -0.5324052f, -0.14725618f, 1.4631968f, -1.3702732f, -0.7870854f, 0.98745936f, 0.26478675f, 0.3556826f, 0.104706556f, 0.25831616f, 0.58448446f, 0.37813473f, 0.0707449f, 0.23480041f, 0.23432183f, -0.0130122695f, 0.1177902f, 0.14724356f, 0.04454773f, 0.30134895f, 0.034679458f, 0.10438265f, 0.080957696f, 0.04673539f, 0.000114658316f, 0.11621634f, -0.061609983f, 0.13820495f, 0.06610005f, 0.024520641f, 0.103318214f, 0.17039937f, -0.07025218f, -0.6798553f, -1.3538299f, -0.82105464f, 2.2388427f, 0.52264774f, -0.36318606f, -1.4912193f, 1.1072139f, 0.33895338f, -1.7142519f, 0.5416925f, -1.0977235f, 1.6462898f, 0.90318096f, 0.94332093f, -1.8965774f, 0.7349083f, -2.4249914f, -1.6165315f, 1.7934322f, 0.48784658f, -0.15854074f, 0.78907776f, 0.014245147f, -2.945607f, 0.5394235f, -0.4857813f, -0.054304346f, -0.3152643f, -0.06946454f, -0.11268508f, -0.17926472f, -0.20574911f, -0.07990353f, -0.49118677f, -0.025087593f, 0.19014266f, -0.18238616f, -0.059863616f, 0.2252154f, -0.17008233f, 0.26245677f, 0.29177034f, -0.2754409f, 0.30317858f, -0.026542168f, -0.56722933f, -0.11456274f, -0.067640044f, -0.10235165f, -0.12649953f, -0.36027682f, -0.49318066f, -0.20856257f, -0.10553966f, 0.14529943f, 0.31293455f, -0.6343524f, -0.41135284f, -0.22918832f, -0.3269688f, -0.4666978f, -0.14151694f, 0.047637857f, 0.3689984f, 0.54759896f, -0.7058803f, -0.5644361f, 0.13388251f, -0.34838295f, -0.7413975f, -0.38709667f, 0.25354767f, -0.007902776f, 0.33674595f, -0.0746156f, -0.27811626f, -0.110156484f, -0.2025166f, -0.2381966f, -0.021202441f, 0.8231694f, -0.6653018f, -1.2321107f, 0.8115323f, -0.122332565f, -1.0530983f, 0.45618296f, 0.102331914f, 0.033566006f, 0.85834605f, -0.29432422f, -1.2657924f, 0.9141286f, -0.3266094f, -0.7053741f, 0.81276864f, 0.07665286f, -0.5127557f, 0.14322002f, -0.7193492f, -0.338985f, 0.97604406f, -0.105564944f, -0.19280234f, 0.526181f, 0.3487025f, -0.12819663f, -0.15909345f, -0.10290787f, -0.5248588f, 0.48928633f, 1.0575275f, 0.14167315f, 0.83029175f, 1.1101023f, 0.5940608f, -0.01074784f, -0.723216f, -0.7768869f, 0.98885226f, 0.54384017f, -0.703233f, 0.63482726f, -0.07262965f, -0.61900723f, 0.4230914f, -0.51311386f, -0.7291202f, 0.27294713f, 0.10586888f, -0.5550978f, 0.22313671f, 0.7238348f, -0.4494153f, 0.29698962f, 0.56095773f, 0.31671995f, 0.17024502f, 0.38235816f, 0.25565818f, -0.1672302f, 0.3076467f, -0.01307815f, 0.14418042f, 0.56610113f, 0.2148333f, 0.15399817f, 0.67229635f, 0.13392828f, 0.20211038f, 0.31115752f, 0.0095776105f, -0.19347395f, 0.015239959f, -0.07266435f, -0.21352863f, -0.048559375f, -0.19423409f, -0.29441926f, -0.21786705f, -0.13871895f, 0.13560575f, -0.2710085f, -0.7794796f, -0.62922764f, -0.96720576f, -1.7171217f, -0.86367893f, -1.268142f, -0.39895812f, 0.55501527f, 0.5426243f, 1.0501138f, 1.3332919f, 1.0797073f, 0.6276182f, 1.3336443f, 0.89330786f, 0.79221326f, -0.031759303f, 0.6283158f, -0.8274064f, -0.26828262f, 0.5890328f, -0.6915631f, 0.29678676f, 0.12777342f, -0.4851606f, -0.21372864f, -0.30243278f, -0.057936516f, -0.22304212f, -0.5086857f, -0.36543858f, 0.061323658f, -0.058094397f, -0.2603215f, -0.04734044f, -0.12903345f, 0.1044603f, -0.17583425f, -0.2569909f, -0.29177812f, 0.011159535f, -0.11316811f, -0.15704016f, -0.112502016f, 0.076443285f, 0.08122089f, -0.00030651398f, -0.19409938f, -0.18510209f, 0.097724915f, -0.13614564f, -0.11792337f, 0.6576927f, -1.0175071f, -0.65340555f, -0.5979028f, 1.1775038f, 0.5222899f, -0.8214336f, 1.736255f, -0.8586219f, -0.79329425f, 0.17091788f, -0.011192297f, -1.8893261f, -0.5987776f, -0.99274975f, -0.58744484f, 1.0230196f, -1.8118623f, 1.0436924f, 0.34172526f, 0.7626623f, 0.16033667f, 0.20234789f, -0.21112663f, -0.40952432f, 2.2407742f, -1.4594872f, -3.1228063f, -3.9376194f, 2.432453f, 1.2279854f, -0.13547976f, -3.1744912f, 1.8420978f, -2.0824459f, 4.346323f, -0.10367142f, -3.9673567f, 2.7665029f, 4.8321104f, 0.17018299f, 0.5056449f, -1.5576425f, -2.362877f, 4.7744937f, 0.57975817f, -2.178875f, 3.423763f, 5.2192326f, 2.6792204f, -4.330439f, -2.3420188f, -6.791226f, 0.863587f };
+static float conv0_bias[16] = { 0.5312736f, 2.0255265f, 0.5032426f, 1.0871441f, -0.16811907f, -1.4195297f, 1.3647283f, 1.4160137f, 2.0942433f, 0.37322155f, -0.98419213f, -1.6288463f, 0.11098604f, 1.7342286f, 0.8017651f, 0.11197768f };
+
+static float conv1_weight[32 * 16 * 3 * 3] = { 0.014125248f, 0.02011669f, 0.0045715445f, 0.04060846f, -0.0028727339f, -0.0051887906f, -0.0021336132f, 0.017233144f, 0.019087555f, -0.050847527f, -0.036057323f, -0.0474122f, -0.03970468f, -0.057623364f, -0.023586567f, -0.056559544f, -0.015139501f, -0.035067342f, 0.035408456f, 0.016424006f, 0.028921401f, 0.034245424f, 0.037314687f, -0.00438508f, 0.021399492f, 0.010438159f, -0.0007815449f, -0.034098484f, -0.007026171f, 0.032585986f, 0.05825255f, 0.013727081f, 0.07811452f, 0.01124295f, 0.021197375f, -0.0015449037f, -0.0013319806f, -0.008390102f, -0.017952355f, -0.0023986371f, -0.0050387303f, 0.06115652f, 0.00823463f, -0.04006314f, 0.016569383f, 0.052072126f, -0.0019818866f, 0.026132092f, 0.02867473f, 0.007973486f, 0.062428784f, 0.015201683f, -0.0019699773f, 0.019259062f, 0.005896697f, 0.0035950614f, 0.02319124f, 0.0452346f, 0.002449538f, 0.04406255f, 0.04981729f, 0.052721806f, 0.038780723f, -0.005027108f, 0.02685495f, 0.03040057f, 0.0391252f, -0.018487908f, 0.044216696f, 0.010911246f, -0.013053186f, 0.022384612f, -0.087844744f, -0.018411404f, -0.019791473f, -0.073141314f, -0.032482456f, -0.04522565f, -0.033846974f, -0.045551565f, -0.0016718251f, -0.0049911127f, -0.03445318f, 0.008672465f, -0.018223213f, -0.02042446f, -0.004876857f, 0.06469478f, -0.018232081f, 0.0144121405f, -0.00037349598f, 0.04014398f, 0.020879557f, 0.048954535f, 0.049837742f, 0.070625f, 0.047983874f, -0.0110023f, 0.030104399f, 0.038402166f, 0.010721614f, 0.039257772f, 0.045628298f, 0.048027314f, 0.07042415f, 0.028564949f, 0.034244537f, 0.017332964f, 0.028848995f, 0.00462516f, 0.045134764f, 0.03252499f, 0.03574412f, 0.059356324f, 0.06291903f, 0.018422052f, 0.023654588f, -0.051211495f, -0.04428374f, -0.01636019f, -0.06823624f, -0.027714513f, -0.034291353f, -0.025394281f, -0.004618259f, -0.032069903f, 0.011104218f, -0.02635356f, 0.009131064f, -0.013256146f, -0.0060902066f, 0.034868386f, -0.0002852273f, 0.0040159603f, -0.004564797f, -0.047324132f, -0.023962462f, 0.026137087f, 0.051210742f, 0.024852907f, 0.06375664f, 0.044772327f, -0.041245874f, 0.028111624f, 0.015253411f, 0.026545225f, -0.08274737f, -0.074680224f, -0.010917103f, -0.008953084f, -0.12511635f, -0.053736676f, -0.031518374f, 0.03455151f, 0.21167342f, 0.060543872f, -0.046763882f, 0.16498752f, 0.15159644f, -0.16125081f, 0.0060472656f, 0.125927f, -0.08319646f, -0.021254519f, 0.06058255f, -0.099235214f, -0.04911397f, 0.018714586f, -0.09558144f, -0.072429664f, 0.023992715f, -0.007939357f, -0.12063019f, -0.16489992f, 0.014591068f, -0.11732934f, -0.18235694f, -0.032383732f, -0.11013844f, -0.1375559f, -0.04727904f, 0.17402138f, 0.26712856f, -0.028024355f, 0.021619577f, 0.1812035f, 0.018803462f, 0.04771608f, 0.06890072f, 0.036188934f, -0.17731284f, 0.051151965f, 0.1519915f, -0.13831817f, -0.11978731f, 0.2106041f, 0.00462742f, -0.09450281f, -0.013326147f, -0.03574589f, -0.06175537f, -0.12081138f, -0.0859599f, -0.09429288f, -0.09505276f, -0.15294029f, -0.07188203f, -0.0066667725f, -0.021395031f, 0.009661893f, -0.018800395f, -0.02461362f, -0.012288863f, -0.029849278f, -0.03699604f, -0.009184922f, 0.0060506705f, 0.22485133f, 0.052589826f, -0.12472782f, 0.102051996f, 0.13418278f, -0.21064802f, -0.025355697f, 0.06517182f, 0.09981221f, 0.13040014f, -0.012923718f, 0.08306546f, 0.28628814f, 0.120045744f, -0.052516982f, 0.092872456f, 0.124382295f, 0.10239299f, -0.22453439f, -0.03500422f, 0.18508445f, -0.05593278f, -0.123204954f, 0.20199533f, 0.028091053f, -0.112577416f, -0.035306547f, -0.23756664f, -0.045920223f, 0.03301163f, -0.17477708f, -0.14416474f, 0.13095346f, -0.07892382f, -0.15437244f, 0.008724582f, -0.063123666f, 0.08656124f, 0.047250714f, -0.021903718f, -0.006356725f, 0.03625579f, 0.0042241663f, -0.0035029536f, 0.017216401f, 0.20514575f, 0.038903993f, -0.067970864f, 0.119485684f, 0.13879508f, -0.12752385f, 0.011380805f, 0.05480924f, -0.03858474f, -0.00046294296f, -0.07161286f, -0.08865503f, -0.0018964176f, -0.019543221f, -0.13756199f, -0.032048848f, -0.05913124f, -0.0101326f, -0.0015753054f, 0.027494822f, 0.0014196017f, 0.0044595306f, 0.0012213995f, -0.038983308f, -0.049142092f, 0.04794849f, 0.0009651372f, -0.002637324f, 0.011883203f, 0.002563157f, 0.019058762f, 0.030600691f, 0.014115883f, 0.032696083f, 0.043301374f, 8.318255e-05f, 0.027780557f, 0.015090973f, -0.01972309f, -0.001173348f, -0.010289963f, -0.029546442f, 0.0028431343f, 0.022420688f, 0.015909696f, -0.0041557234f, 0.017329317f, 0.022179246f, -0.006993201f, -0.010310398f, -0.00123551f, 0.021966962f, 0.006622839f, 0.069876656f, 0.04527835f, 0.07949403f, 0.06090086f, 0.027644373f, 0.032443225f, 0.05238901f, 0.031170253f, 0.0509662f, -0.016589602f, 0.013168334f, -0.0056770546f, 0.034721322f, 0.0063995635f, 0.0034566934f, 0.026242092f, -0.010821046f, 0.049934756f, 0.001989844f, -0.023880387f, -0.013836202f, 0.008899786f, 0.01562885f, 0.010918571f, -0.031115342f, 0.0023456651f, -0.010096847f, 0.052210435f, 0.027478084f, 0.0358251f, 0.0511717f, 0.0468986f, 0.027749758f, 0.017511345f, 0.044061992f, 0.037847824f, 0.06308244f, 0.02315965f, 0.012050436f, 0.023294382f, 0.023284264f, 0.038453303f, 0.05443062f, 0.030910557f, 0.021595314f, -0.007425822f, -0.0016078671f, 0.0025320612f, -0.04226839f, 0.0030872729f, 0.012502826f, 0.0072079585f, -0.01261794f, 0.019275164f, 0.06885986f, 0.011376271f, 0.064169586f, 0.0095228795f, 0.0011001187f, 0.01636024f, 0.05098465f, 0.0034864345f, 0.047419805f, 0.010074589f, 0.008863873f, -0.005056209f, 0.010233964f, 0.02171337f, -0.014566464f, -0.008240393f, -0.03583871f, -0.010112417f, 0.0004198168f, 0.011100249f, -0.005054376f, -0.019727575f, 0.010587928f, -0.025497468f, 0.0046942662f, -0.0029203678f, -0.004570243f, -0.036247827f, -0.021469899f, -0.041306995f, 0.021415163f, -0.022150273f, -0.0370679f, 0.009897294f, -0.031268638f, -0.016731208f, 0.02270379f, 0.0044755414f, 0.031421516f, -0.029350527f, -0.0027889558f, 0.0061243298f, 0.00932064f, -0.006046284f, 0.020961367f, 0.02178064f, 0.022325892f, 0.0012179662f, -0.037456512f, 0.016718522f, 0.013440761f, 0.04041118f, 0.03733975f, 0.030419562f, 0.060966413f, 0.07450549f, 0.050234914f, 0.07075591f, 0.014681637f, 0.072940014f, 0.0012711012f, -0.06835999f, 0.06684235f, 0.0026866319f, 0.007616575f, -0.011647566f, 0.014003383f, -0.035295863f, 0.002978575f, -0.0012869523f, -0.0078805415f, 0.01783392f, -0.07207559f, -0.048050113f, -0.065096654f, -0.06867883f, -0.06361245f, -0.058711533f, -0.054465104f, -0.026701357f, -0.026534671f, 0.012088573f, -0.015934138f, -0.030870456f, -0.03879173f, -0.032883026f, -0.055212755f, -0.0025475356f, -0.015456707f, 0.035257325f, -0.019688852f, 0.02979608f, 0.028460104f, 0.02314902f, 0.075917855f, 0.09069404f, -0.038456738f, -0.08827853f, -0.06923629f, -0.057367545f, 0.01038085f, 0.10748697f, 0.043677345f, 0.064662084f, 0.11071822f, -0.008692642f, -0.058254164f, -0.051143926f, 0.021604793f, 0.012816572f, -0.0017434213f, -0.03590835f, -0.012899126f, -0.0072575817f, -0.053933013f, -0.044396807f, -0.04766038f, 0.1200502f, 0.05184235f, 0.09962108f, 0.102992915f, 0.055423856f, 0.10812152f, 0.07321805f, 0.03081598f, 0.01828473f, -0.02366985f, 0.05840003f, -0.022050912f, 0.0044102264f, 0.104057424f, -0.018393802f, -0.016131427f, 0.006524725f, 0.016732832f, -0.061409723f, -0.08326538f, -0.034994863f, -0.078927f, -0.06631797f, -0.06550441f, -0.017424056f, -0.0598076f, -0.037405767f, -0.014945922f, 0.0113092875f, 0.009300066f, -0.04156107f, -0.042164393f, -0.006075931f, 0.009762053f, -0.03180444f, 0.00014387305f, 0.019476162f, -0.0075921253f, 0.009099958f, 0.009037114f, 0.014816223f, 0.0026243897f, -0.042678278f, -0.02075295f, -0.02588497f, 0.009092025f, 0.038667627f, 0.005821046f, 0.009612776f, 0.03739686f, 0.0029781887f, -0.00021139551f, -0.039126936f, 0.014384236f, -0.021736303f, -0.02889446f, 0.0033345744f, 0.023117825f, -0.013924731f, -0.0053566243f, 0.022635462f, 0.005264483f, -0.03572943f, -0.027383814f, -0.04792765f, -0.033467304f, -0.08080321f, -0.0646017f, -0.06041844f, -0.048238203f, -0.050220627f, -0.022124147f, 0.0051916824f, 0.006584962f, -0.021767782f, -0.011446081f, 0.01882262f, -0.01299332f, 0.0030890056f, 0.018202072f, -0.004934282f, -0.032871585f, 0.06366763f, -0.016718589f, -0.02249574f, 0.34137696f, 0.20208173f, -0.040264945f, 0.08010729f, 0.045016624f, -0.006159633f, -0.015495915f, -0.02915024f, -0.0029963504f, -0.024540272f, -0.054798987f, -0.009961343f, -0.03519944f, -0.048945185f, -0.0047740396f, -0.02102925f, 0.0025079204f, -0.00891678f, -0.025403522f, -0.0031043629f, 0.019027047f, -0.0029102608f, -0.0067213452f, 0.008691971f, -0.02031007f, -0.04849098f, -0.015706316f, -0.049552027f, -0.036185414f, -0.009110461f, -0.026671112f, -0.016385878f, -0.010433546f, 0.00014343031f, 0.013638414f, -0.0071144695f, -0.0025728655f, -0.002666923f, -0.0100076925f, -0.00020986369f, -0.008781097f, -0.02839022f, -0.039115578f, -0.026804127f, -0.026105966f, -0.042063255f, -0.05479556f, 0.040555645f, 0.002886485f, -0.008486121f, 0.055080514f, 0.047427345f, 0.0063539706f, 0.064771526f, 0.06547859f, 0.03672543f, 0.029186435f, 0.035604723f, 0.026737267f, 0.0131502f, -0.0051195975f, -0.009927112f, -0.019463371f, -0.016168337f, -0.024909016f, -0.012331441f, -0.012114684f, -0.005994488f, -0.0021838f, -0.017063478f, -0.02621687f, 0.002133298f, -0.006176066f, -0.013459342f, -0.002965413f, 0.0044426396f, -0.0077449786f, -0.010644454f, -0.010087688f, 0.010094839f, -0.006276892f, -0.04673869f, -0.018304154f, 0.026855338f, -0.0047932337f, 0.017266618f, 0.0010646192f, -0.005462929f, -0.018872011f, -0.046046168f, -0.03693878f, -0.0391345f, 0.011648876f, -0.015128415f, -0.034650292f, 0.027246758f, 0.036310524f, 0.016515773f, 0.028804975f, 0.042811487f, 0.034101382f, 0.015895015f, 0.023083275f, 0.008645101f, 0.02428278f, -0.002094274f, -0.019435378f, 0.032628596f, 0.013094297f, -0.012096168f, -0.012416899f, -0.014868241f, 0.0011711719f, -0.04030001f, -0.027203742f, -0.026008861f, -0.0047772317f, -0.010823114f, -0.024525348f, -0.015753295f, -0.03151514f, -0.020192042f, -0.012118214f, -0.0053264676f, -0.0025475607f, -0.03468845f, -0.030174747f, -0.039665144f, 0.0038372558f, -0.018532906f, -0.00479735f, -0.023638304f, -0.00644051f, -0.01115271f, -0.013376127f, -0.025982147f, -0.012644796f, -0.011618949f, -0.013616335f, -0.016360568f, -0.0099102305f, -0.011859342f, -0.03943827f, -0.039006773f, -0.041398026f, -0.04674905f, -0.031684633f, -0.05278899f, -0.05099096f, 0.033064023f, -0.029915031f, -0.0206671f, 0.0049834135f, 0.009635478f, -0.0146983825f, 0.0021425614f, -0.0001459136f, 0.04948327f, -0.04039265f, -0.04808888f, -0.041974507f, -0.042574257f, -0.048071597f, -0.014984771f, -0.04500971f, -0.0939243f, 0.0010392506f, -0.01595026f, -0.009534432f, -0.032400753f, -0.070161246f, -0.04189296f, -0.06717756f, -0.029670592f, 0.01427058f, 0.050291196f, 0.13378224f, -0.10923916f, 0.07666793f, 0.13373318f, -0.032206405f, 0.047997683f, -0.09889689f, -0.17710191f, -0.14338665f, 0.05883516f, -0.114319235f, 0.07618672f, 0.05573734f, -0.10756956f, 0.0013396556f, -0.120109245f, -0.21723248f, -0.08546098f, -0.08769601f, -0.031038972f, -0.019289935f, -0.049270708f, -0.026000557f, -0.019079149f, -0.047314458f, -0.05783854f, -0.0015615497f, 0.11855278f, 0.042745393f, 0.076520465f, 0.1622469f, 0.08644111f, 0.17179479f, 0.06494823f, -0.05219075f, 0.035075244f, 0.1617232f, -0.060976274f, 0.1749027f, 0.1526193f, -0.040842503f, 0.08890403f, -0.011428061f, -0.058289904f, -0.019042837f, -0.021887148f, -0.03716216f, -0.0017771637f, -0.03897083f, -0.048633438f, -0.04957285f, -0.027007932f, -0.04268626f, 0.0340374f, 0.08099041f, -0.08114599f, 0.063764125f, 0.081889324f, -0.120778345f, 0.12019826f, 0.001380004f, -0.094882995f, -0.007135923f, -0.0122512905f, -0.10785212f, -0.022819554f, 0.0035290013f, -0.035509225f, 0.018765762f, 0.0016628773f, -0.073619604f, -0.019555328f, -0.06311736f, 0.019624103f, -0.049590148f, -0.024535505f, -0.030308083f, -0.04980435f, -0.012389482f, -0.072191186f, -0.009453051f, -0.030120248f, -0.036210377f, 0.03713928f, 0.03501498f, -0.026665263f, 0.009803477f, 0.011207234f, 0.02239622f, 0.046940625f, -0.06583688f, -0.027575335f, -0.025566794f, -0.04718374f, -0.022654766f, -0.08627003f, -0.05913401f, -0.018461933f, -0.02302853f, 0.028055908f, 0.03327861f, 0.09337644f, 0.095223196f, 0.025336238f, 0.010041548f, 0.12641664f, 0.098160855f, 0.13814315f, 0.3158341f, -0.13518634f, 0.3935221f, 0.35168123f, -0.313993f, 0.18457678f, -0.2106849f, -0.1303756f, -0.02617982f, -0.057662208f, -0.061903875f, 0.0147926295f, -0.001417657f, -0.010317153f, 0.055847626f, -0.031324033f, -0.03026136f, 0.06619213f, -0.09097963f, -0.07835136f, -0.017532999f, -0.053156346f, -0.022700978f, -0.088348255f, -0.032722145f, -0.07756208f, -0.07203881f, -0.0059217946f, -0.059302635f, -0.02969479f, -0.07765823f, -0.060820654f, -0.07270349f, -0.073487595f, -0.011581575f, -0.05681515f, -0.004081702f, -0.035099193f, 0.045190938f, 0.12203471f, 0.050935768f, 0.18708114f, -0.037824765f, -0.117888525f, -0.0038648183f, -0.031012613f, -0.017360581f, 0.021691088f, 0.053681478f, 0.0047270353f, 0.09863914f, -0.027774306f, -0.0670003f, -0.0055641313f, -0.065704025f, -0.06931376f, -0.059371248f, -0.05817431f, -0.05379514f, -0.05120555f, -0.05893473f, -0.049114246f, 0.0019561697f, 0.06977933f, 0.004531597f, 0.11770598f, 0.14245103f, 0.086591735f, 0.21408756f, 0.046918f, -0.0821254f, -0.006626782f, -0.064343505f, -0.087228216f, -0.11817987f, -0.062038112f, -0.12040682f, 0.038870174f, -0.0517222f, -0.09656634f, -0.011945017f, -0.02548263f, -0.04909491f, -0.02343953f, -0.05825485f, -0.11683507f, -0.09742989f, -0.032909364f, -0.056715365f, -0.03424579f, -0.06934945f, -0.0740149f, 0.0026010422f, -0.11048176f, -0.0773665f, 0.036269367f, -0.08578479f, -0.068075925f, 0.061582763f, -0.07077827f, -0.03899702f, -0.04192339f, -0.009638312f, -0.0052259536f, 0.06504437f, -0.06288333f, -0.1064825f, 0.021941138f, -0.028099814f, -0.048797194f, 0.023550002f, -0.0886266f, -0.047753047f, -0.025439784f, -0.018213911f, -0.03423854f, -0.0071385987f, 0.025322806f, 0.05982162f, 0.07387447f, 0.053674042f, 0.058749832f, 0.02364644f, 0.06902191f, 0.028702617f, 0.03993657f, -0.05537636f, -0.057839796f, 0.00054042175f, -0.038251087f, -0.078320004f, -0.051295634f, -0.07812029f, -0.06841534f, -0.029505644f, -0.040048588f, -0.03977412f, 0.06254341f, -0.024664652f, 0.0046801195f, 0.0022724757f, 0.046710297f, 0.0013846228f, -0.017811615f, -0.048943456f, -0.032024674f, -0.07383382f, 0.07590087f, -0.117858894f, 0.14526425f, -0.06977623f, -0.12755066f, 0.0015090866f, -0.017834507f, -0.019205512f, -0.03223386f, -0.021451943f, -0.05985507f, -0.062640876f, -0.038825795f, -0.058107205f, -0.05169534f, 0.0537118f, 0.03446607f, 0.021188755f, 0.012755678f, -0.056189343f, -0.05131891f, 0.014083227f, -0.019543407f, -0.02819427f, -0.05620049f, -0.12113895f, -0.09659379f, -0.07228816f, -0.09039624f, -0.0754186f, -0.063912064f, -0.047289513f, -0.044459887f, -0.023534177f, 0.0031969554f, -0.0048569413f, -0.01983498f, -0.014143015f, 0.020474065f, -0.011061322f, -0.0018192919f, 0.0018152938f, 0.0007713295f, -0.03249884f, -0.039532907f, -0.012324465f, -0.033320367f, -0.071462646f, 0.035415158f, 0.035012662f, -0.026339227f, 0.0129687395f, 0.025302326f, 0.04937779f, 0.012644299f, 0.070955634f, 0.079493456f, 0.022248773f, 0.06835429f, 0.08724844f, -0.0064268173f, -0.019173326f, -0.0015811323f, -0.029057939f, -0.060206916f, -0.04314473f, -0.019028276f, -0.053273812f, -0.047530964f, -0.018872192f, -0.018759806f, -0.032723296f, -0.040151455f, -0.020304352f, -0.017512329f, -0.027532939f, 0.0052096345f, 0.008637604f, 0.047157593f, 0.010378136f, 0.018867286f, 0.012558432f, -0.05620928f, -0.06112157f, 0.047062833f, 0.0073020654f, -0.037385795f, 0.0054565906f, -0.0029075008f, -0.027383162f, 0.0015988754f, -0.01695304f, -0.026864698f, -0.009848268f, -0.013625228f, -0.015904078f, 0.02236602f, 0.042484917f, 0.012865269f, -0.017459424f, 0.03250595f, 0.06955578f, -0.0047257245f, 0.030761538f, 0.031614196f, -0.02303258f, -0.005164729f, 0.012235217f, -0.004632935f, 0.057545725f, 0.07120321f, -0.010148232f, 0.057828117f, 0.06456791f, -0.07509054f, -0.078138955f, -0.07067239f, -0.04231019f, -0.026123516f, -0.0015497945f, -0.05004437f, 0.0022744527f, -0.026719818f, 0.04615604f, -0.01503839f, 0.021232221f, 0.018428622f, -0.025301917f, -0.06274437f, 0.039044987f, -0.031908557f, -0.022275154f, 0.011606989f, -0.01651101f, 0.011302044f, -0.017947515f, -0.06778639f, -0.05802372f, -0.0076002222f, -0.014868092f, -0.032929547f, -0.037188306f, -0.035072457f, -0.04365028f, -0.039903548f, -0.051698215f, -0.072952986f, -0.03279872f, -0.051092267f, -0.048012234f, -0.047424074f, -0.05860808f, -0.051389076f, -0.0808276f, -0.12190105f, -0.08485694f, -0.0027886669f, -0.06677051f, -0.079945415f, -0.050958913f, 0.022454198f, 0.124532804f, -0.04526539f, -0.08716217f, -0.02236642f, 0.24938177f, 0.14178553f, 0.008417592f, -0.05666143f, -0.05871242f, -0.07756922f, -0.021216083f, -0.062176067f, -0.063481934f, -0.041189674f, -0.026708154f, -0.039581053f, -0.014825039f, 0.054523982f, 0.018907871f, -0.0060071507f, 0.0382126f, 0.04204657f, -0.02867721f, -0.03820921f, -0.040100776f, -0.046096444f, -0.08192342f, 0.019677f, 0.073477715f, 0.031248074f, -0.04205188f, 0.07612663f, 0.16223627f, 0.09466484f, 0.12562715f, 0.12410716f, 0.027010055f, 0.102206f, 0.19839591f, 0.12993506f, -0.043296654f, -0.0242775f, 0.06870859f, -0.04321859f, -0.012436382f, -0.016241604f, -0.061887816f, -0.0539074f, -0.03236688f, -0.03304699f, 0.0057737343f, -0.00817524f, -0.075932525f, -0.022129158f, -0.024464272f, -0.038714387f, -0.051005706f, -0.012441986f, -0.07027441f, -0.042624597f, -0.006963255f, -0.06467332f, -0.008616646f, 0.09284493f, 0.021807881f, -0.105744f, -0.076175794f, 0.23135315f, 0.2000648f, 0.042234067f, 0.01769212f, 0.04680096f, 0.018187849f, -0.049665168f, -0.020543283f, -0.067685746f, 0.07336252f, 0.018630821f, -0.10660223f, 0.110690355f, 0.157778f, 0.025762565f, 0.036814597f, 0.065294504f, 0.039661583f, -0.06807379f, -0.11385454f, -0.031119457f, 0.058951065f, 0.032083828f, -0.035014763f, 0.05264535f, 0.09516881f, 0.047477055f, -0.058608852f, -0.032567162f, 0.052659098f, -0.027251434f, -0.057665333f, -0.10154038f, -0.035762932f, -0.0502205f, -0.015293529f, -0.05340477f, -0.04371852f, 0.0017092018f, -0.096105196f, -0.0064352835f, 0.10393168f, -0.052829992f, -0.09510966f, -0.04217613f, 0.17971744f, 0.10541234f, -0.01331648f, -0.086524576f, -0.036593087f, 0.022677964f, -0.03910947f, -0.07648808f, -0.019456856f, 0.0613111f, -0.0015404345f, -0.024806727f, -0.029905869f, -0.07939314f, -0.0404675f, -0.045695066f, -0.054098524f, -0.039873555f, -0.03981298f, -0.03922279f, -0.036222972f, 0.03056626f, -0.0025673048f, 0.01808043f, 0.04463036f, 0.012045276f, 0.012429936f, 0.009197224f, -0.008914679f, 0.045192994f, 0.024020832f, 0.011258487f, 0.021825451f, 0.051066868f, -0.030821187f, -0.04626908f, 0.04002148f, -0.011716116f, -0.05165188f, 0.030023083f, -0.03626009f, -0.05175095f, -0.009900104f, -0.002113248f, 0.018123899f, 0.053103656f, 0.05988467f, 0.030110702f, 0.008569706f, -0.04063558f, -0.0022532637f, -0.002792018f, 0.027291957f, 0.01885089f, -0.059104655f, -0.064820655f, -0.011223214f, 0.077925645f, 0.08421734f, -0.10844681f, 0.009726319f, 0.19515754f, -0.11351379f, 0.03289861f, 0.17427583f, -0.062243953f, -0.117003664f, 0.016685817f, 0.082664475f, -0.14365914f, 0.0882101f, 0.10175789f, -0.09357928f, 0.046027068f, 0.17856334f, -0.0526417f, -0.078270264f, -0.013498279f, -0.0099994745f, -0.0039701634f, -9.5283e-05f, -0.05825151f, -0.07465106f, -0.048376635f, 0.0124691f, 0.027479634f, -0.020379083f, 0.034806672f, 0.023234978f, 0.07029584f, 0.060344774f, 0.0048070736f, 0.059192695f, 0.019191453f, -0.0071654273f, -0.021281421f, 0.047590572f, -0.0075001004f, -0.05878232f, 0.060316667f, -0.046876352f, -0.050191797f, 0.026200265f, -0.03088913f, -0.0031278771f, -0.003292739f, 0.01134904f, 0.016261734f, 0.04526495f, -0.0047179013f, 0.037760273f, -0.005056152f, 0.038194913f, 0.11922885f, -0.049047705f, 0.08118518f, 0.16073616f, -0.05844987f, 0.07746161f, 0.18305342f, -0.06944081f, 0.06950534f, 0.106079526f, -0.10575153f, 0.09074685f, 0.16710082f, -0.057237074f, 0.09307507f, 0.15784745f, 0.04091362f, 0.05480682f, 0.071631186f, -0.01318048f, 0.08302624f, 0.07992843f, 0.0016576084f, 0.051183715f, 0.15221922f, 0.037930693f, -0.033946276f, 0.019298384f, 0.029632552f, -0.05217097f, -0.046570797f, 0.055939645f, -0.021285534f, -0.028067684f, -0.004351737f, -0.046031114f, -0.056843776f, -0.020276405f, -0.09673886f, -0.029311014f, -0.06463654f, -0.04575831f, -0.06714546f, -0.006926247f, 0.06296685f, -0.02550667f, -0.013834648f, 0.06263099f, -0.05500149f, -0.0062368987f, 0.026019493f, -0.049076688f, -0.014951187f, -0.025565995f, -0.018700657f, 0.004162414f, 0.0011095292f, -0.021274822f, 0.024035664f, 0.018364936f, 0.020691944f, -0.020129489f, -0.030552858f, -0.030371506f, 0.003287016f, 0.01231259f, -0.003287165f, 0.021279182f, -0.00325092f, 0.005683369f, -0.020515956f, -0.046710685f, -0.037644323f, -0.042847846f, -0.011054181f, -0.009446173f, -0.009981419f, -0.012996057f, -0.02677905f, 0.011978866f, -0.005607669f, 0.017950168f, 0.038341f, 0.026833639f, 0.044972673f, 0.046315167f, 0.0021750215f, -0.0011881988f, 0.0018297061f, -0.02246514f, -0.015028316f, 0.035502266f, 0.037694767f, 0.01238024f, 0.009892485f, 0.0016713943f, -0.016378134f, -0.023557784f, -0.01718774f, -0.043214858f, -0.06735793f, -0.056163106f, -0.040966935f, -0.02393259f, -0.061403457f, -0.030263029f, -0.017186105f, -0.0046632704f, -0.02850054f, 0.034121778f, 0.028566731f, -0.0010298224f, 0.017686429f, 0.020754384f, 0.004010945f, 0.03860479f, -0.0103426995f, 0.018044675f, 0.017716777f, 0.011809417f, 0.0028927599f, 0.036322087f, 0.01559187f, 0.006944342f, -0.032824248f, -0.041560613f, 0.0032465458f, -0.0044604777f, 0.011132895f, -0.020866208f, 0.029303275f, -0.007533954f, 0.007979924f, 0.0032653506f, -0.008406028f, 0.0015198402f, -0.02560937f, -0.012400804f, 0.023956472f, 0.0048012044f, -0.011123032f, 0.009484343f, -0.046901874f, -0.051696494f, -0.053708963f, -0.053082615f, -0.071880825f, -0.039434616f, -0.026124466f, -0.044428125f, -0.052659873f, -0.051449653f, -0.04384728f, -0.016938588f, -0.06517131f, -0.056874994f, -0.03554308f, -0.03157528f, -0.025288003f, -0.026191367f, -0.05176593f, -0.061089743f, -0.020483468f, -0.052831095f, -0.044536408f, -0.025311055f, -0.047603156f, -0.029854557f, -0.04074045f, 0.0080309f, -0.023100602f, -0.020509126f, 0.008503109f, -0.009452087f, -0.020541823f, 0.03169574f, 0.01764954f, 0.009305987f, -0.06963832f, -0.017464904f, -0.057851672f, -0.02958102f, -0.033413578f, -0.03311073f, 0.0062624253f, 0.010890539f, -0.02173663f, 0.014044633f, -0.054203298f, -0.02005405f, 0.04519255f, 0.015997622f, 0.028509535f, 0.05123586f, 0.009012142f, -0.0029423058f, -0.05840385f, -0.01120132f, -0.0015802133f, -0.02718856f, 0.009863025f, 0.0419309f, -0.046808604f, 0.046250895f, 0.038278334f, -0.03802624f, -0.036096238f, -0.031004213f, -0.0055095875f, -0.05849809f, -0.032844126f, 0.03246036f, 0.038324587f, -0.015053449f, -0.02872662f, -0.02921427f, 0.0077498564f, -0.035635766f, -0.02294525f, -0.025247877f, -0.0012320838f, -0.040869676f, 0.005525898f, -0.18663275f, -0.18096715f, -0.12087612f, -0.13694145f, 0.11648409f, -0.06455649f, 0.02176718f, 0.24187504f, 0.20546818f, -0.080251105f, -0.13859975f, -0.05088751f, -0.0695156f, 0.0030695966f, -0.109448135f, 0.015130632f, 0.0534024f, 0.044457246f, -0.06907988f, -0.03647267f, -0.025362631f, -0.005908991f, 0.008299531f, -0.010628761f, -0.051799316f, -0.0015481522f, -0.006961306f, -0.07571305f, 0.017224623f, -0.061175745f, 0.056141622f, 0.18704574f, -0.006173563f, 0.11394659f, 0.26575375f, 0.23098356f, -0.014116598f, -0.06369241f, -0.04103791f, -0.03220181f, 0.010605358f, 0.03839897f, 0.014282024f, 0.028635023f, 0.076981485f, -0.054083697f, -0.055299234f, -0.030564353f, -0.010884446f, 0.012426099f, 0.033950593f, 0.030283108f, -0.0052479184f, 0.033323046f, -0.021666301f, -0.057029434f, -0.0060506053f, -0.11596377f, -0.030020677f, 0.03152946f, -0.046907358f, 0.03338001f, 0.092204385f, -0.09934921f, -0.030724127f, -0.020471742f, -0.1313284f, 0.007164484f, -0.0391749f, -0.11065286f, 0.0062043685f, -0.018015342f, -0.051493622f, -0.024327066f, 0.0105530275f, 0.027828947f, 0.015390317f, 0.06473947f, -0.0024513945f, -0.028821852f, -0.035382178f, -0.03851547f, -0.025333844f, -0.00557828f, 0.022362845f, 0.023557616f, -0.041503556f, 0.050983515f, -0.032459177f, 0.008398263f, -0.023122247f, -0.05254723f, 0.012681226f, -0.048530214f, 0.0044490937f, -0.006803173f, -0.028390324f, 0.015171055f, 0.04162343f, -0.06443762f, 0.023998313f, -0.036967073f, 0.07312733f, 0.07085126f, 0.022817831f, 0.030342134f, 0.11778298f, 0.11580512f, -0.026578818f, -0.20322369f, -0.023371821f, -0.21385098f, 0.006121552f, 0.086797416f, 0.033710208f, -0.069643706f, 0.42126474f, 0.013264021f, 0.013158445f, 0.010524707f, -0.008687047f, -0.0023584745f, 0.027510913f, -0.0065396097f, -0.008066233f, -0.0034750088f, 0.035420336f, 0.07003826f, 0.038084194f, 0.047817156f, 0.05699939f, 0.033067916f, 0.01038684f, 0.010173104f, 0.049650405f, 0.023537565f, 0.030876063f, 0.06651181f, 0.03699299f, 0.071486376f, 0.063530244f, 0.025125688f, 0.031988043f, 0.06869547f, 0.0039566983f, -0.02691076f, -0.018213937f, 0.005358452f, -0.0026827469f, -0.013796746f, 0.03004571f, 0.0013274575f, -0.016439568f, -0.009243709f, -0.023620652f, 0.01985801f, 0.0063869553f, 0.008550058f, -0.016681746f, 0.038641516f, 0.014712003f, -0.017185576f, 0.0064477334f, -0.024336142f, -0.012532564f, -0.02127517f, -0.04412281f, -0.031934828f, 0.0017333745f, -0.00409986f, -0.036140103f, -0.011808596f, -0.015575017f, -0.02568814f, -0.019954942f, -0.006584995f, -0.029180786f, -0.0023630608f, -0.009549076f, -0.022371154f, 0.028358331f, 0.02886954f, 0.018744355f, 0.04343304f, 0.03809524f, 0.05455f, 0.02798634f, 0.0143622765f, 0.024345022f, 0.022577181f, 0.051355638f, 0.032674834f, 0.049353834f, 0.058388185f, 0.04420783f, 0.014775554f, 0.012084809f, 0.030994812f, 0.011097137f, 0.026137495f, -0.021579375f, 0.037977193f, 0.037141f, 0.01581821f, 0.004227428f, 0.05978006f, 0.015231983f, 0.017664097f, -0.028678313f, -0.012047083f, 0.011046023f, -0.011383483f, -0.028009076f, 0.011230261f, -0.023371998f, -0.014879229f, 0.027765386f, -0.029473845f, -0.011040055f, -0.0070497436f, -0.028093727f, -0.020878403f, -0.0018430928f, -0.021045893f, -0.0023807979f, 0.030848376f, 0.020471923f, 0.031958275f, 0.055472843f, 0.024611888f, 0.04046029f, 0.04058992f, 0.025054052f, 0.039738294f, 0.041467737f, 0.064614944f, 0.038224757f, 0.05401695f, 0.038258445f, 0.04401892f, -0.0017623536f, 0.02702011f, 0.056950435f, 0.028368488f, 0.017722297f, -0.011583753f, 0.015110408f, 0.007248801f, 0.004954382f, 0.0029533843f, 0.0061957613f, 0.0015192163f, -0.028038872f, -0.038801815f, -0.021538982f, 0.0010023454f, -0.030072737f, -0.01334728f, -0.019752642f, -0.03536173f, -0.010363232f, -0.013302299f, -0.026960706f, -0.014206377f, -0.058478314f, -0.06889315f, -0.07876765f, -0.059350137f, -0.0946421f, -0.06447443f, 0.035647646f, 0.042449642f, 0.015849175f, -0.035659295f, -0.047268935f, -0.0046958523f, -0.011539023f, -0.01796313f, 0.0057013035f, -0.065117486f, -0.09616795f, -0.048459433f, -0.075424984f, -0.049969774f, -0.057754487f, -0.06849142f, -0.06953261f, -0.038464177f, -0.012080431f, -0.01922735f, -0.0032977057f, -0.02238252f, -0.011761285f, -0.008925758f, -0.015719574f, 0.002032684f, -0.01459135f, -0.037091892f, -0.012638545f, -0.022148529f, -0.023311976f, -0.034963064f, -0.031450823f, 0.022841189f, 0.022057934f, 0.014336414f, 0.021055397f, 0.032058362f, 0.026117114f, 0.010173643f, 0.045123454f, 0.027343657f, 0.0064760097f, 0.014910824f, -0.009058242f, 0.00083765725f, -0.01735682f, -0.015122494f, -0.022807706f, -0.017932266f, -0.025214694f, -0.018764976f, -0.01761208f, -0.018315008f, -0.02487935f, -0.018628746f, -0.021223169f, -0.04565786f, -0.021052377f, 0.0050957464f, -0.025210684f, -0.015636241f, -0.006243852f, 0.016197653f, 0.013977775f, 0.018349411f, -0.034098785f, -0.037543118f, -0.030956646f, 0.02726785f, -0.015595175f, 0.003474487f, 0.037277155f, 0.016391711f, -0.0037546798f, -0.002515907f, -0.03134781f, -0.005069974f, -0.043166418f, -0.0005863025f, -0.031235673f, -0.00016065054f, 0.005254292f, 0.007974386f, -0.010719291f, 0.007561226f, 0.020196762f, -0.0061765076f, 0.0033546567f, -0.0039514094f, -0.0019577758f, 0.025670614f, 0.012735358f, 0.002642736f, 0.0229734f, 0.029484747f, 0.0095469635f, 0.022714036f, 0.0015888182f, -0.07132269f, -0.037558965f, -0.021794299f, -0.074335f, -0.048818264f, -0.005612813f, -0.03077654f, -0.007731583f, -0.015148186f, 0.034223124f, 0.022829195f, 0.013090597f, -0.029688248f, -0.04911284f, -0.027072689f, -0.031572733f, 0.0031355359f, -0.001383719f, -0.03995026f, -0.043619655f, -0.025150204f, -0.049025662f, -0.042795617f, -0.05351653f, -0.039111312f, -0.019892752f, -0.03872632f, -0.024196846f, -0.010926264f, -0.024452968f, -0.027680172f, -0.020926924f, -0.034156445f, -0.039964363f, -0.046379413f, -0.04038993f, -0.009265838f, 0.008351841f, 0.034762077f, -0.0113657145f, 0.0035767013f, 0.011213236f, -0.012418044f, -0.00903215f, 0.012175044f, 0.033502262f, 0.025440605f, 0.004337651f, 0.018578727f, 0.03791039f, 0.006358748f, 0.023423852f, 0.0647571f, 0.056650322f, 0.04327986f, 0.04382225f, 0.012864755f, 0.021130513f, 0.03708064f, 0.060996212f, 0.035561826f, 0.028854359f, 0.046353266f, 0.0011278184f, 0.0022981735f, -0.0012790324f, 0.007628452f, 0.004097227f, -0.016799418f, 0.007066698f, -0.010982468f, 0.017406829f, -0.025668936f, 0.018893752f, 0.011992277f, -0.029126698f, 0.0065278113f, -0.0079814615f, 0.015434764f, 0.02869494f, 0.03638488f, 0.03242299f, -0.011720624f, 0.015828827f, 0.017271006f, 0.018877756f, 0.027879896f, 0.016386863f, 0.00031474995f, -0.0053969384f, 0.032178435f, 0.03777389f, 0.04616577f, 0.0033725176f, 0.06483021f, 0.049845196f, 0.027511958f, 0.060099f, 0.05330873f, -0.020925822f, 0.027926844f, -0.030076f, -0.0052864607f, 0.008229328f, -0.045195565f, 0.0139827f, -0.0019554503f, 0.001521749f, 0.05039962f, 0.045878313f, 0.038129974f, 0.033230748f, 0.060450405f, 0.04735802f, 0.04117305f, 0.077583276f, 0.068664625f, 0.020495983f, 0.020604383f, 0.008765774f, 0.024786372f, 0.01768134f, 0.004021698f, 0.04746211f, 0.05534464f, 0.045640767f, 0.02935887f, -0.015439983f, 0.0065554082f, 0.030247608f, 0.022472814f, 0.012781169f, 0.0034690332f, 0.03077281f, 0.04150717f, 0.021402268f, 0.009212227f, 0.0176987f, 0.030564168f, 0.008822783f, 0.03996702f, 0.042571962f, 0.020811258f, 0.00679044f, 0.012888188f, 0.03129117f, 0.024148472f, 0.032863066f, 0.020562764f, 0.032775443f, 0.031418934f, 0.030251717f, 0.02667308f, 0.011155983f, 0.027227178f, 0.020604014f, -0.002958033f, 0.040357698f, 0.012222732f, 0.023137966f, 0.0587226f, 0.026363535f, 0.040519703f, 0.048024587f, 0.009834336f, 0.0782261f, 0.05876976f, 0.06275695f, 0.072245106f, 0.04472842f, 0.052728713f, 0.010174431f, 0.027791353f, -0.017136972f, 0.019330027f, -0.0034299619f, 0.011840228f, 0.012198367f, 0.027014531f, 0.03806292f, -0.08744685f, -0.03290313f, -0.06985111f, -0.107997134f, -0.10337187f, -0.077202655f, -0.092535615f, -0.013020369f, -0.021967607f, 0.0027251425f, -0.062054608f, -0.04249326f, -0.055718705f, -0.05912315f, -0.103855975f, -0.10194244f, -0.06395339f, -0.06297735f, 0.015421556f, -0.009241015f, -0.086512074f, -0.038205493f, 0.017778378f, -0.05455585f, -0.08253485f, -0.025853075f, 0.010928281f, -0.23855911f, 0.16139744f, 0.0039608004f, -0.23473908f, -0.1168464f, -0.24458234f, 0.120817184f, 0.27195555f, 0.11193265f, -0.07527004f, 0.12095036f, -0.0542689f, -0.1962884f, -0.115403675f, -0.17087072f, -0.06702802f, 0.07706367f, 0.03391525f, -0.09040407f, -0.0621323f, -0.035171945f, -0.05993652f, -0.11614265f, -0.043318383f, -0.09553292f, -0.087749235f, -0.074503265f, -0.11015433f, 0.1889588f, 0.06398753f, -0.032776f, -0.020325337f, -0.0026678434f, 0.07828025f, 0.1105019f, 0.020500321f, -0.020257097f, 0.05876704f, -0.007564645f, -0.033415467f, 0.026786111f, 0.017499948f, -0.01119817f, 0.15163653f, 0.04748244f, -0.07292245f, -0.011801137f, -0.062283743f, -0.11685125f, -0.06184042f, -0.04166574f, -0.096849486f, -0.035967525f, -0.022981787f, -0.06447414f, 0.04979543f, -0.016090319f, -0.05683756f, 0.026032683f, 0.024494972f, -0.022425167f, 0.11239687f, -0.049656395f, -0.14451112f, -0.017464371f, -0.037877586f, -0.0791717f, -0.118898876f, -0.04139308f, -0.07560849f, 0.012357013f, -0.09596578f, -0.055052273f, -0.041051593f, -0.046863895f, -0.05338826f, -0.005109376f, -0.047552247f, -0.074122794f, -0.06229097f, -0.06335188f, -0.013407073f, 0.019226713f, -0.0570324f, -0.017220898f, 0.016112646f, -0.0376985f, -0.014344951f, -0.022457406f, -0.060119595f, -0.03729432f, -0.041544423f, -0.048867133f, -0.055975318f, -0.04662216f, -0.021985568f, -0.048404407f, -0.014972009f, -0.08971106f, -0.010221814f, 0.0016724027f, -0.010326414f, -0.029837435f, -0.029581098f, 0.043947715f, -0.03172154f, 0.08354545f, 0.028787924f, -0.1061067f, 0.19928227f, -0.10423375f, -0.08930179f, -0.009156313f, -0.02680609f, -0.032096002f, 0.2668109f, 0.3705113f, 0.01703147f, 0.015168584f, -0.084577516f, 0.017323002f, -0.04331818f, -0.110360846f, -0.084451124f, -0.07977984f, -0.04813047f, 0.1449568f, 0.18446809f, -0.007051432f, 0.15085849f, 0.132385f, -0.0344313f, -0.0076317037f, 0.00204235f, 0.021513302f, -0.0040324023f, -0.046302337f, -0.027869198f, -0.06358379f, -0.08026896f, -0.07706836f, -0.08193663f, -0.104922645f, -0.021958396f, -0.007351687f, -0.040751588f, -0.04948918f, -0.026532188f, -0.06569976f, -0.018382335f, -0.009772179f, -0.06451443f, -0.016947465f, 0.05905686f, 0.10612968f, 0.061145313f, -0.019771293f, 0.07264428f, 0.08150205f, 0.016329788f, 0.024123298f, 0.035886943f, -0.12397765f, -0.0033329404f, 0.123472266f, -0.13600077f, -0.07499498f, 0.11941169f, -0.05075294f, -0.04055186f, 0.066961534f, -0.005262989f, -0.02318517f, -0.041581407f, -0.030189594f, -0.05832161f, -0.080117896f, -0.056589216f, -0.104441546f, -0.033755597f, -0.005339281f, -0.04736868f, 0.004711903f, -0.051761355f, -0.072615184f, -0.046875052f, -0.06800366f, -0.062255133f, -0.05533911f, 0.17808245f, 0.19622168f, -0.03342663f, 0.13098161f, 0.10660091f, -0.036358513f, -0.0022073141f, 0.005844987f, 0.02183141f, 0.08066454f, 0.060394973f, -0.06365169f, 0.07831401f, 0.0884938f, -0.008786842f, -0.057757184f, 0.0011430306f, -0.013317605f, -0.09545505f, -0.056821886f, 0.062480498f, -0.08014114f, -0.08165519f, 0.05153873f, -0.01992173f, -0.029031556f, -0.001905942f, -0.09263228f, -0.02503431f, 0.12572135f, -0.10674108f, -0.09647776f, 0.12523884f, -0.034311477f, -0.054957394f, 0.07344644f, -0.01129866f, 0.015343442f, 0.07249488f, -0.06830164f, -0.046891917f, 0.0054591983f, -0.09188681f, -0.06780083f, 0.024130937f, 0.1531791f, 0.16682768f, 0.009463933f, 0.14710675f, 0.091915905f, -0.021879079f, 0.011898708f, -0.010613104f, 0.026869332f, 0.07669347f, 0.06076478f, -0.04389779f, 0.065345794f, 0.013657343f, -0.013935083f, -0.060238153f, -0.022669125f, -0.026976166f, -0.044537548f, -0.04206957f, -0.043683525f, -0.07674959f, -0.03294037f, -0.03414576f, -0.10109446f, -0.002935959f, 0.005584098f, -0.03822428f, -0.08086858f, -0.029749861f, -0.055859417f, -0.014377028f, -0.025028337f, -0.04933808f, -0.055686686f, -0.055114396f, 0.024540747f, 0.014856922f, 0.02283472f, 0.030890688f, -0.008387067f, -0.023978926f, 0.07628432f, 0.07709818f, 0.07073965f, -0.113782965f, -0.17373006f, -0.14132726f, -0.11378683f, -0.1594696f, -0.11465615f, -0.14290906f, -0.15488257f, -0.101291105f, -0.024955198f, -0.0025769698f, -0.001638414f, -0.025480973f, -0.00038943306f, 0.019207299f, -0.021072121f, -0.025672076f, -0.01317503f, 0.025548613f, -0.008530803f, -0.0019617183f, 0.043044962f, 0.006493358f, -0.0019330641f, 0.04933088f, 0.09228715f, 0.039726038f, 0.02191391f, 0.017809575f, 0.060565136f, 0.033622008f, 0.06342474f, 0.04336298f, 0.020111876f, 0.028659448f, 0.022711556f, -0.009382786f, -0.02197872f, 0.013758635f, -0.029307062f, -0.04552142f, -0.00838845f, -0.0079119f, 0.0016178677f, 0.0062243636f, -0.057465937f, -0.08467164f, -0.025631063f, -0.049155373f, -0.06855881f, -0.060188293f, -0.035382938f, -0.06882605f, -0.036648232f, -0.010455286f, 0.02036694f, 0.004485726f, 0.07432242f, 0.014423466f, 0.027275372f, 0.12262699f, 0.07917265f, 0.101053335f, -0.00799068f, -0.02045089f, -0.0008486952f, -0.046362817f, -0.016310573f, -0.009165378f, 0.044752944f, 0.006040661f, 0.022760032f, 0.016977487f, -0.00019082549f, -0.015099661f, -0.024773797f, 0.026873546f, -0.020695977f, -0.031488795f, -0.021588217f, -0.031116905f, -0.03478768f, -0.04105905f, -0.0005554514f, -0.058984254f, 0.0005998497f, 0.022652265f, -0.033017397f, -0.05230156f, -0.0004661384f, -0.08123672f, -0.10157547f, -0.057583284f, -0.087975495f, -0.047094595f, -0.07928409f, -0.03559703f, -0.055751283f, -0.061663657f, -0.025994513f, 0.0067268847f, 0.020498596f, 0.0061352225f, -0.047383524f, -0.03061016f, 0.03771457f, 0.04561525f, 0.062043402f, -0.023036072f, -0.04096887f, -0.038143523f, -0.03244427f, -0.05914745f, -0.048373718f, 0.014300384f, -0.033002965f, -0.0037063276f, -0.054360215f, -0.038585734f, -0.03570147f, -0.04707872f, -0.032622807f, -0.036980715f, -0.009967346f, -0.0389849f, -0.030139908f, 0.026872825f, -0.03363423f, 0.0055799875f, -0.021314425f, -0.005196596f, -0.02759404f, -0.0039948155f, -0.026916193f, -0.058660407f, -0.036441695f, -0.08498425f, 0.0017688539f, -0.0039049373f, -0.016139459f, -0.064742625f, -0.037242293f, -0.048053063f, -0.12874663f, -0.048939377f, 0.0014015104f, -0.019356437f, 0.00204645f, -0.010756456f, 0.023849372f, -0.041709058f, -0.059356987f, -0.08313989f, 0.03613251f, 0.017123139f, 0.05715709f, 0.106989734f, -0.12614293f, -0.12669376f, 0.021960225f, 0.08592853f, 0.06484452f, 0.027428724f, 0.025001202f, 0.08423098f, -0.005525685f, -0.07047068f, -0.07400043f, 0.005523466f, -0.0414679f, 0.00903168f, -0.054400537f, -0.062371675f, -0.058066487f, -0.061003674f, -0.05769996f, -0.054279298f, -0.10745663f, -0.1040004f, -0.05249666f, 0.10126862f, 0.11086642f, 0.13415962f, 0.11551581f, -0.057403892f, 0.02798743f, -0.017409425f, 0.10746334f, 0.27105197f, -0.03554238f, -0.032749895f, -0.030315034f, 0.007578674f, -0.09932317f, -0.053456236f, -0.023336489f, -0.028758338f, -0.08914177f, -0.03534896f, -0.0038485853f, -0.017604603f, -0.025157955f, -0.045293517f, -0.09641528f, -0.073895685f, -0.07061529f, -0.048515122f, -0.04651074f, -0.10517167f, -0.09527717f, -0.037588645f, -0.114027f, -0.103445135f, -0.08920102f, -0.063829616f, -0.12961227f, -0.031931408f, -0.014263685f, -0.020480417f, -0.06026414f, -0.064527325f, -0.05841756f, -0.080641f, -0.043452065f, -0.049092136f, -0.07130322f, -0.04426858f, -0.032084182f, -0.10751376f, -0.08544966f, -0.06012954f, -0.033821158f, -0.09969742f, -0.062833585f, -0.0050768736f, -0.055683006f, -0.025171183f, -0.014470455f, -0.028426014f, 0.004662791f, -0.07800255f, -0.035908338f, -0.060107753f, 0.0061515267f, 0.0020559481f, -0.022110771f, -0.05278335f, -0.0046274667f, -0.022792807f, -0.083038f, -0.0723572f, -0.09098192f, -0.025469592f, -0.0065591554f, -0.013658967f, -0.010231958f, -0.07357015f, 0.008927139f, -0.09303085f, -0.07533625f, -0.027860114f, 0.0082545495f, 0.006079529f, 0.014529486f, 0.22700627f, 0.0038553914f, 0.079304315f, 0.07292456f, -0.017791886f, 0.008688102f, 0.0050082495f, 0.020577341f, -0.035618372f, 0.0059689013f, -0.008655796f, -0.013416205f, -0.0019995274f, 0.0096812835f, 0.01210212f, 0.09244709f, 0.11672657f, -0.0049900343f, 0.10071558f, 0.11335959f, 0.0152831655f, 0.005500986f, 0.10226177f, 0.0589324f, 0.025960114f, 0.05490616f, 0.031122347f, 0.037239555f, 0.049353283f, 0.063971326f, 0.043107476f, 0.050902173f, 0.06717807f, 0.0033410804f, -0.022920534f, -0.0294533f, 0.0346424f, 0.0007202677f, -0.023995299f, 0.022754895f, -0.02122598f, -0.019500569f, 0.03112497f, 0.14232332f, 0.122947425f, 0.01262416f, 0.062462762f, 0.07902206f, 0.030480979f, 0.024805361f, 0.058150984f, -0.010123863f, -0.026905661f, 0.087666705f, 0.009954388f, -0.01704452f, 0.059501924f, 0.06599389f, -0.018275466f, -0.01332859f, -0.0018285839f, -0.044424273f, -0.06696577f, -0.02620628f, -0.021080183f, -0.04598718f, -0.00897781f, -0.031321272f, -0.026953861f, -0.0017519585f, 0.017774714f, 0.020193864f, 0.006311295f, 0.012519083f, 0.012769834f, 0.005287637f, -0.00036001738f, 0.024093922f, 0.09051896f, 0.1545773f, 0.01753514f, 0.07086159f, 0.14911945f, 0.05192157f, -0.031497166f, 0.060085457f, 0.04724837f, 0.00072099577f, 0.034686424f, 0.021375641f, 0.066784084f, 0.08273601f, 0.053971145f, 0.047700137f, 0.11825678f, 0.055638447f, -0.0032265554f, -0.055657078f, 0.06403195f, 0.026373511f, -0.0037126853f, 0.034012318f, 0.053986736f, 0.018127048f, 0.0013047585f, -0.026356805f, -0.026838254f, 0.056876913f, 0.013592557f, -0.024439193f, -0.007190173f, 0.026953053f, -0.026917098f, -0.014454234f, -0.02355051f, 0.013790462f, 0.08308052f, -0.012853185f, -0.013345854f, 0.014378409f, 0.011831402f, -0.005780217f, 0.0041309763f, 0.116596304f, 0.11299485f, -0.010972169f, 0.079031006f, 0.1400517f, 0.04544853f, 0.0069575515f, 0.092425734f, 0.07187751f, 0.031601977f, 0.013966258f, -0.04407524f, 0.029268043f, 0.010787117f, -0.038501654f, -0.040111706f, -0.0072099087f, -0.0014331414f, -0.034045734f, -0.0069202334f, -0.01096872f, -0.016320879f, -0.016189327f, 0.0021328505f, -0.0310633f, -0.04178272f, -0.01387202f, -0.08995027f, -0.07186957f, -0.03623642f, 0.017054174f, 0.045022447f, -0.035524048f, -0.09082974f, -0.049232487f, -0.073971696f, -0.05333241f, -0.080685735f, 0.06529154f, 0.024219058f, 0.08365079f, 0.14385639f, -0.056282654f, 0.113645025f, 0.1257628f, -0.097243f, -0.045176256f, -0.05363579f, -0.06606136f, -0.09756023f, -0.078116745f, -0.111574076f, -0.14296977f, -0.08087612f, 0.024854762f, 0.046392053f, 0.056218497f, 0.005737625f, 0.02092694f, -0.01369102f, 0.018062627f, 0.041427746f, -0.04382733f, -0.0058604456f, 0.02624229f, 0.016903523f, -0.01155833f, 0.044553038f, 0.04325931f, 0.012547539f, 0.021371901f, 0.074216306f, 0.13655731f, 0.13336825f, -0.0036333057f, 0.11782326f, -0.093881674f, -0.10132007f, 0.0337491f, -0.11521777f, -0.1170502f, -0.091699384f, -0.048792996f, -0.026899029f, -0.092472106f, -0.020886766f, -0.0045082867f, -0.05791916f, -0.008674264f, -0.038781866f, -0.06211765f, -0.098634385f, -0.041664034f, -0.026408585f, -0.09422576f, -0.07497757f, -0.04531877f, -0.08879781f, -0.15477434f, -0.1304044f, -0.057746127f, 0.07604787f, 0.013531822f, 0.11889577f, 0.12815914f, -0.03701881f, 0.08585561f, 0.073822096f, -0.046855908f, -0.06641138f, 0.043642946f, -0.025311692f, 0.02738508f, 0.06694249f, -0.022565845f, 0.0584642f, 0.035207234f, 0.0698211f, 0.025318928f, -0.039885752f, 0.035876196f, -0.06798812f, -0.13803618f, 0.05874098f, -0.10600316f, -0.08512012f, 0.058727413f, 0.043392915f, -0.06080625f, 0.029169157f, -0.088446066f, -0.11185186f, -0.02021406f, -0.16281953f, -0.13290122f, -0.0082070045f, -0.017695906f, -0.037732165f, -0.009753054f, -0.073360525f, -0.008195686f, -0.036286198f, -0.07367019f, -0.04359175f, -0.1106229f, -0.0803806f, 0.060253065f, -0.027399799f, 0.081719406f, 0.12618715f, -0.03750724f, 0.097621985f, 0.09492291f, -0.10447768f, -0.07830216f, -0.0037304107f, 0.003376436f, 0.021298777f, 0.057929754f, -0.05477704f, 0.019308964f, 0.022381563f, -0.060716264f, -0.09783318f, -0.06708782f, -0.05851881f, -0.077658035f, -0.059447795f, -0.04841888f, -0.0628037f, -0.03463161f, 0.08411867f, 0.07893114f, 0.0684314f, 0.081461295f, 0.082283854f, 0.10915562f, 0.08650812f, 0.06523089f, 0.10947133f, 0.03344678f, 0.043014415f, 0.027598694f, -0.00015032983f, 0.01449096f, 0.024371281f, -0.003175967f, -0.003680004f, 0.004168074f, 0.010135354f, -0.018394364f, 0.008866052f, -0.012073265f, -0.013808126f, -0.03192537f, -0.04900372f, -0.04903997f, -0.09256276f, -0.0027842328f, 0.006073874f, 0.04321254f, 0.024608748f, 0.040490326f, 0.0012980542f, 0.017104998f, 0.02379537f, -0.0032398861f, 0.0075511937f, -0.021180926f, 0.020028353f, 0.04664353f, 0.018747885f, 0.002516178f, -0.021980034f, -0.018082147f, 0.001569654f, -0.0075567127f, 0.036145598f, -0.015259942f, 0.013395118f, 0.014162581f, -0.0053919223f, 0.029308561f, 0.014426773f, -0.029421335f, 0.047961146f, 0.024291262f, 0.00501193f, -0.0016597551f, 0.066400535f, 0.020340573f, 0.056552425f, 0.029164366f, 0.069665216f, 0.014652581f, 0.0042601177f, 0.036386874f, 0.020283666f, -0.0067111845f, 0.028460922f, 0.005756898f, 0.0228453f, 0.0005051519f, 0.068059765f, 0.055170476f, 0.047211807f, 0.0109409f, -0.023973942f, 0.015075965f, -0.055851743f, -0.0016589132f, 0.0025137472f, -0.021466319f, 0.025846016f, -0.014916096f, 0.009491347f, 0.043084983f, 0.06738844f, -0.02920736f, 0.040672902f, 0.015849933f, 0.0073525873f, 0.034189824f, 0.0028130757f, 0.01698235f, 0.061101172f, 0.05600768f, 0.0086541725f, -0.00614215f, 0.005035352f, -0.015131291f, 0.0075588287f, -0.0072387634f, -0.023567414f, -0.014037643f, -0.019675042f, 0.0031154184f, 0.017249294f, -0.053661272f, -0.06037785f, -0.058198202f, -0.03712154f, -0.055984795f, -0.078582175f, -0.068909325f, -0.0694313f, -0.053755626f, -0.059835415f, 0.04153879f, 0.019129217f, 0.020196153f, 0.010417069f, 0.01780192f, 0.009213106f, -0.017717717f, -0.011992599f, -0.00791608f, 0.0563806f, 0.09466002f, 0.023451472f, 0.036138434f, 0.05978176f, 0.109305106f, 0.034684055f, 0.037705284f, 0.018989768f, -0.045981508f, -0.032752283f, 0.044566177f, 0.0059835454f, -0.032692872f, 0.016179984f, -0.0024962812f, -0.041569643f, 0.03878836f, 0.036330953f, 0.035141475f, 0.023334645f, 0.026201544f, 0.059055444f, 0.03009788f, 0.027618516f, 0.07153671f, 0.06957469f, 0.075212896f, 0.010447275f, -0.072536565f, 0.032148805f, 0.037832137f, -0.038385477f, 0.049453367f, 0.05984183f, 0.0418622f, -0.033206526f, -0.028368626f, -0.03282033f, -0.022997554f, -0.038809545f, -0.019403933f, -0.011191557f, 0.011767197f, -0.034680855f, -0.009201859f, 0.05995387f, 0.08337306f, -0.023641478f, 0.001388564f, -0.06588298f, 0.04247195f, -0.023669286f, 0.02998335f, 0.028161243f, 0.06378325f, 0.06862726f, 0.0019739016f, -0.0013578748f, 0.023892779f, -0.005573345f, 0.053109445f, 0.06955553f, -0.081363335f, -0.0029061593f, 0.11416496f, -0.07303788f, -0.0072268923f, 0.08614167f, -0.0687227f, -0.06777737f, 0.007688207f, 0.11603499f, 0.08639686f, 0.10470189f, 0.004201953f, 0.0377138f, 0.03260827f, 0.07707067f, 0.037912305f, 0.068055704f, 0.00040287175f, 0.021146894f, -0.016102012f, 0.022044167f, -0.018869314f, -0.032135222f, 0.021631762f, -0.0074809426f, -0.016591664f, 0.0703503f, 0.0017938791f, -0.05305037f, 0.015238494f, -0.003964752f, 0.0019086652f, 0.007327405f, 0.03789757f, 0.040529888f, -0.020305438f, 0.002656379f, -0.001804573f, 0.0047808955f, 0.013547524f, -0.033370458f, 0.03163412f, 0.029428683f, -0.029153584f, -0.0042831996f, 0.01460798f, 0.02380818f, -0.020576145f, -0.07284722f, 0.06712687f, -0.0011183434f, -0.057168595f, 0.049801275f, -0.084280394f, -0.019980758f, 0.06446597f, -0.08823133f, -0.050272133f, 0.048896864f, -0.05520829f, -0.093579374f, -7.574513e-05f, 0.0041903993f, -0.03227946f, 0.045599908f, -0.0005766875f, -0.017837858f, 0.03452244f, -0.030607471f, -0.0484089f, -0.011834489f, 0.0374868f, 0.009482968f, -0.05729042f, 0.027369704f, 0.03493217f, 0.014152799f, 0.06223391f, 0.036907166f, 0.005915494f, 0.03742923f, 0.026297964f, 0.008753938f, 0.08440584f, 0.05678099f, 0.013129128f, 0.0765657f, 0.042928234f, 0.052278657f, 0.017115025f, 0.01969414f, 0.012092544f, -0.017025772f, -0.001872097f, 0.005033075f, -0.02001671f, 0.010071875f, 0.0003915348f, -0.046043295f, 0.01324126f, 0.014889673f, 0.019131731f, 0.015856326f, 0.013743081f, -0.02486524f, 0.019598821f, 0.04399673f, 0.01777915f, 0.0014782128f, 0.034130096f, 0.032107633f, -0.019931326f, 0.029221496f, 0.007123004f, 0.0032191637f, 0.0030249245f, -0.044868924f, -0.023232065f, -0.025968384f, 0.010045674f, -0.016600689f, -0.020682938f, 0.010099275f, 0.01651016f, -0.011850858f, -0.060770653f, -0.11145976f, 0.003163539f, -0.0078024287f, 0.05293224f, 0.08415644f, 0.025247231f, 0.023228062f, 0.087954685f, -0.042228412f, -0.085183784f, -0.012886587f, -0.05228497f, -0.017057106f, 0.0092057735f, 0.012424538f, -0.05587935f, -0.0071039703f, -0.06604022f, -0.06450242f, -0.05374949f, -0.045863014f, -0.03228653f, -0.04502368f, -0.0043005864f, 0.00806537f, -0.0032533905f, -0.022095662f, -0.073854856f, 0.03458847f, -0.0007061297f, 0.078257136f, 0.12548909f, 0.021412736f, 0.05825706f, 0.048064493f, -0.014857f, -0.05820459f, -0.018415654f, 0.049860287f, -0.021998601f, 0.017297562f, 0.03733871f, 0.012136511f, 0.045071103f, 0.014279455f, -0.041530326f, 0.021228535f, 0.016504265f, 0.021351099f, 0.03241404f, 0.034714736f, -0.005269494f, 0.055284042f, -0.034716282f, -0.061744466f, -0.0060866643f, 0.008835051f, 9.8294935e-05f, 0.031278625f, -0.011888549f, 0.025942981f, 0.07236659f, -0.06958963f, -0.0541723f, -0.019600583f, -0.051735815f, 0.024954392f, -0.025121745f, -0.00068122323f, 0.033998918f, 0.020362258f, -0.061606117f, -0.059150513f, -0.042279135f, -0.020731578f, -0.040669527f, -0.047736328f, 0.02530331f, -0.018951485f, -0.055180978f, 0.012154295f, -0.03221739f, 0.010793857f, 0.0069858874f, 0.02275102f, -0.035924967f, 0.021874687f, 0.031516388f, 0.0067541427f, 0.018166712f, -0.0077575524f, 0.007558043f, -0.003535835f, -0.012546506f, -0.008382534f, 0.03714237f, 0.03392287f, 0.05949783f, 0.012667697f, -0.0064913905f, 0.055898648f, 0.007266989f, 0.06625533f, 0.007267195f, 0.047478914f, 0.060376126f, 0.025563892f, -0.059238296f, -0.06643827f, 0.067654744f, -0.025079105f, -0.052231025f, 0.045163676f, 0.08294106f, -0.0886038f, 0.21232907f, 0.03447037f, 0.0069786957f, 0.01055769f, 0.018716484f, 0.030003294f, 0.034631077f, 0.03347614f, 0.05703974f, 0.04874907f, -0.008441354f, -0.007478474f, -0.044350687f, -0.038751394f, -0.048527125f, -0.052527808f, -0.0427516f, -0.050050702f, -0.04225709f, 0.012502462f, -0.013128064f, 0.008907661f, 0.01427721f, 0.02878423f, -0.012971943f, 0.023949767f, 0.01946632f, 0.03641043f, 0.02231045f, 0.08181246f, 0.024899386f, 0.03535711f, 0.056747183f, -0.013250703f, 0.034064442f, 0.005121707f, -0.046585992f, 0.033144653f, 0.06405171f, 0.028359799f, 0.06752103f, 0.07957919f, -0.01331505f, 0.05723489f, 0.055162176f, 0.010048017f, -0.06681819f, -0.029232604f, 0.0011128866f, -0.024675103f, 0.0043499433f, -0.0026943395f, -0.015763469f, -0.02372949f, 0.009463773f, 0.016514422f, 0.05456241f, 0.043939505f, 0.07661709f, 0.03876781f, 0.06183167f, 0.076172315f, 0.037746616f, 0.026617885f, 0.04053505f, 0.06676118f, -0.016353432f, 0.05877036f, 0.011137042f, -0.017464658f, 0.04082371f, 0.031087203f, 0.030702822f, 0.004905345f, -0.050350524f, -0.022649258f, -0.03818084f, -0.032736648f, -0.064454116f, -0.043010358f, -0.05074921f, -0.060989138f, -0.038660903f, 0.016662445f, -0.028901592f, 0.008160121f, -0.026083412f, -0.0504604f, 0.032440145f, 0.05307018f, -0.024884839f, -0.0890583f, 0.029128918f, -0.02044576f, -0.049543552f, 0.030319573f, -0.0095651485f, -0.026818015f, 0.0019153496f, 0.0013130886f, -0.012216791f, 4.4506373e-06f, 0.008401575f, -0.042663105f, 0.016081586f, 0.027744481f, -0.03573466f, -0.022077555f, 0.0015283015f, -0.0054991106f, -0.009748982f, -0.005717088f, -0.04232121f, 0.009096679f, -0.05795694f, 0.00026179978f, 0.008435277f, -0.02307219f, -0.021791853f, -0.0252644f, -0.038821556f, -0.060728386f, -0.043062165f, -0.04950688f, -0.043811668f, -0.05105221f, -0.061575357f, 0.0239321f, -0.010482202f, 0.0063794963f, 0.01877354f, -0.010373136f, -0.00039950162f, 0.032347616f, -0.0054584127f, -0.011988914f, 0.076728955f, 0.11688884f, -0.00021963095f, 0.1363811f, 0.14115071f, -0.04653454f, 0.0009977922f, 0.023017513f, -0.017838486f, 0.026556099f, 0.011108896f, 0.027327837f, -0.062581174f, -0.038441047f, -0.054263078f, -0.100868955f, -0.15532687f, -0.15000153f, 0.12866642f, 0.14509055f, 0.14359044f, 0.059343193f, 0.048598845f, 0.06389045f, -0.08609514f, -0.0719649f, -0.09371462f, 0.035298496f, 0.017644538f, 0.07105711f, -0.14955692f, -0.15585512f, -0.10465012f, -0.20182674f, -0.22494975f, -0.18275645f, 0.083073795f, 0.08866139f, 0.00264324f, -0.020741869f, -0.058209617f, -0.08236127f, -0.04119528f, -0.11382986f, -0.09168366f, 0.014819937f, 0.041930784f, 0.02010875f, -0.038125154f, -0.009471149f, -0.0132855335f, -0.021711465f, 0.015262671f, -0.044235133f, -0.01347153f, -0.07293989f, -0.0027254885f, -0.02349602f, -0.08138214f, -0.0075015137f, -0.015669204f, -0.0009103615f, 0.07143092f, 0.06886851f, 0.07080019f, 0.10411498f, -0.039810937f, -0.08225613f, -0.0137550775f, -0.039180756f, -0.13924764f, -0.116327435f, 0.06316818f, 0.08472606f, 0.06296301f, -0.02343777f, -0.023361748f, -0.04143534f, -0.06605565f, -0.16093439f, -0.12391475f, 0.08138672f, 0.17193456f, 0.14913349f, 0.03755845f, 0.02058868f, 0.004689663f, -0.08042409f, -0.071915284f, -0.113808386f, 0.044122566f, 0.100487076f, 0.092409424f, 0.031993758f, 0.042137932f, 0.023476401f, -0.04641357f, -0.07372723f, -0.10311917f, 0.025446555f, -0.1036365f, -0.09157401f, -0.0036332887f, -0.08523582f, -0.047452107f, 0.011649614f, -0.037244454f, 0.01658956f, -0.011996706f, -0.06176476f, -0.061231293f, -0.063514434f, -0.13672945f, -0.012832407f, -0.05981572f, -0.082125254f, 0.00263638f, 0.039739657f, 0.0626262f, 0.10165479f, -0.024664663f, -0.10286068f, -0.04567615f, -0.12135337f, -0.12469627f, -0.04965502f, 0.095226385f, 0.12777673f, 0.15979093f, 0.029976668f, 0.03554907f, 0.044704262f, -0.054619487f, -0.058927365f, -0.09738038f, 0.022807965f, 0.037166983f, 0.073730014f, -0.024428435f, -0.06392375f, -0.052748468f, -0.10554256f, -0.17115556f, -0.13444273f, 0.07521017f, 0.07538551f, -0.0025007701f, -0.000115967036f, 0.029949883f, -0.009155495f, -0.0061323233f, 0.04404907f, -0.03219186f, -0.042493667f, 0.0012675009f, -0.019735359f, -0.049482856f, -0.07576123f, -0.08554373f, -0.0069313445f, 0.009073038f, 0.024156395f, -0.014567518f, -0.057015557f, -0.062813796f, -0.0077635827f, -0.011344669f, -0.04436705f, -0.061377507f, -0.07032401f, -0.079565875f, -0.060107935f, -0.0879673f, -0.05964742f, 0.03586143f, -0.04205906f, -0.02506311f, -0.03067352f, -0.07847884f, -0.1259801f, -0.004568586f, -0.092903115f, 0.09788542f, -0.37638932f, -0.27007854f, -0.22180006f, 0.13010587f, 0.21455292f, 0.4078063f, 0.012934595f, -0.05562914f, 0.06710392f, -0.15964414f, -0.18883583f, -0.10527331f, 0.12412712f, 0.06381566f, 0.27017352f, -0.08496488f, 0.0009434262f, 0.008235074f, -0.022539765f, 0.039330103f, 0.0512536f, 0.006067596f, -0.041767757f, 0.0094637f, 0.074458055f, 0.03284145f, 0.2179261f, -0.18163976f, -0.06417766f, 0.007958172f, 0.14138839f, 0.06959807f, 0.47795248f, 0.0071582193f, -0.0085550975f, -0.095505826f, 0.048269346f, 0.050108775f, -0.060406346f, 0.09898245f, 0.04877983f, -0.02305241f, -0.014865384f, -0.026708463f, -0.092251636f, 0.0056516193f, -0.06736646f, -0.051130086f, 0.009916673f, -0.017720843f, -0.054958127f, -0.041299902f, -0.077909164f, -0.091232695f, -0.034064654f, -0.050711825f, -0.06343463f, 0.032846216f, -0.05996344f, -0.027716022f, -0.018988844f, -0.04477548f, 0.08088549f, 0.03667879f, -0.03701075f, 0.08578355f, -0.0040182984f, 0.027806938f, 0.022852356f, -0.04555148f, 0.002740207f, -0.0057409005f, 0.051296752f, -0.01640503f, -0.012084381f, -0.0011002711f, 0.01584053f, 0.012035637f, 0.021260295f, -0.043444853f, 0.047382373f, 0.052609563f, -0.0033981544f, 0.0516047f, 0.033680696f, -0.024738682f, -0.030173244f, -0.043956034f, -0.008717445f, -0.05222331f, -0.020619385f, 0.022398897f, -0.09951203f, -0.029651405f, -0.029652337f, -0.07968941f, -0.039823417f, -0.015339715f, 0.06793843f, -0.021782493f, 0.07175022f, 0.114657104f, 0.060154643f, 0.043891888f, 0.1609537f, -0.06784401f, -0.16286957f, -0.1326118f, -0.06392557f, -0.11477526f, -0.2937133f, 0.40904295f, 0.013077133f, 0.07838013f, 0.060446676f, 0.04541535f, 0.06254514f, 0.03231132f, 0.0778063f, 0.08019706f, 0.08290098f, 0.09020758f, 0.08087913f, -0.0042130575f, -0.0033950086f, 0.017998423f, -0.008723462f, -0.013242131f, 0.018326811f, 0.0496777f, 0.016519448f, 0.037216794f, 0.0035678577f, 0.004856674f, 0.009522521f, 0.017668298f, 0.036567695f, -0.0117301345f, 0.06071401f, 0.058828205f, 0.049053315f, 0.06844349f, 0.0422957f, 0.040304538f, 0.045244575f, 0.0013119001f, -0.023208607f, -0.010915434f, -0.01466801f, 0.09471632f, 0.088559225f, -0.0013754631f, -0.027555287f, 0.10069812f, 0.048134945f, -0.0049036723f, 0.15262322f, 0.070601925f, 0.04873887f, 0.022683429f, 0.05513855f, 0.0029996834f, 0.034270864f, 0.048974786f, 0.066740155f, 0.026886307f, 0.049533524f, 0.07722614f, 0.10911483f, 0.10932454f, 0.0541533f, 0.080740586f, 0.058577213f, 0.027555812f, 0.07631593f, 0.054625098f, 0.094063215f, -0.033158205f, 0.023329124f, -0.06853043f, -0.0008423399f, 0.034644462f, 0.036475334f, 0.026705863f, -0.0058532376f, 0.0047350507f, 0.0015072522f, -0.017206822f, 0.03110859f, 0.023246258f, 0.010767255f, 0.030026833f, 0.07139888f, 0.039356317f, 0.07926461f, 0.046248622f, 0.08663312f, 0.025619423f, 0.06741084f, 0.03679062f, 0.028458303f, 0.05212999f, 0.056716733f, 0.08566273f, 0.046145137f, 0.06851183f, 0.013504396f, 0.116066895f, 0.06530596f, 0.060939513f, 0.08743752f, 0.045314647f, 0.10124138f, 0.035565786f, 0.01203193f, -0.010085313f, 0.084372625f, 0.030105367f, 0.064014964f, 0.023103377f, 0.07086011f, 0.03746499f, -0.0044754837f, 0.006998218f, -0.025239985f, 0.03784377f, 0.008258479f, -0.03478929f, 0.012181622f, 0.02791604f, -0.018044798f, 0.0064416407f, 0.01743552f, -0.0011615546f, 0.03697803f, -0.0024724805f, -0.0057997014f, 0.024852475f, 0.031228375f, 0.07821151f, 0.06546681f, 0.053504393f, 0.025250115f, 0.039253008f, 0.070000164f, 0.08314209f, 0.120354205f, 0.030793844f, 0.088134766f, -0.0043040398f, 0.003308641f, -0.036413256f, 0.014174829f, -0.040784582f, -0.053661767f, 0.02529691f, 0.009535452f, -0.048085567f, -0.019237528f, -0.025007937f, -0.014290477f, -0.010659611f, -0.014207254f, -0.010128724f, -0.072221965f, -0.046580777f, -0.021528175f, -0.071173094f, -0.057579853f, -0.036798634f, -0.032954488f, -0.013394831f, -0.020958684f, -0.022973184f, -0.056733612f, -0.012293252f, -0.017687958f, -0.06358794f, -0.021162733f, -0.054843824f, 0.0009718489f, -0.06202637f, -0.11436623f, -0.114541724f, -0.10135701f, -0.043566566f, 0.082300685f, 0.10421029f, 0.066161364f, 0.08782173f, 0.046713617f, 0.014427237f, 0.06679642f, 0.03905166f, -0.025821378f, 0.020363793f, 0.058032434f, 0.014678755f, 0.016950682f, 0.008944815f, -0.06513314f, -0.013619749f, 0.021867037f, -0.04093466f, -0.041281924f, -0.053637818f, -0.06676408f, -0.07099681f, -0.052529383f, -0.073964655f, -0.07220074f, -0.032761957f, -0.0187487f, 0.0409317f, 0.103513405f, 0.10027495f, 0.049127683f, 0.1291983f, 0.03785814f, 0.061564058f, 0.014994548f, -0.0498798f, -0.03696903f, 0.024995882f, 0.0044545475f, 0.04681773f, 0.025419623f, -0.040591847f, -0.0017739055f, 0.011977826f, -0.07334135f, -0.020192515f, -0.031836674f, 0.00017900133f, 0.0049632895f, 0.0031338246f, -0.05462367f, -0.063613884f, -0.02663047f, 0.006497116f, -0.0151845515f, -0.0057856645f, 0.07547658f, 0.03302598f, -0.009911133f, -0.0113238115f, 0.0005443337f, -0.041041616f, -0.021467436f, -0.054726645f, -0.04266218f, -0.057505406f, -0.06560308f, -0.06696529f, -0.047559626f, -0.059596293f, -0.046569183f, 0.017118994f, -0.020526314f, -0.019661376f, -0.034112256f, -0.032873463f, -0.013865893f, -0.042941645f, -0.061765637f, -0.030822188f, -0.0122684315f, -0.01999984f, -0.0241577f, -0.035588562f, -0.035357893f, -0.012998595f, -0.05109182f, -0.022363467f, -0.06446323f, -0.054769795f, -0.03813249f, 0.0003529642f, -0.013713835f, 0.02025561f, 0.007844577f, -0.08209433f, -0.019687977f, -0.02685314f, -0.019351104f, -0.010572628f, -0.06619601f, 0.0023977426f, -0.029578004f, 0.025670188f, -0.054423116f, -0.039897617f, -0.10144383f, -0.009774956f, 0.0008246205f, 0.12880772f, 0.08992288f, 0.11826939f, 0.04243593f, -0.09069028f, 0.00039224862f, 0.08900015f, -0.08218833f, -0.121496044f, -0.100326195f, 0.063899584f, -0.015516575f, 0.039386384f, 0.023232242f, -0.010776543f, -0.00819164f, -0.10433392f, -0.21921057f, -0.14315607f, 0.04515794f, 0.018664762f, 0.046440165f, 0.2196884f, 0.2532219f, 0.17766024f, 0.019189326f, -0.066706575f, -0.09596621f, 0.08010904f, -0.007716093f, -0.08590861f, 0.10852185f, -0.039205413f, -0.087091796f, 0.031650297f, 0.049283087f, 0.0594924f, -0.0049329675f, 0.029353112f, -0.014659451f, 0.018491587f, 0.04957888f, 0.0015876802f, 0.0096336715f, -0.08270872f, -0.031440426f, 0.13093707f, 0.12008422f, 0.0605436f, 0.025336396f, 0.14173166f, 0.09891933f, 0.16162132f, 0.1521732f, 0.12659557f, 0.009080911f, -0.027013922f, -0.045456346f, -0.0732478f, -0.1860242f, -0.09225819f, -0.0987194f, -0.16363035f, -0.112438485f, -0.023419615f, -0.039553627f, -0.032456614f, 0.0068500643f, 0.031094033f, 0.014966518f, -0.13754368f, -0.22741088f, -0.19336097f, -0.091308504f, -0.120692596f, -0.10300668f, -0.059848253f, -0.11222464f, -0.13242319f, -0.1348378f, -0.23732015f, -0.15766464f, 0.16182463f, 0.13670513f, 0.06916004f, 0.22093613f, 0.24730612f, 0.16774519f, -0.13295968f, -0.15236267f, -0.15358275f, -0.060493693f, -0.05734477f, -0.08259393f, 0.14002028f, 0.13094066f, 0.06958496f, 0.0591491f, 0.08729177f, 0.12852108f, -0.019423114f, -0.058721025f, -0.1137946f, -0.00078517356f, -0.09341964f, -0.08837716f, 0.08583755f, 0.104863144f, 0.03887605f, -0.018807288f, -0.08417542f, -0.08460291f, -0.13410841f, -0.18093391f, -0.19631734f, 0.057301123f, -0.056354206f, -0.06768044f, 0.04761245f, -0.0190536f, -0.06868081f, 0.052673973f, -0.10633839f, -0.07810036f, -0.13798723f, -0.24852774f, -0.14181434f, 0.09824307f, 0.022844616f, -0.028380517f, 0.14297704f, 0.21096404f, 0.089676216f, -0.18634446f, -0.19632609f, -0.14243697f, 0.038136903f, 0.075067386f, -0.0069999797f, 0.09722832f, 0.13640445f, 0.06743119f, 0.0051203626f, -0.11642034f, -0.10489936f, -0.060095884f, -0.031396244f, -0.09934338f, 0.08590775f, 0.07642316f, -0.024737567f, 0.042539135f, 0.049791194f, 0.0031739564f, 0.0058619855f, 0.03130102f, 0.016047334f, -0.02665226f, 0.016010653f, 0.007974732f, 0.060910124f, 0.076214f, 0.059224945f, 0.060329974f, 0.092434354f, 0.074051365f, -0.033280537f, 0.023311922f, 0.058589987f, -0.032575566f, -0.009323457f, 0.013640399f, -0.091236725f, -0.048257835f, -0.028310312f, -0.07911308f, -0.06784717f, -0.04166577f, 0.0041572233f, 0.0023145902f, -0.010847232f, -0.005907807f, -0.030894954f, -0.019646592f, -0.00044186745f, -0.010739498f, -0.016569944f, 0.023570107f, 0.020890119f, 0.019437317f, -0.02249607f, 0.02334284f, 0.029683871f, -0.009359756f, -0.007686101f, 0.018920874f, 0.0015051332f, -0.019869294f, 0.021435864f, -0.0127882995f, -0.013739709f, 0.0087631475f, 0.003936128f, 0.01597672f, -0.002827668f, -0.02808653f, 0.002851045f, -0.006772083f, -0.037968393f, -0.04166951f, -0.032392584f, -0.046272147f, -0.05240324f, -0.041896068f, -0.0004948246f, -0.0021789107f, -0.0018645467f, -0.032838758f, -0.030798491f, -0.017109241f, -0.045722928f, -0.06446988f, -0.025802908f, 0.06516468f, 0.09195885f, 0.08288816f, 0.010311022f, 0.08020159f, 0.08149345f, -0.057171676f, 0.013244947f, 0.019533534f, 0.019622339f, 0.03534413f, -0.014336124f, 0.040231396f, 0.041709762f, 0.029843882f, -0.009908329f, 0.028608453f, 0.03161734f, 0.01935873f, -0.033275094f, -0.02583423f, 0.014170603f, -0.0353155f, -0.031129602f, 0.044201564f, -0.023941603f, -0.043871537f, -0.022034027f, -0.048987225f, 0.025191477f, -0.02479703f, -0.03201428f, -0.0057363478f, 1.3286028e-05f, -0.05773215f, 0.0010211216f, -0.039277807f, -0.034658745f, -0.03513643f, -0.051691674f, -0.043074675f, -0.03633859f, -0.06455077f, -0.05326915f, -0.054044213f, 0.07332068f, 0.08461299f, 0.05425628f, 0.015671154f, 0.07108573f, 0.06541749f, -0.012517891f, 0.0041072564f, 0.011336395f, 0.032422286f, 0.033737913f, 0.0115303015f, 0.018666707f, 0.011302851f, 0.010160458f, -0.04927126f, -0.019413982f, 0.0022745028f, -0.039348233f, -0.06901253f, -0.04161271f, -0.057561707f, -0.058145605f, -0.047394615f, -0.062434733f, -0.06992622f, -0.046725612f, 0.024292845f, 0.055992804f, 0.051553667f, 0.007017131f, -0.009453489f, 0.023856986f, -0.008531717f, 0.00711653f, -0.012454719f, 0.04520376f, 0.051208265f, 0.09756708f, 0.032533184f, 0.06452918f, 0.050245736f, 0.060796175f, -0.0017057229f, -0.032767054f, 0.0010098094f, 0.030280532f, -0.0071224323f, 0.080540396f, 0.050619658f, 0.064314365f, 0.08757555f, 0.08998067f, 0.06224075f, 0.025815161f, -0.039787468f, -0.0028031857f, 0.014306028f, 0.1317842f, 0.06180106f, 0.005844317f, 0.0078797825f, 0.04130575f, -0.016162409f, -0.039466437f, -0.097213216f, 0.07113229f, 0.010512533f, -0.094243355f, 0.09187617f, 0.0543952f, -0.0026920103f, 0.018268637f, 0.011860534f, -0.013309175f, 0.07362853f, 0.13339062f, 0.088314354f, 0.11085475f, 0.057951722f, 0.10236997f, 0.042451486f, 0.060497135f, 0.039362982f, 0.06293402f, 0.0379494f, 0.011883398f, 0.04542988f, 0.028867662f, 0.0387267f, -0.01222258f, 0.0037037944f, 0.006269834f, 0.026516668f, 0.033365242f, 0.02031543f, 0.019028427f, 0.04833683f, 0.024127873f, 0.06357879f, 0.08373602f, 0.15295511f, 0.026898947f, 0.04428103f, 0.019590724f, 0.037314173f, -0.043376837f, -0.060304314f, 0.015557977f, 0.02414393f, 0.028603148f, 0.028471341f, 0.057720035f, 0.035048064f, -0.05761279f, -0.03965411f, -0.05261159f, 0.053092066f, 0.011567431f, -0.008595857f, 0.07370258f, 0.15398668f, 0.103096f, 0.06520837f, 0.062096197f, 0.104582645f, 0.048672587f, 0.025665415f, 0.0019548708f, 0.11012467f, 0.11822473f, 0.088453256f, 0.08047899f, 0.13114056f, 0.13887131f, 0.009072441f, 0.0060423906f, -0.0315559f, 0.086359225f, 0.1408678f, 0.052142628f, 0.13102898f, 0.18518943f, 0.10231054f, 0.022931123f, 0.098195694f, 0.1252835f, 0.026339192f, 0.0543996f, 0.05251012f, 0.019316835f, 0.00028399617f, -0.020306058f, 0.005990177f, 0.022027789f, 0.027005013f, -0.013480629f, 0.034556057f, 0.014890174f, -0.032172356f, -0.046051808f, -0.013147603f, -0.07138005f, 0.0017971245f, -0.0026273746f, -0.033563778f, -0.012010244f, 0.010379702f, -0.039497703f, 0.020332132f, -0.11045477f };
+static float conv1_bias[32] = { -0.8984575f, 0.12183002f, -1.2174866f, 0.15396571f, 0.5613631f, 0.39191365f, 1.5804975f, 0.92713225f, -0.28752735f, -1.2465117f, 0.54117906f, 0.45883402f, -0.9297666f, 0.9465098f, -2.0196316f, 1.9819049f, 0.03240406f, 0.7440181f, 1.6237522f, -2.151311f, 1.003879f, -0.7344588f, -0.8972895f, -0.14268021f, -0.28659603f, 0.6522633f, 0.69248044f, -2.569141f, 1.0389522f, 0.6716339f, 0.31258696f, -2.8816516f };
+
+static float conv2_weight[32 * 32 * 3 * 3] = { -0.027050192f, -0.017725047f, -0.006851328f, -0.020700077f, -0.0037872873f, -0.011506191f, -0.018590478f, -0.009452225f, -0.029281627f, 0.05290905f, 0.01166422f, 0.05537632f, 0.009948438f, 0.008186054f, 0.015557705f, 0.018378869f, 0.03167071f, 0.0017401287f, -0.0007858689f, -0.00575824f, -0.0065817237f, 0.0028112784f, -0.020406732f, -0.00835715f, -0.004253875f, -0.003077982f, -0.0074679004f, 0.01752797f, 0.015340114f, -0.0075743534f, -0.003682821f, 0.013794054f, 0.0060446193f, 0.013539095f, 0.0040081707f, -0.010908588f, -0.00079227285f, 0.0020387575f, -0.009674571f, -0.0028220608f, 0.0047964794f, -0.0027470302f, -0.019039772f, 0.0031588695f, -0.0060399403f, 0.014505548f, 0.017389594f, -0.008206185f, -0.033258256f, -0.005993521f, -0.011771646f, -0.0066443505f, -0.018936053f, -0.02678795f, -0.0015331382f, -0.017511612f, -0.0067842025f, 0.0050638113f, -0.036415875f, -0.011515878f, -0.018644972f, -0.010256759f, -0.021024473f, -0.008490279f, -0.0002227534f, -0.0073943315f, 0.009670207f, 0.0076289866f, -0.0019076256f, -0.01761692f, -0.01152281f, 0.00253728f, -0.008980309f, -0.014178534f, -0.005024206f, 0.0057767546f, -0.0019527839f, 0.009842334f, 0.005836024f, -0.0069425325f, -0.0042826426f, -0.049064547f, -0.019946624f, -0.03707982f, -0.030329097f, -0.03683071f, -0.0409065f, -0.025409969f, -0.041079935f, -0.017233685f, 0.0065203677f, 0.01878582f, 0.014872525f, 0.018578755f, 0.041122045f, 0.031411726f, 0.023421982f, 0.049234785f, 0.019919235f, 0.014901445f, -0.0029940198f, -0.0029258577f, 0.029110555f, 0.0041460367f, 0.008717467f, 0.023216179f, 0.034386918f, 0.016640201f, 0.021494957f, 0.014782286f, 0.0043718214f, 0.011633891f, -0.012688495f, -0.0108691845f, 0.009031582f, 0.0023954154f, 0.0060502207f, -0.010249458f, -0.01737232f, -0.0066254116f, 0.007830046f, 0.0008348276f, -0.0054253424f, -0.009955126f, 0.0004911968f, 0.00035108914f, 0.00072816736f, 0.0012947539f, -0.012370137f, -0.0061672353f, -0.020166202f, -0.009071584f, 0.016158316f, 0.011221343f, 0.011473228f, -0.01959326f, -0.008063956f, -0.021450259f, -0.004468727f, -0.021590367f, -0.008278661f, -0.012220947f, -0.016888393f, -0.020233791f, 0.04606553f, 0.050170347f, 0.061570365f, 0.006826035f, 0.014648705f, 2.4974279e-05f, 0.0130019635f, -0.0019350549f, 0.016821247f, 0.008983294f, 0.0016926051f, 0.0030824768f, 0.016176505f, 0.031285543f, 0.022820724f, 0.008195401f, 0.012582815f, 0.006211109f, -0.0030902762f, 0.0047071087f, -0.011782307f, -0.0036741577f, 0.003779913f, -0.009457893f, 0.0074523087f, 0.010392067f, -0.006922658f, 0.017287266f, 0.0035975925f, -0.0037122646f, -0.006269518f, -0.020540137f, -0.03200098f, 0.030434247f, 0.0024788687f, -0.002589671f, 0.0049879528f, -0.0063454662f, 0.00547597f, -0.0024036986f, -0.012690311f, 0.014211666f, 0.011958968f, 0.03975206f, 0.018606048f, 0.016837154f, 0.0012773447f, -0.015139874f, -0.002300143f, -0.015069379f, -0.051349528f, 0.018516177f, 0.0038959482f, -0.021717256f, 0.0019559604f, 0.011387902f, -0.00748776f, -0.0063730865f, -0.01154633f, -0.021385862f, 0.0383071f, 0.009246511f, 0.000898424f, 0.022888822f, 0.0028416482f, 0.0005382412f, 0.028449945f, -0.016622305f, 0.008455251f, 0.020424f, 0.013521046f, 0.0046670483f, 0.006698618f, 0.014181458f, -0.0062627783f, -0.0036390342f, 0.008234312f, -0.0072449525f, -0.009479482f, -0.0017848269f, -0.02007854f, 0.067764364f, 0.070538074f, 0.08126589f, 0.010582196f, 0.033476528f, 0.017475564f, -0.017052602f, 0.01371271f, 0.04789167f, -0.005220298f, 0.0016032545f, -0.011391606f, -0.0025578947f, 0.010439769f, -0.0011327921f, -0.015747698f, 0.0145903425f, -0.021771085f, 0.0064699943f, -0.0025544437f, -0.026442157f, 0.008153557f, -0.01308076f, -0.013910105f, 0.007486882f, -0.005742524f, -0.008729483f, 0.012378178f, 0.025393542f, -0.00012605672f, 0.00478001f, 0.0013706061f, 0.0069234725f, 0.013393227f, 0.02692855f, 0.020927737f, -0.04393537f, -0.02269572f, -0.021847991f, 0.018124463f, 0.038815565f, 0.046943113f, 0.052237943f, 0.061002817f, 0.018007647f, 0.03788917f, 0.031922292f, 0.031425737f, 0.0031465923f, 0.012386785f, 0.01047641f, 0.018939205f, 0.04102377f, 0.013187324f, -0.021038774f, -0.023826512f, -0.012116372f, -0.0021463684f, -0.019530965f, -0.0045958655f, -0.01670049f, -0.017524563f, -0.01669557f, -0.004041527f, -0.0062255766f, 0.0010519458f, 0.015056448f, 0.008463439f, 0.013327585f, 0.027669916f, 0.0071702255f, -0.0003265169f, 0.0024025582f, -0.047794275f, 0.009751662f, -0.013903162f, -0.04196744f, -0.038273245f, -0.005357461f, 0.024203632f, 0.019768022f, -0.017407652f, -0.015844498f, -0.015714895f, -0.016667653f, -0.006382362f, -0.014834052f, 0.015832515f, 0.028658772f, -0.004213039f, -0.029841255f, -0.019963918f, -0.048154633f, 0.012948784f, 0.005644436f, -0.022595275f, 0.06602119f, 0.03585661f, -0.0079354355f, 0.01173521f, 0.010193819f, 0.0112915635f, 0.0054467437f, -0.00034655564f, 0.020291544f, -0.022115704f, -0.030971646f, -0.0010883831f, -0.020218903f, -0.0127813835f, -0.030825278f, -0.008294217f, -0.023635041f, -0.032576006f, 0.08096592f, 0.044564724f, 0.02699716f, -0.020960275f, -0.033483997f, -0.030658197f, 0.010970608f, -0.024901688f, -0.016421998f, 0.035792124f, 0.03961994f, 0.050265696f, 0.03345416f, 0.03140859f, 0.02265159f, -0.0036999017f, 0.013041067f, 0.0053891526f, -0.011499291f, -0.043073844f, -0.024090324f, 0.026138982f, -0.0050840336f, 0.013583278f, 0.015858693f, 0.03660747f, 0.03602021f, 0.005923567f, -0.042731978f, -0.018777993f, -0.041774083f, 0.012846776f, -0.018925482f, -0.018709252f, -0.0030621865f, -0.043387502f, -0.00022717963f, -0.051503256f, -0.048587266f, -0.0012979049f, 0.00030247206f, -0.025338193f, 0.028726831f, 0.020286096f, -0.005422213f, 0.0019618259f, 0.006938177f, -0.0070481068f, -0.025807746f, -0.037278708f, -0.037244968f, 0.08018873f, 0.0042762975f, 0.019848103f, 0.026091367f, 0.036708478f, 0.011614563f, -0.006324549f, -0.024510322f, -0.014670049f, -0.011987484f, -0.0048665414f, -0.02152021f, -0.032326426f, -0.02085891f, -0.00044483528f, 0.023965761f, 0.0065025203f, 0.017544582f, 0.006405955f, -0.001166404f, 0.011549874f, -0.0142876385f, -0.033810996f, -0.0033042252f, -0.028265629f, -0.02018761f, -0.01971586f, 0.005712035f, 0.0059552826f, -0.00031391426f, -0.0037811408f, -0.005547538f, 0.0015425849f, -0.016330896f, -0.021129463f, -0.04383271f, 0.025325794f, -0.008388852f, -0.04208743f, 0.087463796f, 0.07817928f, 0.0270659f, 0.00045641465f, 0.00454173f, -0.027422696f, -0.0231088f, -0.0194866f, -0.049670264f, -0.024965817f, -0.020865163f, -0.016797032f, 0.018203989f, 0.0023086967f, 0.013865873f, 0.0039993273f, 0.014874414f, 0.041678336f, -0.019186283f, -0.019365607f, -0.016008312f, -0.018593919f, -0.030483045f, -0.030280685f, 0.019546932f, 0.0041569155f, -0.0100196805f, 0.04280446f, 0.035443958f, 0.0055949697f, -0.015904345f, -0.039179005f, -0.020892035f, -0.023738086f, -0.004105606f, -0.025271533f, -0.055093393f, -0.03076933f, -0.023336869f, -0.0010821347f, -0.029783322f, -0.0078554405f, 0.030687783f, 0.0036129218f, 0.061202805f, -0.005057146f, -0.018929584f, 0.018067453f, -0.010905156f, -0.022302618f, -0.016622722f, 0.021631423f, -0.015114413f, -0.013416938f, 0.013612444f, 0.0062768096f, 0.0043861433f, -0.03368014f, -0.039953265f, -0.038876344f, -0.0058330563f, -0.002994489f, -0.022894543f, 0.0013215301f, 0.00611929f, -0.029061422f, -0.039169345f, -0.0339005f, -0.03405584f, 0.050909866f, -0.016685586f, -0.002957391f, 0.039075173f, 0.023767285f, 0.026476461f, -0.046839274f, -0.018974165f, -0.020132085f, -0.0128779225f, -0.022479711f, -0.025983023f, 0.040625792f, 0.008137259f, 0.004226209f, 0.04092827f, 0.057365723f, 0.058731366f, -0.010903303f, -0.027180593f, -0.03159306f, 0.05441403f, 0.06319959f, 0.05962287f, -0.021863913f, -0.018281322f, -0.027079133f, 0.0432271f, 0.046478424f, -0.014463496f, 0.07615295f, 0.050683577f, 0.039254867f, -0.016149392f, -0.010536567f, -0.016900102f, -0.0020200142f, 0.013927865f, -0.0029641401f, -0.0009849946f, -0.0043799006f, -0.0020121657f, -0.023865057f, -0.018364206f, -0.006515468f, 0.029776376f, -0.010924012f, -0.0031341172f, 0.058415096f, 0.041671075f, 0.02855565f, -0.010848569f, 0.006172903f, 0.005249004f, 0.056791883f, 0.12687913f, 0.09700027f, 0.0053661205f, 0.010654711f, 0.03200086f, 0.019815572f, 0.005301547f, 0.017222205f, 0.005453902f, -0.012558684f, 0.011136376f, 0.012607069f, -0.008312005f, 0.009532529f, 0.024939468f, 0.011271378f, 0.037503675f, 0.01532451f, 0.000660741f, 0.009800403f, 0.024123518f, -0.036488805f, -0.019993227f, -0.0106215f, -0.0080164485f, -0.011589646f, 0.0056624557f, 0.0063862973f, 0.020240132f, -0.0045905537f, 0.009479692f, 0.0007340352f, 0.005081018f, 0.007873933f, 0.03939672f, -0.005925812f, -0.0040946277f, 0.026212038f, -0.0017522593f, 0.01815512f, 0.035190243f, -0.017359879f, -0.016515605f, -0.014171627f, -0.013877724f, -0.011285828f, -0.005799114f, -0.027106458f, -0.0060199876f, -0.008922993f, -0.009841131f, -0.012060787f, -0.016439868f, -0.016261227f, -0.008865384f, -0.0011002042f, -0.0154394545f, -0.015910579f, -0.0105762305f, 0.0052037085f, -0.0034780279f, -0.0026409647f, 0.01875976f, 0.0025231314f, 0.006753949f, 0.00765992f, 0.005913961f, 0.009018114f, -0.010373359f, -0.004079301f, -0.017152373f, -0.02005285f, -0.015791746f, -0.012916688f, -0.019995838f, -0.01966726f, -0.017637692f, -0.01338626f, -0.016395826f, -0.0154628595f, 0.005810191f, -0.015754638f, -0.014657498f, 0.0060028112f, -0.008220889f, -0.0056443834f, 0.007354991f, 0.0032700566f, -0.0057777977f, -0.0024233093f, 0.0030908603f, 0.0015492468f, -0.0045307423f, -0.00014193646f, 0.0015180625f, 0.004445527f, 0.00035038227f, -0.0070089945f, 0.02998711f, 0.027106142f, 0.023480631f, 0.016455134f, 0.017135583f, -0.0019274242f, -0.011830813f, -0.01734553f, 0.0019685698f, -0.0048191207f, 0.0053587197f, 0.0033287515f, -0.0043692696f, 0.013829764f, 0.015848428f, -0.009834928f, -0.016752493f, -0.015155516f, -0.0077659227f, -0.0055581094f, -0.006535188f, 0.016113589f, -0.0054711467f, 0.0008227111f, -0.027986376f, -0.025164304f, -0.013531142f, -0.013952191f, -0.0058755716f, -0.0028455479f, 0.00035411146f, -0.014387109f, -0.0029419812f, -0.01226721f, -0.004234284f, 0.0031722276f, -0.026073419f, -0.025945326f, -0.013712652f, -0.02505757f, -0.01700428f, 0.0038835169f, -0.0023137452f, -0.004512147f, -0.013602959f, 0.0050344686f, -0.0045576477f, -0.009921596f, -0.00299973f, 0.0012278775f, 0.0016959478f, -0.008665616f, -0.0074214768f, -0.017288238f, -0.0030029532f, -0.015120955f, -0.020228103f, -0.0050079785f, -0.01817236f, -0.016200833f, -0.018615004f, -0.008797843f, -0.011897443f, -0.020999536f, -0.004861705f, -0.007438909f, -0.006742672f, -0.0012114703f, -0.000790495f, 0.0023664583f, 0.005851665f, 0.030790588f, -0.0139790755f, 0.009310227f, 0.019064572f, -0.00315278f, 0.008246131f, 0.024107832f, -6.5297514e-05f, -0.0064744786f, -0.0067357104f, 0.003157386f, 0.0009519284f, 0.005601186f, 0.013697534f, 0.013560174f, 0.001683864f, -0.006956386f, -0.027233653f, -0.0225636f, 0.011875082f, -0.011750558f, -0.0041702385f, -0.014810024f, -0.017087191f, -0.008394839f, 0.007949486f, -0.006065859f, 0.010300181f, -0.018429771f, -0.014843645f, 0.00077882083f, -0.01491363f, -0.010912171f, 0.0038990667f, -0.014403614f, -0.005716014f, 0.018533735f, 0.0013266914f, 0.013278811f, 0.02274408f, 0.016213931f, 0.027134636f, 0.028927628f, -0.020841865f, -0.023153523f, -0.009512686f, -0.018388417f, -0.027434302f, -0.02185015f, -0.022463625f, -0.019490805f, -0.00670897f, -0.015493942f, -0.01867081f, -0.016209606f, -0.023981972f, -0.023910368f, -0.018355764f, -0.03149102f, -0.018074699f, -0.0012553327f, -0.014903518f, -0.014099618f, -0.0021970859f, -0.019077657f, -0.009822895f, 0.0011572745f, -0.01152264f, -0.013166706f, 0.004315959f, -0.017668352f, -0.024958989f, -0.01317532f, -0.02382666f, -0.019559298f, -0.006588384f, -0.026759384f, -0.016982634f, -0.00022143891f, -0.0016834495f, 0.0006238436f, -0.0021272486f, -0.007265856f, -0.003079119f, -0.007905612f, 0.0058305934f, 0.02728338f, 0.027675653f, -0.028777014f, -0.021687595f, -0.014788808f, -0.017496312f, -0.011673807f, -0.0033111866f, -0.004174473f, -0.010020278f, -0.01888006f, -0.0095991455f, -0.030347094f, -0.028133452f, -0.01288146f, -0.026267698f, -0.023563802f, -0.009512111f, -0.024528721f, -0.0074184462f, 0.00041794518f, -0.021803081f, -0.0056057572f, -0.00205266f, -0.00441667f, -0.009858253f, -0.008450894f, 0.012368194f, 0.0112253735f, -0.025859848f, -0.020810151f, -0.027599588f, 0.0059364727f, 0.0084363045f, -0.006025003f, 0.037951067f, 0.029359786f, -0.0071416786f, -0.0048407377f, 0.003082429f, 0.014835923f, 0.0011041004f, 0.0039200815f, 0.008467089f, -0.010284967f, 0.012568167f, 0.0227094f, -0.0051525603f, 0.007058811f, -0.0046814154f, 0.008386388f, 0.012660397f, 0.016080778f, 0.0018722301f, 0.006253674f, 0.0051386f, -0.004316464f, -0.02554666f, -0.031228289f, -0.025774492f, -0.03469436f, -0.025910044f, -0.027845245f, 0.0045122486f, 0.010025009f, -0.006644055f, 0.0073593734f, -0.04647616f, -0.009885716f, 0.010947123f, -0.057049505f, -0.026078755f, -0.039623335f, -0.05444939f, 0.013264999f, 5.446968e-05f, -0.0029772397f, -0.010911291f, -0.020824235f, -0.042935763f, -0.012441689f, -0.016061973f, -0.013196662f, 0.026014587f, 0.007441679f, 0.03984324f, 0.017543487f, -0.01580012f, 0.0023403026f, -0.013884318f, -0.019187417f, 0.00039577868f, -0.0058736885f, -0.0013287077f, 0.0029979274f, 0.0016850354f, -0.006800607f, 0.008468082f, 0.01627422f, 0.029793492f, 0.037346736f, 0.03461893f, 0.036125686f, 0.031491637f, 0.043474082f, 0.026698198f, -6.7712e-05f, -0.008484865f, -0.0033732317f, 0.0005916182f, 0.027508296f, -0.011960135f, -0.014837224f, -0.004768079f, -0.03324616f, -0.046609707f, -0.02759952f, -0.02605615f, -0.014302696f, 0.018368732f, -0.018219493f, 0.01826259f, 0.04406246f, 0.018648738f, 0.048439912f, 0.043161184f, 0.050420433f, 0.06350586f, 0.005415125f, -0.017866287f, -0.013078811f, -0.022353841f, -0.01783734f, 0.003752824f, 0.015199884f, 0.027577695f, 0.036368564f, 0.011861559f, -0.07171371f, 0.0037622529f, -0.009805642f, -0.07893733f, -0.03172081f, -0.0072647673f, -0.01837771f, 0.0075179148f, 0.010309874f, 0.004812347f, 0.0006710101f, 0.00676226f, -0.014777691f, -0.018674104f, 0.0103461575f, 0.0015960935f, -0.03891233f, 0.07231583f, -0.026117427f, 0.018252902f, 0.0010622957f, -0.012172654f, -0.0034286794f, 0.009453245f, -0.017819785f, 0.026611224f, -0.008913827f, 0.004866319f, -0.011595543f, -0.025365528f, -0.02814434f, -0.06704852f, -0.00611553f, -0.020158984f, -0.04085134f, -0.0029023371f, -0.0051137f, -0.008944665f, 0.042357814f, 0.020197583f, 0.036081266f, 0.04064227f, 0.034232542f, 0.048013423f, -0.01358411f, -0.03241453f, -0.02734553f, -0.04795099f, -0.029737856f, -0.037593488f, -0.024302626f, -0.0119381165f, -0.0049681794f, 0.04142138f, -0.014760524f, 0.017037695f, 0.011801947f, 0.0017022548f, 0.014078526f, -0.00020367047f, -0.02689211f, -0.02314355f, 0.0036774918f, 0.010965138f, 0.014995625f, 0.005994568f, 0.03946892f, 0.01444703f, 0.010878276f, -0.0054244236f, -0.05659625f, 0.0060577276f, -0.01845353f, 0.02161529f, 0.029041737f, 5.4111955e-05f, 0.022692803f, 0.03203003f, 0.011691359f, 0.020853454f, 0.01079743f, 0.0070791473f, 0.037089374f, 0.026442796f, 0.0120323235f, 0.014689491f, -4.6297628e-05f, -0.012666667f, -0.002257455f, -0.010923621f, 0.023508368f, 0.02966985f, -0.026587313f, -0.02096145f, -0.034784485f, -0.0069368943f, -0.015503895f, -0.0178449f, 0.034249485f, 0.0423566f, -0.013551338f, -0.008502827f, -0.022013918f, -0.042697445f, -0.010106273f, -0.024878973f, -0.02223905f, 0.025947273f, 0.015678369f, 0.014507293f, 0.0020547295f, 0.009417346f, -0.010059395f, -0.011250774f, -0.02752458f, -0.015612474f, 0.014911238f, 0.013357611f, 0.012133238f, -0.008444161f, -0.026008582f, -0.025960915f, -0.009183701f, -0.007255288f, -0.0070912116f, 0.035331525f, -0.00087842f, -0.0069829184f, -0.013737117f, -0.022052335f, -0.027331214f, -0.0037017388f, -0.030024573f, 0.0024737346f, 0.011437855f, -0.00093817996f, 0.026986329f, 0.00029341012f, -0.016961303f, -0.0015711046f, 0.00021258448f, -0.0070695733f, -0.013446551f, 0.016050352f, 0.045104478f, 0.038787756f, 0.06257033f, 0.059165888f, 0.026641736f, -0.0017675702f, -0.018414484f, -0.058437347f, 0.025100445f, -0.0016095667f, 0.021633672f, -0.023553438f, -0.015381351f, 0.0064567253f, 0.00020620368f, 0.0040809494f, 0.023056135f, -0.00032882192f, -0.03129152f, -0.017041473f, -0.039849464f, -0.064643234f, -0.06320706f, -0.031078089f, -0.0237642f, -0.0025667818f, 0.08879498f, 0.054957177f, 0.103375144f, 0.08056067f, 0.0044208635f, 0.009851622f, 0.0030938012f, -0.018059937f, 0.009260644f, 0.0075081023f, 0.036892034f, 0.03954021f, -0.017183574f, -0.022243826f, -0.0032808846f, -0.020239169f, 0.0021395325f, -0.0027093885f, 0.004521147f, 0.015658187f, -0.0018338556f, 0.0016593635f, 0.004512028f, -0.01656489f, -0.009525486f, -0.016348328f, -0.031200381f, -0.04741647f, -0.049211215f, -0.053761728f, -0.05215219f, -0.047508616f, -0.037532136f, -0.017117195f, 0.027763184f, 0.03288472f, -0.011760321f, -0.006248081f, -0.0008403687f, -0.00599124f, -0.015825834f, -0.009986361f, -0.009978107f, -0.013391776f, -0.012084281f, 0.024089238f, 0.025704501f, 0.017907921f, 0.018131893f, 0.029298024f, 0.01114104f, -0.026115615f, 0.008027995f, -0.00899673f, -0.011544971f, 0.0017535378f, -0.007222553f, -0.0040164124f, 0.010391812f, 0.0039078863f, -0.015088176f, -0.006580725f, -0.0076068225f, -0.0099849515f, -0.0026625162f, -0.010266661f, 0.0073783016f, -0.0016734386f, -0.005596226f, -0.0124089485f, -0.0019371005f, 0.0055331765f, 0.0134505695f, 0.002283973f, -0.011580654f, 0.0038541742f, 0.0068094055f, -0.011186324f, 0.019208288f, -0.007877244f, -0.0074329735f, -0.03582665f, -0.02549497f, -0.020931918f, -0.02178156f, -0.0079083275f, -0.019345084f, -0.023831988f, -0.008997561f, -0.018034838f, -0.0041767433f, 0.0019145937f, 0.014365182f, 0.009100608f, 0.022825846f, 0.02581187f, -0.018144812f, 0.007356287f, 0.017556256f, 0.012515769f, -0.0074417903f, 0.0069080335f, 0.01866899f, 0.012469602f, 0.0087077385f, 0.027236883f, 0.012223275f, -0.014068769f, 0.0048572817f, -0.0056816647f, -0.011330043f, 0.0074943155f, -0.0055116606f, -0.015102552f, 0.018213285f, -8.948813e-05f, -0.009784685f, -0.01864595f, 0.00022163126f, -0.0036486378f, -0.026669126f, -0.016118672f, -0.011310222f, -0.025576852f, -0.0049025277f, 0.00035706518f, -0.005793182f, 0.009235707f, 0.010866362f, 0.006286311f, 0.011143234f, 0.010303651f, 0.001187458f, 0.017031321f, 0.011867921f, 0.027445119f, 0.030004319f, -0.0027727534f, -0.013055723f, 0.006081666f, -0.011876662f, -0.0015198259f, 0.025887745f, 0.026682755f, 0.0026263508f, 0.012018898f, 0.01499813f, -0.014783168f, -0.0026706178f, -0.0037384226f, -0.015751487f, -0.010003089f, -0.0053848107f, 0.003134955f, -0.003765347f, -0.014023912f, 0.013782035f, 0.010718261f, -0.0024325564f, 0.018634351f, 0.013215859f, -0.0047844932f, -0.013156341f, 0.002035113f, -0.0049566054f, -0.03678505f, -0.027685925f, -0.022920435f, -0.036707323f, -0.027549205f, -0.018467056f, -0.014121673f, -0.00045805323f, -0.029050175f, -0.013300761f, 0.01454302f, -0.016837386f, -0.024371289f, -0.00958541f, -0.010206427f, 0.022487188f, 0.049941182f, 0.042710807f, 0.020454206f, 0.04614022f, 0.027118448f, 0.004313846f, 0.017260427f, 0.015295666f, 0.011449811f, 0.01557597f, 0.006152576f, 0.02843488f, 0.034694336f, 0.019524282f, 0.031536717f, 0.035988215f, 0.014602514f, -0.008844421f, -0.010059209f, -0.015276631f, -0.007355689f, 0.0042046793f, 0.003133471f, -0.011141964f, -0.004001078f, -0.020192234f, 0.0068931016f, 0.025478465f, 0.012952578f, -0.018605921f, 0.0067858966f, 0.0044788467f, -0.037543107f, -0.02117159f, -0.017354766f, 0.021174412f, 0.03704254f, 0.011908743f, -0.0010810669f, 0.022177119f, 0.0008488468f, 0.034134258f, 0.061084587f, 0.029539859f, 0.015439441f, 0.0396077f, 0.027269065f, 0.008521081f, 0.019311713f, 0.00949049f, -0.017802643f, -0.009054755f, -0.0017099805f, -0.015487611f, 0.017307691f, 0.004945516f, -0.0311061f, -0.013023134f, -0.0066289376f, -0.014953516f, -0.0064507523f, -0.0089017255f, 0.010024985f, 0.021073755f, 0.013416222f, -0.02470161f, -0.01656108f, -0.0037911215f, -0.011773845f, -0.010317011f, -0.0058656507f, -0.0142848445f, -0.0056582657f, -0.00037992117f, -0.009535771f, 0.012724772f, 0.009853289f, -0.012913996f, -0.01574555f, -0.008652399f, 0.03150753f, 0.037152156f, 0.01285929f, 0.03768814f, 0.053695798f, 0.036757037f, -0.01554746f, 0.0015115808f, -0.003886026f, -0.004695513f, -0.015086221f, -0.013658892f, 0.0043720654f, 0.0109846415f, 0.016738866f, -0.023020392f, -0.0066342284f, -0.014187448f, -0.014072694f, -0.010526174f, 0.0055295937f, -0.02850935f, -0.0264439f, -0.018021233f, -0.025293719f, -0.033940624f, -0.029549176f, 0.0010954111f, 0.01952394f, -0.0002477311f, 0.010470391f, 0.022922482f, -0.0023680783f, 0.00993637f, 0.028880412f, 0.024725188f, 0.014233381f, 0.010448482f, -0.005518691f, -0.017437316f, -0.023527494f, -0.026462652f, 0.03888528f, 0.026241282f, 0.03852933f, 0.017505514f, 0.051930934f, 0.033844147f, 0.0134256845f, 0.040545974f, 0.029774953f, 0.001198842f, 0.030975167f, 0.018305965f, -0.017377406f, -0.021653956f, -0.019494995f, -0.021231042f, -0.03753262f, -0.027067684f, -0.021050097f, -0.02204372f, -0.024250006f, -0.003886173f, -0.005749501f, -0.013847858f, 0.015355266f, 0.0175429f, 0.008479141f, -0.0041310135f, 0.013583224f, -0.002685319f, -0.033317532f, -0.03634806f, -0.0596153f, -0.027305461f, -0.048109125f, -0.09417508f, 0.0012119696f, -0.013276153f, -0.058758467f, -0.00629686f, -0.011205415f, -0.0102144545f, 0.011316004f, -0.011943314f, -0.0059436094f, 0.0014693048f, -0.0062323157f, 0.034890056f, -0.0006707406f, -0.013461228f, -0.0085025625f, 0.02279186f, 0.0029813477f, 0.007461808f, -0.0029178588f, 0.018153066f, 0.03165306f, 0.009686535f, 0.021544268f, 0.018437391f, 0.0066778f, 0.014731031f, 0.0072517577f, -0.008543997f, -2.8669892e-05f, -0.010605562f, 0.018556096f, 0.009929737f, 0.014591589f, -0.0100379605f, -0.023737818f, -0.011620294f, 0.0140633965f, -0.01476259f, 0.025864493f, 0.0025299327f, 0.001240495f, -0.010969879f, 0.005762592f, -0.014291915f, 0.0019801774f, 0.029836139f, 0.0018058036f, 0.031941213f, 0.024013046f, 0.022434328f, 0.015812267f, 0.0014301183f, 0.010388982f, -0.0014228342f, 0.001096873f, -0.016597085f, -0.016999237f, 0.004797379f, 0.010424402f, -0.0043977695f, 0.0039644814f, 0.031691987f, 0.01041812f, 0.0123284785f, 0.031632833f, -0.00027820354f, 0.004112341f, -0.01161471f, -0.0083915f, 0.014427735f, -0.012891942f, -0.022724502f, 0.020345224f, -0.0067134965f, -0.0059618107f, -0.008301339f, -0.017314836f, -0.009811818f, -0.006352816f, -0.0067780036f, -0.005395284f, 0.0026789843f, 0.008705405f, 0.0029453123f, -0.0024124708f, -0.033960618f, -0.019216917f, 0.015113915f, 0.0044891876f, 0.0012594799f, -0.0054208855f, 0.024469873f, 0.04373855f, -0.013107828f, -0.0329158f, -0.02357242f, -0.025500787f, -0.024301691f, -0.034910746f, 0.027220072f, -0.0036763633f, -0.0053629777f, 0.012447075f, 0.015474835f, -0.00058578525f, -0.006393076f, 0.00016563713f, 0.0024899994f, -0.0054824515f, -0.00274941f, -0.0070095854f, -0.004072489f, -0.005328677f, -0.0039521316f, 0.020687303f, 0.004283198f, -0.0034096218f, 0.020974668f, 0.0057876455f, 0.008551605f, -0.0025250611f, -0.023459496f, -0.026355406f, 0.021159537f, -0.007777237f, -0.010576453f, -0.00081012247f, 0.015637679f, 0.029586295f, -0.033026073f, -0.035912126f, -0.010083404f, -0.054814376f, -0.015962536f, -0.019191397f, -0.0062465705f, -0.018973568f, -0.00339936f, 0.016011674f, 0.015458558f, 0.0013802057f, 0.008841255f, 0.000875951f, -0.005658899f, 0.010781136f, -0.0018249727f, -0.00928789f, 0.00038272757f, -0.015997054f, -0.008919064f, 0.009213657f, -0.018390832f, -0.0021253617f, -0.0011221536f, 0.0015394386f, 0.02415984f, -0.030549925f, -0.037824087f, -0.009450728f, -0.026049193f, -0.024783257f, -0.035751164f, 0.027634118f, -0.00838021f, 0.009492401f, -0.035331577f, -0.047669705f, -0.038069174f, -0.015380307f, -0.030734163f, -0.04748181f, 0.01850082f, -0.013565093f, -0.028556477f, -0.009595673f, -0.008913042f, -0.011505793f, -0.0059575797f, -0.02098837f, -0.008489884f, 0.0034844321f, -6.491857e-05f, 0.003840372f, 0.0054103313f, -0.009293657f, -0.01932714f, 0.012099872f, -0.008100332f, -0.008222659f, 0.014116831f, 0.0036658363f, 0.030247744f, -0.010409594f, -0.009462429f, -0.025609257f, -0.0019230945f, -0.010228165f, 0.0016283055f, 0.013875301f, 0.010068735f, 0.016754702f, -0.006966456f, -0.0081211645f, -0.01157537f, 0.01017503f, -0.0027951335f, -0.00037611873f, -0.0021215307f, -0.004595644f, 0.025259508f, 0.0030668452f, 2.6534213e-05f, 0.0036654668f, -0.020233069f, -0.0053858017f, -0.01833547f, -0.0104281865f, -0.030128555f, -0.014715881f, -0.022957858f, -0.027929366f, -0.0033685472f, 0.010762678f, 0.0057865516f, 0.027909553f, -0.011283188f, -0.006111433f, 0.0429523f, 0.0032876749f, -0.01573474f, 0.003049547f, 0.023195984f, 7.25748e-05f, 0.0009216643f, 0.030996528f, 0.0033852682f, 0.009960826f, -0.009318373f, -0.028317653f, -0.009009899f, -0.0014289317f, -0.022316989f, -0.01189747f, 0.0013831109f, 0.0061540618f, 0.016511701f, -0.057345513f, -0.029171944f, -0.01459616f, -0.0003099426f, -0.030634107f, -0.007936278f, 0.02383614f, 0.03699359f, 0.0102360835f, -0.021669397f, -0.018328182f, -0.015632883f, -0.020927487f, -0.016233105f, -0.035233743f, 0.0040231794f, -0.010310956f, -0.019797591f, -0.00014266887f, 0.004933172f, -0.009038765f, 0.0012817353f, 0.01271701f, 0.0010652837f, 0.004518746f, 0.014005593f, -0.006499463f, 0.0056096935f, 0.011831003f, 0.006960886f, 0.025338823f, 0.060790118f, 0.045566324f, 0.029036367f, 0.023661893f, 0.027999816f, -0.009088711f, -0.0075312033f, -0.02030074f, 0.01626147f, -0.018578073f, -0.0012605055f, 0.016480519f, 0.017746428f, -0.02231923f, 0.011692987f, 0.004397346f, 0.010355398f, 0.012205285f, 0.020903872f, 0.023838054f, 0.004971503f, -0.008529527f, 0.016358512f, 0.015298031f, -0.013392803f, -0.029100934f, 0.019369218f, 0.04029538f, 0.0042373007f, 0.014908755f, -0.0036073118f, 0.009050405f, -0.004216399f, 0.0056417366f, 0.0036603652f, 0.012925546f, 0.014407131f, 0.011734169f, 0.014536494f, 0.004143033f, 0.016697105f, 0.03495174f, 0.0080639655f, 0.004489998f, 0.035056766f, 0.02770189f, 0.015266336f, 0.08251959f, 0.019495748f, 0.04277221f, 0.005439649f, 0.014023323f, 0.020012148f, 0.012464362f, 0.04057235f, 0.02913019f, 0.00895479f, 0.0038448966f, 0.010313441f, -0.016704008f, 0.001143129f, -8.464497e-05f, -0.015689008f, -0.011765237f, 0.0048082434f, 0.013238287f, 0.0064166565f, 0.021584284f, -0.009504248f, 0.00568454f, 0.007404877f, -0.0022287532f, 0.013813936f, 0.013411677f, 0.012585072f, 0.0074416995f, 0.037703957f, 0.024919322f, 0.0018505038f, -0.012300261f, 0.019239876f, 0.040051192f, 0.031478886f, 0.03285262f, 0.015519197f, 0.02404102f, 0.00011006128f, -0.010089661f, -0.00783732f, -0.012776305f, -0.010195219f, -0.010447519f, -0.010294963f, -0.019963114f, -0.0053695696f, 0.017820615f, 0.012928366f, -0.007846545f, 0.013144353f, 0.024867862f, 0.0053514023f, 0.005919651f, -0.018307447f, -0.01565149f, 0.006526148f, 0.00022676475f, -0.0023464202f, -0.0069240155f, -0.005559698f, 0.0005907648f, -0.0073832334f, -0.016366282f, -0.026086047f, -0.006987366f, 0.0060973098f, 0.009163601f, -0.00053312234f, -0.00014432092f, -0.009698396f, -0.00088979385f, -0.0016904415f, 0.020791465f, -0.0019323286f, 0.015149206f, -0.0045863637f, 0.014117823f, 0.027199863f, 0.025393618f, -0.00033488232f, 0.008902777f, 0.006849319f, 0.01558271f, 0.017083097f, -0.009123904f, 0.015497597f, 0.049050104f, 0.0030332718f, -0.008239648f, -0.009680596f, -0.033872735f, 0.0075913523f, 0.0003388401f, 0.0008724978f, -0.015109049f, -0.018331265f, -0.031541403f, -0.014497434f, -0.00012823853f, -0.0051898244f, -0.009815655f, -0.0006534501f, -0.009387313f, 0.0017953254f, -0.010787989f, -0.0070941206f, 0.002682558f, -0.0023490146f, -0.001749333f, 0.0066654026f, 0.010030976f, -0.022526551f, 0.003414996f, 0.008285737f, 0.0147775095f, 0.014981006f, 0.0053893626f, 0.013739236f, -0.014330028f, -0.021852052f, -0.025809707f, -0.021348825f, -0.025960473f, -0.026643014f, -0.01746232f, -0.007121153f, -0.02242157f, 5.3133048e-05f, 0.011290833f, 0.021351818f, 0.005026936f, 0.007456978f, -0.0035559295f, 0.010923045f, -0.0028497002f, -0.004057228f, 0.00039872323f, -0.0045274706f, -0.0043614055f, -0.0011971376f, -0.019371636f, -0.006839131f, -0.0022451554f, -0.017561799f, -0.03944851f, 0.0002847546f, 0.00011577523f, -0.016183658f, -0.0067529525f, -0.007263693f, -0.0010287288f, -0.0031190685f, -0.014266875f, -0.027148193f, 0.014170899f, 0.00048061684f, 0.011828525f, -0.00036760682f, -0.0018117015f, 0.0005103333f, 0.0013747696f, -0.0239182f, -0.013131825f, 0.013200139f, -0.0010291873f, -0.020592362f, 0.0152764255f, 0.028291665f, 0.010977398f, 0.012001383f, 0.0010230152f, 0.0050030607f, 0.005196208f, -0.0026108578f, 0.034410603f, 0.0015288865f, -0.010411461f, -0.009167023f, -0.00075748394f, 0.007482522f, -0.00033231228f, 0.012616905f, 0.027841683f, 0.008909789f, 0.009097305f, 0.062270254f, 0.023856303f, -0.009323558f, -0.017673878f, -0.03273946f, -0.00218783f, 0.0070866235f, 0.003448705f, 0.003481601f, 0.02719377f, 0.014863568f, -0.0035459832f, -0.010671435f, 0.0031799092f, 0.010427901f, -0.0065732817f, -0.01622256f, -0.003896509f, 0.003375859f, -0.0037509908f, 0.0037507683f, 0.004424141f, -0.019636963f, -0.013634707f, 0.005746292f, 0.015034619f, -0.029177124f, -0.001180885f, 0.0046379566f, 0.015404284f, 0.0012592041f, 0.010768763f, 0.00015198572f, 0.00897562f, 0.01662488f, -0.008739956f, -0.005474287f, -0.010439825f, -0.007915125f, 0.008407391f, 0.004116532f, -0.0032235107f, 0.011755372f, 0.029668977f, 0.008838672f, 0.044504993f, 0.025377635f, 0.018916316f, 0.017079558f, 0.04851041f, -0.0071748877f, -0.008653128f, -0.013084352f, -0.0075066863f, -0.017619098f, -0.037080675f, -0.0058531f, -0.0031772233f, -0.013611592f, -0.041093644f, -0.025800902f, 0.012684418f, -0.011210279f, 0.0024265153f, -0.014240861f, -0.019134428f, -0.016750826f, -0.052863065f, -0.007556284f, 0.00087287906f, 0.0049581407f, -0.022332909f, -0.020870227f, -0.012588158f, -0.011937543f, -0.014107125f, -0.00883411f, -0.010181882f, -0.006474218f, 0.0071781715f, -0.008188821f, 0.00020132615f, -0.01107995f, -0.017863462f, -0.0029496131f, -0.025333889f, 0.018165208f, 0.013414277f, 0.004668461f, 0.013664936f, 2.7842607e-05f, 0.0017087074f, 0.013886168f, 0.020278323f, 0.02285776f, 0.006008269f, -0.0043054107f, 0.0010406227f, -0.016268859f, -0.014084377f, -0.014773259f, -0.0010901731f, -0.014435952f, -0.031224186f, 0.0013762206f, 0.010863834f, -0.007613216f, -0.009591229f, -0.008275541f, -0.012207974f, -0.0040423796f, -0.009271131f, -0.008361762f, 0.009604021f, 0.00017840466f, 0.004673476f, 0.0047810837f, 0.0050389054f, 0.003409953f, 0.021063728f, 0.015843915f, 0.018064804f, 0.017520195f, 0.023911212f, 0.015753545f, 0.005171546f, 0.0028688451f, -0.0070527117f, 0.004997267f, 0.016577339f, 0.0070028175f, 0.007331777f, -0.015944285f, -0.03285963f, -0.036934674f, -0.03911899f, -0.041828733f, -0.030158658f, -0.02629727f, -0.032524332f, -0.021876445f, -0.028305737f, -0.03231043f, -0.015312619f, -0.025304414f, -0.036344633f, -0.012994029f, -0.017709134f, -0.020788226f, 0.0034631977f, 0.011352923f, 0.0032798906f, -0.0046499535f, 0.0006438012f, -0.027496878f, -0.005801052f, -0.0010264859f, 0.0046390984f, -0.006702982f, -0.0065757744f, 0.0108918f, 0.00012967178f, 0.02552516f, 0.013594849f, -0.0023176093f, -2.6471167e-05f, 0.00029079767f, 4.2651363e-06f, -0.0013278249f, -0.0032188746f, 0.0017817199f, -0.009040571f, 0.0016846664f, 0.007954655f, -0.0011912589f, 0.007461936f, 0.019107865f, 0.009508406f, 0.011258966f, 0.0056560836f, 0.0052683144f, -0.00055572356f, 0.0108417375f, 0.0033574572f, -0.0043290416f, -0.0061832005f, -0.0094806235f, -0.0106948875f, -0.012372022f, -0.02658761f, -0.061336696f, -0.0025293708f, 0.0070925187f, -0.021346455f, -0.033908114f, -0.015565394f, -0.023678843f, -0.025561173f, 0.016058082f, 0.0054167192f, -0.05337238f, -0.0059237443f, -0.025375947f, 0.004393748f, 0.0029546786f, -0.009219771f, -0.015412528f, -0.008544094f, -0.010315039f, -0.0099142175f, -0.0013491675f, 0.0043337704f, -0.008647907f, -0.012821842f, -0.011148935f, -0.011520722f, -0.014997435f, -0.015967282f, -0.013790763f, 0.0029959104f, -0.0032196266f, -0.005957414f, -0.0011029397f, 0.03139688f, 0.014164259f, 0.03659441f, 0.045265697f, -0.013561452f, 0.029025387f, 0.022867253f, -0.030793473f, -0.014320373f, -0.026838008f, -0.03865287f, -0.020252535f, -0.03851587f, -0.033339094f, -0.042121194f, -0.031031683f, -0.0030242198f, 0.008179281f, 0.0040065898f, 0.005733787f, 0.004721037f, 2.3001703e-05f, -0.00016445853f, -0.004065569f, -0.015710184f, 0.00026945106f, -0.010818729f, 0.00099877f, -0.0147258155f, 0.0013603073f, -0.015445186f, -0.014099282f, 0.0016752959f, -0.0035968737f, -0.0049171895f, -0.008863427f, -0.0068579055f, -0.005222152f, -0.008376691f, -0.009623918f, 0.0026702592f, 0.0011847316f, -0.013322637f, -0.018702187f, -0.01973482f, -0.00021151727f, -0.020056557f, -0.020631561f, -0.01071081f, -0.02887667f, -0.0025571182f, -0.016110852f, -0.06111202f, -0.044737883f, -0.034215223f, -0.046120804f, -0.0057553886f, -0.017001757f, -0.035821393f, -0.013928572f, -0.045083042f, -0.00671393f, 0.015764838f, 0.0020369866f, -0.018788232f, -0.026361072f, -0.04861085f, 0.0038593041f, 0.009564168f, 0.011553177f, 0.016430467f, 0.008505878f, 0.001765511f, -0.015383723f, 0.0023933647f, -0.009476885f, -0.0030214551f, 0.0014146529f, -0.0033473368f, -0.025463808f, -0.0048766583f, -0.00031815833f, -0.002194261f, -0.008233627f, -0.017849678f, -0.009402219f, -0.0004205295f, -0.0074001835f, -0.02573243f, 0.024237176f, -0.013177652f, -0.041574646f, 0.0027588096f, -0.05950573f, -0.075927414f, -0.022146843f, -0.03908744f, -0.042869225f, -0.01996437f, -0.01193918f, -0.030551113f, -0.0030243748f, -0.01479562f, -0.04002103f, -0.024977917f, -0.04342524f, 0.013941461f, 0.0028844725f, -0.0038504899f, 0.00418515f, -0.011878952f, -0.005882338f, 0.012731798f, 0.0047535044f, 0.0074248086f, -0.013616001f, -0.027735395f, -0.01787288f, -0.009574934f, -0.0306616f, -0.030520689f, -0.020765822f, -0.029396549f, -0.023945505f, -0.018056566f, -0.018803876f, -0.065203615f, -0.035536923f, -0.021067485f, -0.013706796f, -0.010674921f, -0.02408443f, -0.0076080547f, -0.015775807f, -0.015509751f, -0.0036991679f, -0.02624119f, -0.03620828f, -0.02985933f, -0.024708198f, -0.015784878f, 0.00025436276f, 0.013133176f, -0.0009729411f, 0.012780395f, -0.008513833f, -0.029220039f, -0.021158926f, 0.00887246f, -0.0046249637f, 0.01077632f, 0.009990112f, -0.0036874309f, -0.00012464538f, 0.015554797f, 0.003096122f, 0.01244663f, -0.002047388f, -0.007069722f, -0.0068210936f, 0.028128145f, 0.047243822f, 0.040602934f, 0.016068583f, -0.008185629f, -0.004096813f, 0.0154373525f, 0.0042195544f, 0.0096066985f, 0.005086503f, -0.010960435f, 0.018024474f, -0.0018588698f, -0.031476647f, -0.0074276384f, 0.013003892f, 0.0027341277f, 0.022630379f, 0.017534018f, 0.0017820528f, 0.0093895355f, 0.017610602f, 0.014260231f, 0.014266291f, 0.021018406f, 0.004307886f, 0.0023056704f, 0.01128713f, -0.013620344f, -0.01745117f, 0.0026416038f, 0.006406631f, -0.0055982987f, 0.0016332591f, -0.025649177f, -0.008412902f, -0.027991213f, -0.047413934f, -0.0576229f, -0.037679687f, -0.06439289f, -0.045617886f, -0.024787642f, -0.050888374f, -0.03949064f, -0.010644013f, -0.028418247f, -0.0019174579f, -0.00962574f, -0.013536016f, -0.01238252f, 0.0074790358f, 0.017954325f, 0.008087717f, 0.022341557f, -0.0011990437f, 0.036683742f, 0.017757034f, -0.00081117055f, 0.016781423f, 0.01933818f, 0.019974697f, 0.04622741f, -0.022173913f, -0.022504365f, -0.035039574f, -0.01316957f, -0.005319568f, -0.006630635f, -0.019357413f, -0.020653505f, -0.0031831712f, 0.048756573f, 0.025284834f, 0.030607915f, 0.029187854f, 0.035257995f, 0.0424958f, 0.03421944f, 0.01966858f, 0.024904098f, -0.023403632f, -0.023853954f, -0.013197454f, -0.027854443f, -0.02336432f, -0.014989118f, -0.023465736f, -0.026898447f, 0.0067666727f, 0.018528337f, -0.008500625f, 0.02729687f, -0.002142095f, -0.00030984488f, 0.0047402275f, 0.001764535f, -0.002985108f, 0.031881966f, -0.016944785f, -0.027831718f, -0.053330503f, -0.030822104f, -0.023229903f, -0.038886603f, -0.020963889f, -0.021974424f, -0.014684268f, 0.017540252f, -0.00037759985f, 0.0088499375f, 0.032437548f, 0.014450173f, 0.011199547f, 0.009203255f, 0.0028298716f, 0.029200578f, -0.0004973038f, 0.0024668272f, 0.023253793f, 0.020059345f, -0.010160843f, -0.01171565f, 0.021008588f, -0.0062762355f, -0.0008382195f, -0.011241413f, -0.019217832f, -0.018853372f, -0.02074862f, -0.014846615f, -0.0047928463f, -0.007875263f, -0.011250922f, -0.0029581592f, -0.016492717f, -0.03130279f, -0.028468058f, -0.02044214f, -0.054984108f, -0.013395052f, -0.003501146f, -0.004203595f, 0.038221013f, -0.007968218f, 0.004387496f, 0.0021646079f, -0.010367973f, -0.014736031f, 0.012926286f, 0.008841795f, 0.013229231f, 0.014391372f, -0.00037735235f, -0.018351458f, -0.018625429f, -0.005146783f, -0.029029908f, -0.014200121f, -0.005470281f, -0.022001827f, 0.0031553851f, -0.0019039148f, -0.013198812f, 0.011251414f, 0.0038251467f, 0.005019011f, 0.012798678f, 0.00643508f, 0.019841645f, 0.027315322f, 0.0011810934f, -0.006035894f, 0.00932651f, 0.007685279f, -0.017639985f, -0.024155563f, -0.006659252f, -0.00732631f, -0.008449474f, -0.0010912853f, 0.0014300687f, 0.0036182927f, -0.010847126f, 0.0028844273f, -0.015332332f, -0.0046498757f, -0.0038792084f, 0.023762483f, 0.040237464f, 0.020018898f, 0.05476339f, 0.009933155f, 0.0009835567f, 0.017440261f, 0.019593906f, 0.049648467f, 0.050136223f, -0.0074568964f, -0.024248954f, -0.016592994f, -0.030225158f, -0.034622543f, -0.007962929f, -0.010962392f, -0.012640023f, 0.016456828f, 0.024124049f, 0.0067325267f, 0.04005521f, 0.016983625f, -0.021186484f, 0.0024729955f, 0.034314316f, 0.007875319f, 0.04059232f, -0.006891408f, -0.020859942f, -0.006254148f, -0.023357281f, -0.036575567f, -0.034846023f, -0.026763434f, -0.019170355f, 0.007979924f, -0.014639191f, -0.021952463f, -0.03630635f, -0.03721141f, -0.032458793f, -0.041945353f, -0.013976539f, -0.015839728f, -0.020399524f, -0.01644145f, -0.03221196f, -0.04150662f, -0.02065722f, -0.03794399f, -0.035502035f, -0.032778535f, -0.02412108f, -0.028333293f, 0.0058282735f, 0.004000473f, -0.00087349414f, -0.008320853f, -0.008093938f, -0.00060788717f, 0.0013432846f, -0.00497675f, -0.0049764183f, -0.022053942f, -0.00063416595f, -0.010280494f, 0.0026032103f, -0.0006128721f, -0.01778775f, 0.016956061f, 0.02291457f, -0.004903223f, 0.023740573f, 0.018786117f, 0.008747014f, 0.0060159503f, 0.0030149769f, -0.0067161396f, 0.0076507833f, 0.018424561f, 0.022690503f, 0.015676897f, 0.005969049f, 0.014384437f, 0.025833538f, 0.013710519f, 0.0018216362f, 0.009846034f, 0.009846831f, -0.0006533981f, -0.01030009f, -0.0011261306f, -0.0067457156f, -0.0073393267f, -0.018970955f, -0.013914962f, 0.00031327363f, -0.0019143763f, 0.0026190476f, 0.020285932f, 0.006963059f, -0.012463946f, 0.013572917f, 0.011684878f, -0.0057482645f, 0.0155299725f, 0.014129161f, 0.020334838f, 0.0060962127f, 0.0030836018f, 0.0044887126f, -0.004767354f, 0.0010000742f, 0.0037738972f, 0.0032488273f, 0.0062071704f, 0.0023624084f, -0.009215373f, -0.013083056f, -0.013871129f, -0.00813757f, -0.03169308f, -0.013988242f, -0.0064768875f, -0.01926454f, -0.002590764f, -0.0033915958f, 1.0875708e-05f, 0.012707963f, -0.003099836f, -0.0040509994f, 0.0026136765f, -0.007361129f, -0.00830906f, 0.021755576f, 0.009052047f, -0.0010199093f, 0.006176624f, -0.0047052954f, -0.010181856f, 0.01841133f, 0.005281191f, -0.002748659f, 0.026230736f, 0.009172665f, 0.013095332f, 0.0069098016f, 0.0044619762f, 0.014138004f, 0.012020357f, 0.0026030065f, 0.0046330295f, 0.0065025296f, 0.017338427f, 0.009134049f, 0.007944301f, 0.01197563f, 0.012638246f, -0.0077006165f, 0.0004811683f, 0.013495775f, 0.017285634f, -0.012906625f, 0.0019492274f, -0.010979651f, -0.016350972f, -0.0023138355f, -0.006306405f, -0.0020491343f, 0.0033779894f, 0.0015720325f, 0.0064666257f, -0.0012384487f, -0.001986379f, -0.004292423f, -0.0049872096f, -0.008627829f, -0.01084144f, -0.015223311f, -0.010919438f, 0.00391106f, 0.008369768f, 0.0056925393f, -0.0018681731f, 0.008952985f, 0.0025307282f, 0.0067847623f, 0.019887228f, 0.01696394f, 0.019514576f, 0.0034506568f, 0.002572483f, 0.0066834297f, -0.0026493545f, 0.0011913895f, 0.004106116f, 0.0005031397f, 0.0030321614f, -0.01788726f, -0.009110237f, -0.0072633303f, -0.01644888f, -0.015992185f, -0.010365973f, -0.018753428f, -0.0070960666f, -0.0049575507f, 0.0052827382f, -0.00181193f, -0.005750681f, -0.0070263203f, -0.0015535863f, -0.0027043903f, -0.016380223f, -0.008711834f, 0.0026053125f, 0.011176871f, 0.009504023f, 0.0047923564f, 0.0029477028f, 0.006282928f, -0.008826007f, 0.01363697f, 0.018604858f, 0.010184104f, -0.015711484f, -0.008397166f, -0.010768806f, -0.0035635133f, -0.0058524827f, -0.009452474f, 0.007977039f, 0.006403678f, 0.0076725534f, -0.014338039f, -0.012314284f, -0.009781544f, -0.0042135767f, -0.006500818f, -0.009249836f, 0.0009521649f, -0.001956506f, -0.020643717f, -0.017057734f, -0.0034720034f, -0.010185028f, -0.0065450934f, -0.011471247f, -0.019813074f, 0.0037120313f, 0.006004831f, -0.003077602f, 0.0058841314f, 0.0019735103f, 0.0046049384f, -0.011402388f, -0.0048306603f, -0.010342472f, -0.0025688566f, 0.012723666f, 0.007856672f, 0.004353214f, 0.0021239044f, -0.0018670314f, 0.0021874935f, 0.0074876705f, -0.0018831304f, 0.006045181f, 0.010336541f, 0.01329332f, 0.02252177f, -0.0013574389f, -0.005947514f, -0.006969314f, -0.005394723f, -0.011618216f, -0.0037638873f, 0.0029441172f, 0.0076683853f, -0.003985396f, -0.009278014f, -0.0021813726f, -0.01376826f, -0.009100112f, -0.01932268f, 0.0030524118f, 0.003230724f, -0.009599562f, 0.013610264f, 0.015482912f, 0.005411027f, 0.0013775175f, 0.011315445f, -0.0017554477f, 0.011117982f, 0.0029875461f, 0.004458835f, 0.007971543f, 0.012401463f, 0.010467421f, -0.0066139665f, 0.0076589948f, -0.005464156f, -0.0032613548f, 0.017039489f, 0.011884812f, 0.013445736f, -0.0011525113f, 0.0066751037f, 0.00028789233f, -0.005253317f, -0.0065212194f, -0.0028377017f, 0.018263394f, 0.0028637722f, -0.0028348092f, 0.0059163696f, 0.0016086571f, 0.0014383344f, 0.019865338f, -0.004211571f, -0.0073980107f, 0.00841807f, -0.0012255315f, -0.012428578f, -0.017039303f, -0.011352573f, -0.018932456f, -0.008596699f, -0.016563956f, -0.0090664495f, -0.010836561f, -0.013456677f, 0.005711577f, 0.003403192f, 0.013040142f, -0.0008696858f, -0.0014871837f, 0.0077979537f, 0.0028844133f, 0.0017753101f, 0.0145771485f, -0.013488074f, -0.005412329f, 0.00041419064f, -0.012053605f, -0.009884355f, -0.006915757f, -0.009523316f, -0.0054359245f, -0.008427087f, -0.0006681004f, 0.0026931847f, 0.0019572633f, 0.001242181f, 0.0015400706f, 0.010591101f, 0.0053683813f, 0.0040435763f, 0.01056355f, -0.011876185f, -0.01040904f, -0.0117282225f, -0.020698128f, -0.01554077f, -0.018160302f, -0.017506346f, -0.008774454f, -0.010776645f, -0.020101786f, -0.0164416f, -0.019563835f, -0.017691584f, -0.012419162f, -0.016882205f, -0.030014403f, -0.016242407f, -0.019482452f, 0.0018635106f, 0.004796033f, 0.0016177864f, 0.0031175837f, 0.002428377f, 0.0023327335f, 0.003333769f, 0.00028922834f, 0.003235771f, -0.013167487f, -0.01684545f, -0.015856994f, -0.023283001f, -0.017411092f, -0.019827709f, -0.01226082f, -0.012494726f, -0.021063937f, -0.011622186f, -0.0052488092f, -0.0036672591f, -0.012063702f, -0.013255124f, -0.01585872f, -0.011939815f, -0.010704267f, -0.008486685f, 0.00610266f, -0.0020952919f, -0.0005660685f, 0.0008863172f, -0.0013362853f, -0.0005372497f, 0.0028696784f, -0.0029373807f, 0.00039053388f, 0.0039127143f, -0.002884661f, 0.008155058f, -0.0030659244f, -0.0052560125f, -0.002042294f, -0.002175791f, -0.002778874f, 0.003208903f, -0.005519558f, -0.007884972f, -0.000103283855f, -0.0042089857f, -0.0066433344f, -0.004190663f, -0.0040175226f, -0.006395558f, -0.0049411096f, -0.0024118589f, 0.001766416f, 0.006976364f, -0.0038320674f, -0.0037838498f, 0.004172818f, -3.9853483e-05f, -0.0031749976f, 0.0012040173f, -0.007367237f, -0.0026312817f, -0.0002011048f, -0.009824542f, -0.008233292f, -0.006359503f, -0.019033836f, -0.016412407f, -0.005795027f, -0.008311033f, -0.0052763126f, -0.0045794384f, -0.007861701f, -0.0023957866f, -0.0025089022f, 0.0037509203f, 0.0020586576f, 0.0053623514f, 0.007998613f, -8.140037e-05f, 0.0050417893f, -0.0032843626f, -0.0019125855f, 0.0017318665f, -0.00033851707f, -0.007376696f, -0.0048018405f, -0.005111714f, 0.00032720904f, 0.0061820927f, -0.010933516f, -0.006700873f, -0.0062828897f, -0.008724602f, -0.0024644576f, 0.000997392f, -0.017522112f, -0.011023402f, -0.011856142f, -0.012679415f, -0.014233448f, -0.013114214f, -0.02020722f, -0.012733331f, -0.008426259f, -0.00056912575f, 0.000158964f, 0.0045288657f, 9.679404e-05f, 0.00660948f, 0.011773478f, 0.007651775f, 0.004306694f, 0.0064937053f, 0.005723082f, 0.0045972746f, 0.008603326f, 0.008105884f, -0.004650801f, 0.0028579289f, -0.0036985232f, -0.0018661879f, -0.0015979396f, -0.006721069f, -0.0076536387f, -0.006494916f, -0.0038157178f, -0.00901234f, -0.009193679f, -0.006412478f, -0.0065189386f, -0.004651006f, -0.0033494204f, 0.0013794638f, -3.0467767e-05f, 0.004969064f, 0.0026415165f, 0.0088958945f, 0.004086895f, 0.0062274137f, 0.0073147137f, -0.0056086374f, 0.0060121436f, 0.00202916f, 0.0075451834f, 0.0036945415f, 0.0042635454f, 0.0029989642f, -0.0013956027f, 0.0023340837f, -0.0075543467f, -0.0045786947f, -0.0048854905f, -0.017181775f, -0.017377364f, -0.009695193f, -0.011378488f, -0.012575579f, -0.009050076f, -0.004014445f, -0.0053029233f, -0.005960873f, -0.009547705f, -0.003142888f, -0.002320939f, -0.009528131f, -0.011506769f, -0.0067617735f, -0.0039809393f, 0.00075416686f, 0.001432249f, -0.0058030845f, -0.00525549f, -0.0052226484f, -0.01128971f, -0.0048048026f, -0.0022847494f, -0.011687926f, -0.007713631f, -0.01692508f, -0.014132198f, -0.013163463f, -0.01921418f, -0.024424694f, -0.012756596f, -0.01783434f, -0.0030779638f, -0.00264385f, -0.0065870723f, -0.010147318f, 0.00056896557f, 0.005889325f, -0.00081250136f, 0.0024308949f, 0.0036632216f, -0.0123977065f, -0.0076780347f, -0.008310059f, -0.01574629f, -0.011912885f, -0.011335378f, -0.01356474f, -0.012018872f, -0.009457494f, -0.007013898f, -0.008763424f, -0.0031322846f, -0.020670755f, -0.016458187f, -0.0139798f, -0.009578314f, -0.0064227884f, -0.010290986f, -0.005150543f, -0.0035986146f, 0.001382167f, -0.0082471995f, -0.0051435544f, -0.012054248f, -0.004378721f, -0.004309989f, -0.0043987758f, -0.0019118079f, 0.004911354f, 0.009840214f, 0.0063890675f, 0.0029688235f, 0.0048783086f, -0.004048627f, -0.0068841223f, 0.00027902378f, -0.0002980055f, -0.000997639f, -0.0025976812f, -0.0053103934f, 0.002735322f, 0.0044512628f, -0.0012102975f, 0.00040136764f, 0.0058719465f, -0.010114678f, -0.007402089f, -0.0023762714f, -0.00879102f, -0.008446229f, -0.0075038704f, 0.002147205f, 0.0075942595f, 0.0073660417f, -0.014402467f, -0.025567943f, -0.014740415f, -0.027206296f, -0.029464051f, -0.021497598f, -0.021262597f, -0.03320285f, -0.0397884f, 0.040609587f, 0.038449217f, -0.0030415216f, -0.0052249175f, -0.0025905308f, -0.02320495f, 0.0038780444f, 0.01514922f, -0.010927833f, -0.006634433f, 0.008865694f, -0.0012813101f, -0.018089734f, -0.012346359f, -0.010533529f, -0.012985006f, 0.0024910301f, -0.010284648f, 0.0051358184f, 0.017643f, 0.0034512545f, 0.0043211738f, 0.016018432f, 0.0037761256f, 0.0076517533f, 0.016058756f, 0.0031968304f, -0.015826294f, -0.017952504f, -0.0072020213f, -0.019113425f, -0.021595199f, -0.007229752f, -0.008733993f, -0.01100658f, 0.0039005245f, 0.007591444f, 0.031469427f, 0.012435395f, 0.014326972f, 0.014064368f, 0.013019771f, 0.018501492f, 0.034545377f, 0.0012307017f, 0.024618652f, 0.019661933f, -0.0032685234f, 0.016987765f, 0.028947083f, 0.009584341f, 0.016336547f, 0.023942802f, 0.008292789f, -0.0099441195f, -0.005794658f, -0.007056423f, -0.00012293788f, -0.005978141f, -0.0034826414f, -0.04064234f, -0.024019804f, -0.026534436f, -0.020922754f, -0.012975546f, -0.020852001f, -0.04240693f, -0.019362153f, -0.036186337f, -0.03203498f, -0.020626256f, -0.0070565105f, -0.018278781f, -0.006916423f, -0.0068873153f, -0.023544062f, -0.00018872716f, -0.017005485f, -0.023456566f, -0.009358563f, 0.0004789209f, 0.021455579f, 0.022976551f, 0.0068817576f, 0.040517926f, 0.017053135f, 0.008347748f, 0.03279988f, 0.018682133f, 0.0016102534f, 0.037088808f, 0.05706166f, 0.0010419947f, 0.036794133f, 0.078756824f, 0.0014703218f, 0.04218703f, 0.0174082f, -0.004657891f, -0.016612148f, -0.0024777723f, -0.009293881f, -0.01518679f, -0.012823375f, -0.0121684f, -0.013841521f, 0.010348106f, 0.0006260846f, 0.010773775f, -0.0030898785f, 0.0029014456f, 0.0039544306f, 0.0019292384f, 0.009849408f, -0.0030080297f, -0.015043736f, -0.005580686f, -0.02035137f, 0.0040537016f, -0.024259506f, -0.03300083f, -0.021348242f, -0.02512837f, -0.023029078f, -0.003944817f, -0.0033954424f, 0.007365577f, 0.03833052f, 0.007586977f, 0.03309953f, 0.037518155f, -0.0034346306f, 0.009341383f, 0.0040266705f, 0.0101998225f, 0.0055459905f, 0.032488503f, -0.0075693447f, -0.012734832f, 0.007890023f, -0.019222373f, -0.00086672785f, 0.028258977f, 0.009881697f, 0.02344947f, 0.004892907f, 0.0021774613f, 0.020286357f, 0.010417685f, -0.0132061085f, 0.03216697f, 0.013795141f, -0.011030751f, 0.006584588f, 0.008732234f, -0.01137322f, 0.014082251f, -0.002392514f, -0.010014615f, 0.022837104f, 0.019574814f, -0.00844236f, -0.015248608f, 0.008989353f, -0.02071326f, -0.03733783f, -0.0027774542f, -0.031776395f, -0.0301609f, 0.00643093f, -0.011324142f, 0.030344976f, 0.02316348f, -0.0069596097f, 0.02006886f, 0.018988734f, -0.003155958f, 0.03487064f, 0.030676682f, 0.0026530337f, -0.0072701555f, 0.0215427f, -0.017022101f, -0.007100004f, 0.0040372848f, -0.010128354f, -0.00091515924f, 0.0079529965f, 0.0077145617f, -0.003920322f, 0.021626009f, 0.0014656939f, -0.0106663415f, 0.004829477f, -0.016679721f, 0.0043435064f, 0.028226731f, 0.015155364f, 0.01502962f, 0.027724704f, -0.0011921515f, 0.03235906f, 0.03998597f, 0.015919685f, 0.017745085f, 0.010304946f, 0.0030477042f, 0.00023653643f, 0.021136122f, 0.0070807207f, -0.0097257625f, 0.016668428f, 0.0100720525f, -0.0061379913f, 0.01135013f, -0.0015040177f, 0.040886167f, 0.02906808f, 0.0057604127f, 0.0118582565f, 0.001064492f, -0.016431183f, 0.023992663f, 0.029435804f, 0.0041624135f, 0.035156444f, 0.0067974012f, 0.008807951f, 0.051139094f, 0.047520623f, 0.014540851f, 0.024030142f, 0.014552644f, 0.011615225f, -0.025350142f, -0.023602543f, -0.013602145f, -0.036101837f, -0.034741964f, -0.022592146f, -0.01740754f, -0.027552543f, -0.0136449495f, 0.023633853f, 0.04657789f, -0.00032444185f, 0.030016538f, 0.020417914f, 0.004372908f, 0.056553435f, 0.02972134f, -0.022587704f, 0.026708193f, 0.008502334f, -0.017754368f, 0.012261941f, -0.003954623f, -0.027529197f, 0.0055098035f, -0.005785437f, -0.01896144f, -0.0028517973f, 0.004885288f, -0.015975865f, -0.011812232f, -0.00955554f, -0.014445839f, -0.0021901887f, 0.0059236833f, 0.0015669761f, -0.026714532f, -0.031106237f, -0.02167761f, -0.049285274f, -0.045285627f, -0.020514157f, -0.04288723f, -0.038949665f, -0.018742597f, 0.009491734f, 0.00464044f, 0.0132863615f, 0.0063741324f, 0.007827196f, 0.0064062346f, 0.0055432715f, 0.0007165631f, 0.0192332f, 0.0025099427f, 0.012995737f, -0.017867295f, 0.0020773555f, -0.001340324f, -0.018374167f, 0.0074043395f, 0.015946373f, 0.005128502f, -0.009272732f, 0.0068767667f, -0.028527152f, 0.0052071055f, 0.005217112f, -0.020215504f, -0.0013716307f, 0.0069013247f, -0.0061569293f, 0.005862947f, 0.016703347f, -0.02620504f, -0.005762597f, 0.030723834f, -0.011341121f, -0.00031994566f, 0.008130316f, -0.0062706904f, -0.005341147f, -0.0021592712f, 0.0070839734f, 0.003663611f, -0.019248523f, 0.00031334968f, 0.017306931f, 0.006224935f, 0.0051161493f, 0.021475459f, 0.0055759107f, -0.01460459f, 0.010039635f, 0.011087017f, 0.002433129f, 0.01368388f, 0.02833636f, 0.015620672f, 0.009206829f, 0.0118077155f, 0.0019975335f, 0.013222699f, 0.024143547f, 0.004557209f, 0.010696387f, 0.0104965065f, 0.0033173661f, -0.008255943f, 0.009328232f, 0.009070231f, -0.0066358163f, -0.020313062f, -0.0011380486f, 0.009479047f, 0.0018686517f, 0.00033947465f, -0.009626073f, 0.0005297291f, 0.019022498f, -0.015914524f, -0.0055763596f, 0.007399369f, 0.015991246f, 0.0021560749f, 0.006758075f, -0.008351859f, 0.0029691423f, 0.008968416f, -0.010060725f, 0.012190077f, 0.0021378917f, -0.0072390223f, 0.020621553f, 0.025151134f, 0.00022801431f, 0.01214335f, -0.010284049f, 0.0059407214f, 0.019321537f, 0.026028065f, 0.0077837985f, 0.006521751f, -0.0009288957f, 0.02782592f, 0.03182948f, 0.00096391846f, 0.012780868f, 0.020606583f, 0.012000481f, -0.0074730758f, 0.015690172f, -5.1276114e-05f, -1.8663804e-05f, 0.00028178672f, -0.0107400995f, -0.011533193f, -0.0016784273f, -0.0012023621f, -0.010050977f, -0.0022397381f, -0.0069777546f, -0.007918564f, 0.0002347314f, -0.00078542077f, -0.0065347f, -0.01784668f, -0.0069221845f, 0.0043087555f, 0.008704827f, 0.0029958216f, 0.008070357f, 0.015423039f, 0.0026911206f, 0.0021676035f, 0.01909749f, -0.002929098f, -0.0008082684f, 0.0062248684f, 0.0016993539f, 0.007347634f, 0.037588235f, -0.010391371f, 0.005773002f, 0.034272064f, -0.003969796f, -0.003852702f, 0.017377537f, 0.0014886254f, -0.002373442f, 0.012568995f, 0.00089911855f, 0.002959963f, -0.0061000222f, -0.011282831f, -0.0035997087f, 0.0074568572f, 0.007935948f, -0.01920052f, -0.0039160163f, 0.0072591784f, -0.014498279f, -0.0094478f, -0.004580724f, 0.00528141f, -0.0014117258f, -0.011704155f, 0.018517766f, 0.036127042f, 0.02042246f, 0.008221315f, 0.029481506f, 0.024357533f, 0.0069355858f, 0.030948974f, 0.024775423f, -0.005157436f, 0.0016769534f, -0.026837304f, -0.011173434f, -0.016093995f, -0.018397722f, -0.004748893f, -0.008367121f, -0.0016189581f, -0.0090354225f, 0.001663301f, 0.004401094f, 0.00045789318f, 0.00035159703f, -0.00570545f, 0.015084069f, 0.006689237f, 0.00322244f, 0.0010943678f, -0.008374096f, -0.008768685f, 0.009137728f, -0.007090072f, -0.007012794f, -0.0026104758f, 0.0053394726f, 0.002167139f, 0.004534864f, 0.0144560095f, -0.02332082f, -0.002180223f, 0.01577949f, 0.007471429f, -0.001258982f, 0.010137719f, -0.0050013904f, 0.009742416f, 0.015139276f, -0.0037994275f, 0.00056615047f, 0.013557353f, -0.009943364f, -0.00785967f, 0.01156314f, -0.006193036f, -0.0084920265f, 0.004890634f, -0.0078282505f, 0.0023440337f, 0.02040132f, 0.0018842504f, 0.004929417f, 0.010944374f, 0.00361233f, -0.000269293f, -0.00857444f, -0.0008177564f, -0.003285728f, -0.0045753582f, -0.023957632f, 0.017199991f, 0.020034578f, 0.018045783f, 0.024870386f, 0.033709317f, 0.008304821f, 0.021281851f, 0.05066518f, 0.0051740697f, 0.012179714f, 0.013038492f, 0.0050477064f, -0.0053817504f, -0.0014143179f, -0.0037827687f, -0.010239932f, 0.017232765f, 0.0005579479f, -0.0063453787f, 0.006124224f, 0.0046387864f, 0.010727396f, 0.0005396988f, -0.013488513f, 0.009151702f, 0.016032606f, 0.0044136043f, 0.0006201652f, 0.002660559f, 0.0030134616f, -0.018028855f, 0.0005748735f, 0.0008877689f, 0.016128037f, 0.01458708f, 0.034201775f, 0.008774127f, -0.013944829f, -0.011911626f, -0.0027771464f, 0.0070964037f, -0.0038132628f, 0.006145177f, -0.009337709f, -0.0015980169f, -0.0029133728f, 0.0021202366f, 0.0055658054f, -0.0013598744f, 0.007937863f, 0.010709424f, -0.005533484f, -0.005096751f, -0.000732491f, -0.0048767827f, 0.012907955f, 0.017540878f, -0.0075255395f, 0.0028435506f, -0.0028872832f, -0.016029648f, -0.018485077f, -0.016508562f, -0.008942746f, -0.008859637f, -0.018888418f, 0.027785193f, 0.0043471986f, -0.019748293f, 0.012914994f, 0.00016928992f, -0.0048400373f, 0.038052227f, 0.006964373f, 0.0057264157f, -0.010668023f, -0.023698807f, -0.009736122f, -0.03672594f, -0.016848324f, -0.006591238f, -0.018795893f, -0.011161134f, -0.0038132304f, -0.007417637f, -0.017295592f, 0.0033781978f, -0.018271543f, -0.005129897f, -0.008899243f, -0.009392059f, -0.006377057f, -0.0030211443f, -0.00067155046f, -0.0007767164f, -0.0050110775f, -0.017793816f, -0.017214585f, -0.03950043f, -0.020017799f, -0.032772433f, -0.03456105f, 0.010826539f, -0.009859715f, -0.00336755f, -0.025314432f, -0.021489989f, -0.021453353f, 0.003957608f, -0.003130902f, -0.0028250008f, -0.005988001f, -0.023215435f, -0.03603701f, -0.017504342f, -0.023736928f, -0.025895664f, -0.012736376f, -0.037444808f, -0.019480959f, -0.0006268916f, -0.0022602484f, -0.0016776449f, 0.0013521066f, -0.012302314f, -0.029546387f, -0.01003638f, -0.0104004815f, -0.020486113f, 0.018886352f, 0.013563487f, -0.0042683454f, 0.000546885f, -0.0052808905f, -0.022386363f, -0.0025625643f, -0.0043193265f, -0.020118574f, 0.040901616f, -0.0019001316f, -0.017106004f, 0.014489766f, -0.016972115f, -0.036616843f, 0.04252091f, 0.019026779f, -0.015941035f, 0.005561672f, -0.02846773f, -0.02355512f, 0.008148083f, 0.0034564992f, -0.008169964f, 0.00021856219f, -0.0059800185f, -0.016563049f, -0.021864608f, -0.03294018f, -0.027917428f, -0.012866882f, -0.033831242f, -0.022636272f, 0.011657239f, -0.022532238f, -0.027753487f, 0.025117803f, -0.0098222075f, -0.020464404f, -0.0067967023f, -0.006860858f, -0.003582747f, 0.02805658f, 0.00043409437f, 0.010753453f, -0.0005608773f, 0.0019478626f, 0.0009743062f, -0.010069784f, -0.010733875f, -0.008081612f, -0.011268336f, -0.02076432f, -0.010076915f, -0.0120968735f, -0.008283293f, -0.017158382f, -0.019934129f, -0.020476723f, -0.037458003f, -0.0119184125f, -0.021616135f, -0.033605155f, 0.008188031f, -0.0013102744f, 0.0024412817f, -0.025443776f, -0.017779743f, -0.015041743f, 0.010405905f, 0.00040887526f, -0.0056538535f, 0.028849555f, -0.003588834f, -0.019307239f, 0.021799222f, 0.0013909942f, -0.0122572025f, 0.03408562f, 0.014778082f, -0.0050383974f, 0.0025953345f, 0.0027841863f, 0.00233655f, 0.0077855047f, -0.0069572884f, -0.0025774653f, -0.011663266f, -0.021756388f, -0.028355084f, 0.009175274f, -0.015517225f, -0.009354606f, -0.01732053f, -0.025777081f, -0.02358086f, 0.0014056516f, -0.030618656f, -0.023873776f, 0.02813957f, 0.0014476994f, -0.019707697f, 0.009018191f, -0.00033359643f, -0.014227432f, 0.063823566f, 0.012376319f, 0.010144135f, -0.010762292f, -0.0037003877f, -0.012756108f, 0.0024386237f, -0.002433874f, -0.0111484025f, -0.0032611836f, -0.013599341f, -0.0028845568f, 0.0155505f, 0.0068505816f, -0.029942915f, -0.027379492f, -0.023333775f, -0.023946786f, -0.002625398f, -0.02360015f, -0.016172716f, 0.010778119f, -0.010819057f, -0.03839735f, -0.031326268f, -0.025666783f, -0.017196082f, -0.0064256405f, -0.012133033f, -0.021499494f, 0.004742722f, -0.0064298706f, -0.017391738f, -0.0044324524f, -0.020837968f, -0.001966185f, 0.027702136f, 0.0038404604f, -0.0031580233f, 0.005524034f, -0.004244174f, 0.0023769755f, -0.02234346f, -0.0018138732f, -0.017067842f, -0.007785512f, 0.009408649f, -0.011325575f, -0.002841106f, -0.014237806f, -0.012665942f, -0.006390436f, -0.02400163f, -0.008017981f, -0.010952798f, -0.016421188f, -0.016244607f, -0.025904056f, -0.028795706f, -0.020758472f, -0.033990983f, -0.025161108f, -0.02116089f, -0.019009877f, -0.0073233666f, -0.0051985225f, -0.0067022447f, -0.022153934f, -0.013972541f, -0.022027342f, -0.0334617f, -0.024625126f, -0.0011591648f, -0.01968406f, -0.020843854f, 0.0032011985f, -0.019443661f, -0.0034283926f, -0.010325285f, -0.010832811f, -0.009430989f, -0.007191754f, -0.004245467f, -0.012378283f, -0.03665868f, -0.026893158f, -0.031146541f, 0.009986871f, -0.018666744f, -0.014555817f, 0.0044117817f, 0.004288274f, -0.017900402f, 0.007241759f, -0.0008185969f, -0.009892507f, 0.01038684f, 0.0032138966f, -0.013076862f, -0.0010368759f, -0.00061865454f, -0.004852934f, -0.005903999f, 0.0035694793f, -0.014665705f, -0.021014305f, -0.012955072f, -0.032301538f, 0.0024686637f, -0.0038451862f, -0.0062467437f, -0.03345902f, -0.025756441f, -0.008909996f, -0.022879686f, 0.023452913f, 0.03738092f, 0.01826121f, 0.003561364f, 0.02164763f, 0.014939581f, -0.01855573f, -0.03362266f, -0.007844391f, -0.016203843f, -0.007409962f, 0.028833624f, 0.0016513242f, -0.009639823f, -0.047152407f, -0.030198209f, -0.013969828f, -0.021314094f, 0.00920963f, -0.00032556648f, -0.0028621142f, -0.022245817f, -0.032769784f, -0.022566857f, 0.007938425f, -0.01751292f, -0.021071818f, 0.025599793f, 0.0023549362f, 0.006710931f, -0.027484559f, -0.020717638f, -0.017258748f, -0.02914785f, -0.014363703f, 0.010321839f, -0.009277948f, -0.029035127f, -0.0022809359f, -0.007582594f, -0.006504335f, -0.03134802f, -0.032778695f, -0.013540161f, -0.032215357f, -0.028890682f, 0.03164571f, 0.0449153f, 0.046615105f, 0.050254915f, 0.009348575f, 0.015339659f, 0.019519083f, 0.0046099373f, 0.069077924f, 0.049623534f, 0.036602594f, 0.033018474f, 0.0033477896f, -0.0081051765f, 0.0054488303f, 0.008919248f, 0.0033586596f, -0.026065096f, -0.0240895f, 0.021753203f, 0.027957533f, -0.007484231f, -0.07850302f, -0.058123734f, -0.059801493f, -0.042464513f, -0.0335026f, -0.037811507f, 0.010136026f, 0.019002642f, 0.004372121f, -0.036948025f, -0.026995892f, -0.02880996f, 0.0028319252f, 0.006514218f, -0.015951537f, -0.012995519f, -0.020311223f, -0.022044186f, 0.015365615f, -0.0008831748f, 0.020648453f, 0.013072951f, 0.0049799094f, 0.012954056f, -0.010371297f, 0.0053085764f, 0.008390398f, 0.020144414f, 0.03854832f, 0.03688698f, 0.03466405f, 0.076680474f, 0.055264425f, 0.011034798f, 0.021589115f, 0.0003016847f, -0.0003723839f, -0.0039972607f, -0.017118284f, -0.0019650902f, -0.00095533323f, 0.009198896f, -0.012313838f, -0.027500195f, -0.031435944f, -0.014279031f, -0.011863761f, -0.0015414295f, 0.0015574592f, -0.0075171404f, -0.026492305f, 0.013789443f, 0.022386707f, 0.011186868f, -0.013906826f, 0.005363069f, -0.014907866f, 0.0032887303f, 0.037951536f, 0.011619285f, -0.013845662f, -0.003150956f, -0.03654828f, 0.005189423f, 0.025249384f, 0.014486878f, 0.0017446604f, 0.07326174f, 0.02535227f, -0.002474752f, 0.034280017f, 0.023328157f, 0.017433217f, 0.014026993f, -0.01469769f, -0.0012775328f, -0.01684128f, -0.004958183f, -0.0021416652f, 0.027697429f, -0.0005651501f, -0.027845344f, -0.0013013919f, 0.0017788416f, -0.033776466f, -0.04679897f, -0.06380158f, -0.012362246f, -0.0012236417f, -0.004200358f, -0.0025633213f, -0.015327958f, -0.010382448f, -0.01121946f, 0.03588373f, 0.03979601f, 0.018521711f, 0.030630253f, 0.017007371f, -0.012851142f, -0.004846109f, -0.05438814f, -0.008953581f, -0.0064132423f, -0.014840188f, -0.014367369f, -0.014763167f, -0.04133962f, 0.013571863f, 0.020974789f, 0.020217959f, -0.01303012f, -0.0023417273f, -0.0019042742f, 0.0030394392f, -0.006050194f, -0.0056956126f, -0.012883879f, -0.020667f, -0.0083752675f, 0.002292608f, 0.014797015f, -0.0024014206f, 0.009604233f, -0.0036343627f, -0.01377472f, -0.0007523461f, 0.00893767f, -0.016532628f, 0.008775605f, 0.02402775f, 0.007844823f, -0.002019019f, 0.025741415f, -0.013964696f, 0.025850566f, 0.029161375f, 0.005173854f, 0.07283968f, 0.094208665f, 0.050628446f, 0.027685786f, 0.004820222f, -0.02508269f, -0.048039995f, -0.046002578f, -0.049691293f, -0.030421125f, 0.0033025881f, 0.015810698f, -0.011963076f, -0.0058985394f, -0.01270477f, 0.0019645274f, -0.010931843f, 0.0026161647f, -0.028299501f, -0.020591797f, -0.017369032f, 0.03308903f, 0.05561083f, 0.05410789f, 0.0380601f, 0.032906983f, 0.07231682f, 0.043794833f, 0.15844566f, 0.05897518f, 0.019720752f, 0.03669572f, 0.0370355f, -0.042460825f, -0.013348678f, -0.037804376f, -0.017476918f, 0.041853853f, 0.0176283f, -0.0037438185f, -0.01839278f, -0.02423104f, -0.0066208984f, -0.015813401f, -0.0008342792f, -0.020130241f, 0.020479463f, 0.012596366f, 0.006230523f, 0.03261457f, -0.036553893f, 0.0018770956f, 0.016776977f, 0.025517676f, -0.038929977f, -0.0023578869f, 0.02756453f, -0.025433505f, -0.008369745f, 0.0028244294f, 0.017889118f, -0.0047007105f, -0.015933715f, -0.0030028166f, 0.0023558356f, -0.022987815f, -0.012576533f, 0.005271275f, -0.009716136f, -0.02388849f, -0.0135773625f, -0.034479372f, -0.006099706f, 0.011434432f, 0.0019518144f, 0.034674373f, -0.0115279965f, 0.00044337392f, -0.031987786f, -0.024525769f, -0.024740336f, -0.0076044397f, -0.012760675f, -0.006496712f, -0.021978652f, -0.026801312f, -0.031146513f, 0.02876093f, 0.056688763f, 0.032750532f, 0.009014498f, 0.046713796f, 0.03618375f, 0.018027116f, 0.03858212f, 0.042421576f, -0.0030021626f, -0.011689887f, -0.014467731f, 0.0022274074f, -0.0018282222f, -0.0037410553f, -0.007965787f, -0.0072915056f, -0.0122633865f, -0.01949625f, -0.006066981f, -0.016749388f, -0.008796526f, 0.0026899334f, 0.0058175223f, -0.008831984f, 0.0044568954f, -0.009975616f, 0.00979298f, -0.013669149f, -0.010795594f, 0.020658998f, 0.0007241449f, -0.0046606674f, 0.010502668f, -0.0027896413f, -0.011945334f, -0.010101482f, -0.019975267f, -0.038100198f, -0.023391254f, -0.013919627f, -0.00331425f, -0.014449652f, -0.017031377f, -0.009516619f, -0.0096514635f, 0.00096994004f, -0.013204359f, -0.0065214485f, -0.007205255f, -0.0049709086f, -0.0039320793f, -0.003424662f, -0.013758933f, -0.0013509205f, -0.00029670377f, -0.006208634f, 0.015439445f, 0.01169952f, 0.0072194343f, 0.014162015f, 0.0042172633f, 0.0077456455f, 0.020246992f, -0.005147986f, -0.010451617f, 0.032368332f, 0.02079442f, 0.00905842f, 0.02778325f, -0.0037122648f, -0.013549033f, 0.0013105995f, 0.012329502f, 0.010676055f, 0.013966021f, 0.0165243f, 0.0058381525f, 0.0021038037f, -0.0017451134f, 0.011575562f, -0.026705336f, -0.008988941f, -3.1319203e-05f, -0.026225198f, -0.0063372226f, -0.0067301313f, -0.0030431207f, -0.010218112f, 0.0059399484f, -0.010262676f, 0.0008721136f, -0.008950899f, -0.017315906f, -0.008448526f, -0.002078621f, -0.008012361f, -0.0045664115f, -0.01528453f, -0.007914199f, -0.004807027f, 0.010646648f, -0.01806394f, 0.0011779994f, 0.0043335715f, -0.009485452f, 0.012765252f, 0.0063492497f, 0.010445021f, -0.009024943f, -0.0024143665f, 0.018149463f, 0.0072671976f, 0.00208072f, 0.0008722965f, -0.0073452685f, 0.0024435332f, -0.01902868f, -0.009020473f, -0.02696956f, -0.0078712115f, -0.015267732f, -0.023711532f, -0.0059891306f, -0.00068407564f, -0.006415873f, -0.020244902f, -0.008259489f, -0.028077321f, -0.01941128f, -0.0076167155f, -0.010050325f, -0.0023857646f, -0.013222797f, -0.014909213f, 0.002232122f, 0.008006778f, 0.026997678f, -0.024326645f, 0.022455206f, 0.019877404f, 0.006739451f, 0.018630248f, 0.037374727f, 0.0011219359f, 0.008216455f, 0.011613782f, 0.01949892f, 0.0060128914f, 0.012507972f, 0.0018317668f, 0.0026319276f, 0.0169862f, -0.01453323f, -0.02933222f, -0.0037484877f, -0.009395801f, -0.010410016f, -0.007945672f, -0.018204926f, -0.012673641f, -0.0034860983f, -0.0020207257f, 0.017844647f, 0.009217161f, -0.0042497795f, 0.014835219f, 0.005238986f, 0.008410454f, 0.015132336f, 0.014896134f, -0.010289897f, 0.024643056f, 0.010092121f, 0.008286476f, 0.027011286f, 0.016942207f, 0.020001415f, 0.026845358f, -0.008731349f, -0.008487308f, 0.002170995f, -0.011304208f, -0.01266008f, 0.0016218679f, -0.014847877f, -0.013119449f, 0.008249072f, -0.015570997f, -0.011466334f, -0.011699564f, -0.012359832f, -0.014395257f, -0.0016944658f, -0.0020956246f, 0.002309148f, -0.0008502877f, -0.0054197996f, -0.015966263f, -0.0063615893f, -0.019091457f, -0.019473812f, -0.008843078f, -0.013134486f, -0.013610887f, -0.001755542f, -0.011926438f, -0.011592147f, -0.009346741f, -0.01804634f, -0.0166439f, -0.003912525f, -0.0052709347f, -0.013667281f, -0.0052853664f, -0.0026791971f, 0.0032575259f, -0.002997834f, 0.0015966609f, -0.009108455f, 0.0021260716f, 0.016880305f, -0.011826665f, 0.009206162f, 0.028062321f, -0.021752538f, -0.011710975f, -0.016445775f, -0.017173095f, -0.00604286f, -0.0016657475f, -0.011001542f, -0.0041320976f, -0.016205486f, -0.024980435f, -0.02698904f, -0.03289154f, -0.023823973f, -0.014748197f, -0.022349369f, -0.02916783f, -0.0050740107f, -0.020877937f, 0.022054613f, 0.010851868f, 0.00814166f, -0.005711336f, -0.01240055f, 0.0017589527f, -0.023068039f, -0.016054451f, -0.013552871f, -0.024376148f, -0.01933553f, 0.0029499403f, 0.002190118f, 0.009840647f, 0.019567247f, 0.056151614f, 0.030362803f, 0.007018507f, 0.005494871f, 0.008004212f, 0.011338303f, -0.0012962398f, 0.016139772f, 0.016493853f, 0.008406757f, 0.031752873f, 0.01870995f, -0.031983137f, 0.0004113259f, -0.022006117f, -0.0033969942f, -0.016979493f, -0.012530692f, -0.024806915f, -0.031579226f, -0.033618912f, 0.0062438324f, 0.031880084f, 0.0106617175f, 0.012019515f, 0.0015104618f, 0.011428386f, -0.009190493f, -0.011128636f, 0.0064096176f, -0.013705883f, -0.017565995f, -0.00987984f, 0.034688413f, -0.008118122f, -0.03631619f, 0.033143822f, 0.011979829f, -0.028565364f, -0.0057958052f, -0.009719918f, -0.035153583f, 0.017232526f, 0.009464137f, -0.0230771f, -0.022097178f, -0.009461717f, -0.019586813f, 0.025376597f, -0.016209735f, -0.030231727f, 0.025043184f, 0.025453819f, -0.016596287f, -0.0053664413f, 0.0018475908f, -0.026045056f, 0.00054150395f, 0.022654504f, 0.017593648f, -0.0056122416f, 0.011498425f, 0.020074941f, -0.005167707f, -0.019852323f, -0.006188355f, 0.010229363f, -0.00939888f, -0.0032831233f, 0.040663194f, 0.030975817f, -0.02063203f, 0.017431255f, -0.0024915398f, -0.0044769626f, 0.01029969f, 0.010848427f, -0.00813179f, 0.025743786f, 0.011130006f, -0.0021683415f, -0.013549697f, 0.014249194f, -0.0032667161f, -0.0039616376f, 0.036407605f, 0.038789928f, -0.013521279f, 0.016238758f, 0.035400845f, -0.025416775f, 0.0030546186f, 0.029603418f, 0.014335831f, 0.04446463f, 0.038315993f, -0.008965755f, 0.032662947f, 0.0497214f, -0.0012910592f, 0.012678514f, 0.02545041f, -0.012899035f, 0.082102455f, -0.013052051f, -0.01218294f, 0.059575275f, 0.010771432f, -0.038499676f, 0.03900415f, 0.04819081f, 0.014804634f, -0.025539454f, -0.012175794f, 0.009179627f, -0.014215522f, -0.0031668525f, 0.0049675517f, -0.0078115673f, -0.0027269237f, 0.06124443f, 0.016097326f, -0.021327548f, 0.012253951f, -0.027715104f, -0.012125831f, 0.030732911f, 0.039972752f, -0.003961302f, 0.0007477686f, -0.0024748936f, -0.011504477f, 0.0018762745f, -0.027240753f, -0.017634837f, 0.0125558f, 0.01621797f, 0.0054348153f, -0.0013480157f, 0.0011406188f, 0.00946504f, -0.01612453f, -0.00032209864f, 0.017511059f, -0.019539746f, -0.013530181f, 0.013266731f, 0.008301475f, 0.012361793f, -0.011757009f, 0.0023006953f, 0.015946409f, -0.011052894f, -0.0005682446f, 0.02967239f, 0.019463262f, 0.047679666f, 0.039450694f, -0.027231285f, 0.0072491053f, 0.014529081f, -0.023926007f, 0.0134401135f, 0.07503603f, -0.004920144f, 0.016169557f, 0.010356897f, -0.006460096f, 0.011553628f, 0.037683163f, -0.0065649324f, 0.013467514f, 0.054843977f, 0.0053483592f, -0.019788433f, 0.013513278f, 0.027627932f, -0.02315174f, 0.007116171f, 0.02375847f, -0.019457597f, 0.008551496f, 0.024214229f, -0.0054386742f, -0.004762057f, -0.0073273713f, -0.0016054861f, 0.031849913f, 0.014188774f, -0.011304504f, -0.003956572f, 0.024934817f, 0.0006687463f, 0.006339976f, -0.013031633f, 0.022492295f, 0.01668709f, -0.02837566f, 0.007813857f, 0.042628773f, -0.0039801504f, -0.0077023287f, -0.037679635f, -0.0050726957f, 0.0018827275f, 0.014088643f, -0.00713267f, -0.009053187f, 0.006954976f, 0.0058289f, 0.004330389f, 0.019115942f, 0.005290842f, 0.02313454f, 0.010637428f, -0.013964812f, 0.014579638f, 0.0067336326f, -0.010923489f, 0.014499961f, 0.029983599f, -0.025540985f, 0.03603588f, 0.058980826f, -0.021080414f, 0.0030312715f, 0.06476129f, -0.014586969f, 0.008002263f, 0.023473248f, -0.021418925f, 0.034139853f, 0.0032176734f, -0.01644675f, 0.017237894f, 0.033325706f, 0.005955862f, -0.0017791167f, 0.01819499f, -0.018556613f, 0.009087001f, 0.0632594f, -0.012558011f, -0.008142574f, 0.0080888895f, -0.014352717f, -0.018293025f, -0.016237777f, 0.0066050175f, -0.002853773f, -0.00038146842f, -0.015248003f, 0.0020640236f, -0.00962585f, 0.0100166425f, 0.037762668f, 0.040832043f, -0.020566646f, -0.019002195f, 0.053316474f, -0.00075733656f, 0.0046060234f, 0.034822475f, -0.0016551694f, -0.0048635826f, -0.014603677f, -0.024266932f, -0.012396994f, 0.021870507f, -0.005723107f, -0.0039777025f, 0.008774149f, 0.01097547f, 0.0035369715f, -0.009333916f, -0.013815951f, 0.020348564f, 0.015583822f, -0.00779312f, 0.00286658f, 0.02757364f, 0.013649422f, -0.014449725f, 0.014228532f, 0.031334992f, -0.013540484f, 0.029352415f, 0.060532656f, -0.016342362f, 0.013400318f, 0.018437855f, -0.006054521f, 0.0029799044f, 0.00065270596f, 0.008116539f, 0.003384258f, -0.013879427f, 0.016507039f, -0.0012828794f, -0.0031309074f, -0.016531516f, -0.0008073854f, 0.0011042892f, -0.0030658538f, 0.008255847f, 0.005154244f, -0.013237025f, -0.015432736f, 0.03366261f, -0.014690148f, -0.012306187f, -0.02390927f, -0.027854757f, -0.031334862f, -0.049548477f, -0.0014399763f, -0.017943233f, -0.030211875f, 0.022440368f, -0.0016989894f, -0.009709928f, 0.040039055f, 0.016972665f, 0.024758259f, 0.03573811f, 0.04604908f, 0.047450006f, 0.0071478668f, 0.015795302f, -0.008412767f, -0.007604871f, -0.0040049166f, -0.035359565f, -0.0131848855f, 0.00048064435f, -0.026595477f, -0.004662003f, 0.0025393493f, -0.010882363f, -0.0017298817f, 0.005556116f, -0.025598371f, -0.009531123f, -0.0010633555f, -0.06056766f, 0.0035887926f, 0.004067246f, 0.00816692f, -0.007500492f, -0.0032897461f, -0.0009811549f, 0.009302853f, 0.0029429866f, 0.00026355556f, 0.0028559198f, 0.016840035f, 0.0015021982f, -0.014634314f, -0.019826358f, -0.027261514f, -0.008467878f, -0.013065003f, -0.017825363f, -0.012255978f, -0.0028115057f, 0.00026503473f, -0.004994807f, -0.011984441f, -0.028705835f, 0.00914264f, 0.0066702436f, 0.0038301512f, 0.01860025f, -0.0007260002f, 0.021094052f, -0.030983755f, -0.0071428516f, 0.0446504f, 0.0018506211f, -0.023699153f, 0.0057537938f, 0.026754344f, 0.006868036f, 0.011139244f, 0.0026638247f, 0.015241381f, 0.006982031f, -0.0073264525f, -0.030706007f, -0.008106456f, -0.0003526702f, 0.005467758f, 0.020717327f, 0.011581425f, -0.003786877f, 0.0475156f, 0.00632709f, 0.014892466f, 0.03710034f, -0.0029594272f, 0.009358203f, -0.0006264004f, -0.003559292f, -0.00093837705f, -0.007086718f, -0.011445774f, -0.011704709f, -0.02267941f, -0.006849614f, 0.024364896f, 0.0049773417f, -0.0012332246f, -0.006248642f, -0.0073175277f, 0.0083675245f, -0.008383098f, 0.0113366f, -0.0035543153f, -0.00026535906f, 0.0076752086f, 0.0074212626f, 0.027373435f, 0.046909086f, 0.024617357f, 0.053805567f, 0.06629103f, -0.0106262965f, 0.0023972124f, 0.0008623757f, -0.04724122f, -0.013545513f, -0.0067359083f, -0.00962589f, -0.026078604f, -0.0223852f, 0.0027367703f, 0.0020824617f, 0.018917283f, -0.008711778f, 0.004881374f, 0.0087485295f, 0.016541589f, 0.018076701f, 0.022671742f, 0.013465683f, 0.021400554f, 0.015205839f, -0.008473615f, -0.0055356026f, -0.03206086f, -0.0014536217f, 0.008737831f, -0.017205775f, 0.011069861f, -0.002575175f, 0.017565403f, 4.8665337e-05f, -0.008643023f, 0.042728603f, 0.0104394555f, 0.016439019f, 0.045913644f, -0.00033953984f, 0.0130625935f, 0.0005281689f, -0.010259126f, 0.005838475f, -0.005653357f, -0.015463231f, -0.037717957f, -0.021666424f, 0.020503953f, 0.012639313f, 0.012289604f, 0.012933933f, 0.0031565074f, -0.02602154f, -0.002185104f, 0.012228023f, -0.00081572647f, 0.0040113656f, 0.0033581478f, 0.02187928f, 0.017397378f, 0.016195027f, 0.061097883f, 0.020381978f, 0.051448133f, 0.06717043f, -0.0060927593f, 0.005103244f, -0.0042108763f, 0.020547032f, 0.03371865f, 0.00980369f, -0.0056754756f, -0.02222212f, -0.0015680013f, -0.005310844f, -0.011949332f, 0.011569511f, -0.007736952f, -0.0055512916f, 0.012177188f, -0.0027913912f, 0.023432387f, 0.039462686f, 0.004319196f, 0.003512162f, 0.018202094f, 0.003384322f, 0.0009489446f, 0.007276821f, -0.0043331366f, 0.0101382425f, 0.034628898f, -0.0078100762f, -0.011092001f, 0.01594474f, -0.013446747f, 0.008702417f, -0.007792855f, 0.01644602f, 0.024801444f, 0.045381077f, 0.007884291f, -0.0023301938f, 0.0128318025f, -0.0053184405f, -0.017925072f, -0.013662612f, -0.02095691f, -0.015897071f, -0.012265897f, -0.012881752f, -0.019926518f, -0.021711553f, -0.026126128f, -0.041893315f, -0.05663339f, -0.004848699f, -0.016481841f, -0.0037537843f, 0.03485092f, 0.027166001f, 0.0046237344f, -0.008038372f, 0.012453954f, -0.022940574f, -0.009085037f, -0.0041427272f, -0.0044791712f, 0.0014329588f, -0.0010857532f, 0.017920868f, -0.003915248f, 0.0077620675f, 0.013202142f, -0.006999462f, 0.002358914f, 0.0069370847f, 0.0053447373f, 0.022918155f, 0.006644853f, -0.008467039f, -0.023698797f, -0.0363874f, -0.025865909f, -0.0028336986f, -0.012997253f, -0.011388428f, 0.018219855f, 0.027871165f, 0.033580486f, 0.08094791f, 0.071328044f, -0.02826451f, -0.040489953f, -0.023817152f, -0.002705711f, -0.0056487177f, 0.0049783466f, -0.0004060602f, 0.01365366f, 0.017336862f, 0.008026086f, 0.018679569f, 0.019899672f, 0.006731444f, 0.005667512f, -0.002269145f, -0.017130345f, -0.010465157f, 0.005310435f, 0.012963399f, 0.0019810721f, 0.021511817f, -0.010119324f, -0.009408061f, -5.7707693e-05f, -0.006291428f, -0.006505046f, -0.004173028f, -0.008557783f, -0.010350596f, -0.0026201303f, -0.025842894f, -0.026377324f, -0.00647115f, -0.007711794f, -0.0173943f, -0.008734582f, 0.0066846814f, -0.013874832f, -0.014158377f, -0.009472791f, -0.0068218056f, -0.011532064f, -0.0089588845f, -0.0024988344f, -0.016555136f, -0.0043498664f, -0.003009601f, -0.01881903f, -0.018255277f, -9.703689e-05f, -0.011347574f, -0.006007646f, 0.009407465f, -0.01059844f, -0.019311657f, -0.012726612f, -0.022902416f, 0.010165961f, 0.009055397f, 0.012116587f, 0.009547091f, 0.011174402f, 0.011395394f, 0.015970828f, 0.011223987f, 0.0008766248f, -0.008061198f, 0.015226482f, -0.0059905066f, -0.0012676298f, 0.006335619f, -0.011685758f, -0.00059680716f, -0.0066045364f, -0.02117787f, 0.0049838233f, 0.0067441356f, -0.005441418f, 0.0021200557f, -0.00014854071f, 0.00072607165f, 0.004554236f, -0.008786828f, -0.014140075f, 0.027703525f, 0.013355749f, 0.014079094f, 0.0166544f, 0.011451549f, 0.024968559f, 0.016635198f, 0.0032071779f, 0.018381633f, 0.006405545f, 0.012842777f, 0.007818559f, 0.016263869f, 0.010660132f, 0.016845584f, 0.016128492f, 0.009244743f, 0.015278616f, -0.024009682f, -0.012910425f, 0.0005538914f, -0.023787105f, -0.02068065f, -0.0029555075f, -0.0040560067f, -0.009254217f, 0.0047209137f, -0.005084029f, -0.0028892253f, -0.0039949077f, -0.0041799624f, 0.0046237297f, -0.000680301f, -0.0014421836f, -0.00040552882f, 0.0035801039f, -0.01008748f, -0.0041578645f, -0.007523338f, -0.002424287f, -0.007325339f, -0.0032474073f, -0.0088518895f, -0.02011838f, -0.004171588f, -0.022696927f, -0.023467103f, -0.017514667f, -0.028303994f, -0.015638513f, -0.010642494f, -0.031577896f, -0.027378824f, -0.018085318f, 0.015489586f, 0.004438644f, 0.0034603702f, 0.01737456f, 0.011815563f, 0.014835594f, 0.012304382f, -2.5510091e-05f, 0.005562151f, 0.0018262297f, -0.0018785355f, 0.0009535723f, -0.003091238f, -0.010467023f, -0.008566017f, 0.0015067867f, -0.009571985f, -0.004884724f, -0.002669959f, 0.0031313424f, -0.001685401f, -0.004324048f, 0.0019196592f, -0.008058483f, 0.0032407474f, -0.00827786f, -0.0050488515f, -0.0071469974f, -0.018644428f, -0.0085718f, -0.008175555f, 0.0039189397f, 0.0038352623f, -0.01426248f, -0.0055333124f, -0.0017764809f, 0.023075439f, 0.011782374f, 0.013995606f, 0.015453021f, 0.011233259f, 0.01590173f, 0.0051796245f, 0.011143343f, 0.0043440657f, -0.0072359648f, 0.00646383f, -0.0038362327f, 0.004942989f, 0.008868815f, 0.005002094f, 0.0016849415f, -0.0005699319f, -0.0007365506f, -0.019489327f, -0.029228296f, -0.00797339f, -0.02686123f, -0.011449939f, -0.010619777f, -0.02266403f, -0.033626422f, -0.025723642f, -0.0069857924f, -0.005835745f, 0.002031745f, -0.0013994708f, 0.0013645646f, 0.00084604946f, -0.009127353f, 0.002408772f, 0.008200438f, -0.0071099713f, -0.008158427f, -0.0040453854f, -0.01579231f, -0.007631245f, -0.011848969f, -0.017359123f, -0.020168066f, -0.015974369f, -0.012843509f, -0.008425531f, -0.006173328f, -0.013646903f, -0.011075129f, -0.010161784f, -0.013561608f, -0.029982245f, -0.016343841f, -0.0130491955f, -0.011164978f, -0.005957128f, -0.00645881f, -0.0019394393f, -0.010056073f, -0.01571675f, -0.019015279f, -0.016366549f, -0.015282198f, -0.0063395747f, -0.0052273595f, -0.010101711f, -0.0067136306f, -0.006870769f, -0.0056506027f, -0.017578237f, -0.0071871364f, -0.014609224f, -0.02003616f, -0.007858225f, 0.007671112f, 8.853396e-05f, 0.0062699653f, -0.011203288f, 0.0008119767f, 0.0014722056f, -0.006930101f, 0.00011434887f, -0.005098278f, -0.0052999225f, -0.00058213057f, -0.0026137119f, -0.0004640307f, 0.0037482833f, -0.0036232986f, -0.009374892f, 0.002393833f, 0.0007960044f, -0.012583437f, -0.0104490435f, -0.0041585537f, -0.016580459f, -0.026512863f, -0.015320276f, -0.000875109f, -0.00040817866f, -0.0019031225f, 0.0071139093f, 0.009634596f, -0.002178817f, -0.0020541202f, 0.002916895f, -0.0016720359f, -0.004114859f, 0.010979963f, 0.0046871505f, 0.014781375f, 0.012656952f, 0.012350109f, -0.0043616365f, 0.009148841f, 0.0072294483f, -0.0015720944f, -0.006783173f, -0.00689391f, -0.008416863f, -0.00314006f, 0.0049087107f, -0.0032743744f, -0.009313074f, 0.001904131f, -0.009394665f, 0.00163284f, 0.0077252965f, -0.0038286382f, -0.0036257484f, 0.008547798f, 0.0046192184f, 9.004117e-05f, 0.0041442034f, -0.016449282f, 1.7721444e-05f, -0.0028494897f, -0.012853354f, -0.00895709f, -0.005916344f, -0.01930732f, -0.010855016f, -0.0049554748f, 0.010106028f, 0.012946856f, 0.0010287396f, 0.024970952f, 0.03386918f, 0.022323884f, 0.0042834706f, 0.017454702f, 0.009849815f, -0.024100743f, -0.015951907f, -0.010900419f, -0.0066097076f, -0.0012667032f, -0.016135188f, -0.007822859f, -0.015326722f, -0.015948234f, -0.031740382f, -0.029610531f, -0.023090536f, -0.0019472347f, -0.0032559494f, -0.0105645675f, -0.0145788705f, -0.013879277f, -0.016053127f, -0.00048265254f, -0.0030337179f, -0.0028834904f, 0.0045860456f, 0.011114076f, 0.0029971604f, 0.015267029f, 0.011710168f, 0.006936308f, -0.05063135f, -0.03967064f, -0.052493554f, -0.01502544f, -0.017176246f, -0.02385071f, -0.021502346f, -0.012383128f, -0.03525961f, -0.011284445f, -0.018193973f, -0.0067702997f, 0.00020297471f, -0.015410785f, -0.012150643f, -0.013217011f, -0.010035893f, -0.015374924f, 0.012680936f, 0.016420085f, 0.012507918f, 0.02669922f, 0.018333554f, 0.014132392f, 0.035956714f, 0.027910562f, 0.025352284f, 0.02262041f, 0.011697965f, 0.011764345f, 0.009294866f, 0.020645563f, 0.011458843f, 0.025462804f, 0.020303335f, 0.0024112181f, 0.004610024f, 0.0067608478f, 0.014446656f, -0.006757269f, -0.004313001f, 0.018073602f, 0.0014687192f, 0.0026690508f, 0.0073135793f, -0.007689793f, -0.004024808f, 0.007333753f, 0.0033798376f, -0.005983495f, 0.0059269555f, 0.002790237f, 0.0048608743f, 0.0045068976f, -0.0050255824f, -0.005363938f, -0.014888177f, -0.006898195f, -5.859477e-05f, -0.005759754f, -0.0077664824f, -0.013221548f, -0.010594126f, 0.0030507324f, 0.0088714035f, 0.01133526f, 0.0011154138f, 0.0015921568f, 0.0023966336f, -0.009771132f, -0.0065487707f, -0.01081967f, 0.010864664f, -0.0034403463f, 0.0022959893f, 0.011408281f, 0.0077173896f, 0.009726968f, 0.017826766f, 0.019412894f, 0.011966465f, 0.0028830932f, 0.007373336f, -0.009151662f, -0.003720678f, -0.0033110774f, -0.017504496f, -0.011068818f, -0.015647875f, -0.015355824f, -0.01211118f, -0.015452242f, -0.024096617f, -0.0068955733f, -0.0071461857f, -0.018963555f, -0.018816017f, -0.003696355f, -0.0143733835f, 0.013246025f, 0.01374355f, 0.020375738f, 0.025444817f, 0.036524724f, 0.03535125f, 0.022279846f, 0.018251328f, 0.017696913f, 0.017851524f, 0.009254071f, 0.014053082f, 0.020477695f, 0.020371705f, 0.026635617f, 0.02366322f, 0.021103112f, 0.02510994f, -0.010495079f, -0.022338497f, -0.00905881f, -0.0048601246f, -0.0025523438f, -0.0065557016f, -0.01767142f, -0.020462638f, -0.017188532f, 0.010482865f, 0.01883804f, 0.0066251378f, 0.009474988f, 0.013667997f, 0.007693044f, 0.0002657366f, -0.0059150695f, -0.012281267f, 0.0037611045f, 0.012613709f, -0.0054113586f, 0.008743326f, 0.019619549f, 0.010618115f, 0.0015207763f, 0.015250881f, 0.019023621f, 0.006300695f, -0.0015847158f, -0.003617046f, 0.007814869f, 0.007497361f, -0.0067991912f, -0.010067333f, -0.005405202f, -0.017082639f, 0.008910293f, 0.007853421f, 0.0009816514f, 0.0025101255f, 0.004325062f, -0.003425668f, -0.0041775885f, -0.013332076f, -0.014076823f, -0.007373064f, -0.0073613846f, -0.006454815f, -0.008859911f, -0.017235095f, -0.017050488f, -0.008233548f, -0.014566546f, -0.008479613f, -0.01621485f, -0.012744953f, -0.009509956f, 0.0032928493f, 0.00422663f, -0.0044407533f, -0.000822569f, -0.006801948f, -0.011341807f, -0.00050135603f, -0.0044597476f, -0.00030764294f, 0.029015427f, 0.033416368f, 0.029333772f, 0.009305931f, 0.0112895295f, 0.013128738f, 0.0007582972f, 0.0023500188f, -0.0046409946f, -0.0029402033f, -0.010341821f, -0.0076208985f, -0.016839763f, -0.009902416f, -0.018255012f, -0.004729503f, -0.0050616288f, -0.009239673f, -0.01253925f, -0.017419996f, -0.031733785f, -0.01357866f, -0.025755186f, -0.028522972f, -0.005410333f, -0.013860096f, -0.008715244f, -0.0010506251f, -0.0021227358f, -0.009054292f, -0.005457351f, -0.0044364408f, -0.0022076063f, 0.028194368f, 0.028450886f, 0.022531953f, 0.02784436f, 0.019446872f, 0.026531545f, 0.026220158f, 0.014149153f, 0.011191482f, 0.01485826f, 0.0110365655f, 0.0035177288f, 0.021237982f, 0.022642916f, 0.018342456f, 0.01424862f, 0.008498187f, 0.0113134375f, -0.023387471f, -0.008260155f, -0.013291933f, -0.020265104f, -0.005733944f, -0.014947398f, -0.011502635f, 0.00036955308f, -0.005446452f, -0.001986141f, 0.00843988f, -0.004209397f, -0.02497805f, -0.008808888f, -0.01756524f, -0.019209864f, -0.025064396f, -0.015925478f, -0.006203528f, 0.009047536f, -0.008039809f, -0.0026358794f, -0.01114775f, -0.0009170681f, 0.02682167f, 0.026408538f, 0.017463194f, -0.0029833212f, -0.0009290344f, 0.014137839f, -0.030614622f, -0.0048650205f, -0.0024435907f, -0.019880138f, -0.024416521f, -0.0065951594f, 0.026401848f, 0.02284001f, 0.036076475f, -0.0070924917f, 0.011916814f, 0.008737618f, -0.0205239f, -0.006787723f, -0.0040261806f, -0.015549865f, -0.009636372f, -0.026037365f, -0.018988494f, -0.024060175f, -0.015157592f, -0.01746755f, -0.016545577f, -0.019042853f, 0.05216612f, 0.04419912f, 0.03974741f, -0.02480599f, 0.024790619f, 0.00890736f, -0.020747658f, -0.0030872195f, 0.000634332f, -0.004658693f, 0.0055763517f, 0.007730908f, -0.022120435f, -0.02011149f, -0.006262004f, -0.015509193f, -0.013696328f, -0.018283172f, 0.0012840651f, -0.0049524694f, -0.013318414f, -0.007516397f, -0.006954169f, -0.01849485f, -0.002825339f, -0.007815546f, -0.012606664f, 0.008918082f, -0.008687266f, -0.009670886f, -0.01471318f, -0.027199645f, -0.040131282f, -0.010776714f, -0.022030912f, -0.032317355f, -0.011505492f, -0.028772969f, -0.017858768f, -0.025209762f, -0.024736086f, -0.026278805f, -0.013706668f, -0.0125130685f, -0.007951827f, 0.003705566f, 0.006848629f, -0.0024303799f, 0.004078863f, 0.01472384f, 0.006284699f, 0.0023378748f, -0.00016132268f, 0.004489362f, -0.007589561f, 0.020987632f, -0.008922074f, -0.01806897f, -0.009768905f, -0.012750342f, -0.006112748f, -0.030643156f, -0.032324504f, -0.02651826f, -0.02937935f, -0.028141782f, -0.009071375f, -0.0030078967f, -0.0014846598f, 0.011290437f, 0.013522858f, 0.004922382f, -0.010951507f, -0.009891542f, -0.0040790346f, 0.0075475196f, 0.00019816823f, -0.013023504f, -0.014492951f, -0.009303977f, -0.012369885f, -0.02890162f, -0.0075050867f, -0.008410089f, -0.03648855f, -0.017402656f, -0.011558628f, -0.021185404f, -0.012519463f, 0.004194705f, 0.013377953f, 0.020210672f, 0.015993068f, -0.026863113f, -0.019855462f, 0.0038265577f, -0.047448978f, -0.033604f, -0.025535585f, -0.016918527f, -0.006599817f, -0.009402068f, 0.018478306f, -0.00803252f, -0.009987441f, 0.010259234f, 0.0012808653f, -0.010169346f, 0.025314726f, 2.6859168e-05f, 0.023364061f, -0.010346875f, -0.0009529144f, -0.0043169064f, -0.011104485f, -0.0164239f, -0.01508933f, -0.0078709535f, 0.018553915f, 0.016481834f, -0.035917625f, -0.0038295272f, -0.02856005f, -0.024681928f, -0.0334209f, -0.023098204f, -0.015487651f, -0.0065231416f, -0.02281195f, 0.010914691f, -0.0070709535f, -0.008072409f, 0.03460144f, 0.016015528f, 0.0026194646f, 0.011938252f, 0.031248689f, 0.020273337f, 0.0056150863f, -0.005515915f, -0.008552627f, 0.006359235f, -0.004483693f, 0.0030263185f, -0.04011405f, -0.016669381f, -0.00982362f, -0.028646087f, -0.026993332f, -0.013583379f, -0.02460882f, -0.019340117f, -0.012703186f, -0.016027521f, -0.009752409f, -0.0005463245f, -0.024419092f, -0.0061078053f, -0.0035072088f, -0.006818945f, -0.0051857852f, -0.0122673735f, -0.019468075f, -0.010855445f, -0.008485074f, -0.013073869f, -0.0140090855f, -0.019102411f, -0.009582584f, -0.019441988f, -0.017027542f, 0.016730497f, 0.002346318f, 0.017035743f, -0.008944225f, -0.0013819828f, 0.0014503921f, -0.016552841f, -0.009337149f, -2.3376024e-05f, -0.016765203f, 0.017370934f, 0.0024724645f, 0.018444587f, 0.0048185713f, 0.015665151f, -0.007005619f, -0.010574338f, -0.0020571817f, 0.0025891403f, 0.017535245f, 0.012596523f, -0.04042287f, -0.006920705f, -0.02646436f, -0.015858658f, -0.027385127f, -0.022836303f, -0.013240931f, -0.024501089f, -0.02304722f, -0.035007928f, -0.02913861f, -0.021420134f, -0.01209837f, -0.010995664f, -0.026846154f, 0.004841269f, 0.03706227f, 0.037821237f, 0.0067901346f, 0.021945287f, -0.003852563f, -0.008397131f, -0.018354747f, -0.029532438f, 0.022011502f, -0.003926459f, -0.01328742f, -0.014514615f, -0.012934498f, -0.030573584f, -0.007696688f, -0.01732008f, -0.028431952f, -0.017062543f, -0.009764728f, -0.022240333f, -0.0054089627f, 0.0026493073f, -0.0016846147f, 0.0027034818f, 0.0017745352f, -0.010769575f, -0.015358996f, -0.022618735f, -0.043909725f, -0.02737983f, -0.033417463f, -0.049744833f, -0.0029204625f, -0.021440022f, -0.011368075f, -0.013134125f, -0.0023500957f, -0.019182086f, -0.019605426f, -0.017442748f, -0.01707134f, -0.023529943f, -0.039031353f, -0.029282387f, -0.003087111f, -0.02011311f, 0.0011304133f, -0.024283417f, -0.022413788f, 0.0036064237f, 0.018910645f, 0.028849017f, 0.019296603f, 0.0010022183f, -0.0017543067f, -0.014726931f, -0.017284682f, -0.015066546f, -0.016789062f, -0.011459018f, -0.018652288f, 0.0069419104f, 0.00023940996f, -0.0027933987f, -0.0101581f, -0.009582116f, -0.008972671f, -0.032805134f, -0.0031340022f, -0.02195895f, -0.011359998f, 0.01656509f, -0.00059288257f, -0.0082670655f, 0.004648797f, 0.0072667287f, -0.0010773442f, -0.019315677f, -0.007262951f, -0.019937802f, 0.007661018f, 0.012347442f, -0.01565669f, -0.022715658f, -0.011644289f, -0.021230655f, -0.00839609f, -0.0036347616f, -0.026695441f, 0.002649159f, 0.00050681346f, 0.008984745f, -0.018564172f, -0.018607995f, -0.0042690714f, 0.015213773f, -0.0061620087f, 0.019721227f, 0.028140716f, 0.015873116f, 0.0056034774f, 0.02725701f, 0.013540103f, 0.0020732472f, 0.0014777677f, 0.0057956968f, -0.0008376138f, -0.012503918f, -0.01576047f, -0.021409063f, 0.018691702f, 0.012648029f, -0.0073307715f, -0.0061119446f, -0.028727867f, 0.0018267039f, -0.015975825f, -0.016924787f, -0.032642163f, -0.019552168f, -0.021379698f, -0.031936444f, 0.004092365f, -0.0118015595f, -0.022306766f, -0.005552524f, 0.0043567205f, 0.010958941f, 0.01721789f, 0.023392886f, 0.017138788f, 0.010933706f, 0.011523927f, 0.012403592f, -0.02214292f, -0.013685282f, 0.011413243f, -0.017261203f, -0.011456458f, 0.0073217517f, -0.01682208f, -0.021109208f, 0.020323077f, -0.0026010086f, -0.0114122145f, -0.0028891913f, -0.012829402f, -0.02174061f, 0.022642642f, -0.013039971f, -0.004982953f, 0.016079957f, 0.020444814f, 0.014223205f, 0.018808037f, 0.019712169f, 0.015826458f, 0.013316878f, 0.015816258f, 0.010443034f, 0.013029945f, -0.012547489f, -0.013851771f, -0.00029450151f, -0.021075938f, -0.027100323f, -0.00881758f, -0.019401576f, -0.007598968f, 0.013829453f, 0.0051470827f, 0.012796045f, 0.0005143892f, -0.021269703f, -0.027865073f, -0.008402679f, 0.010737215f, -0.0051151672f, 0.032169066f, 0.0037452031f, -0.0002840408f, 0.016030818f, -0.02105509f, -0.012921477f, -0.0033686156f, -0.0013664035f, 0.011847403f, 0.004678057f, 0.008139733f, 0.005082912f, 0.016620426f, 0.021385042f, 0.024771182f, 0.017107917f, 0.012314721f, 0.021442698f, 0.0014202683f, -0.0050914665f, -0.0016849389f, -0.019336246f, -0.011719184f, -0.013334134f, 0.0029800101f, 0.008112752f, 0.0027897076f, 0.011200535f, -0.022852132f, -0.020858072f, -0.0092044035f, -0.018487137f, -0.017517745f, -0.013082055f, -0.00966742f, -0.0033825038f, 0.0003916561f, -0.007253204f, 0.011955536f, 0.05469526f, 0.024337962f, 0.03841205f, 0.06536236f, 0.00559255f, 0.048963826f, 0.050795596f, -0.008241013f, -0.00942586f, -0.0028555251f, -0.022205045f, -0.015405308f, 0.0085999975f, -0.018593175f, -0.024578357f, 0.0029188008f, -0.005499202f, -0.009636795f, -0.013455701f, -0.026716089f, -0.037786387f, -0.027179383f, -0.0074043837f, -0.04707896f, -0.013244852f, -0.026037993f, -0.007860787f, 0.004034296f, -0.019828886f, -0.011011869f, 0.01786427f, -0.0010196504f, -0.00051300944f, 0.02111376f, -0.006683007f, -0.0049595777f, -0.01737539f, -0.023219643f, 0.0035291791f, -0.028430719f, -0.008156284f, -0.0044683735f, -0.005901122f, 0.011927831f, 0.0023908557f, -0.0048052804f, -0.0060344776f, 0.014510719f, 0.009633683f, 0.010325698f, 0.03254527f, 0.02496312f, -0.02206225f, 0.0024067143f, 0.003628658f, -0.030196218f, -0.032317538f, -0.0035039175f, 0.01648252f, 0.0029739465f, 0.012216723f, 0.001522162f, -0.0076864953f, -0.010138404f, -0.0131347f, -0.01812293f, -0.005461238f, -0.012924027f, -0.014320657f, 0.010073609f, -0.0031969128f, 0.007763155f, 0.008100928f, -0.00075276557f, 0.019061202f, 0.0035556643f, 0.01395997f, 0.02204439f, 0.019348236f, -0.047865648f, -0.03264441f, -0.021422468f, 0.018442757f, 0.017095994f, -0.011649079f, -0.002288008f, 0.019925257f, -0.0066470923f, -0.0033737142f, -0.020102592f, 0.0103656305f, -0.0023569283f, -0.0127822645f, 0.01632562f, -0.0023979456f, 0.00016190174f, 0.0057125036f, 0.008251893f, -0.0029857967f, -0.010367191f, -0.008846164f, -0.0038041247f, -0.01341024f, -0.0002758216f, -0.01840635f, -0.0046682465f, -0.046417948f, -0.047943823f, -0.002879663f, -0.019526077f, -0.004949587f, -0.010164866f, 0.02075326f, -0.010487678f, 0.005736375f, 0.028694319f, 0.047837205f, -0.031058429f, 0.01590716f, 0.0624816f, -0.024139334f, 0.045919318f, 0.06564644f, -0.030583382f, -0.004680318f, -0.010976472f, 0.013021706f, 0.0009842792f, 0.0031219164f, 0.00719524f, -0.001436628f, 0.001958722f, -0.021334505f, -0.015371211f, -0.031123426f, -0.009496867f, -0.0012096928f, 0.008031153f, 0.008410701f, -0.030294709f, -0.005789568f, -0.023164874f, 0.015657822f, 0.000626947f, 0.033874817f, 0.012826684f, -0.0053382837f, 0.0056086564f, 0.022785177f, 0.015305631f, 0.020851582f, 0.027224695f, 0.003919143f, 0.019348126f, 0.035663217f, -0.001076036f, 0.054070193f, 0.05173957f, 0.04282653f, 0.019557891f, 0.0038611665f, -0.018477276f, 0.011937041f, 0.015001561f, 0.07089281f, -0.0124122705f, 0.025251282f, 0.0072109783f, -0.011685064f, 0.012748179f, -0.02729205f, 0.04733852f, 0.001095304f, -0.049292393f, 0.05744046f, 0.03996523f, -0.034051806f, 0.012010491f, -0.0061250366f, -0.06981496f, 0.03537852f, -0.0055869217f, -0.009805489f, 0.0036890157f, -0.023763357f, -0.04836401f, 0.013633278f, 0.026460642f, -0.0020685222f, 0.067132555f, 0.021497637f, -0.011429031f, 0.06598116f, -0.00051092997f, -0.02299146f, 0.042079806f, -0.01652896f, -0.010749874f, 0.010380851f, -0.016326971f, 0.0008739777f, 0.010911343f, -0.055188578f, -0.0162347f, -0.018003408f, -0.013443512f, 0.033724945f, 0.0077307587f, 0.0065932386f, -0.02145254f, -0.018850194f, 0.017692275f, 0.06971362f, 0.045037746f, 0.0041833236f, 0.023163764f, 0.013316816f, 0.0021304972f, 0.046363242f, 0.018131355f, -0.0019598803f, 0.042002928f, 0.03060714f, 0.005085824f, -0.027185908f, 0.00806125f, -0.0008540612f, -0.025323857f, 0.00951582f, -0.0067061186f, -0.007275271f, 0.0007730939f, -0.012375069f, -0.0052901553f, 0.008980388f, -0.004472067f, 0.00931857f, 0.027529206f, -0.0055935183f, 0.0108332625f, 0.0010849712f, -0.012747788f, 0.026154919f, -0.0031700588f, -0.0020233088f, 0.0022985986f, -0.05199485f, 0.01755707f, 0.054674514f, 0.040313184f, 0.0029405558f, 0.033772323f, 0.051667668f, -0.0063965204f, -0.014035909f, 0.04351758f, -0.022945492f, 0.0069819847f, 0.0358015f, -0.011579519f, -0.01721841f, 0.0020635219f, -0.010370403f, -0.0014936012f, 0.00084963563f, -0.013955318f, -0.022686379f, -0.0048928554f, 0.021124726f, -0.0013670829f, 0.008339905f, 0.004342692f, -0.023488302f, 0.013837734f, -0.006359258f, 0.011795511f, 0.017605709f, 0.00030322518f, 0.033195607f, 0.0077903736f, -0.022013053f, 0.020142706f, 0.04004098f, -0.02305177f, 0.009253164f, 0.023198623f, 0.009136935f, 0.03561067f, -0.014588222f, 0.010983304f, 0.05124485f, -0.00521226f, 0.010255046f, 0.025024366f, -0.0051637148f, 0.008825462f, 0.027478866f, 0.023833262f, 0.0045989137f, 0.026711758f, 0.006379948f, 0.017005986f, 0.032356825f, 0.018065972f, 0.018047443f, 0.019893542f, 0.038905572f, -0.008761603f, 0.017734969f, 0.008129487f, -0.013021193f, -0.0051311357f, 0.027943566f, -0.0070610163f, 0.027639797f, 0.010882423f, -0.023820026f, 0.059608724f, -0.0089353025f, -0.0048733847f, 0.05635571f, 0.013558626f, -0.012294486f, -0.013773335f, 0.024711488f, 0.0045800135f, -0.01800849f, 0.014224292f, 0.0165217f, -0.005655287f, 0.00088459626f, 0.008118699f, -0.008600406f, -0.069485165f, -0.016644105f, -0.04430878f, -0.06618513f, -0.014666355f, -0.019509012f, -0.03037237f, 0.026308117f, 0.014536651f, -0.012348427f, -0.01271032f, 0.000350601f, -0.03107383f, 0.015479631f, 0.0046807257f, 0.04138881f, -0.01960701f, -0.02389828f, 0.01253833f, 0.004474617f, 0.017764334f, -0.019293016f, -0.018819526f, 0.00015132234f, -0.018617956f, -0.009078695f, -0.007592808f, -0.030298699f, -0.01425037f, -0.018083956f, -0.020357082f, -0.024579886f, -0.015155808f, -0.023691045f, -0.038105596f, -0.022252576f, -0.0042657647f, 0.025381727f, -0.052650914f, -0.023043407f, -0.02187419f, -0.070005804f, -0.01748541f, -0.0113665415f, 0.020417223f, -0.0010598054f, -0.025667967f, 0.03196996f, -0.0038646895f, -0.013724433f, 0.023733094f, 0.021677684f, -0.019263854f, -0.06024025f, -0.03177376f, -0.02856179f, -0.019142812f, -0.012964316f, -0.019665902f, -0.050157897f, -0.015381303f, -0.013186887f, -0.019803543f, -0.01481971f, -0.015297049f, -0.00705347f, 0.0035378458f, -0.015719341f, -0.001443151f, -0.0036239359f, 0.0049814736f, 0.0037096562f, 0.027917966f, -0.01664317f, -0.022740452f, -0.027678424f, -0.025561156f, -0.03560471f, -0.023395209f, -0.0049393745f, -0.013271812f, -0.014692207f, -0.013841294f, -0.0046861176f, -0.013043738f, -0.015441748f, 0.0012241744f, -0.0013222394f, -0.004013022f, -0.008738087f, -0.010723741f, -0.011412414f, -0.014745553f, -0.015543678f, -0.015396842f, -0.00022542641f, -0.006113282f, 0.0054328926f, -0.0114527885f, -0.0019127809f, 0.014128027f, 0.008956074f, 0.0036126794f, 0.017901814f, 0.009029081f, 0.0055991467f, 0.0035699017f, 0.0023686131f, -0.019917201f, -0.0031615868f, -0.0020947875f, 0.0010580064f, -0.009359121f, -0.00452391f, -0.006959367f, -0.0011356515f, -0.0140038505f, -0.0011410333f, -0.007820727f, -0.0037583134f, -0.008277011f, -0.0063826754f, 0.0072815097f, 0.005957802f, 0.008918616f, 0.0061088013f, -0.0055691907f, 0.024014378f, 0.009391737f, 0.0010323399f, 0.033998862f, 0.016222414f, 0.0051849615f, -0.0058264364f, -0.01868691f, -0.005531603f, 0.002522262f, 5.1788335e-05f, 0.0029356754f, 0.0063702585f, 0.018137628f, 0.017416313f, 0.0022688163f, -0.0069965497f, -0.0037253094f, -0.012008823f, -0.01154588f, 0.0099284025f, -0.0062564267f, -0.0019065326f, 0.003993902f, 0.0017936742f, 0.003001515f, 0.0017406341f, -0.0020467683f, -0.014009656f, -0.008370569f, -0.007515088f, -0.0063611018f, 0.00019694502f, -0.004601262f, -0.009894688f, 0.008022173f, -0.0031201064f, -0.008231084f, -0.011195105f, -0.015183984f, -0.00422451f, 0.011599415f, -0.0005462574f, -0.00467708f, 0.009025534f, -0.016936248f, -0.023953201f, -0.028145196f, -0.015673969f, -0.031876218f, -0.009480261f, -0.0022443258f, -0.01851241f, -0.011119963f, 0.012872307f, 0.0099107465f, 0.006998185f, 0.021940935f, 0.008254395f, -0.0029017397f, -0.009205802f, -0.014873942f, -0.0042321943f, -0.012335874f, -0.019317545f, -0.0137836635f, -0.013961567f, -0.010937545f, -0.001042559f, -0.010016687f, -0.0030110586f, -0.008329043f, -0.015188128f, -0.009378644f, -0.0023659754f, -0.005632282f, 0.015385595f, 0.007730809f, 0.007851813f, 0.010715054f, 0.022300504f, -0.008816645f, -0.004326247f, 0.0072015915f, -0.01565833f, -0.008486837f, -0.0012687949f, 0.004415115f, -0.0055561815f, -0.014617688f, 0.013880448f, 0.0035260732f, -0.000489511f, 0.011693237f, 0.004113426f, -0.0039996495f, -0.0045639095f, -0.0038019395f, -0.015379342f, -0.009697053f, -0.0029431279f, -0.00092671794f, 0.0032099206f, 0.0021130496f, -0.006721648f, -0.004904585f, 0.0090910755f, 0.02804035f, -0.0057253195f, -0.0070231333f, -0.0152156055f, -0.02085637f, -0.01436922f, -0.00830905f, 0.0059668454f, 0.0018238301f, 0.0011318452f, -0.006462259f, -0.0073741493f, -0.007979423f, -0.024237715f, 0.0011883614f, 0.0041453145f, 0.0044461833f, -0.0065374156f, -0.009393108f, -0.005135151f, -0.02184161f, -0.010828873f, -0.014664471f, -0.01962782f, -0.010554589f, -0.0072757304f, 1.3654768e-05f, -0.0010775317f, -0.01897467f, -0.032193795f, -0.0034037689f, -0.01335596f, -0.0060708555f, -0.001504874f, -0.011316623f, -0.013627061f, -0.00024803355f, -0.014000265f, -0.020550193f, -0.020174572f, -0.018484684f, -0.017973704f, -0.006798165f, -0.00050953444f, -0.00021911798f, -0.0070878216f, -0.013530072f, -0.0037786625f, -0.014178285f, -0.01598503f, -0.00771823f, -0.008231031f, 0.008976511f, 0.0025791065f, 0.018094089f, -0.016961655f, -0.015863938f, 0.0013895786f, -0.012726719f, -0.005337951f, -0.003052524f, 0.00010651731f, -0.012877315f, 0.0031297074f, -0.019179704f, -0.0075829136f, -0.013216814f, -0.0011792077f, 0.013027088f, 0.03936806f, -0.0054619955f, -0.01108776f, -0.0007038247f, -0.029279912f, -0.02167372f, -0.016476657f, -0.015214598f, 0.002528804f, -0.0039267903f, -0.0038410283f, -0.00032009673f, -0.00958389f, -0.009703079f, -0.008527171f, -0.0033551506f, -0.003843444f, 0.005243322f, 0.0021718494f, 0.0030690557f, -0.0066485615f, -0.0011550192f, -0.019050023f, -0.020125957f, -0.0143067725f, -0.010750799f, 0.015181835f, 0.008395262f, 0.00682166f, 0.0075964476f, 0.013021027f, -0.011205321f, -0.008035214f, 0.00088813016f, -0.017635496f, -0.017831879f, -0.0026353695f, -0.008958976f, -0.023180267f, -0.0085284915f, -0.005391429f, -0.0041981484f, -0.00602875f, 0.016764736f, 0.004698156f, 0.0027250368f, -0.0018206866f, -0.0101472f, -0.021859465f, -0.012067128f, -0.0023698208f, -0.023310728f, -0.009267043f, 0.005049658f, 0.0025280514f, -0.0026244167f, 0.018314715f, -0.01035326f, 0.000997464f, 0.013559715f, 0.027455961f, 0.011462659f, 0.0067336517f, 0.008415932f, 0.0043503535f, 0.00019468476f, -0.008304651f, 0.0017826646f, 0.016148034f, -0.0159968f, 0.003440806f, 0.01664743f, 0.0035121292f, 0.0044732117f, 0.0071861255f, -0.012896959f, 0.020822655f, 0.014554621f, -0.0008573318f, -0.011358493f, 0.0042358227f, -0.010167685f, -0.0031393373f, 0.005068911f, -0.0031957f, 0.0077968817f, 0.011378357f, -0.004546425f, 0.009278282f, 0.0009430446f, 0.0016571265f, 0.016945018f, 0.0033919895f, -0.015585214f, -0.011440706f, -0.017546168f, -0.002242463f, -0.0077170455f, 0.011102464f, 0.008323394f, 0.009847594f, 0.015000716f, -0.007544016f, 0.019377114f, 0.027715445f, -0.014031711f, 0.009920867f, 0.0065736f, 0.0038578643f, -0.0050219893f, -0.0038058585f, -0.010741903f, -0.00688362f, -0.017230686f, -0.004250239f, -0.0070973616f, -0.011182172f, -0.002294783f, 0.0058312896f, -0.0023407033f, 0.003244757f, 0.0029090391f, 0.0051213456f, -0.0028107173f, 0.01456905f, 0.0015081723f, 0.0030066485f, 0.0087924255f, -0.0030536328f, -0.0043026768f, -0.010131774f, -0.023370083f, 0.012027597f, -0.01625656f, 0.0057089217f, 0.005763521f, -0.008154225f, -0.0003049332f, 0.011549213f, -0.0027419194f, 0.0118844f, 0.015564727f, -0.00474755f, 0.007305593f, 0.007395545f, 0.004157624f, 0.0047767f, 0.0038701908f, 0.01578771f, 0.017674113f, -0.014847855f, 0.011898119f, 0.017088626f, 0.017285127f, -0.008613405f, 0.009202451f, -0.0027154905f, -0.012810842f, 0.007183841f, 0.022014342f, 0.0001841929f, 0.010457057f, 0.008198321f, -0.0022112373f, -0.0034145287f, -0.01062596f, -0.00808946f, -0.008208029f, -0.009488297f, 0.0037071994f, -0.010819314f, -0.009799961f, 0.0015433135f, 0.012631178f, -0.019314077f, 0.006663728f, 0.01850767f, 0.0010519183f, -0.002486191f, 0.005723152f, 0.00374919f, 0.015209498f, 0.00748417f, -0.019898903f, 0.015272386f, 0.017653361f, -0.022802139f, 0.009635058f, 0.013437718f, 0.009556446f, -0.00044452382f, -0.003648762f, 0.0043359064f, 0.008108128f, -0.019768776f, 0.008665079f, -0.008004261f, 0.004506507f, 0.015849115f, -0.012677767f, -0.0012441553f, 0.0055752997f, 0.0052577043f, 0.0074619753f, -0.012654467f, 0.007566198f, 0.0046754475f, -0.0071919616f, 0.008740148f, 0.016199589f, 0.0011871952f, -0.00082439353f, 0.015659753f, 0.0033636778f, -0.008058463f, 0.022672556f, 0.014178104f, 0.0008000081f, 0.009900049f, 0.010781753f, 0.006631247f, 0.005055825f, 0.03320177f, 0.0052070916f, 0.0057794377f, 0.00149144f, -0.020303544f, -0.008635374f, -0.006565033f, 0.0028123f, 0.008441315f, -0.00331042f, 0.005077632f, 0.0029221284f, 0.0015397943f, 0.010946979f, 0.014419669f, 0.0058354037f, 0.0056616934f, 0.021116914f, 0.019744104f, 6.0001075e-05f, 0.016162232f, 0.005932963f, 0.015899073f, 0.027269155f, 0.008392745f, 0.0048601385f, 0.021919841f, 0.0155492015f, 0.010798869f, 0.0046609533f, 0.014208676f, 0.0037471347f, 0.017868415f, -0.0063913115f, 0.009724104f, 0.021926874f, 0.0132275075f, -0.0031429315f, 0.014117058f, 0.015501325f, 0.021020109f, 0.010355487f, -0.0076101692f, 0.006646848f, 0.012349756f, -0.0035860974f, -0.0029556327f, 0.0054705334f, -0.0060042427f, -0.005563191f, -0.009251632f, -0.026284615f, -0.018138189f, 0.00075919006f, -0.019283585f, 0.0005353419f, 0.013834939f, 0.008052197f, 0.017274143f, 0.018572442f, -0.011976043f, 0.009892218f, 0.017655069f, -0.0036617764f, 0.0039921873f, 0.0057680965f, 0.016189888f, 0.006338379f, 0.014909327f, 8.4497435e-05f, 0.008052309f, 0.01618066f, -0.008717127f, 0.003586817f, 0.004615818f, 0.0003728036f, 0.006716467f, -0.0009466398f, 0.0047082016f, -0.0016382815f, 0.033728305f, -0.008318303f, -0.008732626f, 0.030177372f, 0.007394264f, -0.01226284f, 0.01205607f, 0.01615187f, 0.008168472f, 0.0073553184f, -0.0042768f, -0.01653573f, 0.00087572343f, -0.0019435073f, -0.017524516f, -0.009494128f, 0.0027702563f, -0.0023596843f, 0.000665979f, 0.0028759516f, -0.006968006f, 0.001478745f, 0.004943802f, -0.00054784236f, 0.002434198f, -0.015917022f, 0.0008054227f, -0.004905784f, -0.014140263f, -7.8243145e-05f, 0.0050229947f, -0.004856259f, -0.004588625f, -0.010583168f, -0.010137419f, 0.0024711916f, -0.017222172f, -0.012659367f, -0.012739954f, -0.033786356f, -0.016319172f, 0.003203438f, 0.005217126f, -0.004655443f, 0.009698986f, 0.015761465f, 0.0054110843f, -0.0027477457f, 0.005702525f, 0.013809045f, -0.005393201f, -0.017023155f, -0.018965652f, 0.0075515243f, -0.016166043f, -0.0138019305f, 0.002079767f, -0.008531683f, -0.002962324f, 0.005844375f, -0.008134743f, -0.013414188f, 0.01653976f, 0.00042275843f, -0.0013564104f, 0.018449327f, -0.005491808f, 0.017842617f, 0.003095747f, 0.00041046843f, 0.011594033f, -0.009829449f, -0.01658169f, -0.0032215395f, -0.0067064473f, -0.005308114f, -0.0044111866f, 0.0129622165f, 0.013793122f, -0.0031405096f, 0.028203152f, 0.0020873384f, -0.0021918507f, 0.020070007f, 0.016389364f, 0.012995081f, 0.00062075077f, -0.010812731f, -0.0016963872f, 0.009114654f, 0.0050729048f, 0.0058467514f, 0.008206031f, 0.0037087542f, 0.0031336285f, 0.009329766f, 0.019023241f, 0.03386047f, -0.015833538f, -0.0010133722f, 0.0028582097f, -0.00534376f, -0.01297343f, -0.0003388273f, 0.005871123f, 0.005497914f, 0.024960168f, -0.005881503f, -0.016619667f, -0.0020319272f, 0.0057962597f, -0.008673821f, -0.00074231566f, -0.017322876f, -0.027881704f, -0.024666598f, -0.021442221f, -0.03095421f, -0.039514117f, -0.03396652f, -0.039380707f, -0.027360626f, 0.0097519485f, 0.000118163654f, -0.0068146223f, 0.00040340595f, 0.0073862677f, -0.0012750966f, 0.009896675f, 0.0038764935f, 0.004213354f, 0.016326617f, -0.015366539f, -0.021352276f, 0.010854252f, 0.003442455f, 0.017142756f, 0.007065743f, -0.0056533217f, 0.00029068263f, -0.024346828f, -0.025104519f, -0.033655994f, -0.020550996f, -0.0060329977f, -0.02577764f, -0.006488653f, -0.013273121f, -0.029194992f, 0.008422625f, 0.010639986f, 0.03087814f, 0.0048412653f, -0.009481777f, 0.010006048f, 0.009555826f, 0.0056503704f, 0.011547354f, -0.0017969663f, -0.0098755285f, -0.014085779f, -0.003110882f, -0.017473185f, -0.01494102f, -0.008522071f, -0.0127764335f, -0.019992733f, 0.011661458f, -0.0009265104f, -0.001416251f, 0.01985263f, -0.00052798697f, 0.00798752f, 0.017848494f, 0.01036193f, 0.0032495447f, -0.0213902f, 0.009993501f, -0.00813848f, -0.026572546f, -0.0052723796f, -0.02280249f, -0.019739626f, -0.010840173f, -0.031363454f, 0.011007927f, 0.0108245555f, 0.01996412f, 0.001228422f, 0.01463916f, 0.026307313f, 0.006097524f, 0.0049368083f, 0.014878897f, -0.0005922781f, 0.0033459854f, 0.0014064978f, 0.020863071f, 0.019025577f, 0.003165724f, 0.015891504f, 0.012772792f, 0.0058344686f, -0.021677632f, -0.016865842f, -0.037908737f, -0.028781496f, -0.015275008f, -0.03478845f, -0.015780624f, -0.02471606f, -0.043711517f, 0.01901696f, 0.003074031f, 0.006753083f, 0.0018067661f, -0.012112674f, 0.01879919f, 0.003276414f, 0.0032643683f, 0.017932735f, -0.017392086f, -0.010374315f, -0.014244744f, -0.0042068483f, -0.01148019f, -0.022660173f, -0.021446794f, -0.005395987f, -0.017108586f, -0.0055239163f, -0.009132721f, -0.012567942f, -0.009719547f, -0.012053378f, -0.010315803f, -0.006653094f, 0.001178947f, -0.012780053f, 0.0035741217f, -0.01534278f, -0.022720922f, -0.0035468126f, -0.0054858853f, -0.0027461897f, 0.0013172245f, -0.008050583f, 0.008096975f, 0.0034080723f, -0.009514767f, -0.008773895f, 0.012781594f, -0.0053620157f, -0.016266752f, 0.0003827605f, -0.007667189f, -0.0037002256f, 0.015193654f, 0.02091736f, 0.0153350495f, 0.017133037f, 0.0034587274f, -0.00056410016f, 0.017955853f, 0.018324837f, 0.021460442f, 0.014572729f, 0.0058848076f, 0.0023642757f, 0.024683805f, 0.03965592f, 0.021033665f, 0.008303523f, 0.010301564f, 0.0111067025f, -0.009125689f, -0.019989891f, -0.014430445f, 0.0025663339f, -0.016568251f, -0.01607315f, -0.009401838f, -0.010871052f, -0.028193112f, 0.012986668f, 0.008450758f, -0.0017506375f, 0.02148016f, 0.006067026f, 0.008794213f, 0.022085236f, 0.017890163f, 0.011200658f, 0.031276204f, 0.031011725f, 0.021868058f, 0.015423556f, 0.045923173f, 0.04307869f, -0.005221677f, -0.008130828f, -0.0037732518f, -0.016739115f, -0.0062324563f, -0.01889038f, -0.023444451f, -0.024230132f, -0.015047474f, -0.017300807f, -0.02994753f, -0.03334114f, -0.0025211403f, -0.00873746f, -0.011151324f, -0.0057863058f, -0.024893997f, -0.016711058f, -0.01122915f, -0.019893086f, -0.021020964f, 0.011389114f, 0.002843107f, 0.0009265038f, -0.022025649f, -0.008003118f, 0.004490934f, -0.009811415f, 0.0085966475f, 0.0057114903f, -0.046488654f, 0.0168477f, 0.0072339913f, -0.016497882f, 0.05826387f, 0.0025487654f, -0.003537891f, -0.018636f, -0.033185713f, 0.0007059139f, -0.015805893f, -0.0066900146f, -0.003578551f, -0.020662326f, -0.015770387f, -0.009736739f, -0.030880054f, -0.0110740885f, 0.005348816f, 0.02314535f, 0.0032307194f, 0.014140001f, -0.005007523f, 0.025443181f, -0.013603343f, -0.0051960917f, 0.0020488922f, -0.0069225784f, -0.014153848f, -0.0069401413f, -0.034551907f, -0.029520873f, -0.014565873f, 0.0064540817f, 0.014300775f, -0.00070632505f, -0.01620603f, -0.0037258088f, -0.029976996f, -0.016150009f, 0.023713224f, 0.0068343184f, -0.015471098f, -0.012887068f, -0.010792196f, -0.006188555f, -0.025570726f, -0.013240365f, -0.0012816173f, -0.010700206f, -0.017663447f, -0.012211323f, -0.017878613f, -0.0015350714f, 0.014726398f, -0.002880949f, 0.025852742f, -2.3928556e-05f, 0.0052863853f, 0.027999856f, 0.02345194f, 0.023479886f, 0.022584422f, -0.017797554f, 0.0027069114f, 0.032072157f, -0.04497729f, -0.054460082f, -0.018500773f, -0.013599442f, 0.029718393f, 0.039404903f, 0.009818106f, 0.0076807877f, 0.026890492f, -0.030538443f, -0.039068453f, 0.006763545f, -0.00095089286f, -0.0006803566f, 0.02823483f, -0.00017545359f, 0.008924201f, -0.009059459f, 0.0081707975f, 0.002344137f, -0.011776138f, 0.0075903954f, 0.015398807f, 0.009212586f, 0.033879362f, 0.004918748f, 0.013417793f, -0.0220696f, -0.03054836f, -0.017836755f, -0.003161578f, 0.011027737f, 0.020487515f, 0.020704437f, 0.036774263f, 0.05099046f, 0.009637946f, -0.0009197822f, 0.0027431585f, -0.00062007067f, -0.016200772f, -0.028737323f, -0.004312083f, -0.002292034f, 0.003860722f, -0.030833336f, -0.011360236f, 0.010434333f, 0.001984483f, 0.011730719f, 0.0119047f, 0.014756766f, 0.012834418f, 0.025268413f, -0.017416308f, -0.027186427f, -0.0112033645f, -0.020615526f, -0.011551557f, 0.003886691f, -0.025912195f, -0.019387065f, -0.01277844f, -0.009522964f, -0.013378084f, -0.018873867f, -0.014317592f, -0.011664953f, -0.0050827023f, -0.015170047f, 0.035111845f, 0.017790763f, 0.057798874f, 0.081251666f, 0.05623782f, 0.024703933f, 0.00055256265f, 0.01307563f, -0.007556254f, -0.0019418304f, 0.02726097f, -0.0343437f, -0.016151687f, 0.014860285f, 0.009426662f, 0.018703813f, 0.033416823f, -0.0023371964f, -0.0042481786f, -0.008412186f, 0.004562943f, 0.003047229f, -0.0053222836f, -0.003735437f, -0.0077884537f, -0.020848367f, -0.011020373f, 0.031284947f, 0.029068671f, -0.0038717852f, -0.007049717f, -0.0010163694f, -0.018212749f, -0.041577604f, -0.028684864f, 0.01292946f, 0.05717096f, 0.008180691f, -0.0068451026f, 0.007363611f, -0.021285666f, 0.0082352245f, 0.014457414f, -0.003332457f, 0.013340114f, 0.019011514f, 0.02854182f, 0.023040298f, 0.018011251f, 0.0123049375f, 0.0108803995f, -0.015248775f, -0.014147553f, -0.007620674f, 0.016566968f, 0.0066359234f, -0.0023030965f, -0.013877032f, 0.0060062683f, -0.0016317003f, -0.017447155f, -0.007370175f, 0.005919857f, -0.0071519865f, 0.016179625f, -0.0031316173f, -0.016325837f, -0.021806704f, 0.0066315993f, -0.014694703f, -0.008701629f, -0.003906159f, -0.00074907154f, 0.0036260905f, 0.009137334f, 0.010894354f, 0.018443266f, -0.0070947306f, -0.010771434f, -0.0064095426f, -0.02493929f, 0.02147156f, 0.039573595f, 0.05779454f, 0.084044226f, 0.045246992f, 0.014925966f, 0.004015111f, -0.014601268f, 0.012175045f, 0.0037508984f, 0.0071467585f, -0.011107801f, -0.00644675f, -0.0023366297f, -0.0279681f, 0.005479622f, 0.0040207016f, -0.0042267484f, 0.0035314916f, 0.011486637f, -0.02295152f, -0.039183773f, -0.0321325f, -0.009785549f, -0.009227786f, -0.030052846f, 0.018115852f, 0.024457494f, 0.011893382f, 0.041826945f, 0.021177715f, -0.0072898194f, -1.9911167e-05f, 0.01048045f, 0.0017743f, 0.04621148f, 0.05875546f, 0.04281634f, -0.06850974f, -0.08108537f, -0.054019045f, -0.0105860755f, 0.037874833f, 0.03734441f, 0.020385755f, 0.039104648f, 0.026200918f, 0.03022634f, 0.057688016f, 0.025604697f, 0.021031002f, 0.0028585044f, -0.006475f, -0.019052342f, -0.023298718f, 0.033352144f, -0.04655949f, -0.03903011f, -0.009814858f, -0.0057960134f, 0.014055392f, 0.030943723f, -0.015224206f, -0.03738839f, -0.0019028571f, -0.017245566f, -0.042757407f, -0.014054499f, -0.016493443f, -0.029979972f, -0.024443999f, 0.016910367f, 0.039063405f, 0.045804337f, 0.0028587307f, -0.013018984f, -0.014484982f, -0.018569097f, 0.0255697f, 0.038431015f, -0.022424333f, -0.03154638f, 0.0065589584f, -0.037069757f, -0.034750666f, -0.030584892f, -0.022858545f, -0.008290091f, -0.02356062f, -0.021597628f, -0.014772194f, 0.016432349f, -0.021937463f, -0.01582064f, 0.020602759f, -0.014009642f, 0.03346063f, 0.031322625f, 0.017385345f, -0.040007357f, -0.0109869875f, 0.028624661f, -0.0276544f, -0.044887908f, 0.031505417f, -0.015785765f, -0.033115055f, -0.021061918f, -0.015101657f, 0.03764441f, -0.019674892f, -0.027490284f, -0.007865085f, -2.4366063e-05f, 0.012159998f, 0.01633139f, 0.004315453f, 0.014753433f, 0.0098361755f, -0.0067814197f, 0.00716316f, 0.0054254117f, 0.007300981f, 0.030094808f, -0.00904195f, 0.003480743f, -0.05768733f, -0.062861666f, 0.038596276f, -0.033449013f, -0.066876605f, 0.042565055f, -0.025012756f, -0.06611022f, -0.0005347671f, -0.047054432f, -0.020434394f, 0.028759163f, -0.029485961f, -0.043474957f, 0.03315739f, -0.029049922f, -0.03227643f, 0.009502934f, -0.0100593055f, 0.031626772f, -0.011718348f, -0.05359312f, -0.030649327f, -0.0045573334f, -0.0422946f, -0.0072854487f, -0.036210313f, 0.023459105f, 0.010747985f, -0.021959929f, 0.028800713f, 0.017468315f, 0.009194734f, 0.036076058f, 0.015999924f, 0.0085193515f, 0.044432174f, 0.02294832f, -0.023953484f, 0.014190403f, -0.0020442072f, 0.0070637013f, 0.0632311f, 0.015643807f, 0.006831481f, 0.047667056f, 0.046623882f, -0.0197531f, 0.010287136f, -0.0074101156f, -0.017178316f, -0.016011268f, 0.012111364f, 0.0064071463f, -0.02550691f, -0.03600149f, 0.029432662f, -0.00682771f, -0.021323217f, 0.035381213f, -0.013132937f, -0.03324433f, -0.0034422104f, -0.010723714f, -0.0051571717f, -0.03275549f, -0.030266894f, -0.0344142f, -0.031489413f, -0.03241207f, -0.027465532f, -0.010307388f, 0.010955734f, 0.030040873f, -0.020725837f, 0.018184843f, -0.0042677457f, -0.016102279f, 0.040720955f, -0.01600787f, 0.0007123804f, 0.04999847f, 0.02591355f, -0.033442356f, 0.012477476f, -0.023764022f, -0.019218316f, -0.0143749565f, 0.015051464f, -0.012183117f, -0.038425814f, -0.024242818f, 0.009614384f, -0.012296066f, -0.023664668f, 0.013955265f, -0.015805352f, -0.014608364f, -0.011546004f, -0.0017494487f, 0.02885129f, 0.0021657583f, -0.0030634573f, 0.012059385f, -0.0055118017f, 0.026052725f, 0.011545945f, -0.0011869755f, 0.032085184f, 0.04616303f, -0.03466512f, -0.0017576999f, -0.019305756f, -0.04153707f, -0.03436077f, -0.010898436f, -0.0077211503f, -0.00868089f, -0.0124161765f, -0.031028492f, -0.006340789f, -0.021971658f, 0.018596599f, 0.022860225f, -0.018204775f, 0.004254327f, 0.024192607f, 0.04398477f, -0.014445823f, 0.0052891225f, 0.0037768844f, -0.025617616f, 0.013139707f, 0.0060719736f, 0.012960321f, 0.0066477316f, 0.028478611f, -0.016948119f, -0.00039454555f, -0.0079907235f, -0.03170537f, -0.0131599745f, -0.0021042153f, 0.0002947384f, 0.039211452f, 0.026512813f, -0.047961406f, 0.0039294516f, -0.0056874314f, -0.025421469f, 0.019487495f, 0.0006268765f, -0.0414897f, -0.036558382f, -0.008997595f, -0.030001875f, -0.023163961f, -0.027365465f, -0.018359927f, -0.011499099f, 0.0019632522f, -0.0013124658f, 0.049769696f, 0.005685394f, -0.025481576f, 0.0026525748f, -0.020690016f, -0.033095352f, -0.004544786f, -0.011325905f, -0.007426872f, 0.016258484f, 0.0023176027f, 0.0041075954f, 0.018710436f, 0.017025527f, 0.009974104f, 0.012886514f, 0.01959989f, -0.0207965f, -0.031845238f, -0.025799757f, -0.035769444f, -0.045797765f, -0.042363964f, -0.042715423f, -0.039491754f, -0.027939124f, -0.006608453f, 0.04101239f, 0.027368912f, -0.012459468f, 0.022339685f, 0.03926377f, 0.027816743f, 0.065524854f, 0.04113732f, -0.029524952f, -0.039194435f, 0.013119392f, -0.037176166f, -0.053074222f, -0.018064767f, 0.013137917f, -0.025607526f, -0.04499796f, -0.0071800286f, 0.024483003f, 0.00856233f, -0.020831069f, 0.0011148959f, -0.0014303199f, -0.004719648f, -0.0008312464f, 0.013959875f, -0.013221266f, -0.035839632f, -0.037095986f, -0.021487996f, -0.09535405f, -0.070011735f, -0.03360238f, -0.071821295f, -0.043065954f, -0.0079175625f, 0.008042774f, 0.0054755793f, -0.0088783335f, -0.0032537137f, 0.003113787f, 0.010985158f, -0.0036322207f, -0.003474671f, 0.013373279f, 0.003378901f, 0.0075490903f, 0.020841591f, 0.01780086f, -0.013477101f, -0.0039578653f, -0.0018626422f, -0.006384153f, -0.00453302f, 0.0008997129f, -0.008293249f, -0.0034202295f, -0.0030900727f, -0.010775671f, -0.0021114375f, 0.011180939f, -0.004159574f, -0.027104732f, 0.0009753049f, -0.005659708f, -0.007220483f, -2.2644836e-05f, -0.003596623f, 0.002276595f, 0.013317584f, 0.0035167653f, 0.017717877f, 0.022548405f, 0.017483128f, 0.009327893f, 0.01995309f, 0.015349883f, 0.025490372f, 0.021490142f, 0.014456062f, -0.018641088f, -0.011257914f, -0.026701892f, -0.014721264f, 0.007823036f, -0.016343988f, -0.012114853f, -0.009311256f, -0.016929163f, -0.0025945662f, 0.008513616f, -0.0028116263f, -0.0023682625f, -0.01582706f, -0.0029984666f, 0.0014386715f, -0.008602518f, 0.008689158f, 0.039851595f, 0.04055496f, 0.026433485f, 0.04237968f, 0.0341464f, 0.02569294f, 0.041755978f, 0.031037837f, 0.0134949135f, 0.015452838f, 0.03496262f, 0.025829045f, 0.014992025f, 0.026740244f, 0.022885166f, 0.03242664f, 0.020728208f, 0.01828408f, -0.006731524f, 0.002109348f, -0.003356306f, 0.005007978f, -0.024005434f, -0.014973022f, 0.012279389f, -0.009227205f, -0.006748165f, -0.0030229713f, 0.0011554464f, 0.0057663326f, -9.3323884e-05f, 0.00053424295f, -0.00024468204f, -0.0010180797f, 0.00292649f, 0.003981571f, -0.018391687f, -0.0128743835f, -0.0039405106f, -0.004154761f, -0.0044291485f, 0.010443265f, -0.00633851f, 0.013034936f, 0.024448032f, 0.0056606294f, -0.0072928695f, 0.00028537f, -0.00444995f, -0.0176784f, -0.008185619f, -0.025983231f, -0.015384071f, -0.004986207f, 0.017391313f, 0.03063585f, 0.02090949f, 0.019222353f, 0.029948337f, 0.02944735f, 0.028003333f, 0.026670901f, 0.026240546f, 0.008111086f, 0.012430187f, -0.0011511137f, -0.0029823608f, 0.0003910479f, 0.0033127689f, 4.5277255e-05f, 0.0025450727f, 0.008849492f, -0.013336313f, -0.007466538f, -0.017524756f, -0.0073304838f, 0.0010319615f, -0.009305987f, 0.009786002f, 0.0059359833f, 0.0022331064f, 0.030052584f, 0.012933938f, 0.011169022f, 0.021044457f, 0.01358134f, 0.008195957f, -0.007170918f, -0.0022393893f, -0.006850021f, 0.027795786f, 0.018819986f, 0.032485835f, 0.03304864f, 0.04333615f, 0.039886814f, 0.034484558f, 0.0363813f, 0.032220468f, 2.2404183e-05f, 0.0014487518f, 0.017127337f, 0.015632026f, 0.012243022f, 0.011697975f, 0.008573445f, 0.007857157f, 0.01275211f, 0.018443123f, -0.015651917f, -0.0012797908f, -0.008878724f, -0.009505385f, -0.016448086f, -0.017837439f, -0.021562537f, -0.012840916f, 0.023528907f, 0.021540685f, 0.010126234f, 0.016935522f, 0.02434027f, 0.025082314f, 0.01713018f, 0.03259726f, 0.029581098f, -0.0007170562f, 0.004458699f, 0.005601251f, -0.011499313f, -0.016262917f, -0.004162339f, -0.0201023f, -0.022734866f, -0.008524752f, 0.01488842f, 0.00056090293f, -0.0010560551f, -0.0064452454f, -0.008287934f, -0.0059898454f, -0.012790023f, -0.0061871856f, -0.0022930882f, 0.005488572f, -0.004115303f, -0.0012887677f, -0.011393167f, -0.015156716f, -0.0049098674f, -0.013298671f, -0.0066367486f, 0.0072052376f, -0.015724966f, 0.010003089f, 0.0029158487f, -0.010009594f, 0.003228724f, -0.0037577352f, -0.0053663836f, -0.0015070364f, -0.0035972511f, 0.027667906f, 0.029576743f, 0.024101676f, 0.03603368f, 0.034062367f, 0.016757375f, -0.008168895f, 0.009222624f, 0.016921714f, -0.018041508f, 0.004203187f, 0.009678923f, -0.018901067f, -0.0018238878f, 0.00044294808f, 0.0016062398f, 0.021631297f, 0.01868576f, -0.0026680748f, -0.0018359182f, -0.004700015f, -0.010550893f, -0.009752318f, -0.011996374f, -0.00068755244f, -0.00744632f, 0.0014575555f, 0.003734907f, 0.012222165f, 0.019638414f, 0.0062172f, 0.008297494f, 0.020838603f, 0.004533191f, 0.009098049f, 0.022739798f, 0.012697403f, 0.034408808f, 0.003128964f, 0.004089827f, 0.04499709f, 0.029880103f, 0.030294957f, 0.042565152f, 0.018790495f, 0.023857702f, 0.0038907584f, 0.014234493f, 0.008795329f, 0.013211024f, 0.012299317f, -0.010914668f, 0.0015393948f, 0.009020437f, -0.008805382f, 0.004043405f, 0.004273895f, -0.010622364f, -0.0050812694f, -0.006919946f, 0.0071791178f, -0.0027381296f, -0.0029353173f, -0.014171552f, 0.017063739f, 0.014665679f, 0.0071365414f, 0.03446326f, 0.049716454f, 0.0022852647f, 0.043394454f, 0.03042971f, -0.026341535f, 0.010939183f, 0.02008324f, -0.038248423f, -0.0089837145f, -0.029271722f, -0.03234003f, -0.015189531f, -0.017441196f, -0.01899366f, 0.0013913194f, 0.022041183f, -0.0145265125f, 0.026146675f, 0.051325064f, -0.035646234f, 0.009323609f, 0.023899097f, -0.028424727f, -0.00035571645f, 0.024077343f, -0.018609397f, 0.02833757f, 0.0093389135f, 0.03194902f, 0.025341777f, 0.038438614f, 0.0019552617f, 0.0028139947f, -0.009168747f, -0.0016003599f, -0.0074494164f, -0.017311916f, -0.0028651534f, -0.008609935f, -0.0021254735f, -5.442181e-05f, 0.015574933f, 0.03707442f, 0.0145967305f, 0.0318784f, 0.06623937f, -0.0056453487f, 0.02391556f, 0.04550286f, -0.041333996f, -0.02070483f, -0.023102483f, -0.0025444478f, -0.0017897888f, 0.014141586f, 0.0049207783f, 0.027014185f, 0.0103230905f, 0.022644073f, -0.0155661125f, -0.049410567f, 0.017901093f, -0.017470462f, -0.032029223f, -0.02290635f, -0.04837191f, -0.036429815f, 0.012999189f, -0.007462555f, -0.024763491f, 0.0015119069f, -0.00836387f, -0.026920116f, 0.019482244f, 0.047197398f, 0.011656433f, 0.015465185f, 0.004921976f, -0.00977266f, 0.0007884481f, -0.030112712f, -0.025494723f, -0.02168867f, -0.058097087f, -0.031676695f, -0.039678026f, -0.019555673f, -0.006219372f, -0.0045762495f, -0.0019228812f, -0.0019062309f, 0.004459277f, -0.005400261f, 0.011363569f, -0.03712667f, 0.00012984866f, -0.003023623f, 0.017914727f, 0.0116957305f, 0.014398913f, 0.048105396f, 0.09145591f, 0.043569785f, -0.004926153f, 0.027162258f, 0.012998295f, -0.012592743f, -0.008234748f, -0.007190117f, -0.0014643755f, -0.014174609f, -0.0013239642f, 0.008974309f, -0.010983969f, -0.027816774f, -0.00063694245f, -0.0011915255f, -0.025791813f, -0.0020210797f, -0.007980388f, -0.027286615f, -0.025654454f, 0.008120681f, -0.0014929085f, -0.006606503f, 0.00049154944f, -0.009807479f, -0.008865851f, 0.021973362f, 0.0050594704f, -0.054009825f, -0.018144583f, -0.010748781f, -0.0065842867f, -0.006910781f, 0.007667373f, 0.048254166f, 0.063593164f, 0.04058058f, -0.024786852f, 0.018165382f, -0.009452397f, -0.027633816f, -0.04803888f, -0.035194524f, -0.036617327f, -0.042623814f, -0.06591125f, 0.004599236f, -0.028000237f, -0.017600382f, 0.0026674045f, -0.018333886f, -0.030911263f, 0.0027121445f, -0.0038690288f, -0.010251754f, -0.036095727f, -0.020652045f, -0.005728183f, -0.015142421f, -0.017397167f, 0.02822175f, -0.01567321f, 0.011423228f, 0.02449334f, -0.009878801f, 0.025061853f, 0.0065892683f, -0.04123542f, -0.021894103f, -0.029609334f, -0.038093846f, -0.03520969f, -0.040444348f, -0.032577373f, -0.013321401f, -0.022503361f, -0.013099839f, -0.0324696f, -0.021483652f, 0.015567994f, 0.025388898f, 0.042588662f, -0.0408399f, -0.009082081f, -0.018392883f, -0.026129013f, -0.040504396f, -0.035404254f, -0.006283287f, -0.019243563f, -0.013338621f, -0.038773466f, -0.02023439f, -0.0126978f, 0.0018822125f, -0.006747781f, -0.009788955f, -0.030974591f, -0.03055093f, -0.023084585f, -0.011497903f, -0.0037063523f, 0.002213546f, 0.00037117815f, 0.008374952f, 0.01693695f, 0.012359951f, 0.02353976f, 0.0036016793f, 0.0054334546f, -0.01787356f, -0.0022297134f, -0.017388664f, 0.008016337f, 0.022696024f, -0.004535081f, -0.012837258f, 0.019871341f, 0.0024682034f, -0.0013003555f, 0.0010239205f, 0.005405726f, -0.016731692f, 0.008866388f, 0.007147825f, -0.008384622f, 0.010769656f, -0.053594165f, -0.010893708f, 0.0048783273f, -0.018691638f, -0.016512537f, 0.028738506f, 0.06586427f, 0.08340788f, 0.048074916f, -0.024029257f, 0.00061806425f, -0.003688926f, -0.029784389f, 0.0011360135f, 0.00014989587f, -0.015294973f, 0.017599817f, 0.00058754877f, -0.07934393f, -0.037223537f, -0.027223185f, -0.014202576f, 0.016268263f, 0.026525877f, 0.006628004f, 0.03492016f, 0.04255694f, -0.008549164f, 0.028308937f, 0.009755435f, -0.030166654f, -0.032694213f, -0.02763225f, 0.049545996f, 0.09293944f, 0.100882165f, -0.019208334f, -0.0095499335f, 0.017652769f, -0.035675567f, -0.055506717f, -0.025993004f, -0.008520375f, -0.025852093f, -0.0017739455f, 0.01995033f, 0.02247406f, 0.009053642f, 0.0060302084f, 0.01985106f, 0.009859432f, 0.0015719093f, 0.020478664f, -0.023939978f, 0.003975773f, 0.0014551653f, -0.008810176f, 0.0014487265f, 0.004496595f, -0.00669072f, -0.0070795636f, -0.010320751f, -0.014298262f, -0.008259645f, 0.00910338f, -0.018879391f, -0.003728907f, -0.00096349604f, -0.01149456f, 0.0134054115f, 0.007423951f, -0.01423411f, 0.0045843413f, -0.019960372f, -0.017274864f, -0.0016039946f, -0.0050649997f, -0.018956112f, -0.009285846f, -0.015318721f, -0.010420606f, -0.0069972156f, -0.02296673f, -0.033505626f, -0.004018723f, -0.023286942f, -0.025715206f, 0.009911122f, -0.010802089f, -0.0036857566f, -0.0011294299f, -0.009385504f, -0.0036807298f, -0.00761388f, -0.0026309893f, -0.011738685f, -0.008183686f, -0.009804499f, -0.015721852f, -0.008740695f, -0.026000967f, -0.0407072f, -0.022137867f, -0.036258917f, -0.030582394f, -0.03650924f, -0.043726567f, -0.055929963f, 0.008912818f, 0.0018499121f, -0.007227883f, 0.00061584753f, -0.007668617f, -0.013324208f, -0.007521817f, -0.004096821f, -0.016820373f, -0.0010231503f, 0.0028240192f, 0.0028706254f, 0.0012550752f, -0.0076116812f, 0.0023248785f, -0.008737276f, -0.013012142f, -0.004776828f, -0.007383933f, -0.011364511f, -0.009430187f, -0.0068654497f, -0.0075830966f, -0.015463412f, 0.004010732f, -0.006531473f, -0.0018107297f, -0.004227462f, -0.010693198f, -0.011497855f, -0.02140221f, -0.027022105f, 0.005873726f, -0.026346182f, -0.030237556f, 0.0032328276f, -0.0021768305f, 0.004891428f, 0.004661201f, -0.001444383f, -0.005194732f, -0.015021775f, 0.005967766f, 0.006223937f, 0.013693957f, 0.021809096f, 0.015001602f, 0.0074008624f, -0.0035547845f, -0.0036482955f, -0.0214936f, 0.0041963714f, -0.0049868547f, -0.016786618f, 0.021314397f, 0.015403634f, 0.020261671f, 0.01569446f, 0.010552708f, -0.0019261324f, 0.030670127f, 0.020214222f, 0.0037134672f, 0.008651981f, -0.008790367f, -0.0029693835f, -0.0026156732f, -0.0027439457f, 0.0037403365f, -0.00048233639f, -0.012621952f, -0.0051797447f, 0.008778941f, -0.0025329904f, -0.0044059507f, 0.012469925f, -0.009989609f, -0.017300481f, 0.009507421f, -0.0038542103f, -0.014417f, 0.001932971f, -0.008849256f, -0.014260562f, 0.00907938f, -0.00414851f, -0.021043718f, -0.0074187033f, -0.016125102f, -0.0347822f, 0.0012545086f, 0.034095444f, 0.019410111f, 0.012463598f, 0.024277585f, 0.02220822f, 0.014816061f, 0.027018646f, 0.027793825f, -0.0008482784f, 0.00069207605f, 0.017016113f, -0.0043553603f, 0.0012645366f, 0.0025240814f, -4.382411e-05f, 0.00014972764f, 0.015911603f, -0.0023122183f, -0.017162753f, -0.015970364f, -0.005504195f, -0.015187099f, -0.024841726f, -0.016695218f, -0.024592469f, -0.0154416f, 0.008958412f, 0.026016353f, 0.015384053f, 0.02194455f, 0.004538131f, -0.001961151f, 0.019815527f, 0.016234985f, -5.5005563e-05f, 0.030099053f, 0.02747488f, 0.002065975f, 0.020852799f, 0.010272107f, -0.015342134f, 0.035820745f, 0.022867681f, 0.0167828f, 0.020021182f, 0.035464488f, 0.03066028f, 0.022369802f, 0.013600482f, 0.0066061057f, 0.023698084f, 0.008180267f, -0.008248111f, 0.009254027f, 0.0039944146f, 0.00047011056f, 0.018431207f, 0.0026132162f, -0.0124695515f, 0.025727894f, -0.0035447432f, -0.016414681f, 0.038001366f, 0.030131916f, 0.026623877f, 0.023331383f, 0.011189229f, -0.013588882f, 0.026023941f, 0.008682544f, 0.0011231749f, 0.0064850817f, -0.00044629912f, -0.010472703f, 0.0127412835f, -0.011249414f, -0.016499568f, 0.006689854f, -0.012728987f, -0.028308475f, -0.0035268648f, 0.016834985f, -0.011934811f, 0.0061505176f, 0.0028151956f, 0.020045074f, 0.011414915f, 0.005886178f, -0.013180858f, 0.005762238f, -0.0029037155f, 0.0038287176f, 0.0043769935f, -0.00369951f, -0.007965378f, 0.003139174f, -0.014216231f, -0.01708488f, 0.031961057f, 0.006751757f, 0.013731983f, 0.020976566f, 4.6863643e-05f, -0.020303272f, 0.012105442f, 0.0022915718f, -0.019586232f, -0.0017992377f, 0.0013301808f, -0.009468509f, 0.005259167f, -0.012749635f, -0.015773088f, 0.012587599f, 0.011681942f, -0.004361456f, 0.009989058f, 0.029890556f, 0.031826917f, -0.009045573f, -0.013917159f, -0.01106809f, 0.018610904f, 0.024042664f, 0.03194428f, 0.025449306f, 0.03996259f, 0.033480152f, 0.032612693f, 0.034180295f, 0.013343795f, 0.03177781f, 0.03268529f, -0.00038521757f, -0.0030208956f, -0.022482209f, -0.011521312f, -8.891563e-05f, -0.016460823f, -0.0071489224f, -0.0077046035f, -0.012869417f, -0.023411946f, 0.0066898386f, -0.005659383f, -0.012287734f, -0.00969405f, -0.017555203f, -0.03316377f, -0.011631649f, -0.016825384f, -0.016708259f, -0.0030602622f, -0.0054674535f, -0.037253488f, -0.0012394857f, -0.011795315f, -0.013853305f, -0.0041983835f, -0.011126127f, -0.00809966f, -0.0071112667f, -0.0025005385f, -0.03016929f, -0.006445119f, -0.014267369f, -0.020539839f, -0.0014565394f, -0.011532587f, -0.0042862757f, -0.0040829205f, -0.0030268338f, -0.015520021f, 0.0012907006f, -0.0070848963f, 0.0022637676f, -0.002454235f, 0.0006633762f, 0.003392531f, -0.0058224495f, 0.007067442f, -0.016720641f, -0.011644321f, -0.020278946f, -0.014947319f, -0.004446262f, -0.009311851f, -0.0039804983f, 0.0023979098f, -0.007117662f, 0.008937009f, -0.0087835f, -0.021290956f, 0.0002914015f, 0.0060876613f, 0.009794261f, -0.0027277211f, -0.008613026f, -0.015377178f, -0.015935762f, -0.02527295f, -0.021116912f, -0.022595866f, -0.010353691f, -0.0127635505f, -0.0022174856f, -0.0012676341f, -0.016885102f, -0.01177051f, 0.006053208f, -0.015068818f, -0.00050448335f, -0.0034690574f, -0.012951323f, 0.002208451f, -0.0068571153f, -0.009025856f, -0.02302629f, -0.0108097065f, -0.022141783f, -0.020264983f, -0.005762808f, -0.009467993f, -0.0017880363f, 0.0021093423f, -0.0071553304f, -0.026484083f, -0.014388019f, -0.014741677f, -0.024218354f, 0.018304775f, 0.0016351467f, -0.0019135836f, -0.012010006f, -0.00855885f, -0.008165766f, 0.004700682f, -0.0041694334f, 0.0010325549f, 0.005541481f, -0.009298729f, -0.012786355f, 0.00040576747f, 0.004331675f, -0.025649f, -0.005174853f, -0.012928141f, -0.011112217f, 0.009061723f, -0.014593148f, -0.005396859f, -0.0068554464f, -0.005717612f, -0.01820214f, 0.011099636f, -0.0040841815f, -0.010164827f, -0.0018239198f, -0.013865615f, 0.004738886f, 0.011260445f, 0.0002782572f, 0.010807269f, 0.006718994f, 0.007384636f, 0.011568432f, 0.000978684f, 0.0024859828f, 0.0013322814f, 0.004621905f, -0.0015755196f, -0.027709216f, -0.012726643f, -0.012259028f, -0.020173503f, -0.0044270037f, -0.009104251f, -5.022416e-05f, -0.00516546f, -0.010976654f, -0.038699932f, -0.015888093f, -0.012423688f, -0.033419132f, 0.012376362f, -0.0038235825f, -0.011300465f, -0.0020020353f, -0.013620226f, -0.009657626f, 0.008943075f, -0.0027856627f, -0.0026290982f, 0.013545018f, -0.003119109f, 0.002886477f, 0.0065526958f, -0.024208888f, 0.015153322f, -0.015094618f, -0.0058470657f, 0.011591734f, -0.017037373f, -0.017890831f, 0.019024184f, -0.008812119f, 0.0043254523f, -0.023373848f, -0.0038180472f, -0.011466933f, -0.012147225f, 0.003782442f, -0.0042840648f, -0.016592825f, 0.004031429f, -0.00061108347f, -0.021704178f, -0.0054404424f, -0.008949164f, -0.0109733045f, 0.012005809f, 0.0074963346f, -0.0050187483f, -0.0045050564f, 0.007713522f, -0.00043033095f, 0.013437764f, 0.00028767576f, -0.008673585f, -0.0003380917f, -0.017536435f, -0.009947606f, -0.012173502f, -0.008733233f, -0.03607296f, -0.010413693f, -0.018746778f, -0.014244807f, -0.0047855605f, -0.021913132f, -0.0016411853f, -0.0025193288f, 0.0022341397f, -0.029369099f, -0.023270808f, -0.017400675f, -0.015207329f, 0.0036356328f, -0.012497966f, -0.009838379f, 0.002077168f, 0.006827443f, -0.033418722f, 0.005610104f, -0.021133082f, -0.020787956f, 0.008893247f, -0.008471489f, -0.01437633f, 0.0016093978f, -0.010797534f, -0.020460932f, -0.00095783116f, -0.017500952f, -0.009451297f, -0.004598973f, -0.0044850064f, 0.003319946f, -0.0059663528f, -0.0015499333f, -0.004688024f, -0.007987892f, 0.011302307f, 0.00081821205f, 0.009657034f, 0.009346934f, 0.0044969823f, 0.0031502068f, -0.014386615f, -0.019634027f, -0.009189723f, -0.015275031f, -0.011085388f, 0.0077137654f, 0.015442162f, 0.0161646f, -0.005362957f, -0.014645462f, -0.035135534f, -0.018266937f, -0.026199507f, -0.016835488f, -0.003982752f, -0.019049399f, -0.014730856f, -0.0058037755f, 0.0029255783f, -0.009425933f, -0.00075255084f, -0.013438651f, -0.0083291195f, -0.001715672f, -0.0029725495f, -0.0021632984f, -0.017504057f, -0.035410773f, -0.035668023f, -0.016514467f, -0.040561352f, -0.010828264f, -0.02932464f, -0.039170045f, -0.027263783f, -0.008313941f, -0.004569377f, -0.02336148f, -0.0048297322f, -0.014095339f, -0.020349057f, -0.004940734f, -0.01728953f, -0.0025492995f, -0.010664318f, -0.0047630244f, -0.03175139f, -0.023276238f, -0.028031448f, -0.03921114f, -0.0057688835f, -0.01985406f, -0.021131404f };
+static float conv2_bias[32] = { -0.9876442f, -0.5730391f, 0.24176481f, -0.1955811f, -0.63301075f, 0.34056598f, -0.9157471f, 0.65030223f, 0.26016375f, -0.46545726f, 0.33029428f, -0.5477017f, -0.8768753f, 0.63696754f, -0.64720476f, -0.28603157f, -1.1642118f, -0.68296003f, 0.10889423f, -0.30630988f, 0.44217426f, -0.015639782f, -0.6834114f, 0.2375867f, -0.8528528f, -0.2255232f, -0.5730451f, 0.41303927f, -0.9590689f, -0.083116576f, -0.35299557f, 0.628371f };
+
+static float fc0_weight[2 * 2048] = { 0.029426228f, 0.055579487f, 0.05933608f, -0.021966496f, -0.030651353f, 0.01354398f, 0.0058340086f, -0.07433262f, 0.028277151f, 0.13484904f, -0.0130783925f, 0.099734806f, 0.087996736f, 0.015883071f, 0.04516471f, -0.002777814f, -0.026842225f, 0.10529068f, -0.040732916f, -0.21106593f, -0.14509328f, 0.04845863f, 0.18772382f, 0.0729458f, 0.03612129f, 0.17047617f, 0.05730895f, -0.09147632f, -0.09763868f, 0.019266134f, 0.106486954f, 0.039002534f, 0.0016635903f, -0.13517824f, -0.15238717f, -0.2501594f, -0.22462238f, -0.02801832f, -0.0629493f, 0.002552459f, -0.014575652f, 0.05548302f, 0.026241997f, -0.17048241f, -0.036948983f, 0.09699369f, 0.055503055f, 0.05196703f, 0.0041869706f, 0.05888769f, 0.05087785f, -0.10876384f, 0.0103190495f, 0.18474242f, 0.07510267f, 0.057710327f, -0.086211026f, -0.016372083f, 0.0006687463f, 0.03831339f, 0.01954364f, -0.0036503586f, 0.011697714f, 0.03614728f, 0.12590407f, 0.040978175f, 0.104348645f, 0.026237639f, 0.07930665f, 0.18253958f, 0.09582291f, 0.0974126f, -0.15926763f, 0.06708534f, 0.009854388f, 0.176161f, -0.064055145f, 0.050763544f, 0.18712783f, 0.16145615f, 0.088982925f, 0.020111743f, -0.12021799f, -0.33465123f, -0.16936636f, 0.18693402f, 0.20698906f, 0.2058994f, -0.19112891f, 0.12320358f, 0.2087189f, -0.0716591f, -0.08126271f, 0.048464343f, 0.36503565f, 0.059853945f, 0.25552496f, 0.15323353f, 0.010326154f, -0.0742486f, -0.06123836f, 0.15301977f, 0.07766233f, 0.25553316f, 0.09636816f, 0.10688864f, 0.012297098f, 0.062101934f, 0.07999385f, 0.36649936f, 0.17754449f, 0.005041016f, 0.14679244f, 0.18296254f, 0.30883986f, -0.19715591f, -0.18133235f, 0.02489328f, 0.13656157f, 0.2739523f, -0.15328766f, -0.44140553f, -0.08285127f, -0.004858983f, -0.17804588f, 0.2087877f, -0.14640751f, -0.012053886f, 0.0006016393f, 0.0333586f, 0.09692249f, 0.0055373595f, 0.012422774f, 0.071257286f, -0.013403791f, 0.056624856f, -0.037547298f, 0.07094736f, 0.10324857f, 0.1525766f, -0.01868349f, -0.04740986f, -0.07453612f, -0.010509743f, -0.017287036f, 0.0023582785f, 0.16038306f, -0.064041056f, -0.22262284f, -0.10349602f, 0.037718322f, -0.03604582f, 0.01587537f, -0.03056936f, 0.12360282f, 0.050914947f, 0.0362307f, 0.008516017f, 0.023453685f, 0.053738184f, -0.0020475409f, 0.0051330603f, -0.16428426f, -0.18202694f, -0.17787004f, -0.23638216f, -0.09972435f, -0.041996546f, 0.037668828f, 0.006738927f, -0.10380895f, 0.026996356f, 0.027930468f, -0.085802175f, -0.046858627f, -0.09469685f, 0.011432899f, 0.0024173574f, -0.025928626f, 0.044665497f, -0.09491655f, -0.0631009f, -0.081563f, -0.043438055f, 0.01547829f, -0.05205283f, -0.008737233f, 0.039801065f, 0.048840456f, 0.060684513f, -0.09352826f, -0.056336217f, -0.027772974f, 0.04388429f, 0.10260859f, 0.14004175f, 0.12237795f, 0.15154508f, 0.055946216f, -0.18766893f, -0.021401297f, 0.05198466f, 0.025345214f, -0.19968598f, -0.17553176f, 0.20640276f, 0.14313807f, 0.08422916f, -0.11930729f, -0.0108875055f, -0.12856558f, -0.05266319f, -0.101293914f, 0.17973477f, -0.06082682f, -0.05568233f, -0.004781948f, 0.018259594f, -0.08418577f, -0.15285014f, -0.15568365f, 0.028287284f, 0.04255137f, 0.04104744f, 0.04131568f, 0.000821025f, 0.008946791f, -0.15284082f, -0.11672262f, -0.037729338f, 0.16158514f, -0.0068003424f, 0.014823647f, 0.08900481f, 0.14990489f, -0.058382344f, -0.17457767f, -0.082800835f, -0.03530383f, -0.1012126f, 0.006604993f, 0.10019735f, 0.20004793f, 0.09949484f, 0.18094823f, 0.17876028f, 0.099312186f, -0.018793216f, 0.004487576f, 0.18969515f, 0.07698164f, 0.086196326f, 0.19933067f, 0.17724834f, 0.08689922f, 0.13698876f, 0.045691397f, 0.030318905f, 0.1219851f, 0.02178014f, -0.022280484f, -0.032191183f, 0.08375798f, 0.005378069f, 0.10807897f, 0.05646971f, 0.122079656f, 0.02645851f, -0.015544868f, -0.031957906f, 0.012394957f, -0.010687114f, -0.040908538f, -0.03465202f, -0.047057714f, -0.031994727f, -0.1019539f, -0.012742553f, 0.009850132f, -0.0807197f, 0.011372864f, 0.024012426f, 0.09432354f, -0.1961894f, -0.25709072f, -0.20545068f, -0.058951654f, -0.016724598f, 0.0154276f, -0.1007763f, -0.05564072f, -0.19843283f, -0.13571653f, -0.15974076f, -0.11326797f, -0.06048908f, -0.028469587f, -0.03170793f, -0.017017636f, -0.121271774f, -0.14244425f, 0.08351456f, 0.055096373f, -0.022986967f, 0.1335657f, -0.022625374f, -0.19985925f, 0.07124429f, 0.16640599f, 0.10171856f, 0.064563856f, -0.054494042f, 0.078276895f, 0.021204902f, -0.04296878f, 0.013833369f, 0.0048872693f, 0.13911974f, 0.15748584f, 0.04601351f, -0.005716179f, -0.026342137f, -0.04448621f, 0.062036958f, 0.030518483f, 0.030991657f, -0.068516545f, -0.11566391f, 0.06336577f, 0.20245655f, 0.093087174f, -0.051694065f, -0.026929494f, 0.017755263f, 0.15537675f, -0.1930853f, -0.09371078f, 0.2128324f, 0.12031663f, -0.2641774f, -0.11432036f, 0.1785514f, 0.19316123f, -0.24251091f, -0.14542596f, 0.06139401f, 0.10305373f, 0.105791226f, 0.0732975f, 0.11289201f, 0.09381807f, -0.05785463f, 0.14132342f, 0.05035157f, -0.057362985f, -0.16802597f, -0.14387585f, -0.018639222f, 0.012908333f, 0.0053718747f, 0.0025609687f, -0.082489915f, 0.10731447f, -0.0006327501f, 0.03900937f, 0.08218358f, 0.036718097f, -0.09947542f, -0.06509303f, 0.0642053f, 0.15107226f, 0.12708908f, -0.08540286f, -0.05755117f, -0.067808665f, -0.13543154f, -0.0022201787f, 0.03807167f, 0.04999632f, 0.119853824f, 0.21426989f, -0.01901934f, -0.13106638f, 0.07781974f, -0.00709998f, 0.09470701f, 0.06545106f, 0.032445975f, 0.06919232f, 0.055272907f, -0.0930274f, -0.11963285f, 0.091456175f, 0.113610856f, 0.0036678615f, -0.039528448f, 0.19586614f, 0.13158563f, -0.109608665f, -0.2872578f, 0.0025293857f, 0.055861734f, 0.079083554f, 0.095885225f, 0.091610916f, 0.05271941f, 0.016013397f, 0.14847018f, -0.09798567f, 0.14229436f, 0.04149839f, -0.060033206f, -0.018077737f, 0.18640688f, -0.02047196f, 0.0052860193f, -0.04423543f, 0.030235464f, 0.052497737f, 0.013864888f, 0.022129918f, -0.02719017f, 0.041539393f, -0.0641655f, 0.027153535f, 0.038606413f, 0.07550613f, 0.13970903f, 0.09553083f, 0.20324475f, 0.01161762f, -0.10554334f, 0.046115473f, -0.021396566f, 0.032602374f, 0.10171263f, 0.064789124f, 0.101963244f, -0.08545024f, -0.033230346f, -0.19586775f, -0.10239913f, 0.09361254f, 0.04512378f, 0.01608483f, -0.08449602f, -0.13168924f, 0.017113535f, -0.0257044f, 0.06841552f, 0.10042016f, 0.06038233f, 0.11321247f, 0.17901252f, 0.111764506f, 0.0035245852f, 0.045518246f, 0.2560068f, 0.14906572f, -0.04958679f, -0.020619605f, 0.15514287f, 0.18693438f, -0.06330276f, -0.057671867f, 0.070090964f, 0.060347795f, -0.057416115f, -0.02908419f, 0.16227248f, 0.1957131f, -0.051976565f, -0.0064477795f, -0.07856089f, 0.037273593f, -0.047109205f, -0.07421819f, 0.093888715f, 0.07443302f, -0.092464f, 0.104228586f, 0.013337657f, 0.05350486f, -0.15401375f, -0.21818614f, 0.010235711f, -0.002967962f, -0.051519386f, 0.037233766f, 0.08621174f, -0.004624668f, -0.15547247f, -0.21221009f, -0.041796815f, -0.07913876f, -0.096946016f, -0.120986484f, 0.040210363f, 0.13826264f, 0.14435057f, 0.12450176f, -0.04460861f, -0.065997735f, -0.055220943f, -0.08140261f, 0.036587223f, 0.025962505f, 0.0353666f, 0.08359321f, 0.017508537f, -0.066454716f, -0.076296516f, 0.007167842f, 0.03431381f, 0.041556533f, 0.1071737f, 0.042865086f, 0.07768187f, 0.092900485f, 0.001691905f, 0.009906135f, -0.02535228f, 0.06028782f, 0.086100094f, -0.05359377f, 0.123755306f, 0.1079415f, 0.0119723715f, -0.04719105f, -0.018781485f, -0.069111414f, -0.044500366f, -0.011548199f, 0.12904356f, 0.0128517905f, -0.059913512f, -0.024782315f, -0.027523855f, 0.1164601f, 0.06472083f, 0.054733608f, 0.18731318f, -0.03645821f, -0.103498414f, 0.009116867f, 0.07795586f, 0.0045978376f, -0.13901341f, -0.10246936f, -0.019126602f, -0.075520344f, -0.019117638f, 0.003062753f, 0.044389647f, 0.07154522f, 0.03246142f, -0.18344119f, -0.04487744f, 0.15690887f, -0.10708657f, 0.0803318f, 0.023546832f, 0.2366971f, 0.10768156f, 0.038388435f, 0.1265063f, 0.21219873f, 0.08619276f, -0.008073198f, 0.026582217f, 0.04253664f, 0.0794011f, 0.09338918f, 0.04634562f, 0.11760219f, 0.049802836f, 0.017330453f, -0.029024381f, 0.017715257f, -0.04132857f, -0.0068896106f, 0.039952956f, -0.052896317f, -0.0600534f, 0.015439924f, 0.116754204f, 0.039127115f, 0.017392948f, 0.037420135f, 0.060622778f, -0.059206378f, -0.12501784f, -0.03295147f, 0.016152129f, 0.06298877f, 0.023658622f, -0.020453876f, -0.010386091f, 0.008231785f, 0.115460865f, -0.043566994f, -0.02502619f, 0.098239206f, -0.0026971109f, 0.0386156f, 0.09966363f, -0.07045455f, 0.05462463f, 0.02055362f, 0.042755824f, 0.05132999f, -0.091659606f, 0.01865141f, -0.050993726f, -0.028688448f, 0.052514438f, 0.020407662f, -0.021926608f, 0.039568864f, 0.062203743f, 0.030950546f, -0.049916547f, -0.0021556101f, -0.0337873f, -0.0075330026f, 0.014406664f, 0.018227048f, -0.050239734f, 0.0517553f, 0.03896805f, -0.087240614f, -0.033896215f, -0.06895696f, -0.03672711f, -0.022039799f, -0.043472648f, 0.03064796f, -0.17278576f, -0.14251383f, 0.05229873f, 0.05678266f, 0.16636218f, 0.13720448f, 0.04874712f, 0.028636675f, 0.17366078f, 0.14706562f, 0.16921626f, 0.021698877f, 0.14836986f, 0.13477065f, 0.017953537f, -0.041769758f, 0.008869594f, 0.09552702f, 0.00897379f, -0.027149111f, 0.007933003f, 0.031526025f, 0.033955578f, -0.03007995f, 0.032256283f, 0.072106585f, 0.06055495f, 0.037729505f, 0.008036999f, 0.040030785f, -0.025011012f, -0.03908512f, 0.021214064f, -0.016711356f, -0.08732911f, 0.08534133f, 0.05703615f, -0.038301185f, -0.09010659f, -0.10405854f, -0.044496313f, -0.03812525f, -0.014704882f, -0.01394253f, 0.006323154f, -0.024004005f, -0.09666208f, -0.11703874f, -0.07996572f, -0.006532953f, -0.036753412f, -0.01485935f, -0.019163186f, 0.07958855f, 0.049646977f, -0.040991828f, -0.026504323f, -0.03971012f, -0.022266395f, 0.020917322f, -0.030507058f, 0.051098794f, 0.087975316f, -0.004573696f, 0.00028384724f, -0.08342866f, -0.039821908f, 0.029296499f, 0.030657653f, 0.050155204f, 0.06653403f, 0.0766751f, 0.15988033f, 0.12820837f, 0.096905f, 0.083268344f, -0.0012328343f, 0.025596049f, 0.07546197f, 0.19658725f, 0.117523044f, -0.018583179f, 0.10356689f, 0.09152235f, 0.10210092f, -0.05892949f, 0.1882292f, 0.058039732f, 0.113831736f, 0.07663026f, 0.13477945f, 0.023175603f, 0.09916256f, 0.04562437f, 0.09421675f, 0.024989441f, -0.02219714f, 0.061919715f, -0.06460029f, 0.03713991f, 0.003548702f, 0.062321503f, -0.07708234f, -0.08357442f, -0.14606617f, 0.03947405f, 0.009182329f, 0.0603315f, -0.024131559f, 0.011808549f, -0.04953207f, -0.033974506f, -0.20753911f, -0.008669173f, 0.18152589f, 0.054494724f, 0.085733846f, 0.059892382f, 0.16926038f, 0.0714221f, -0.024681676f, 0.106960885f, 0.21742016f, 0.0739109f, 0.15147418f, 0.15933557f, 0.19534428f, 0.006723697f, -0.04071243f, 0.012330165f, 0.13175708f, 0.0046791723f, -0.032969516f, 0.06802773f, -0.0075175157f, 0.017401168f, 0.07744272f, 0.017296826f, -0.10654936f, 0.00046132525f, 0.106782526f, 0.01988725f, 0.06426269f, 0.08152622f, 0.04858349f, -0.093759924f, -0.056394678f, -0.04665882f, 0.012447358f, 0.033750303f, 0.13968045f, 0.03909681f, 0.006430228f, 0.03616337f, 0.17686929f, -0.06956337f, 0.05790343f, 0.0719991f, 0.04241393f, 0.021608394f, 0.13234772f, -0.05814072f, 0.048471447f, -0.021699768f, -0.015609064f, 0.04060521f, -0.034143176f, 0.12128258f, -0.008784404f, 0.056029942f, 0.027523229f, -0.0073249177f, -0.0048427824f, 0.06211986f, 0.019338327f, 0.040481728f, -0.023434099f, 0.018193815f, 0.035341524f, 0.018807346f, 0.028378889f, 0.0025566458f, -0.088740975f, 0.123466775f, 0.05563352f, 0.08750205f, -0.062445868f, -0.12482855f, -0.12712722f, 0.0142101785f, -0.16854814f, -0.057048094f, -0.07485089f, -0.09939097f, 0.019263618f, 0.033851195f, 0.21392514f, 0.1734737f, 0.08466916f, -0.023764132f, -0.011897499f, 0.09125773f, 0.03420096f, 0.029901493f, 0.12495228f, 0.097810075f, 0.07987723f, 0.047625773f, -0.023022292f, -0.030415963f, -0.08624107f, 0.01342167f, 0.046333417f, 0.028347874f, 0.005377537f, 0.017445562f, 0.03688252f, -0.046187546f, -0.042004537f, 0.021821817f, 0.1335695f, 0.07397518f, 0.13008203f, 0.005420541f, -0.004228451f, -0.123568915f, 0.03833208f, 0.04486697f, 0.0777625f, -0.0597668f, -0.06118806f, -0.018451734f, -0.07262743f, -0.019422444f, -0.14968967f, 0.0014937695f, -0.05321927f, -0.014553513f, -0.08386144f, -0.016706876f, -0.05731121f, 0.059421536f, -0.13063516f, 0.0059905713f, 0.12163421f, 0.10860918f, -0.035621103f, -0.06413221f, -0.058819998f, -0.05425182f, -0.078246616f, 0.022303684f, 0.024522774f, 0.09856933f, 0.07343792f, -0.00056894065f, 0.019994598f, -0.01587241f, -0.036722474f, 0.14185639f, 0.040035404f, 0.018956965f, -0.044018183f, 0.117396094f, 0.12270895f, 0.013541771f, 0.04640096f, 0.1908027f, 0.111566454f, 0.0050634337f, 0.099440016f, 0.17708944f, 0.15903498f, -0.04088884f, 0.0058730133f, 0.112058565f, -0.022740176f, 0.128913f, 0.14586751f, 0.052076805f, 0.1276023f, 0.14741345f, 0.17738533f, 0.041598484f, 0.087468006f, 0.034213178f, 0.09086285f, 0.16630839f, 0.20946814f, 0.08505538f, 0.036960594f, -0.0077452394f, -0.04387793f, 0.13818341f, 0.1532803f, 0.06424151f, 0.01633049f, 0.0092992475f, 0.006288534f, 0.21167554f, 0.029100299f, 0.09256789f, -0.0272003f, 0.05854061f, -0.0020289202f, -0.059090104f, -0.052401435f, 0.0698137f, 0.0019331184f, -0.04619024f, 0.015438948f, -0.008031044f, -0.05449779f, 0.064985186f, 0.06814861f, -0.4883159f, 0.11190843f, 0.35275504f, -0.01246237f, -0.0991822f, 0.14512612f, -0.11574473f, 0.19552739f, 0.050519403f, 0.031631682f, 0.04348882f, -0.03283883f, -0.033657975f, -0.03483932f, -0.06647367f, -0.00057536084f, -0.00017591097f, -0.021100368f, 0.013651682f, 0.10807616f, 0.1487357f, -0.058455367f, -0.05948007f, -0.019508073f, -0.009849972f, -0.023649717f, 0.014191805f, -0.030585302f, -0.072708376f, -0.10099694f, 0.022918666f, -0.041844282f, -0.06677126f, -0.017266607f, 0.10296538f, -0.01923798f, 0.031022213f, -0.0435643f, -0.04029286f, -0.030617794f, -0.034336273f, -0.044106755f, -0.04533561f, -0.08312042f, -0.09023964f, -0.06899649f, -0.13886553f, -0.08521725f, -0.00045511842f, -0.0030079172f, -0.15988043f, -0.025114397f, 0.038624495f, 0.07242635f, -0.050179407f, -0.077131875f, 0.023704153f, 0.061787765f, -0.062612675f, -0.022318773f, -0.062220063f, 0.069280915f, -0.026755316f, -0.01970782f, 0.0069546686f, -0.058793962f, -0.0053703855f, 0.03504889f, 0.009425111f, -0.0047911876f, -0.00019822671f, -0.022792825f, 0.008797784f, 0.05915233f, 0.25362802f, 0.1610647f, -0.09509294f, 0.1752324f, -0.2965924f, -0.10193742f, -0.03193669f, 0.25160673f, 0.07015004f, 0.09605587f, 0.001305548f, 0.048445616f, -0.09628514f, -0.016543647f, -0.20095637f, -0.019313581f, -0.15238018f, -0.03378316f, -0.044490997f, -0.024790239f, -0.2663351f, 0.24143867f, -0.066229545f, 0.0025093216f, 0.08041707f, -0.031342693f, 0.14990602f, 0.020656293f, -0.122419916f, 0.01940166f, 0.05407084f, 0.119966686f, -0.15653689f, -0.029187057f, 0.19615635f, 0.09496499f, 0.059475034f, 0.08246158f, -0.11328278f, 0.04819704f, -0.039043646f, 0.00414217f, 0.19800763f, 0.12843831f, 0.16182697f, 0.1031871f, -0.10519697f, -0.04256356f, -0.014693418f, -0.09509145f, 0.13510458f, 0.05539274f, 0.02853293f, -0.04274431f, -0.028947242f, -0.060907703f, -0.06891887f, -0.060701903f, 0.061019313f, 0.13577262f, -0.023749322f, -0.03950827f, 0.049594395f, -0.03791203f, 0.02084718f, 0.012836158f, -0.044446446f, -0.068080865f, -0.023714157f, 0.030993318f, -0.06199398f, -0.026933083f, 0.08091596f, 0.06965446f, -0.054553043f, 0.06203809f, -0.097139955f, -0.019333746f, -0.12138838f, -0.15705755f, -0.12252576f, -0.00946052f, -0.10742165f, 0.033924155f, 0.006930282f, 0.11991086f, -0.16589238f, -0.21472387f, 0.06512861f, 0.039844103f, 0.07502889f, 0.1950682f, 0.0308572f, 0.12296039f, -0.048141494f, -0.10003636f, 0.19100042f, 0.14535661f, 0.18854272f, 0.025374943f, -0.01260464f, 0.14029308f, -0.053091027f, -0.044608496f, -0.067347586f, -0.00943593f, 0.21140392f, -0.04012607f, 0.09011538f, 0.13436627f, -0.09430812f, -0.21589781f, -0.07300436f, -0.31546423f, -0.1965825f, -0.021255791f, 0.012686875f, -0.010346223f, -0.17993416f, -0.1817835f, -0.1989429f, -0.08392897f, -0.016218873f, -0.02277838f, -0.032404978f, 0.072269276f, 0.0261724f, 0.07412342f, 0.14344954f, 0.04094055f, 0.058910422f, 0.06783625f, 0.06672203f, -0.06629135f, -0.053563073f, 0.06150863f, 0.07699311f, 0.06401923f, -0.06525875f, 0.03191701f, 0.14188741f, 0.031278886f, -0.053365484f, 0.063140556f, 0.004477316f, -0.15405278f, -0.10573795f, 0.036967777f, 0.028442666f, 0.014984342f, 0.04060561f, -0.025819005f, 0.033036787f, -0.089731485f, -0.07400519f, 0.090770155f, -0.006502014f, 0.025878921f, 0.060662545f, -0.026052026f, -0.15845914f, -0.2163863f, -0.16520777f, 0.0193583f, 0.07031356f, 0.017356602f, 0.119105496f, -0.024320686f, -0.048792724f, -0.18650913f, -0.22632061f, -0.08427127f, 0.021383587f, 0.0045971717f, 0.007678151f, 0.032537993f, 0.16152225f, -0.051109426f, -0.10639661f, 0.06745355f, -0.0073794834f, 0.0545321f, -0.10548153f, -0.07247234f, 0.036713157f, 0.04597727f, 0.091884844f, 0.10705431f, -0.011102022f, 0.025466548f, 0.059811458f, 0.040386364f, 0.039057672f, 0.01221855f, 0.028642127f, 0.039053667f, 0.031235926f, -0.016799351f, 0.0438824f, 0.046835f, 0.07346855f, -0.04215641f, -0.062307395f, -0.058410294f, 0.03743524f, -0.15840594f, -0.06490159f, -0.020639354f, -0.024557695f, -0.0971407f, -0.05235748f, -0.15789364f, -0.038279127f, -0.00054980075f, -0.04178446f, -0.024089126f, -0.060291015f, -0.2393286f, -0.12210756f, -0.17431936f, -0.048987377f, 0.023035357f, 0.019288484f, -0.11185857f, -0.0841198f, -0.14615844f, -0.15724361f, -0.10883488f, -0.12016612f, -0.10190303f, -0.06695987f, -0.081130825f, -0.019064192f, -0.1801977f, -0.17311278f, 0.08213128f, 0.07870374f, -0.048253234f, -0.0029740874f, -0.041161608f, -0.075237386f, -0.061056785f, 0.015351095f, 0.068299875f, -0.0057199355f, -0.11693466f, 0.07132898f, -0.13921875f, -0.078656904f, 0.083211616f, 0.11137438f, 0.107011385f, -0.024848504f, 0.014412931f, 0.018716244f, 0.13346168f, 0.11476318f, 0.02368335f, 0.0019170532f, -0.034984205f, 0.02567118f, 0.0135983005f, 0.012139471f, 0.015096774f, 0.007996345f, -0.048400395f, -0.10658987f, 0.005034661f, 0.0006326376f, 0.06000582f, -0.015732717f, -0.001906857f, -0.039386142f, 0.081308745f, 0.012982914f, 0.096044235f, -0.035696514f, 0.012049971f, -0.009912935f, 0.054407608f, 0.1234224f, 0.09790735f, 0.016214672f, 0.025677333f, 0.01638568f, -0.032668166f, -0.0038888033f, 0.074535385f, 0.12479005f, 0.050630637f, 0.1478203f, 0.019441798f, 0.105467744f, -0.09675161f, -0.07924611f, -0.039174415f, -0.097362876f, -0.07328175f, -0.042289622f, -0.062065907f, 0.019683292f, -0.0012485927f, -0.033387057f, 0.044519566f, 0.036272295f, -0.021127988f, -0.022450812f, -0.012564523f, 0.020723047f, -0.014587466f, 0.044857502f, 0.04778271f, -0.02477864f, 0.045624413f, 0.098261714f, 0.055812556f, 0.09677433f, -0.040644266f, 0.009202474f, 0.10990545f, 0.15045422f, 0.021990307f, 0.049200535f, 0.03430528f, 0.057059772f, 0.039990302f, -0.07033622f, -0.01726054f, -0.04055723f, 0.028084612f, 0.006825708f, 0.048638836f, 0.074721284f, 0.05786684f, -0.033424832f, 0.04309908f, -0.028370326f, -0.07771977f, -0.1328344f, 0.047225356f, 0.00040249678f, -0.00613096f, 0.036652125f, 0.095839486f, 0.1287181f, 0.05672053f, 0.07119529f, 0.095715255f, 0.0074672378f, -0.009562648f, 0.013390625f, -0.019318108f, -0.09125757f, -0.12500879f, -0.118408255f, -0.13975698f, -0.023203395f, -0.0841675f, -0.003672998f, 0.0017821648f, -0.043163512f, 0.015542015f, -0.05154402f, -0.06264468f, 0.012079987f, -0.04707328f, 0.013616146f, 0.07305553f, 0.1331096f, 0.059179105f, -0.17065784f, -0.0413285f, 0.024778407f, 0.023344923f, -0.018099241f, -0.021882512f, 0.023317153f, 0.06898074f, 0.059863146f, 0.038327668f, 0.059647735f, -0.0019556214f, 0.0001798208f, 0.0070122737f, 0.042556852f, -0.07006905f, -0.0047006067f, 0.039903384f, -0.05312599f, -0.018189834f, 0.0821555f, -0.008869185f, 0.068873405f, 0.05611782f, 0.05186568f, 0.022992894f, -0.19754267f, 0.012137308f, 0.06107063f, -0.022207942f, 0.04788224f, 0.20403315f, 0.07649154f, 0.00073636725f, -0.14004739f, 0.0058046896f, -0.011423111f, 0.016754618f, 0.02425622f, 0.17998067f, 0.038220126f, -0.028671937f, -0.08062307f, 0.008793249f, 0.0044994727f, -0.053950783f, 0.10438749f, 0.17823485f, 0.2006777f, -0.08251627f, 0.055889435f, -0.025650693f, 0.098851845f, -0.014468747f, 0.06414861f, 0.07404498f, 0.1802627f, -0.15368222f, -0.0040827617f, 0.02439294f, 0.08737865f, -0.053661745f, 0.036444858f, -0.030032258f, 0.018891132f, -0.0265492f, 0.01587715f, 0.020603672f, -0.04183502f, -0.23097537f, -0.051335685f, -0.0049544442f, -0.026016962f, -0.084207654f, -0.1114535f, -0.0039693527f, -0.017274855f, 0.09041611f, 0.110797584f, 0.08539322f, 0.029505055f, 0.13067108f, 0.13019693f, -0.055269975f, -0.01282291f, 0.08087828f, 0.0734652f, -0.070197456f, -0.19224419f, 0.038918305f, 0.15909055f, 0.019530093f, -0.016398467f, -0.05186055f, -0.041939832f, -0.031144723f, -0.13937303f, 0.020192686f, 0.033009548f, -0.039280597f, 0.011491813f, -0.061113678f, -0.002915049f, 0.04147029f, 0.016028306f, 0.0067237597f, -0.030510511f, -0.033984885f, -0.0052321437f, 7.765913e-05f, -0.014353831f, -0.07267798f, -0.08995215f, -0.050988227f, 0.04572319f, 0.03559729f, -0.0029284079f, 0.06733034f, 0.09373665f, -0.0435639f, -0.049968116f, -0.05636094f, -0.09786733f, -0.05741832f, -0.040984426f, -0.058706053f, 0.07259951f, 0.08634358f, 0.022171771f, 0.030572195f, 0.0020847863f, 0.0665291f, -0.01615507f, -0.01622238f, 0.021181483f, -0.016186789f, -0.01024553f, -0.02309458f, 0.03071425f, 0.009203635f, 0.01420559f, -0.023045037f, 0.014817888f, -0.0011407265f, 0.006055962f, 0.03061069f, 0.012419934f, -0.125207f, 0.009299867f, 0.08757879f, 0.0908129f, 0.09867117f, 0.0046473984f, 0.010768903f, -0.014941733f, -0.051817663f, -0.0084541105f, -0.02746761f, 0.08443972f, 0.06892489f, -0.033831596f, -0.05973643f, 0.0038414642f, 0.13541216f, 0.010462652f, -0.06198878f, 0.05493318f, 0.0089223f, 0.014350066f, 0.10143134f, -0.058473542f, 0.108121924f, 0.021910142f, -0.10797213f, 0.09950044f, 0.08467138f, 0.14167829f, -0.05114173f, 0.058833085f, 0.00013862467f, 0.019312432f, -0.094216645f, 0.034128875f, 0.01517779f, 0.02377179f, -0.087070286f, 0.041773412f, 0.017224958f, -0.04084911f, -0.047041316f, -0.12244347f, -0.09886237f, -0.0043468303f, 0.09091781f, 0.094664015f, -0.055028714f, 0.012043275f, -0.11280894f, -0.056188297f, -0.056170046f, -0.048933532f, 0.06222399f, -0.08878855f, 0.020327283f, 0.064902544f, 0.008734022f, -0.033367537f, -0.045540743f, -0.023337675f, 0.026066557f, -0.022663364f, 0.042946957f, -0.09977567f, 0.0349665f, 0.045921843f, 0.10578851f, -0.021433879f, 0.063611954f, 0.06675371f, -0.004926869f, -0.000504805f, 0.017462848f, 0.011201433f, -0.00437072f, 0.032783817f, 0.079479255f, 0.041149277f, 0.14563861f, 0.030104622f, -0.006880318f, 0.042959955f, -0.1685825f, -0.04285097f, 0.053189855f, 0.099170215f, 0.038558166f, 0.04425717f, 0.0365623f, 0.008735897f, -0.17059991f, -0.095258184f, 0.03207736f, 0.07113972f, 0.18207903f, 0.030247457f, 0.054056738f, -0.000278945f, -0.036971815f, 0.0040265797f, 0.06847445f, 0.06493761f, 0.078844875f, 0.093205206f, 0.098030366f, 0.03305592f, -0.17000838f, 0.071626835f, 0.11850001f, 0.094613776f, 0.038992297f, -0.24865447f, -0.11146353f, -0.06301622f, -0.08463566f, -0.015798608f, 0.09608622f, 0.14458372f, -0.010891625f, -0.019944621f, -0.09090808f, -0.039590444f, 0.0016260576f, -0.12352732f, 0.16773042f, 0.22729091f, 0.026843563f, -0.014942501f, -0.04515513f, 0.008846857f, -0.27683306f, -0.13028346f, -0.029777728f, -0.019781623f, -0.06919016f, -0.048484206f, -0.09451185f, -0.1240008f, -0.039063796f, 0.12187393f, 0.008755842f, -0.08169089f, 0.040857587f, 0.043657858f, 0.05245741f, -0.018190935f, -0.17910735f, -0.19920367f, -0.059425015f, 0.0346662f, -0.014178625f, 0.0036399765f, -0.027640427f, 0.0112474775f, -0.0064008376f, -0.23849484f, -0.006411989f, -0.019943962f, -0.08797946f, -0.19847108f, 0.046352647f, 0.06583064f, -0.06882971f, -0.11868652f, 0.07300004f, 0.009505197f, 0.03492393f, -0.05672601f, 0.03711309f, -0.061682936f, 0.16538358f, 0.21221636f, 0.04466042f, -0.12467786f, -0.0155693265f, 0.12654215f, -0.06085535f, -0.068670645f, 0.029914103f, 0.048633184f, 0.16029403f, 0.15105832f, 0.101169124f, 0.10999767f, 0.06715625f, -0.057569116f, 0.095047034f, 0.049418695f, 0.039810766f, -0.04252783f, 0.110281795f, 0.21988152f, 0.029728413f, 0.20984998f, 0.013213562f, -0.014296036f, -0.18381196f, -0.077468716f, 0.07783833f, 0.080087066f, -0.046508726f, 0.0015895959f, 0.2123917f, -0.20963946f, -0.08438482f, -0.044629443f, -0.061569877f, -0.035129808f, 0.04453897f, 0.16149566f, -0.0016525079f, -0.14114588f, -0.109991774f, -0.18348476f, -0.08218122f, -0.080713585f, -0.008774922f, 0.019630462f, -0.039817337f, 0.10780768f, -0.032083716f, -0.18699354f, -0.10481855f, -0.08733493f, -0.07385538f, 0.10650678f, 0.11779488f, 0.074645504f, -0.06191929f, -0.0034673386f, -0.0736897f, 0.1951282f, -0.01427342f, -0.083860174f, 0.23474988f, 0.23909372f, -0.034729425f, -0.02246073f, 0.03860982f, 0.30510044f, -0.0451783f, 0.015730772f, -0.0070498656f, -0.051455528f, 0.0027380637f, 0.074715525f, 0.004629492f, -0.027268989f, 0.06755795f, 0.110390596f, -0.0127305575f, -0.03891394f, 0.016248222f, 0.12899436f, -0.055157732f, -0.066159524f, -0.05578417f, -0.009587954f, 0.07148054f, -0.10958818f, 0.017892268f, 0.23543225f, -0.00819883f, -0.07170951f, 0.08971936f, -0.090915985f, -0.30206627f, -0.23822908f, 0.043127805f, 0.053628054f, -0.082996435f, 0.028790964f, 0.038402524f, 0.06259254f, -0.11329015f, -0.17687128f, -0.026314361f, -0.052154575f, -0.08068005f, 0.08102154f, -0.0047605657f, -0.0870947f, -0.18242647f, -0.17457332f, -0.015165837f, 0.016098194f, -0.1223199f, 0.071802326f, 0.040160175f, -0.0067062327f, -0.25007772f, -0.22929102f, -0.04018517f, -0.031075506f, -0.17136385f, 0.0408694f, -0.0046653193f, 0.05954658f, -0.20394847f, -0.036421947f, 0.2441775f, 0.091009595f, -0.03764106f, -0.048363965f, -0.09590888f, -0.04158027f, -0.0033674075f, 0.03228996f, 0.048344012f, -0.07089304f, -0.02584751f, -0.076941624f, -0.01863627f, -0.11074129f, -0.19351998f, 0.027409004f, 0.055864904f, 0.112633534f, 0.0010953582f, 0.027139641f, 0.003894566f, -0.106623486f, -0.0023000357f, -0.2587469f, -0.0011237286f, 0.14894834f, 0.11430179f, -0.06350763f, -0.033537272f, 0.22436671f, -0.076819435f, 0.05569105f, -0.031736776f, 0.14823121f, -0.04399368f, -0.009605335f, 0.16104311f, 0.25858986f, 0.098369166f, 0.06647298f, 0.15358235f, 0.26302752f, 0.04754204f, 0.04579265f, 0.30817202f, 0.34090286f, -0.01291611f, 0.07067917f, 0.024394274f, 0.17799874f, 0.12818785f, 0.06023815f, 0.076590374f, 0.40040028f, 0.26514283f, 0.07877044f, 0.21986675f, 0.045564007f, 0.11574234f, 0.048044518f, -0.11642634f, 0.31845713f, 0.13979977f, 0.090844154f, 0.0572285f, 0.10722762f, 0.09166269f, -0.007289765f, 0.033712655f, 0.022978632f, 0.03957071f, -0.011283235f, -0.061123393f, -0.052758235f, -0.12148272f, -0.04827291f, 0.07599936f, 0.06376174f, 0.060903262f, 0.03778679f, -0.023595873f, 0.013212485f, -0.029435867f, 0.15285733f, 0.030488955f, 0.013542281f, 0.014803641f, 0.012594265f, -0.051994234f, -0.13559134f, -0.07090022f, 0.060531892f, -0.15423831f, -0.032296833f, -0.09173148f, 0.114511386f, -0.022795247f, -0.03113913f, -0.027685348f, -0.009954938f, -0.11623013f, -0.14989623f, -0.23457485f, -0.1308126f, -0.13151641f, 0.096682146f, -0.015807357f, -0.07688168f, -0.17094415f, 0.01659154f, -0.17495334f, -0.20486973f, -0.013034498f, -0.052381933f, -0.07751406f, 0.031943955f, -0.11807916f, -0.022947729f, -0.039308593f, 0.0056682182f, 0.13209836f, -0.08472272f, 0.018419435f, 0.3314445f, 0.068337284f, 0.08382636f, 0.20505653f, 0.10030373f, -0.085704505f, -0.16030964f, 0.050090197f, 0.16235124f, 0.0016364339f, 0.084495194f, 0.1105114f, -0.02583204f, -0.01402812f, -0.012134381f, 0.08339093f, 0.02380319f, 0.02734763f, 0.046900496f, 0.03311809f, -0.01847647f, 0.053526416f, 0.07661231f, 0.06238054f, -0.023171091f, -0.01402001f, 0.020486422f, 0.03680956f, 0.034567136f, 0.0801819f, -0.039527874f, -0.011839315f, -0.018974157f, -0.01584978f, 0.008428858f, 0.06863799f, 0.0495753f, 0.14283352f, 0.009457239f, -0.0055417255f, -0.05476943f, 0.012930211f, 0.060748775f, 0.14668947f, 0.08455284f, 0.07965569f, -0.013507148f, -0.06678024f, -0.016849086f, 0.036812264f, 0.04804494f, 0.0671084f, 0.07400907f, 0.04701861f, -0.0459619f, -0.12764509f, -0.0292567f, -0.00050110446f, 0.06988213f, 0.020510543f, -0.017847203f, 0.0030984785f, 0.0011751557f, -0.07515315f, -0.058218867f, 0.03401259f, 0.093636f, 0.050589424f, -0.0008723407f, -0.0013666943f, 0.0039515183f, -0.04995473f, -0.032712594f, 0.024757594f, 0.07038619f, 0.040744077f, -0.0038033002f, 0.0413454f, 0.02942404f, -0.028814623f, -0.0044478104f, -0.08912033f, -0.086793184f, 0.009717443f, 0.031962957f, 0.015241984f, 0.036668207f, 0.085896686f, -0.03920323f, -0.13868026f, 0.016689932f, -0.11554884f, -0.105470754f, -0.026402786f, -0.041492f, 0.0008909095f, 0.012418027f, -0.11670766f, 0.032562535f, 0.22591646f, 0.15507796f, -0.048130687f, -0.18919516f, -0.06457476f, -0.052520834f, -0.1507866f, -0.056576565f, 0.07456123f, 0.10555187f, -0.018902892f, -0.1298565f, -0.03261697f, 0.0005985742f, 0.12127478f, 0.14417677f, 0.25106478f, 0.22711259f, 0.034862664f, 0.0772549f, -0.0046664774f, 0.036797773f, -0.050628174f, -0.017054379f, 0.2042261f, 0.04263073f, -0.10472779f, -0.07988779f, -0.08169998f, -0.004250336f, -0.021015689f, -0.04522867f, 0.11124067f, -0.029414302f, -0.18171902f, -0.10567091f, -0.059198044f, 0.08872141f, 0.01791702f, 0.01791563f, -0.06913299f, -0.019957524f, -0.011079936f, 0.010270166f, -0.0017896536f, -0.14170195f, -0.036096368f, -0.11633934f, -0.0017672251f, -0.090562165f, -0.19290884f, -0.08838083f, -0.08461962f, 0.195404f, -0.092732295f, -0.023758471f, -0.18445066f, 0.063249044f, -0.059678774f, -0.18210083f, -0.15881711f, -0.08854822f, -0.026804533f, 0.10882593f, 0.32853678f, 0.13150454f, -0.19789161f, -0.20731695f, -0.2071383f, 0.16645697f, -0.12027264f, -0.2241509f, 0.070971526f, 0.083804116f, -0.06370736f, -0.3429903f, -0.06690985f, -0.2848419f, -0.17156006f, 0.013132097f, 0.09996974f, 0.06622849f, -0.12828772f, -0.09707085f, -0.24804029f, -0.07736736f, -0.113988765f, -0.00071284815f, -0.050397094f, -0.057970516f, -0.36580044f, -0.15286598f, -0.035576064f, -0.1529871f, -0.18257351f, -0.318133f, 0.21401054f, 0.15854366f, -0.029290076f, -0.16053198f, -0.3023239f, 0.12502202f, 0.46442807f, 0.06889542f, -0.024605172f, 0.20297629f, -0.1734727f, 0.17070508f, -0.0026516162f, -0.029796576f, -0.013815877f, -0.07073918f, -0.0032841528f, -0.015017731f, -0.06584083f, 0.027851608f, -0.046087503f, 0.01118181f, -0.049723428f, -0.09899852f, -0.12666549f, 0.04442747f, 0.08277405f, 0.064933665f, 0.013583745f, 0.011429384f, 0.019505361f, -0.16118936f, 0.04853626f, 0.22295551f, 0.10811214f, -0.021715747f, 0.030597506f, 0.010204067f, 0.038177177f, -0.12778187f, -0.06376877f, -0.034278598f, -0.0028181118f, -0.06430101f, -0.040789127f, -0.007742366f, -0.006747522f, 0.12622406f, 0.14383659f, 0.18628816f, 0.24874772f, 0.0861307f, 0.036773093f, -0.0028511474f, -0.014193685f, 0.09870459f, -0.049215697f, -0.033172984f, 0.07814427f, 0.08327809f, 0.12670405f, -0.021183355f, 0.011130895f, 0.032690752f, -0.04985824f, 0.11560251f, 0.058020316f, 0.08208989f, 0.051047668f, -0.015173316f, 0.07460615f, 0.022945996f, -0.022729045f, -0.059187148f, -0.061507896f, 0.0632022f, 0.031663295f, 0.05313408f, -0.05259778f, -0.13956249f, -0.15101595f, -0.112889506f, -0.117325574f, -0.08566432f, 0.17362973f, 0.027624544f, -0.05631725f, -0.019402009f, 0.23189008f, 0.179068f, -0.2193622f, -0.11091096f, -0.046587758f, 0.12701158f, 0.010943498f, 0.091162756f, 0.07394103f, 0.13377443f, -0.1789116f, 0.05495267f, 0.05778294f, -0.0010629913f, -0.019740416f, 0.073347144f, 0.16716117f, 0.14532992f, -0.057334896f, -0.05261416f, -0.0582381f, -0.04543397f, 0.0184466f, -0.01239351f, 0.14924607f, 0.12040209f, 0.069312975f, -0.19055086f, -0.013207053f, -0.0335854f, -0.09220128f, -0.15100364f, 0.0784795f, 0.20242181f, 0.08064791f, 0.036927875f, 0.0856322f, 0.012867804f, -0.11026874f, -0.20732102f, -0.10646377f, -0.17097892f, -0.16877255f, -0.10648668f, 0.0062691155f, 0.0052651763f, -0.19734995f, -0.052773163f, -0.08548077f, -0.17587224f, -0.17762525f, -0.0917671f, -0.1172276f, -0.039698515f, -0.056560032f, -0.09962151f, 0.0010281903f, 0.043762084f, 0.06843901f, -0.079828255f, 0.008171915f, -0.10889551f, -0.034575578f, -0.1231073f, -0.002639877f, -0.010637886f, 0.04873882f, -0.044897396f, 0.024087388f, 0.050516043f, 0.04529842f, 0.05826583f, 0.019000586f, 0.09345682f, 0.04843331f, -0.010640961f, 0.055603493f, -0.024531782f, -0.00054252526f, -0.09877691f, 0.17477271f, 0.2767399f, 0.18828206f, 0.036703724f, 0.028581096f, -0.017292364f, 0.08300037f, 0.06361656f, 0.19382484f, 0.15328571f, 0.15508308f, 0.10669369f, 0.034088057f, 0.020481406f, 0.036399562f, 0.004467861f, 0.10322786f, 0.13794214f, -0.054967348f, -0.04120344f, -0.0037199236f, -0.14257161f, 0.018623982f, 0.19159552f, -0.0971829f, -0.14717132f, -0.07697471f, -0.04427655f, 0.07017896f, -0.0852186f, -0.039292637f, 0.07593747f, -0.02007186f, -0.0034015512f, -0.13152602f, -0.12112475f, -0.01800713f, 0.015576548f, -0.009685593f, 0.035146058f, -0.073223755f, -0.057749968f, -0.06476847f, 0.029377215f, 0.084197074f, -0.08585883f, -0.17043771f, -0.10977774f, 0.061046764f, -0.0007638146f, -0.0143149765f, -0.13264644f, 0.1877701f, 0.05703981f, -0.21558584f, -0.09245688f, 0.25208366f, 0.08959671f, -0.1569864f, -0.20743796f, 0.2500483f, 0.17486575f, -0.0821971f, -0.11183404f, -0.106735714f, -0.080198325f, -0.10248198f, -0.09155007f, 0.05564615f, -0.14886807f, -0.044760954f, 0.063916296f, 0.14827435f, 0.15064597f, 0.0016802336f, -0.015980838f, 0.021155465f, 0.00072270446f, 0.08360458f, -0.10764339f, -0.0127641205f, -0.045183f, -0.07370967f, -0.02410421f, 0.1086091f, 0.101161465f, -0.07112856f, -0.15521507f, -0.11177759f, 0.065649465f, 0.087611f, 0.06975563f, 0.09672735f, 0.02485329f, -0.04961308f, -0.06923381f, -0.13155213f, -0.22725675f, 0.037623864f, 0.14493605f, -0.064760365f, -0.026972115f, -0.07716995f, -0.08900805f, -0.050651886f, -0.0686792f, -0.054673288f, 0.07260559f, 0.100337915f, -0.08095953f, -0.12057423f, -0.008527154f, 0.026017401f, -0.17853627f, -0.12643193f, 0.079814665f, 0.29524654f, 0.025861235f, -0.097665764f, -0.045308936f, -0.08832373f, -0.07978085f, -0.08866318f, 0.016807139f, -0.17282128f, 0.062932536f, -0.12345744f, -0.01169199f, 0.053871978f, 0.053121384f, -0.21056262f, -0.009054241f, 0.020319602f, 0.020749787f, -0.034381725f, -0.07181472f, -0.024956964f, -0.0068062237f, 0.037951935f, -0.047785494f, 0.06203289f, -0.004928818f, -0.039139215f, -0.05456176f, -0.13374121f, -0.08469703f, -0.17614596f, -0.0221586f, 0.11266579f, -0.016900355f, 0.018872097f, -0.023721099f, -0.11686383f, -0.076946825f, -0.109284975f, 0.07262139f, 0.06422608f, 0.17390041f, 0.08795668f, -0.09676382f, -0.044270832f, -0.028043892f, 0.065686814f, 0.13739634f, -0.018280372f, 0.032290276f, -0.0615395f, -0.12008637f, -0.059810095f, -0.12317447f, -0.16417947f, -0.09458078f, -0.0049863346f, -0.023496145f, -0.2730394f, -0.18500142f, 0.03511366f, 0.023617676f, -0.15394281f, -0.18212609f, 0.0410482f, 0.033731017f, -0.081785835f, -0.05849436f, 0.05170208f, 0.043494757f, -0.1596417f, -0.19529177f, 0.025519365f, 0.038401157f, 0.09682171f, -0.009594897f, 0.040547743f, 0.067673355f, -0.10043f, -0.044564176f, 0.07986076f, -0.101163365f, -0.018866144f, -0.066509046f, 0.17557278f, 0.22514363f, -0.012532569f, 0.012879823f, 0.048724726f, -0.04674961f, -0.11464469f, -0.014962877f, 0.15865138f, 0.21776019f, 0.07304872f, 0.08257967f, 0.08953923f, 0.09941965f, -0.072794296f, -0.12932315f, -0.15396021f, -0.14554301f, 0.0232089f, 0.08082501f, 0.04685622f, 0.053673483f, -0.023409145f, -0.05657803f, -0.022201909f, -0.085155815f, -0.0076641827f, 0.06370942f, 0.09299839f, -0.0040740026f, -0.042455282f, -0.044531643f, -0.104041286f, -0.046224527f, -0.10444458f, -0.094918825f, 0.0006732091f, -0.012179854f, 0.029989459f, -0.044266168f, -0.0823951f, 0.08548014f, -0.12143475f, -0.100400075f, -0.03249861f, 0.03640103f, -0.018854968f, 0.0636667f, 0.03578604f, -0.0011981879f, -0.12682685f, 0.011691189f, 0.041366488f, 0.0127019165f, -0.003335881f, -0.11491581f, -0.08803359f, -0.03193572f, -0.17731017f, 0.05866287f, 0.09149286f, -0.003502632f, -0.08358087f, 0.007885753f, 0.12655395f, 0.100019455f, 0.033448797f, 0.06457548f, 0.0597179f, -0.009941561f, -0.057023995f, -0.06500816f, -0.025432969f, 0.16017385f, 0.05528336f, -0.15603857f, 0.10256161f, -0.064844504f, -0.0036333608f, -0.2683314f, -0.10036161f, -0.066740915f, -0.102281705f, -0.19535188f, -0.12400582f, 0.0029542875f, -0.026163477f, -0.04637805f, -0.07800509f, -0.06438905f, -0.05070221f, -0.14900738f, -0.04662561f, 0.0039929748f, 0.02350023f, -0.0046429965f, 0.06750272f, 0.040413223f, -0.04186824f, 0.050805364f, 0.09116594f, -0.0065055867f, -0.12586747f, -0.05345991f, -0.010864332f, -0.032073654f, -0.062468793f, 0.0664601f, 0.14236599f, 0.0105910795f, -0.018777454f, -0.049739935f, -0.011724208f, 0.022318808f, 0.048464485f, 0.02117847f, -0.12523718f, 0.027202528f, 0.010558859f, -0.058879633f, -0.014845836f, -0.026086008f, -0.08621295f, 0.066756696f, -0.05643736f, -0.015170294f, -0.0085256575f, -0.054846942f, 0.12284939f, -0.01912787f, 0.048925884f, 0.03022497f, -0.053887933f, 0.020461604f, 0.016301122f, -0.03928407f, -0.074084535f, -0.038809158f, 0.072970524f, 0.022074558f, -0.0060919384f, 0.013687344f, -0.026331933f, -0.031101849f, 0.04370746f, -0.07027615f, -0.035098847f, 0.086960986f, 0.062349036f, 0.08773151f, 0.01187417f, 0.015347086f, 0.04238883f, -0.040629126f, 0.17260303f, 0.1278899f, -0.07507154f, -0.058312044f, -0.16902858f, -0.13931063f, -0.042826917f, -0.055395905f, -0.16458319f, -0.12340005f, -0.1321454f, -0.029955694f, -0.16394962f, -0.09957704f, -0.0049644625f, 0.037717476f, -0.005745674f, -0.10504499f, -0.00869998f, 0.038940776f, 0.010958755f, -0.027801748f, -0.03776967f, 0.031833384f, 0.007409294f, -0.041645993f, -0.05939142f, 0.0019906606f, 0.0045328005f, -0.07516677f, -0.00117225f, 0.017093567f, 0.014677263f, -0.0094976155f, 0.08827552f, -0.0991956f, -0.05519206f, 0.0072803493f, 0.05522612f, 0.11121764f, 0.062156003f, 0.06192336f, -0.0036697949f, 0.03147694f, -0.015552818f, 0.048105184f, 0.09048361f, 0.11759247f, 0.082859404f, 0.0044676834f, 0.028461711f, 0.036047984f, 0.028180186f, -0.0716329f, -0.04349822f, 0.02463195f, 0.036665715f, 0.04038763f, 0.007657632f, 0.002600728f, 0.031136908f, -0.061992094f, -0.101572536f, 0.008428734f, -0.0011469887f, 0.10994781f, 0.057498056f, -0.062866114f, -0.04889847f, -0.04072269f, -0.04966748f, -0.06799831f, -0.15608743f, -0.1301307f, -0.06447376f, -0.05208873f, 0.01290383f, 0.00235841f, -0.062106688f, -0.2001098f, -0.084809884f, 0.011373478f, -0.13419874f, -0.081668764f, -0.09130741f, 0.05268645f, -0.16325668f, -0.06859858f, -0.10920395f, -0.10531903f, -0.16555831f, -0.0074159866f, -0.08988478f, -0.0480786f, -0.0897766f, -0.028613672f, 0.030249873f, -0.07404358f, 0.08097016f, -0.007903873f, -0.007892325f, -0.050153617f, 0.066369236f, 0.08030412f, 0.14206202f, -0.009386062f, -0.027195057f, -0.05917086f, -0.011391227f, -0.01971714f, 0.022394177f, 0.044108376f, 0.24215405f, -0.028055433f, -0.16986454f, -0.062392354f, -0.086037315f, -0.07357604f, -0.19757245f, -0.07275703f, 0.01894001f, -0.09858384f, -0.21072364f, -0.083589695f, -0.1543117f, -0.13881437f, -0.19693072f, -0.03242598f, 0.031482775f, -0.032536197f, -0.10974849f, -0.016095882f, 0.046904393f, -0.06985693f, -0.0020842727f, -0.054167304f, -0.07687384f, 0.0022694827f, 0.108684056f, -0.0055046757f, -0.10447492f, -0.048282232f, -0.055390857f, -0.0735757f, -0.03766867f, 0.060475744f, 0.04496464f, 0.028252143f, -0.027659263f, -0.048239063f, -0.14796796f, -0.027465088f, -0.0027248026f, -0.0033457698f, -0.16558374f, 0.07234511f, -0.053922426f, -0.031843416f, -0.051955074f, -0.026952533f, -0.12325884f, 0.06470309f, -0.049780175f, 0.017790524f, 0.01947148f, -0.021020114f, 0.00042031918f, -0.114149466f, 0.008482905f, -0.05909225f, -0.007184533f, 0.03799878f, -0.027704833f, -0.046903983f, -0.046903454f, -0.060612295f, -0.0047354754f, -0.0020046385f, 0.0030922154f, -0.006379396f, -0.005895328f, 0.02163061f, 0.09680834f, -0.10844542f, -0.06748671f, -0.06685789f, 0.024897883f, 0.119461596f, 0.14150189f, -0.01010773f, 0.14465272f, 0.073723525f, 0.074236386f, 0.09371917f, -0.0069673723f, -0.022298709f, -0.20274873f, -0.16594577f, -0.08575933f, 0.038530655f, 0.013028429f, -0.07292181f, -0.027982352f, -0.027851775f, -0.12443182f, -0.08505646f, -0.07879867f, -0.032036796f, -0.0040171975f, 0.023959093f, 0.05305667f, -0.041887857f, -0.024073785f, -0.046424277f, 0.0044604847f, -0.0011938155f, -0.007773924f, 0.044721298f, 0.018388838f, -0.022250282f, -0.13078208f, -0.090498835f, -0.15552019f, 0.0017521149f, -0.0069082873f, 0.10247568f, -0.060577966f, -0.023906358f, -0.08265662f, 0.07327443f, 0.054408655f, 0.0420711f, 0.110643744f, 0.02020482f, 0.13454033f, -0.012298436f, 0.051998653f, 0.020381548f, 0.059544865f, 0.025815353f, 0.068760335f, -0.037110507f, 0.1335637f, -0.017837264f, -0.09262527f, -0.078382835f, 0.026869684f, 0.068528585f, 0.064181134f, 0.07905571f, 0.09464829f, -0.024762185f, 0.00029906502f, -0.10243478f, -0.08186001f, 0.024969215f, 0.010288431f, 0.053560205f, 0.033408985f, -0.13677263f, -0.013808471f, -0.027286328f, 0.038112998f, -0.11454933f, -0.15252937f, -0.04425374f, -0.07534369f, -0.17758736f, -0.121658586f, -0.03266724f, -0.12463156f, -0.17547521f, -0.16581951f, 0.070508674f, 0.009420003f, -0.116412245f, -0.0021310453f, -0.15257303f, -0.14819822f, -0.029226098f, -0.10006548f, -0.14629056f, -0.16444336f, -0.054795712f, -0.106691204f, -0.03922966f, -0.097135104f, -0.16601299f, -0.2107095f, -0.08173112f, -0.034410506f, 0.03244135f, 0.06763122f, -0.16789383f, -0.16046071f, -0.0863808f, -0.0062667867f, -0.039849274f, -0.0113894185f, -0.17556405f, -0.026196998f, -0.12062433f, 0.04444046f, -0.05258389f, 0.00046167354f, 0.083472595f, 0.067231715f, -0.070275664f, -0.0055368934f, 0.05930805f, -0.015059841f, 0.016054466f, 0.0494685f, -0.07985713f, -0.07353378f, 0.5052158f, -0.12872608f, -0.34505334f, 0.016052209f, 0.09943399f, -0.14442924f, 0.14960423f, -0.20502895f, -0.053991728f, -0.0347787f, -0.07529579f, 0.027987706f, 0.030092143f, 0.051253047f, 0.0434121f, -0.003480752f, -0.011777005f, 0.024029823f, -0.009737376f, -0.12690543f, -0.1417342f, 0.046757326f, 0.042184368f, 0.025781998f, 0.014836002f, 0.006625698f, -0.032829646f, 0.012685078f, 0.10391992f, 0.12469877f, -0.022447359f, 0.048693277f, 0.066269875f, 0.03392596f, -0.08697837f, 0.004297411f, -0.046873115f, 0.039525565f, 0.059743647f, 0.02842643f, 0.03141991f, 0.025416555f, 0.04007832f, 0.09066728f, 0.0762737f, 0.077163614f, 0.14824398f, 0.06785431f, -0.0106855715f, 0.004336781f, 0.15590744f, 0.007633609f, -0.008952198f, -0.076748304f, 0.02573159f, 0.08758171f, -0.05018577f, -0.039832704f, 0.0697628f, 0.015690006f, 0.06386314f, -0.06948037f, 0.030153379f, 0.017483614f, 0.014960039f, 0.07715467f, 0.007627833f, -0.02858118f, -0.020568643f, -0.0241967f, 0.01100828f, 0.032591574f, -0.008996437f, -0.03878669f, -0.25761285f, -0.12779197f, 0.069663614f, -0.18297715f, 0.28636596f, 0.088788554f, 0.013599413f, -0.25866517f, -0.06151328f, -0.09322669f, 0.003217963f, -0.041999288f, 0.1257737f, 0.013822042f, 0.21126932f, -5.3172513e-05f, 0.15141505f, 0.007688427f, 0.01548229f, 0.024239054f, 0.24653119f, -0.260469f, 0.089597695f, -0.014741253f, -0.0994982f, 0.043221276f, -0.18223907f, -0.015754096f, 0.119517416f, -0.007978434f, -0.049945533f, -0.09102977f, 0.1978091f, 0.0255948f, -0.20464906f, -0.078036845f, -0.079498634f, -0.074565284f, 0.14750695f, -0.067365594f, 0.052817088f, 0.028079938f, -0.17356472f, -0.13307479f, -0.19342934f, -0.07921872f, 0.09242123f, 0.05303994f, 0.00029618005f, 0.09992896f, -0.11816717f, -0.038614575f, 0.003180649f, 0.032378476f, 0.04125292f, 0.054138623f, 0.07970283f, 0.045881238f, -0.053546913f, -0.13982359f, 0.054256868f, 0.061092675f, -0.0283147f, 0.039800227f, -0.017003551f, -0.011838168f, 0.04045177f, 0.057020728f, -0.0078656245f, -0.03162934f, 0.06917716f, 0.04636895f, -0.068384014f, -0.086470954f, 0.055487625f, -0.063000254f, 0.07268896f, 0.002295925f, 0.11791275f, 0.16724138f, 0.12893997f, -0.01053227f, 0.13369668f, -0.00851173f, 0.019007139f, -0.111560084f, 0.16729006f, 0.24321811f, -0.064611964f, -0.08070831f, -0.056372702f, -0.1644259f, -0.067288f, -0.1411606f, 0.045853365f, 0.08944062f, -0.1706177f, -0.13380562f, -0.18249808f, 0.007528731f, 0.025480833f, -0.11292234f, 0.04914221f, 0.037157066f, 0.041851472f, 0.039811358f, -0.20982663f, 0.054838594f, -0.067217305f, -0.14652742f, 0.08156989f, 0.193741f, 0.07859945f, 0.3072639f, 0.1614359f, 0.034705505f, -0.031391144f, -0.01155274f, 0.1819039f, 0.20480558f, 0.20513503f, 0.117362805f, 0.0072499397f, 0.03149959f, 0.026122604f, -0.07508517f, -0.020435931f, -0.06464052f, -0.1488413f, -0.040911313f, -0.07111112f, -0.07693811f, -0.029874934f, 0.028085079f, 0.028431328f, -0.09575315f, -0.06368492f, -0.08432856f, 0.045792315f, -0.044653904f, -0.17254795f, -0.02305846f, 0.028647812f, -0.042888943f, -0.0031541055f, 0.18836452f, 0.10497443f, -0.070722535f, -0.04743453f, 0.012619296f, -0.0418832f, 0.024982378f, -0.060682107f, 0.07478248f, 0.07352848f, -0.08320228f, 0.03867815f, -0.046606075f, -0.07284813f, 0.03150832f, 0.14514041f, 0.21515827f, 0.18138221f, -0.03432608f, -0.085284464f, -0.01601914f, -0.09715955f, -0.0012932073f, 0.053983487f, 0.19109355f, 0.19912502f, 0.09047158f, -0.036504515f, 0.022487232f, 0.011464319f, -0.020030042f, -0.13311812f, 0.047749285f, 0.10608385f, -0.03171731f, -0.011453377f, -0.06118296f, 0.093678795f, 0.075696394f, -0.05110617f, -0.06492864f, -0.11269265f, -0.097529195f, 0.021558896f, -0.009031746f, -0.03940998f, -0.025378034f, -0.034291215f, -0.038895894f, -0.0049481923f, -0.05193036f, -0.04797773f, 0.042004198f, -0.060799364f, -0.057472557f, -0.091729544f, 0.07201805f, 0.094265066f, 0.07869836f, -0.009506305f, 0.14926347f, 0.07853064f, 0.025343457f, 0.029232327f, 0.110139824f, 0.04389876f, 0.14579111f, 0.04677802f, 0.029579852f, 0.07984889f, 0.031833455f, 0.06991543f, 0.22478667f, 0.15422174f, 0.15219517f, 0.032379095f, -0.014158794f, -0.017075453f, 0.09696774f, 0.05351488f, 0.1441674f, 0.18826659f, 0.11574021f, 0.10195663f, 0.100033134f, 0.03864721f, 0.073137864f, 0.03735576f, 0.16918695f, 0.20664836f, -0.08263447f, -0.08605708f, 0.03049361f, 0.020889454f, 0.026945634f, 0.07554404f, 0.06596975f, -0.0038336318f, -0.06638075f, 0.016225105f, 0.12527299f, -0.074494846f, 0.11270018f, 0.07938756f, -0.075404204f, -0.10930245f, -0.11446504f, -0.0037739116f, -0.023403998f, -0.0033827827f, -0.13703588f, -0.08455505f, -0.026785666f, 0.013035731f, 0.007011803f, -0.013764793f, -0.003590293f, -0.033244304f, -0.016589236f, -0.0045326552f, 0.041981343f, 0.118802875f, -0.0018400596f, -0.011484702f, -0.0721386f, 0.041646633f, 0.0058795284f, 0.054233357f, -0.07515678f, -0.027708549f, -0.086233914f, 0.042518765f, -0.0131063275f, -0.0058194306f, -0.024591912f, -0.13704611f, -0.07235489f, -0.029040422f, -0.02461394f, -0.011995065f, 0.033381768f, 0.018412808f, -0.09305599f, -0.15700607f, -0.051958956f, -0.12817267f, -0.0012780519f, -0.116611876f, 0.108102106f, 0.07364666f, 0.008237242f, 0.07905202f, 0.0767885f, 0.02321535f, 0.037769333f, -0.032410894f, 0.0060301633f, 0.04014334f, -0.056774687f, -0.029430155f, 0.023733154f, 0.00910935f, 0.035273075f, 0.016557889f, 0.029974522f, -0.03542953f, -0.027683957f, 0.044201903f, -0.024135018f, -0.097631395f, -0.06385936f, -0.07619879f, 0.064313166f, 0.00019085886f, -0.11952623f, -0.15256599f, -0.03974963f, -0.02243472f, -0.054877765f, -0.09700268f, -0.037757166f, 0.100818396f, 0.01700559f, 0.030588351f, -0.05637198f, 0.015126007f, -0.059999265f, -0.08428466f, -0.06321369f, 0.040855497f, -0.024160774f, 0.008654242f, 0.08463844f, 0.13798888f, -0.029023632f, 0.005418109f, 0.018517286f, -0.008329777f, -0.07231638f, -0.13308887f, -0.053144816f, -0.05517919f, -0.09057421f, 0.008125579f, 0.01321241f, -0.00987408f, 0.017385036f, 0.09332121f, 0.119795665f, 0.11105387f, 0.13127537f, 0.02962771f, 0.0994457f, 0.018355796f, -0.0001576348f, 0.017003044f, -0.026074577f, 0.056779828f, 0.057507947f, 0.014807431f, 0.023086017f, 0.0155534195f, -0.06312877f, -0.12835483f, -0.04114507f, 0.17622723f, 0.036187623f, -0.022628553f, -0.05888685f, 0.0025490413f, 0.047320183f, -0.02907572f, -0.0947898f, -0.06393893f, -0.01783439f, -0.06606235f, -0.004567406f, -0.01813685f, 0.0009387118f, -0.04443178f, 0.07184961f, 0.012112307f, -0.04434747f, 0.050021414f, 0.00843812f, -0.055862665f, 0.030559035f, -0.10202881f, -0.049642332f, -0.03593258f, -0.03616875f, 0.17834352f, -0.018566467f, -0.055266522f, -0.013511319f, -0.037486408f, -0.1778019f, -0.06603914f, 0.033803385f, 0.101504065f, 0.032410387f, 0.006472713f, 0.0026732015f, -0.02820651f, -0.14530186f, -0.021308102f, 0.04981552f, 0.07191951f, -0.015043382f, -0.028085044f, 0.05873804f, -0.1153902f, -0.20111388f, -0.20825441f, 0.04448567f, -0.075454764f, -0.005310404f, -0.10188036f, 0.032070827f, -0.049346253f, -0.05723407f, -0.1766153f, 0.1547748f, 0.020992016f, -0.024430616f, -0.09141642f, 0.05587344f, -0.034971144f, 0.044796158f, -0.006786561f, 0.06013431f, 0.0038115366f, -0.03177222f, 0.053124893f, 0.22568752f, 0.034803998f, 0.0057502785f, 0.036998905f, 0.06811347f, 0.10029384f, -0.010766758f, 0.014555242f, -0.07605883f, -0.12812702f, -0.053693905f, -0.03948477f, -0.12090022f, -0.15029177f, 0.044848766f, 0.02718764f, -0.071202114f, -0.07225386f, 0.09721708f, 0.16285649f, -0.007745234f, -0.14739278f, 0.0035961708f, 0.04365482f, 0.06105372f, 0.013207247f, 0.047732443f, 0.13444124f, -0.00531109f, -0.017394057f, -0.00019426805f, -0.023396978f, 0.060188837f, 0.015232516f, -0.035411872f, -0.028625475f, -0.00021637665f, 0.017704446f, 0.061424114f, 0.016324792f, -0.028282566f, 0.006845625f, 0.040847298f, 0.09735285f, 0.04735578f, -0.031976424f, -0.019558107f, 0.008940148f, -0.06308573f, -0.07226661f, 0.02352633f, 0.052778635f, 0.0796281f, 0.10405478f, 0.046654765f, 0.020208133f, 0.0471121f, -0.06993255f, -0.09622773f, -0.038649198f, -0.031905312f, -0.023611957f, -0.07096901f, 0.01848016f, 0.03774629f, -0.007704482f, -0.005554341f, 0.037476767f, 0.020233031f, -0.028274838f, -0.033170942f, -0.021122131f, 0.040150754f, 0.0031406519f, -0.009134546f, -0.007804116f, -0.041026566f, -0.022693612f, 0.104412794f, 0.023608804f, -0.09618877f, -0.08954258f, -0.07439809f, -0.029473439f, -0.010993384f, 0.051571537f, 0.04927022f, -0.0010483362f, 0.019388104f, -0.06049783f, -0.054408893f, 0.031372f, 0.06169678f, 0.010911603f, -0.17521693f, -0.008801866f, 0.08547839f, -0.058568824f, -0.011314083f, -0.021104254f, -0.120368265f, 0.050727263f, -0.0818043f, -0.015951827f, 0.09170686f, -0.10057516f, -0.067671f, -0.10959518f, 0.014864802f, -0.043775283f, -0.010268844f, -0.015527501f, 0.06931709f, -0.035635f, 0.00076946995f, -0.035439897f, 0.05621038f, -0.025893385f, -0.013765809f, 0.023487875f, 0.04784045f, 0.10985791f, 0.06745163f, -0.012109575f, -0.078705385f, -0.10510459f, 0.054419674f, 0.026256714f, 0.103498705f, 0.026619107f, 0.0731548f, 0.03980022f, -0.052041043f, 0.053598598f, 0.006198247f, -0.06375741f, 0.012429946f, 0.019416928f, 0.032392915f, 0.0011466998f, -0.045447554f, -0.0038979184f, -0.04532231f, 0.07913936f, -0.045087233f, -0.035668112f, -0.09638039f, 0.0103571685f, -0.05867987f, -0.0885775f, -0.030400634f, -0.0041515813f, -0.042230673f, -0.0027563472f, -0.0073230295f, -0.055152785f, -0.06748403f, -0.04247606f, -0.117589846f, -0.043434706f, 0.025229303f, -0.030152684f, 0.13667367f, 0.050949957f, -0.07521469f, -0.07872961f, -0.037945222f, -0.070682615f, -0.043413788f, -0.011054506f, 0.16443545f, 0.09538635f, -0.044123847f, -0.06464467f, -0.16978317f, -0.048582677f, -0.029344123f, -0.024368381f, 0.0487283f, -0.011608428f, -0.08760616f, -0.06455213f, -0.080804035f, -0.05608352f, -0.10817105f, -0.029368423f, 0.1448901f, -0.09054556f, -0.13786922f, -0.11976675f, -0.047298186f, 0.25984785f, 0.11760635f, 0.08792241f, 0.08765828f, -0.009957504f, -0.07333271f, -0.1564908f, 0.027609348f, -0.009834778f, 0.09621328f, 0.061935294f, -0.014083955f, 0.09773827f, -0.17177866f, -0.20712247f, -0.04909537f, 0.008179399f, 0.039848283f, 0.009680817f, 0.28031304f, 0.14790332f, 0.021573653f, 0.018727625f, 0.07365534f, 0.041300774f, 0.0973789f, 0.117221266f, -0.0039572697f, -0.11638673f, -0.004419521f, 0.07378969f, -0.034843273f, -0.019814255f, -0.022395942f, 0.01462311f, 0.21182568f, 0.18660696f, 0.05497505f, -0.022846427f, -2.6282096e-06f, -0.00022325889f, 0.04932153f, -0.00038742524f, 0.005040009f, 0.20614831f, 0.008987345f, 0.023546088f, 0.06950014f, 0.19810705f, -0.058750615f, -0.1003134f, 0.060792238f, 0.09793109f, -0.09230356f, -0.022457475f, -0.0386332f, 0.035204664f, -0.039922442f, 0.06664219f, -0.15243438f, -0.20012863f, -0.020448746f, 0.12207672f, -0.00026153825f, -0.11532098f, 0.069028236f, 0.06351549f, -0.020246245f, -0.06570233f, -0.1640879f, -0.16423145f, -0.104345694f, -0.12495003f, -0.06837694f, 0.030808637f, -0.08566265f, -0.040194854f, -0.041774593f, 0.035544217f, -0.12587139f, -0.19287433f, -0.017693978f, -0.22619931f, -0.028200543f, 0.03433465f, 0.18368675f, 0.09086467f, -0.055791743f, -0.08827458f, 0.0422952f, -0.00053743785f, -0.2109533f, 0.23175484f, 0.07247351f, 0.013636802f, 0.07345711f, 0.021908771f, -0.048716206f, -0.17156592f, 0.0046683797f, 0.13469642f, 0.123956144f, 0.17394735f, 0.078095146f, 0.05103825f, -0.0017354815f, -0.0061365585f, 0.037819482f, -0.09378305f, 0.051696863f, 0.19226414f, 0.086875506f, 0.10158187f, 0.064238705f, -0.09023846f, -0.12695326f, -0.059331797f, 0.044186976f, 0.017170029f, 0.07887508f, -0.19240755f, 0.00089964067f, 0.09568227f, -0.20826998f, -0.26715967f, 0.019465622f, 0.0051420773f, -0.020554382f, -0.30630875f, 0.018232554f, 0.002586439f, 0.013442269f, 0.011612254f, 0.0125085795f, -0.07648628f, -0.020395216f, 0.01219274f, -0.053716987f, -0.13697098f, 0.0094436705f, 0.020314502f, -0.015157733f, -0.102530934f, 0.04740157f, 0.05627235f, 0.0712381f, 0.0015416603f, -0.051993817f, 0.12150047f, 0.006424115f, -0.19403511f, 0.0020167097f, 0.07627602f, -0.054230407f, 0.10382658f, 0.29557124f, 0.21682334f, -0.04243625f, -0.02287307f, 0.08588155f, -0.0036910374f, -0.04482324f, -0.06218038f, 0.13379197f, 0.18234935f, 0.0454417f, 0.060240246f, 0.06571736f, -0.07062732f, -0.009726577f, 0.08640963f, 0.16811459f, 0.19667768f, 0.031272735f, 0.016600095f, 0.12393245f, -0.042691205f, -0.034083743f, 0.0065908395f, 0.21000889f, 0.20247518f, 0.054585066f, 0.030703176f, 0.17047162f, -0.0493653f, 0.029651877f, -0.05910546f, 0.20694317f, 0.020215042f, -0.24960084f, -0.08420842f, 0.031615056f, 0.045870792f, 0.09011339f, 0.062415414f, -0.006036976f, -0.06389556f, -0.057741795f, 0.06956548f, 0.024150707f, 0.07213299f, 0.0073960912f, 0.11673325f, 0.19701926f, -0.007390487f, -0.04268524f, -0.08982042f, -0.0075777518f, -0.021023167f, 0.0033570805f, 0.10259968f, -0.019900857f, 0.23823188f, 0.010453246f, -0.1451463f, -0.13232473f, 0.054268885f, 0.0344982f, -0.25931355f, 0.09702556f, -0.06586813f, 0.027668497f, -0.14961472f, 0.027619205f, 0.009341865f, -0.14834091f, -0.24075054f, -0.12307515f, -0.07663397f, -0.12293119f, -0.24257548f, -0.05242312f, -0.07395503f, -0.2936296f, -0.35553804f, 0.011749129f, -0.07195644f, 0.0054253624f, -0.18424033f, -0.14082915f, -0.039971367f, -0.05484313f, -0.41248846f, -0.26016775f, -0.074909374f, -0.21676883f, -0.048620768f, -0.11447415f, -0.05359645f, 0.098131254f, -0.33735904f, -0.1398793f, -0.0889287f, -0.06196239f, -0.09449077f, -0.09486239f, 0.016757227f, -0.03243175f, 0.0028097823f, -0.009176617f, 0.018015211f, 0.057277676f, 0.0350274f, 0.09901595f, 0.027624158f, -0.11017093f, -0.05191846f, -0.08742638f, -0.058580734f, 0.0031526345f, -0.0011810233f, 0.006473571f, -0.15361091f, -0.038122576f, -0.04135878f, -0.044839274f, -0.00025732603f, 0.07362353f, 0.13139482f, 0.07066258f, -0.07869738f, 0.19034258f, 0.028144054f, 0.06615227f, -0.1435273f, 0.0072928458f, 0.03138266f, 0.0276735f, 0.0048929895f, 0.11087958f, 0.15087046f, 0.22768597f, 0.12392093f, 0.14384755f, -0.1253381f, 0.0062185144f, 0.06860646f, 0.15004763f, 0.010462499f, 0.18588734f, 0.18151468f, -0.011739039f, 0.034809995f, 0.10000482f, -0.022769874f, 0.09794731f, 0.013294994f, 0.047629002f, 0.019639453f, -0.11048103f, 0.12514634f, -0.019276015f, -0.33654583f, -0.031977754f, -0.07914747f, -0.21867391f, -0.09214379f, 0.07910363f, 0.12958306f, -0.03284005f, -0.14376345f, -0.028383464f, -0.07938012f, -0.08755519f, 0.03209018f, 0.014898552f, 0.019058231f, -0.08210395f, -0.033451498f, -0.048195537f, -0.02315243f, -0.042972934f, 0.043014906f, -0.05090838f, -0.036556013f, -0.048006095f, -0.00961035f, 0.00975493f, -0.029040886f, -0.014452127f, -0.053812746f, -0.05395299f, 0.02768211f, 0.013499533f, -0.005293213f, 0.043932695f, 0.009342231f, -0.032184955f, -0.06832565f, -0.12551615f, 0.011605071f, -0.0061989524f, 0.042272933f, -0.013560173f, -0.098382145f, -0.12646309f, -0.0776046f, -0.07085229f, -0.0033612088f, 0.05345447f, 0.00880778f, -0.05449768f, -0.047958925f, -0.044683643f, -0.048103247f, -0.030908942f, 0.06623111f, 0.091914855f, 0.017747361f, -0.0026993216f, -0.075757824f, -0.012112892f, 0.0131923305f, -0.015608439f, -0.0065935594f, 0.10557203f, 0.01614665f, -0.04164185f, -0.09585541f, -0.031741932f, -0.025562886f, -0.0050108824f, -0.008608132f, 0.031574525f, 0.020541845f, -0.049536098f, -0.06821356f, -0.05407947f, 0.0010441486f, -0.010248369f, -0.019793794f, 0.015951129f };
+static float fc0_bias[2] = { -0.0040076836f, 0.00010113005f };
+
+conv_param conv_params[3] = {
+    {1, 2, 3, 3, 16, conv0_weight, conv0_bias},
+    {0, 1, 3, 16, 32, conv1_weight, conv1_bias},
+    {1, 2, 3, 32, 32, conv2_weight, conv2_bias}
+};
+fc_param fc_params[1] = {
+    {2048, 2, fc0_weight, fc0_bias}
+};